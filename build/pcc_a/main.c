@@ -0,0 +1,128 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_f(rt_int* out, rt_int* pcc_p_n);
+
+static const uint32_t pcc_big_0_words[] = {0xa6424450u, 0x7ca6a2e1u, 0x3e665bebu, 0x00000616u};
+static rt_int pcc_big_0;
+static rt_str pcc_lit_1;
+static rt_str pcc_lit_2;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 4, 1);
+    pcc_lit_1 = rt_str_intern_static("abcd", 4);
+    pcc_lit_2 = rt_str_intern_static("yes", 3);
+}
+
+static void pcc_fn_f(rt_int* out, rt_int* pcc_p_n) {
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int total; rt_int_init(&total);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_licm_1; rt_int_init(&pcc_licm_1);
+    rt_int pcc_licm_2; rt_int_init(&pcc_licm_2);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&total, 0LL);
+    rt_int_set_si(&i, 0LL);
+    rt_int_shl(&pcc_licm_1, &n, 1);
+    rt_int_mul(&pcc_tmp_1, &n, &n);
+    rt_int_mod_pow2(&pcc_licm_2, &pcc_tmp_1, 3);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_2 = rt_int_cmp(&i, &pcc_licm_1);
+    if (!((pcc_tmp_2 < 0))) goto while_end_2;
+    rt_int_add(&pcc_tmp_1, &total, &pcc_licm_2);
+    rt_int_shr(&pcc_tmp_3, &i, 2);
+    rt_int_add(&total, &pcc_tmp_1, &pcc_tmp_3);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &total);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&total);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_licm_1);
+    rt_int_clear(&pcc_licm_2);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int big; rt_int_init(&big);
+    rt_str s; rt_str_init(&s);
+    int64_t x = 0;
+    int64_t pcc_cse_2 = 0;
+    int64_t y = 0;
+    int64_t z = 0;
+    rt_str pcc_licm_1; rt_str_init(&pcc_licm_1);
+    int64_t k = 0;
+    rt_str t; rt_str_init(&t);
+    int64_t n = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&big, &pcc_big_0);
+    rt_print_int(&big);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &big);
+    rt_int_set_si(&pcc_tmp_2, 7LL);
+    rt_int_floordiv(&pcc_tmp_2, &pcc_tmp_1, &pcc_tmp_2);
+    rt_print_int(&pcc_tmp_2);
+    rt_str_clear(&s);
+    s = pcc_lit_1;
+    rt_print_si((int64_t)rt_str_len(&s));
+    x = 10LL;
+    pcc_cse_2 = (x * 3LL);
+    y = (pcc_cse_2 + 5LL);
+    z = (pcc_cse_2 - 5LL);
+    rt_print_si(y);
+    rt_print_si(z);
+    rt_int_set_si(&pcc_tmp_2, 10LL);
+    pcc_fn_f(&pcc_tmp_1, &pcc_tmp_2);
+    rt_print_int(&pcc_tmp_1);
+    rt_str pcc_tmp_3 = rt_str_null(); rt_scope_str(&pcc_tmp_3);
+    rt_strbuf_reserve(&pcc_tmp_3, 20 + 1);
+    rt_strbuf_append_si(&pcc_tmp_3, x);
+    rt_strbuf_append_bytes(&pcc_tmp_3, "!", 1);
+    rt_str_clear(&pcc_licm_1);
+    pcc_licm_1 = pcc_tmp_3; rt_str_init(&pcc_tmp_3);
+    int64_t pcc_ctr_4 = 0LL;
+    int64_t pcc_ctr_4_stop = 5LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    k = pcc_ctr_4;
+    rt_str_clear(&t);
+    t = rt_str_share(pcc_licm_1);
+    rt_print_str(t);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    n = -13LL;
+    rt_print_si((n & 15LL));
+    rt_print_si((n >> 2LL));
+    rt_print_si((n * 8LL));
+    rt_print_str(pcc_lit_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&big);
+    rt_str_clear(&s);
+    rt_str_clear(&pcc_licm_1);
+    rt_str_clear(&t);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "runtime.h"
+
+void pcc_fn_f(long long* pcc_ret, long long* pcc_n);
+
+static rt_str pcc_lit_0;
+static rt_str pcc_lit_1;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("abcd", 4);
+    pcc_lit_1 = rt_str_intern_static("yes", 3);
+}
+
+void pcc_fn_f(long long* pcc_ret, long long* pcc_n) {
+    long long n = *pcc_n;
+    long long total = 0LL;
+    long long i = 0LL;
+    long long pcc_tmp_1;
+    pcc_tmp_1 = n * (1LL << 1LL);
+    long long pcc_licm_1 = pcc_tmp_1;
+    long long pcc_tmp_2;
+    pcc_tmp_2 = n * n;
+    long long pcc_tmp_3;
+    pcc_tmp_3 = pcc_tmp_2 & 7LL;
+    long long pcc_licm_2 = pcc_tmp_3;
+while_start_1:
+    int pcc_tmp_4 = (i < pcc_licm_1);
+    if (!((pcc_tmp_4 != 0))) goto while_end_2;
+    long long pcc_tmp_5;
+    pcc_tmp_5 = total + pcc_licm_2;
+    long long pcc_tmp_6;
+    pcc_tmp_6 = i >> 2LL;
+    long long pcc_tmp_7;
+    pcc_tmp_7 = pcc_tmp_5 + pcc_tmp_6;
+    total = pcc_tmp_7;
+    long long pcc_tmp_8;
+    pcc_tmp_8 = i + 1LL;
+    i = pcc_tmp_8;
+    goto while_start_1;
+while_end_2:
+    *pcc_ret = total;
+    return;
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_str s = pcc_lit_0;
+    long long pcc_tmp_9 = rt_str_len(&s);
+    printf("%lld\n", pcc_tmp_9);
+    long long x = 10LL;
+    long long pcc_tmp_10;
+    pcc_tmp_10 = x * 3LL;
+    long long pcc_cse_2 = pcc_tmp_10;
+    long long pcc_tmp_11;
+    pcc_tmp_11 = pcc_cse_2 + 5LL;
+    long long y = pcc_tmp_11;
+    long long pcc_tmp_12;
+    pcc_tmp_12 = pcc_cse_2 - 5LL;
+    long long z = pcc_tmp_12;
+    printf("%lld\n", y);
+    printf("%lld\n", z);
+    long long pcc_tmp_13 = 10LL;
+    long long pcc_tmp_14;
+    pcc_fn_f(&pcc_tmp_14, &pcc_tmp_13);
+    printf("%lld\n", pcc_tmp_14);
+    rt_str pcc_tmp_15 = rt_str_null();
+    rt_strbuf_reserve(&pcc_tmp_15, 20 + 1);
+    rt_strbuf_append_si(&pcc_tmp_15, x);
+    rt_strbuf_append_bytes(&pcc_tmp_15, "!", 1);
+    rt_str pcc_licm_1 = pcc_tmp_15;
+    long long k = 0LL;
+for_start_3:
+    if (1LL > 0) {
+        if (k >= 5LL) goto for_end_4;
+    } else {
+        if (k <= 5LL) goto for_end_4;
+    }
+    rt_str t = rt_str_share(pcc_licm_1);
+    rt_print_str(t);
+for_continue_5:
+    k += 1LL;
+    goto for_start_3;
+for_end_4:
+    long long n = -13LL;
+    long long pcc_tmp_16;
+    pcc_tmp_16 = n & 15LL;
+    printf("%lld\n", pcc_tmp_16);
+    long long pcc_tmp_17;
+    pcc_tmp_17 = n >> 2LL;
+    printf("%lld\n", pcc_tmp_17);
+    long long pcc_tmp_18;
+    pcc_tmp_18 = n * (1LL << 3LL);
+    printf("%lld\n", pcc_tmp_18);
+    rt_print_str(pcc_lit_1);
+    return 0;
+}
\ No newline at end of file
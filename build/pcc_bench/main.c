@@ -0,0 +1,72 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_work(rt_int* out, rt_int* pcc_p_n, rt_int* pcc_p_m);
+
+static void pcc_fn_work(rt_int* out, rt_int* pcc_p_n, rt_int* pcc_p_m) {
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int m; rt_int_init(&m);
+    rt_int_copy(&m, pcc_p_m);
+    rt_int total; rt_int_init(&total);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_cse_3; rt_int_init(&pcc_cse_3);
+    rt_int pcc_licm_1; rt_int_init(&pcc_licm_1);
+    rt_int pcc_licm_2; rt_int_init(&pcc_licm_2);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&total, 0LL);
+    rt_int_set_si(&i, 0LL);
+    rt_int_mul(&pcc_cse_3, &n, &n);
+    rt_int_copy(&pcc_licm_1, &pcc_cse_3);
+    rt_int_set_si(&pcc_tmp_1, 3LL);
+    rt_int_floordiv(&pcc_licm_2, &pcc_cse_3, &pcc_tmp_1);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_2 = rt_int_cmp(&i, &m);
+    if (!((pcc_tmp_2 < 0))) goto while_end_2;
+    rt_int_mod_pow2(&pcc_tmp_1, &i, 3);
+    rt_int_mul(&pcc_tmp_1, &pcc_tmp_1, &pcc_licm_1);
+    rt_int_add(&pcc_tmp_1, &total, &pcc_tmp_1);
+    rt_int_shr(&pcc_tmp_3, &i, 4);
+    rt_int_add(&pcc_tmp_3, &pcc_tmp_1, &pcc_tmp_3);
+    rt_int_add(&total, &pcc_tmp_3, &pcc_licm_2);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &total);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&total);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_cse_3);
+    rt_int_clear(&pcc_licm_1);
+    rt_int_clear(&pcc_licm_2);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&n);
+    rt_int_clear(&m);
+}
+
+int main(void) {
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&pcc_tmp_1, 1000LL);
+    rt_int_set_si(&pcc_tmp_2, 3000000LL);
+    pcc_fn_work(&pcc_tmp_3, &pcc_tmp_1, &pcc_tmp_2);
+    rt_print_int(&pcc_tmp_3);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
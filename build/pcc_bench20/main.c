@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "runtime.h"
+
+long long pcc_fn_fib(long long n);
+long long pcc_fn_gcd(long long a, long long b);
+long long pcc_fn_sq(long long x);
+
+long long pcc_fn_fib(long long n) {
+    int pcc_tmp_1 = (n < 2LL);
+    if ((pcc_tmp_1 != 0)) {
+    return n;
+    }
+    long long pcc_tmp_2;
+    pcc_tmp_2 = n - 1LL;
+    long long pcc_tmp_3 = pcc_fn_fib(pcc_tmp_2);
+    long long pcc_tmp_4;
+    pcc_tmp_4 = n - 2LL;
+    long long pcc_tmp_5 = pcc_fn_fib(pcc_tmp_4);
+    long long pcc_tmp_6;
+    pcc_tmp_6 = pcc_tmp_3 + pcc_tmp_5;
+    return pcc_tmp_6;
+    return 0;
+}
+
+long long pcc_fn_gcd(long long a, long long b) {
+while_start_1:
+    if (!(1LL)) goto while_end_2;
+    int pcc_tmp_7 = (b == 0LL);
+    if ((pcc_tmp_7 != 0)) {
+    return a;
+    }
+    long long pcc_tail_1 = b;
+    long long pcc_tmp_8;
+    pcc_tmp_8 = a % b;
+    if ((a < 0) != (b < 0) && pcc_tmp_8 != 0) {
+        pcc_tmp_8 += b;
+    }
+    b = pcc_tmp_8;
+    a = pcc_tail_1;
+    goto while_start_1;
+    goto while_start_1;
+while_end_2:
+    return 0;
+}
+
+long long pcc_fn_sq(long long x) {
+    long long pcc_tmp_9;
+    pcc_tmp_9 = x * x;
+    return pcc_tmp_9;
+    return 0;
+}
+
+int main(void) {
+    long long total = 0LL;
+    long long i = 1LL;
+for_start_3:
+    if (1LL > 0) {
+        if (i >= 300000LL) goto for_end_4;
+    } else {
+        if (i <= 300000LL) goto for_end_4;
+    }
+    long long pcc_tmp_10 = pcc_fn_gcd(i, 360360LL);
+    long long pcc_tmp_11;
+    pcc_tmp_11 = total + pcc_tmp_10;
+    long long pcc_tmp_12;
+    pcc_tmp_12 = i % 100LL;
+    if ((i < 0) != (100LL < 0) && pcc_tmp_12 != 0) {
+        pcc_tmp_12 += 100LL;
+    }
+    long long pcc_tmp_13 = pcc_fn_sq(pcc_tmp_12);
+    long long pcc_tmp_14;
+    pcc_tmp_14 = pcc_tmp_11 + pcc_tmp_13;
+    total = pcc_tmp_14;
+for_continue_5:
+    i += 1LL;
+    goto for_start_3;
+for_end_4:
+    printf("%lld\n", total);
+    long long pcc_tmp_15 = pcc_fn_fib(30LL);
+    printf("%lld\n", pcc_tmp_15);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int p; rt_int_init(&p);
+    int64_t i = 0;
+    rt_int q; rt_int_init(&q);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&p, 1LL);
+    int64_t pcc_ctr_4 = 1LL;
+    int64_t pcc_ctr_4_stop = 20001LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_mul_si(&p, &p, i);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_int_mul(&q, &p, &p);
+    rt_int_set_si(&pcc_tmp_1, 1000000007LL);
+    rt_int_mod(&pcc_tmp_1, &q, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&p);
+    rt_int_clear(&q);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int x; rt_int_init(&x);
+    int64_t i = 0;
+    int64_t t = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&x, 1LL);
+    int64_t pcc_ctr_4 = 1LL;
+    int64_t pcc_ctr_4_stop = 3000LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_mul_si(&pcc_tmp_1, &x, i);
+    rt_int_add_si(&x, &pcc_tmp_1, i);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    t = 0LL;
+    int64_t pcc_ctr_9 = 0LL;
+    int64_t pcc_ctr_9_stop = 200000LL;
+    rt_scope_t pcc_scope_10 = rt_scope_mark();
+    for_start_6:
+    if (!(pcc_ctr_9 < pcc_ctr_9_stop)) goto for_end_7;
+    i = pcc_ctr_9;
+    t = rt_math_mod_si((t + (i * i)), 1000000007LL);
+    for_continue_8:
+    rt_scope_reset(pcc_scope_10);
+    pcc_ctr_9 += 1LL;
+    goto for_start_6;
+    for_end_7:
+    rt_scope_reset(pcc_scope_10);
+    rt_int_set_si(&pcc_tmp_1, 1000000007LL);
+    rt_int_mod(&pcc_tmp_1, &x, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_print_si(t);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
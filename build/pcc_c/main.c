@@ -0,0 +1,144 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_g(rt_int* out, rt_int* pcc_p_a);
+
+static const uint32_t pcc_big_0_words[] = {0xdea00000u, 0x35c9adc5u, 0x00000036u};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000001u};
+static rt_int pcc_big_1;
+static const uint32_t pcc_big_2_words[] = {0x00000000u, 0x00000000u, 0x00000001u};
+static rt_int pcc_big_2;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 5, 1);
+    rt_int_init(&pcc_big_2); rt_int_from_words(&pcc_big_2, pcc_big_2_words, 3, 1);
+}
+
+static void pcc_fn_g(rt_int* out, rt_int* pcc_p_a) {
+    rt_int a; rt_int_init(&a);
+    rt_int_copy(&a, pcc_p_a);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&pcc_tmp_1, 8LL);
+    rt_int_floordiv(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 8LL);
+    rt_int_mod(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_mul_si(&pcc_tmp_1, &a, 4LL);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 1LL);
+    rt_int_mod(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 1LL);
+    rt_int_floordiv(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_mul_si(&pcc_tmp_1, &a, 4LL);
+    rt_int_mul_si(&pcc_tmp_2, &a, 3LL);
+    rt_int_set_si(&pcc_tmp_3, 16LL);
+    rt_int_mod(&pcc_tmp_3, &a, &pcc_tmp_3);
+    rt_int_mul(&pcc_tmp_3, &pcc_tmp_2, &pcc_tmp_3);
+    rt_int_add(&pcc_tmp_3, &pcc_tmp_1, &pcc_tmp_3);
+    rt_print_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 4294967296LL);
+    rt_int_mod(&pcc_tmp_3, &a, &pcc_tmp_3);
+    rt_int_copy(out, &pcc_tmp_3);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&a);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int vals; rt_int_init(&vals);
+    rt_int v; rt_int_init(&v);
+    rt_int x; rt_int_init(&x);
+    rt_int w; rt_int_init(&w);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&vals, 0LL);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub_si(&pcc_tmp_1, &pcc_tmp_1, 20LL);
+    rt_int_copy(&v, &pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 20LL);
+    rt_int_set_si(&pcc_tmp_2, 3LL);
+    int pcc_tmp_3 = rt_int_cmp(&pcc_tmp_2, &(rt_int){0});
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    for_start_1:
+    if (pcc_tmp_3 > 0) {
+        if (rt_int_cmp(&v, &pcc_tmp_1) >= 0) goto for_end_2;
+    } else {
+        if (rt_int_cmp(&v, &pcc_tmp_1) <= 0) goto for_end_2;
+    }
+    rt_int_set_si(&pcc_tmp_4, 2LL);
+    rt_int_floordiv(&pcc_tmp_4, &v, &pcc_tmp_4);
+    rt_print_int(&pcc_tmp_4);
+    rt_int_set_si(&pcc_tmp_4, 4LL);
+    rt_int_mod(&pcc_tmp_4, &v, &pcc_tmp_4);
+    rt_print_int(&pcc_tmp_4);
+    rt_int_mul_si(&pcc_tmp_4, &v, 16LL);
+    rt_print_int(&pcc_tmp_4);
+    pcc_fn_g(&pcc_tmp_4, &v);
+    rt_print_int(&pcc_tmp_4);
+    rt_int_mul(&pcc_tmp_4, &v, &pcc_big_0);
+    pcc_fn_g(&pcc_tmp_5, &pcc_tmp_4);
+    rt_print_int(&pcc_tmp_5);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_add(&v, &v, &pcc_tmp_2);
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_copy(&x, &pcc_big_1);
+    rt_int_mod(&pcc_tmp_2, &x, &pcc_big_2);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_sub(&pcc_tmp_2, &pcc_tmp_2, &x);
+    rt_int_mod(&pcc_tmp_2, &pcc_tmp_2, &pcc_big_2);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_sub(&pcc_tmp_2, &pcc_tmp_2, &x);
+    rt_int_floordiv(&pcc_tmp_2, &pcc_tmp_2, &pcc_big_2);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_mul_si(&pcc_tmp_2, &x, 1024LL);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_set_si(&w, 0LL);
+    rt_scope_t pcc_scope_7 = rt_scope_mark();
+    while_start_5:
+    rt_scope_reset(pcc_scope_7);
+    rt_int_set_si(&pcc_tmp_2, 3LL);
+    int pcc_tmp_6 = rt_int_cmp(&w, &pcc_tmp_2);
+    if (!((pcc_tmp_6 < 0))) goto while_end_6;
+    rt_int_set_si(&pcc_tmp_2, 1024LL);
+    rt_int_floordiv(&pcc_tmp_2, &x, &pcc_tmp_2);
+    rt_int_add(&pcc_tmp_2, &pcc_tmp_2, &w);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_add_si(&w, &w, 1LL);
+    goto while_start_5;
+    while_end_6:
+    rt_scope_reset(pcc_scope_7);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&vals);
+    rt_int_clear(&v);
+    rt_int_clear(&x);
+    rt_int_clear(&w);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_4);
+    rt_int_clear(&pcc_tmp_5);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x00000000u, 0x00000000u, 0x00000080u};
+static rt_int pcc_big_0;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_print_int(&pcc_big_0);
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
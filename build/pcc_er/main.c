@@ -0,0 +1,254 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_fib(rt_int* out, rt_int* pcc_p_n);
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n);
+static void pcc_fn_first_square_over(rt_int* out, rt_int* pcc_p_k);
+
+static void pcc_fn_fib(rt_int* out, rt_int* pcc_p_n) {
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1); rt_scope_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 2LL);
+    int pcc_tmp_2 = rt_int_cmp(&n, &pcc_tmp_1);
+    if ((pcc_tmp_2 < 0)) {
+    rt_int_copy(out, &n);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3); rt_scope_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 1LL);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4); rt_scope_int(&pcc_tmp_4);
+    rt_int_sub(&pcc_tmp_4, &n, &pcc_tmp_3);
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5); rt_scope_int(&pcc_tmp_5);
+    pcc_fn_fib(&pcc_tmp_5, &pcc_tmp_4);
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    rt_int_set_si(&pcc_tmp_6, 2LL);
+    rt_int pcc_tmp_7; rt_int_init(&pcc_tmp_7); rt_scope_int(&pcc_tmp_7);
+    rt_int_sub(&pcc_tmp_7, &n, &pcc_tmp_6);
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8); rt_scope_int(&pcc_tmp_8);
+    pcc_fn_fib(&pcc_tmp_8, &pcc_tmp_7);
+    rt_int pcc_tmp_9; rt_int_init(&pcc_tmp_9); rt_scope_int(&pcc_tmp_9);
+    rt_int_add(&pcc_tmp_9, &pcc_tmp_5, &pcc_tmp_8);
+    rt_int_copy(out, &pcc_tmp_9);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&n);
+}
+
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n) {
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int steps; rt_int_init(&steps);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1); rt_scope_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_copy(&steps, &pcc_tmp_1);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2); rt_scope_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 1LL);
+    int pcc_tmp_3 = rt_int_cmp(&n, &pcc_tmp_2);
+    if (!((pcc_tmp_3 != 0))) goto while_end_2;
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4); rt_scope_int(&pcc_tmp_4);
+    rt_int_set_si(&pcc_tmp_4, 2LL);
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5); rt_scope_int(&pcc_tmp_5);
+    rt_int_mod(&pcc_tmp_5, &n, &pcc_tmp_4);
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    rt_int_set_si(&pcc_tmp_6, 0LL);
+    int pcc_tmp_7 = rt_int_cmp(&pcc_tmp_5, &pcc_tmp_6);
+    if ((pcc_tmp_7 == 0)) {
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8); rt_scope_int(&pcc_tmp_8);
+    rt_int_set_si(&pcc_tmp_8, 2LL);
+    rt_int pcc_tmp_9; rt_int_init(&pcc_tmp_9); rt_scope_int(&pcc_tmp_9);
+    rt_int_floordiv(&pcc_tmp_9, &n, &pcc_tmp_8);
+    rt_int_copy(&n, &pcc_tmp_9);
+    rt_scope_reset(pcc_scope_4);
+    } else {
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    rt_int pcc_tmp_10; rt_int_init(&pcc_tmp_10); rt_scope_int(&pcc_tmp_10);
+    rt_int_set_si(&pcc_tmp_10, 3LL);
+    rt_int pcc_tmp_11; rt_int_init(&pcc_tmp_11); rt_scope_int(&pcc_tmp_11);
+    rt_int_mul(&pcc_tmp_11, &pcc_tmp_10, &n);
+    rt_int pcc_tmp_12; rt_int_init(&pcc_tmp_12); rt_scope_int(&pcc_tmp_12);
+    rt_int_set_si(&pcc_tmp_12, 1LL);
+    rt_int pcc_tmp_13; rt_int_init(&pcc_tmp_13); rt_scope_int(&pcc_tmp_13);
+    rt_int_add(&pcc_tmp_13, &pcc_tmp_11, &pcc_tmp_12);
+    rt_int_copy(&n, &pcc_tmp_13);
+    rt_scope_reset(pcc_scope_5);
+    }
+    rt_int pcc_tmp_14; rt_int_init(&pcc_tmp_14); rt_scope_int(&pcc_tmp_14);
+    rt_int_set_si(&pcc_tmp_14, 1LL);
+    rt_int pcc_tmp_15; rt_int_init(&pcc_tmp_15); rt_scope_int(&pcc_tmp_15);
+    rt_int_add(&pcc_tmp_15, &steps, &pcc_tmp_14);
+    rt_int_copy(&steps, &pcc_tmp_15);
+    rt_int pcc_tmp_16; rt_int_init(&pcc_tmp_16); rt_scope_int(&pcc_tmp_16);
+    rt_int_set_si(&pcc_tmp_16, 1000LL);
+    int pcc_tmp_17 = rt_int_cmp(&steps, &pcc_tmp_16);
+    if ((pcc_tmp_17 > 0)) {
+    rt_scope_t pcc_scope_6 = rt_scope_mark();
+    rt_int pcc_tmp_18; rt_int_init(&pcc_tmp_18); rt_scope_int(&pcc_tmp_18);
+    rt_int_set_si(&pcc_tmp_18, 0LL);
+    rt_int pcc_tmp_19; rt_int_init(&pcc_tmp_19); rt_scope_int(&pcc_tmp_19);
+    rt_int_set_si(&pcc_tmp_19, 1LL);
+    rt_int pcc_tmp_20; rt_int_init(&pcc_tmp_20); rt_scope_int(&pcc_tmp_20);
+    rt_int_sub(&pcc_tmp_20, &pcc_tmp_18, &pcc_tmp_19);
+    rt_int_copy(out, &pcc_tmp_20);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    rt_scope_reset(pcc_scope_6);
+    }
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &steps);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&steps);
+    rt_int_clear(&n);
+}
+
+static void pcc_fn_first_square_over(rt_int* out, rt_int* pcc_p_k) {
+    rt_int k; rt_int_init(&k);
+    rt_int_copy(&k, pcc_p_k);
+    rt_int i; rt_int_init(&i);
+    rt_int big; rt_int_init(&big);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1); rt_scope_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 1LL);
+    rt_int_copy(&i, &pcc_tmp_1);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3); rt_scope_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 1000000LL);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2); rt_scope_int(&pcc_tmp_2);
+    rt_int_copy(&pcc_tmp_2, &pcc_tmp_3);
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5); rt_scope_int(&pcc_tmp_5);
+    rt_int_set_si(&pcc_tmp_5, 1LL);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4); rt_scope_int(&pcc_tmp_4);
+    rt_int_copy(&pcc_tmp_4, &pcc_tmp_5);
+    int pcc_tmp_2_cmp = rt_int_cmp(&pcc_tmp_4, &(rt_int){0});
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    for_start_1:
+    if (pcc_tmp_2_cmp > 0) {
+        if (rt_int_cmp(&i, &pcc_tmp_2) >= 0) goto for_end_2;
+    } else {
+        if (rt_int_cmp(&i, &pcc_tmp_2) <= 0) goto for_end_2;
+    }
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    rt_int_mul(&pcc_tmp_6, &i, &i);
+    rt_int pcc_tmp_7; rt_int_init(&pcc_tmp_7); rt_scope_int(&pcc_tmp_7);
+    rt_int_from_dec(&pcc_tmp_7, "100000000000000000000000000000");
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8); rt_scope_int(&pcc_tmp_8);
+    rt_int_mul(&pcc_tmp_8, &pcc_tmp_6, &pcc_tmp_7);
+    rt_int_copy(&big, &pcc_tmp_8);
+    int pcc_tmp_9 = rt_int_cmp(&big, &k);
+    if ((pcc_tmp_9 > 0)) {
+    rt_int_copy(out, &i);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    for_continue_3:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_add(&i, &i, &pcc_tmp_4);
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_4);
+    rt_int pcc_tmp_10; rt_int_init(&pcc_tmp_10); rt_scope_int(&pcc_tmp_10);
+    rt_int_set_si(&pcc_tmp_10, 0LL);
+    rt_int_copy(out, &pcc_tmp_10);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&i);
+    rt_int_clear(&big);
+    rt_int_clear(&k);
+}
+
+int main(void) {
+    rt_int t; rt_int_init(&t);
+    rt_int j; rt_int_init(&j);
+    rt_str s; rt_str_init(&s);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1); rt_scope_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 20LL);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2); rt_scope_int(&pcc_tmp_2);
+    pcc_fn_fib(&pcc_tmp_2, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3); rt_scope_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 27LL);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4); rt_scope_int(&pcc_tmp_4);
+    pcc_fn_collatz(&pcc_tmp_4, &pcc_tmp_3);
+    rt_print_int(&pcc_tmp_4);
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5); rt_scope_int(&pcc_tmp_5);
+    rt_int_from_dec(&pcc_tmp_5, "123456789012345678901234567890123456789");
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    pcc_fn_first_square_over(&pcc_tmp_6, &pcc_tmp_5);
+    rt_print_int(&pcc_tmp_6);
+    rt_int pcc_tmp_7; rt_int_init(&pcc_tmp_7); rt_scope_int(&pcc_tmp_7);
+    rt_int_set_si(&pcc_tmp_7, 0LL);
+    rt_int_copy(&t, &pcc_tmp_7);
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8); rt_scope_int(&pcc_tmp_8);
+    rt_int_set_si(&pcc_tmp_8, 0LL);
+    rt_int_copy(&j, &pcc_tmp_8);
+    rt_int pcc_tmp_10; rt_int_init(&pcc_tmp_10); rt_scope_int(&pcc_tmp_10);
+    rt_int_set_si(&pcc_tmp_10, 10LL);
+    rt_int pcc_tmp_9; rt_int_init(&pcc_tmp_9); rt_scope_int(&pcc_tmp_9);
+    rt_int_copy(&pcc_tmp_9, &pcc_tmp_10);
+    rt_int pcc_tmp_12; rt_int_init(&pcc_tmp_12); rt_scope_int(&pcc_tmp_12);
+    rt_int_set_si(&pcc_tmp_12, 1LL);
+    rt_int pcc_tmp_11; rt_int_init(&pcc_tmp_11); rt_scope_int(&pcc_tmp_11);
+    rt_int_copy(&pcc_tmp_11, &pcc_tmp_12);
+    int pcc_tmp_9_cmp = rt_int_cmp(&pcc_tmp_11, &(rt_int){0});
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    for_start_1:
+    if (pcc_tmp_9_cmp > 0) {
+        if (rt_int_cmp(&j, &pcc_tmp_9) >= 0) goto for_end_2;
+    } else {
+        if (rt_int_cmp(&j, &pcc_tmp_9) <= 0) goto for_end_2;
+    }
+    rt_int pcc_tmp_13; rt_int_init(&pcc_tmp_13); rt_scope_int(&pcc_tmp_13);
+    rt_int_set_si(&pcc_tmp_13, 7LL);
+    int pcc_tmp_14 = rt_int_cmp(&j, &pcc_tmp_13);
+    if ((pcc_tmp_14 == 0)) {
+    rt_scope_reset(pcc_scope_4);
+    goto for_end_2;
+    }
+    rt_int pcc_tmp_15; rt_int_init(&pcc_tmp_15); rt_scope_int(&pcc_tmp_15);
+    rt_int_set_si(&pcc_tmp_15, 2LL);
+    rt_int pcc_tmp_16; rt_int_init(&pcc_tmp_16); rt_scope_int(&pcc_tmp_16);
+    rt_int_mod(&pcc_tmp_16, &j, &pcc_tmp_15);
+    rt_int pcc_tmp_17; rt_int_init(&pcc_tmp_17); rt_scope_int(&pcc_tmp_17);
+    rt_int_set_si(&pcc_tmp_17, 1LL);
+    int pcc_tmp_18 = rt_int_cmp(&pcc_tmp_16, &pcc_tmp_17);
+    if ((pcc_tmp_18 == 0)) {
+    rt_scope_reset(pcc_scope_4);
+    goto for_continue_3;
+    }
+    rt_str_clear(&s);
+    s = rt_str_from_cstr("step");
+    rt_print_str(s);
+    rt_int pcc_tmp_19; rt_int_init(&pcc_tmp_19); rt_scope_int(&pcc_tmp_19);
+    rt_int_add(&pcc_tmp_19, &t, &j);
+    rt_int_copy(&t, &pcc_tmp_19);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_add(&j, &j, &pcc_tmp_11);
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_4);
+    rt_print_int(&t);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&t);
+    rt_int_clear(&j);
+    rt_str_clear(&s);
+    return 0;
+}
\ No newline at end of file
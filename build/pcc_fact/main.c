@@ -0,0 +1,91 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_f(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_f_si(int64_t* out, int64_t n);
+
+static int pcc_fn_f_si(int64_t* out, int64_t n) {
+    int64_t x = 0;
+    int64_t i = 0;
+    x = 1LL;
+    int64_t pcc_tmp_1 = 1LL, pcc_tmp_2 = n, pcc_tmp_3 = 1LL;
+    if (pcc_tmp_3 == 0) return 0;
+    while (pcc_tmp_3 > 0 ? pcc_tmp_1 < pcc_tmp_2 : pcc_tmp_1 > pcc_tmp_2) {
+    i = pcc_tmp_1;
+    int64_t pcc_tmp_4;
+    if (rt_si_mul_overflow(x, i, &pcc_tmp_4)) return 0;
+    x = pcc_tmp_4;
+    for_next_1:
+    if (rt_si_add_overflow(pcc_tmp_1, pcc_tmp_3, &pcc_tmp_1)) break;
+    }
+    *out = x;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_f(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_f_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int x; rt_int_init(&x);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&x, 1LL);
+    rt_int_set_si(&pcc_tmp_1, 1LL);
+    rt_int_copy(&i, &pcc_tmp_1);
+    rt_int_copy(&pcc_tmp_1, &n);
+    rt_int_set_si(&pcc_tmp_2, 1LL);
+    int pcc_tmp_3 = rt_int_cmp(&pcc_tmp_2, &(rt_int){0});
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    for_start_1:
+    if (pcc_tmp_3 > 0) {
+        if (rt_int_cmp(&i, &pcc_tmp_1) >= 0) goto for_end_2;
+    } else {
+        if (rt_int_cmp(&i, &pcc_tmp_1) <= 0) goto for_end_2;
+    }
+    rt_int_mul(&x, &x, &i);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_add(&i, &i, &pcc_tmp_2);
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_copy(out, &x);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int64_t pcc_tmp_1;
+    if (pcc_fn_f_si(&pcc_tmp_1, 20000LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 20000LL);
+        pcc_fn_f(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_int_set_si(&pcc_tmp_3, 1000003LL);
+    rt_int_mod(&pcc_tmp_3, &pcc_tmp_2, &pcc_tmp_3);
+    rt_print_int(&pcc_tmp_3);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_gcd(rt_int* out, rt_int* pcc_p_a, rt_int* pcc_p_b);
+static int pcc_fn_gcd_si(int64_t* out, int64_t a, int64_t b);
+static void pcc_fn_fact(rt_int* out, rt_int* pcc_p_n, rt_int* pcc_p_acc);
+static int pcc_fn_fact_si(int64_t* out, int64_t n, int64_t acc);
+static void pcc_fn_fib(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_fib_si(int64_t* out, int64_t n);
+
+static int pcc_fn_gcd_si(int64_t* out, int64_t a, int64_t b) {
+    int64_t pcc_tail_1 = 0;
+    for (;;) {
+    if (!(1LL != 0)) break;
+    if (b == 0LL) {
+    *out = a;
+    return 1;
+    }
+    pcc_tail_1 = b;
+    int64_t pcc_tmp_1;
+    if (b == 0 || (b == -1 && a == INT64_MIN)) return 0;
+    pcc_tmp_1 = rt_math_mod_si(a, b);
+    b = pcc_tmp_1;
+    a = pcc_tail_1;
+    continue;
+    }
+    return 0;
+}
+
+static void pcc_fn_gcd(rt_int* out, rt_int* pcc_p_a, rt_int* pcc_p_b) {
+    int64_t pcc_si_out, pcc_si_a, pcc_si_b;
+    if (rt_int_to_si_checked(pcc_p_a, &pcc_si_a) == RT_OK && rt_int_to_si_checked(pcc_p_b, &pcc_si_b) == RT_OK && pcc_fn_gcd_si(&pcc_si_out, pcc_si_a, pcc_si_b)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int a; rt_int_init(&a);
+    rt_int_copy(&a, pcc_p_a);
+    rt_int b; rt_int_init(&b);
+    rt_int_copy(&b, pcc_p_b);
+    rt_int pcc_tail_1; rt_int_init(&pcc_tail_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    if (!(1)) goto while_end_2;
+    int pcc_tmp_1 = rt_int_cmp_si(&b, 0LL);
+    if ((pcc_tmp_1 == 0)) {
+    rt_int_copy(out, &a);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_copy(&pcc_tail_1, &b);
+    rt_int_mod(&b, &a, &b);
+    rt_int_copy(&a, &pcc_tail_1);
+    rt_scope_reset(pcc_scope_3);
+    goto while_start_1;
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tail_1);
+    rt_int_clear(&a);
+    rt_int_clear(&b);
+}
+
+static int pcc_fn_fact_si(int64_t* out, int64_t n, int64_t acc) {
+    int64_t pcc_tail_1 = 0;
+    for (;;) {
+    if (!(1LL != 0)) break;
+    if (n <= 1LL) {
+    *out = acc;
+    return 1;
+    }
+    int64_t pcc_tmp_1;
+    if (rt_si_sub_overflow(n, 1LL, &pcc_tmp_1)) return 0;
+    pcc_tail_1 = pcc_tmp_1;
+    int64_t pcc_tmp_2;
+    if (rt_si_mul_overflow(acc, n, &pcc_tmp_2)) return 0;
+    acc = pcc_tmp_2;
+    n = pcc_tail_1;
+    continue;
+    }
+    return 0;
+}
+
+static void pcc_fn_fact(rt_int* out, rt_int* pcc_p_n, rt_int* pcc_p_acc) {
+    int64_t pcc_si_out, pcc_si_n, pcc_si_acc;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && rt_int_to_si_checked(pcc_p_acc, &pcc_si_acc) == RT_OK && pcc_fn_fact_si(&pcc_si_out, pcc_si_n, pcc_si_acc)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int acc; rt_int_init(&acc);
+    rt_int_copy(&acc, pcc_p_acc);
+    rt_int pcc_tail_1; rt_int_init(&pcc_tail_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    if (!(1)) goto while_end_2;
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 1LL);
+    if ((pcc_tmp_1 <= 0)) {
+    rt_int_copy(out, &acc);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_sub_si(&pcc_tail_1, &n, 1LL);
+    rt_int_mul(&acc, &acc, &n);
+    rt_int_copy(&n, &pcc_tail_1);
+    rt_scope_reset(pcc_scope_3);
+    goto while_start_1;
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tail_1);
+    rt_int_clear(&n);
+    rt_int_clear(&acc);
+}
+
+static int pcc_fn_fib_si(int64_t* out, int64_t n) {
+    if (n < 2LL) {
+    *out = n;
+    return 1;
+    }
+    int64_t pcc_tmp_1;
+    if (rt_si_sub_overflow(n, 1LL, &pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_2;
+    if (!pcc_fn_fib_si(&pcc_tmp_2, pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_3;
+    int64_t pcc_tmp_4;
+    if (rt_si_sub_overflow(n, 2LL, &pcc_tmp_4)) return 0;
+    int64_t pcc_tmp_5;
+    if (!pcc_fn_fib_si(&pcc_tmp_5, pcc_tmp_4)) return 0;
+    if (rt_si_add_overflow(pcc_tmp_2, pcc_tmp_5, &pcc_tmp_3)) return 0;
+    *out = pcc_tmp_3;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_fib(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_fib_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 2LL);
+    if ((pcc_tmp_1 < 0)) {
+    rt_int_copy(out, &n);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_sub_si(&pcc_tmp_2, &n, 1LL);
+    pcc_fn_fib(&pcc_tmp_3, &pcc_tmp_2);
+    rt_int_sub_si(&pcc_tmp_2, &n, 2LL);
+    pcc_fn_fib(&pcc_tmp_4, &pcc_tmp_2);
+    rt_int_add(&pcc_tmp_4, &pcc_tmp_3, &pcc_tmp_4);
+    rt_int_copy(out, &pcc_tmp_4);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&pcc_tmp_4);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int64_t pcc_tmp_1;
+    if (pcc_fn_gcd_si(&pcc_tmp_1, 1071LL, 462LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 1071LL);
+        rt_int_set_si(&pcc_tmp_4, 462LL);
+        pcc_fn_gcd(&pcc_tmp_2, &pcc_tmp_3, &pcc_tmp_4);
+    }
+    rt_print_int(&pcc_tmp_2);
+    rt_print_si(58LL);
+    int64_t pcc_tmp_5;
+    if (pcc_fn_fact_si(&pcc_tmp_5, 25LL, 1LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_5);
+    } else {
+        rt_int_set_si(&pcc_tmp_4, 25LL);
+        rt_int_set_si(&pcc_tmp_3, 1LL);
+        pcc_fn_fact(&pcc_tmp_2, &pcc_tmp_4, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_2);
+    int64_t pcc_tmp_6;
+    if (pcc_fn_fib_si(&pcc_tmp_6, 20LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_6);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 20LL);
+        pcc_fn_fib(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&pcc_tmp_4);
+    return 0;
+}
\ No newline at end of file
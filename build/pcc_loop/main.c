@@ -0,0 +1,42 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int s; rt_int_init(&s);
+    rt_int i; rt_int_init(&i);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1); rt_scope_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_copy(&s, &pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2); rt_scope_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_copy(&i, &pcc_tmp_2);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3); rt_scope_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 3000000LL);
+    int pcc_tmp_4 = rt_int_cmp(&i, &pcc_tmp_3);
+    if (!((pcc_tmp_4 < 0))) goto while_end_2;
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5); rt_scope_int(&pcc_tmp_5);
+    rt_int_mul(&pcc_tmp_5, &i, &i);
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    rt_int_add(&pcc_tmp_6, &s, &pcc_tmp_5);
+    rt_int_copy(&s, &pcc_tmp_6);
+    rt_int pcc_tmp_7; rt_int_init(&pcc_tmp_7); rt_scope_int(&pcc_tmp_7);
+    rt_int_set_si(&pcc_tmp_7, 1LL);
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8); rt_scope_int(&pcc_tmp_8);
+    rt_int_add(&pcc_tmp_8, &i, &pcc_tmp_7);
+    rt_int_copy(&i, &pcc_tmp_8);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_print_int(&s);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&s);
+    rt_int_clear(&i);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x00000000u, 0x00000000u, 0x00000040u};
+static rt_int pcc_big_0;
+static rt_str pcc_lit_1;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+    pcc_lit_1 = rt_str_intern_static("done", 4);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int x; rt_int_init(&x);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&x, &pcc_big_0);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_copy(&i, &pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 30000LL);
+    rt_int_set_si(&pcc_tmp_2, 1LL);
+    int pcc_tmp_3 = rt_int_cmp(&pcc_tmp_2, &(rt_int){0});
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    for_start_1:
+    if (pcc_tmp_3 > 0) {
+        if (rt_int_cmp(&i, &pcc_tmp_1) >= 0) goto for_end_2;
+    } else {
+        if (rt_int_cmp(&i, &pcc_tmp_1) <= 0) goto for_end_2;
+    }
+    rt_int_mul_si(&pcc_tmp_4, &i, 1000003LL);
+    rt_int_sub_si(&pcc_tmp_4, &pcc_tmp_4, 7LL);
+    rt_print_int(&pcc_tmp_4);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_add(&i, &i, &pcc_tmp_2);
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_4);
+    rt_print_str(pcc_lit_1);
+    rt_int_mul(&pcc_tmp_2, &x, &x);
+    rt_print_int(&pcc_tmp_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_4);
+    return 0;
+}
\ No newline at end of file
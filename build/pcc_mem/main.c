@@ -0,0 +1,65 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int x; rt_int_init(&x);
+    rt_int i; rt_int_init(&i);
+    rt_int acc; rt_int_init(&acc);
+    rt_int y; rt_int_init(&y);
+    rt_int z; rt_int_init(&z);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1); rt_scope_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 1LL);
+    rt_int_copy(&x, &pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2); rt_scope_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_copy(&i, &pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3); rt_scope_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 0LL);
+    rt_int_copy(&acc, &pcc_tmp_3);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4); rt_scope_int(&pcc_tmp_4);
+    rt_int_set_si(&pcc_tmp_4, 200000LL);
+    int pcc_tmp_5 = rt_int_cmp(&i, &pcc_tmp_4);
+    if (!((pcc_tmp_5 < 0))) goto while_end_2;
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    rt_int_from_dec(&pcc_tmp_6, "1000000000000000000000000000000000000000000000000000");
+    rt_int pcc_tmp_7; rt_int_init(&pcc_tmp_7); rt_scope_int(&pcc_tmp_7);
+    rt_int_mul(&pcc_tmp_7, &x, &pcc_tmp_6);
+    rt_int_copy(&y, &pcc_tmp_7);
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8); rt_scope_int(&pcc_tmp_8);
+    rt_int_from_dec(&pcc_tmp_8, "1000000000000000000000000000000000000000000000000000000000000000000");
+    rt_int pcc_tmp_9; rt_int_init(&pcc_tmp_9); rt_scope_int(&pcc_tmp_9);
+    rt_int_mul(&pcc_tmp_9, &i, &pcc_tmp_8);
+    rt_int pcc_tmp_10; rt_int_init(&pcc_tmp_10); rt_scope_int(&pcc_tmp_10);
+    rt_int_add(&pcc_tmp_10, &y, &pcc_tmp_9);
+    rt_int_copy(&z, &pcc_tmp_10);
+    rt_int pcc_tmp_11; rt_int_init(&pcc_tmp_11); rt_scope_int(&pcc_tmp_11);
+    rt_int_set_si(&pcc_tmp_11, 1000LL);
+    rt_int pcc_tmp_12; rt_int_init(&pcc_tmp_12); rt_scope_int(&pcc_tmp_12);
+    rt_int_mod(&pcc_tmp_12, &z, &pcc_tmp_11);
+    rt_int pcc_tmp_13; rt_int_init(&pcc_tmp_13); rt_scope_int(&pcc_tmp_13);
+    rt_int_add(&pcc_tmp_13, &acc, &pcc_tmp_12);
+    rt_int_copy(&acc, &pcc_tmp_13);
+    rt_int pcc_tmp_14; rt_int_init(&pcc_tmp_14); rt_scope_int(&pcc_tmp_14);
+    rt_int_set_si(&pcc_tmp_14, 1LL);
+    rt_int pcc_tmp_15; rt_int_init(&pcc_tmp_15); rt_scope_int(&pcc_tmp_15);
+    rt_int_add(&pcc_tmp_15, &i, &pcc_tmp_14);
+    rt_int_copy(&i, &pcc_tmp_15);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_print_int(&acc);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&i);
+    rt_int_clear(&acc);
+    rt_int_clear(&y);
+    rt_int_clear(&z);
+    return 0;
+}
\ No newline at end of file
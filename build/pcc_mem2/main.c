@@ -0,0 +1,51 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int i; rt_int_init(&i);
+    rt_int acc; rt_int_init(&acc);
+    rt_int y; rt_int_init(&y);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1); rt_scope_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_copy(&i, &pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2); rt_scope_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_copy(&acc, &pcc_tmp_2);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3); rt_scope_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 300000LL);
+    int pcc_tmp_4 = rt_int_cmp(&i, &pcc_tmp_3);
+    if (!((pcc_tmp_4 < 0))) goto while_end_2;
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5); rt_scope_int(&pcc_tmp_5);
+    rt_int_from_dec(&pcc_tmp_5, "1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    rt_int_mul(&pcc_tmp_6, &i, &pcc_tmp_5);
+    rt_int_copy(&y, &pcc_tmp_6);
+    rt_int pcc_tmp_7; rt_int_init(&pcc_tmp_7); rt_scope_int(&pcc_tmp_7);
+    rt_int_set_si(&pcc_tmp_7, 7LL);
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8); rt_scope_int(&pcc_tmp_8);
+    rt_int_mod(&pcc_tmp_8, &y, &pcc_tmp_7);
+    rt_int pcc_tmp_9; rt_int_init(&pcc_tmp_9); rt_scope_int(&pcc_tmp_9);
+    rt_int_add(&pcc_tmp_9, &acc, &pcc_tmp_8);
+    rt_int_copy(&acc, &pcc_tmp_9);
+    rt_int pcc_tmp_10; rt_int_init(&pcc_tmp_10); rt_scope_int(&pcc_tmp_10);
+    rt_int_set_si(&pcc_tmp_10, 1LL);
+    rt_int pcc_tmp_11; rt_int_init(&pcc_tmp_11); rt_scope_int(&pcc_tmp_11);
+    rt_int_add(&pcc_tmp_11, &i, &pcc_tmp_10);
+    rt_int_copy(&i, &pcc_tmp_11);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_print_int(&acc);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&i);
+    rt_int_clear(&acc);
+    rt_int_clear(&y);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,533 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_collatz_si(int64_t* out, int64_t n);
+static void pcc_fn_sum_squares(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_sum_squares_si(int64_t* out, int64_t n);
+
+static const uint32_t pcc_big_0_words[] = {0x714244cbu, 0x42b64e76u, 0x0000029du};
+static rt_int pcc_big_0;
+static rt_str pcc_lit_1;
+static const uint32_t pcc_big_2_words[] = {0xf67fffffu, 0x02c7e14au, 0x0000152du};
+static rt_int pcc_big_2;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+    pcc_lit_1 = rt_str_intern_static("abc", 3);
+    rt_int_init(&pcc_big_2); rt_int_from_words(&pcc_big_2, pcc_big_2_words, 3, 1);
+}
+
+typedef struct {
+    int64_t pcc_lo, pcc_hi;
+    rt_int longest;
+    rt_int total;
+} pcc_par_0_t;
+
+static rt_error_code_t pcc_par_0(void* pcc_arg) {
+    pcc_par_0_t* pcc_ctx = (pcc_par_0_t*)pcc_arg;
+    int64_t pcc_lo = 0;
+    int64_t pcc_hi = 0;
+    rt_int longest; rt_int_init(&longest);
+    rt_int total; rt_int_init(&total);
+    int64_t i = 0;
+    rt_int c; rt_int_init(&c);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_lo = pcc_ctx->pcc_lo; pcc_hi = pcc_ctx->pcc_hi;
+    rt_int_swap(&longest, &pcc_ctx->longest);
+    rt_int_swap(&total, &pcc_ctx->total);
+    int64_t pcc_ctr_4 = pcc_lo;
+    int64_t pcc_ctr_4_stop = pcc_hi;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    int64_t pcc_tmp_1;
+    if (pcc_fn_collatz_si(&pcc_tmp_1, i)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, i);
+        pcc_fn_collatz(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_int_swap(&c, &pcc_tmp_2);
+    rt_math_max(&pcc_tmp_2, &longest, &c);
+    rt_int_swap(&longest, &pcc_tmp_2);
+    rt_int_add(&total, &total, &c);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_scope_reset(pcc_scope);
+    rt_int_swap(&longest, &pcc_ctx->longest);
+    rt_int_swap(&total, &pcc_ctx->total);
+    rt_int_clear(&longest);
+    rt_int_clear(&total);
+    rt_int_clear(&c);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return rt_error_last()->code;
+}
+
+typedef struct {
+    int64_t pcc_lo, pcc_hi;
+    const rt_int* big;
+    int64_t pcc_licm_1;
+    rt_int acc;
+} pcc_par_1_t;
+
+static rt_error_code_t pcc_par_1(void* pcc_arg) {
+    pcc_par_1_t* pcc_ctx = (pcc_par_1_t*)pcc_arg;
+    int64_t pcc_lo = 0;
+    int64_t pcc_hi = 0;
+    rt_int big; rt_int_init(&big);
+    int64_t pcc_licm_1 = 0;
+    rt_int acc; rt_int_init(&acc);
+    int64_t k = 0;
+    rt_int t; rt_int_init(&t);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_lo = pcc_ctx->pcc_lo; pcc_hi = pcc_ctx->pcc_hi;
+    rt_int_copy(&big, pcc_ctx->big);
+    pcc_licm_1 = pcc_ctx->pcc_licm_1;
+    rt_int_swap(&acc, &pcc_ctx->acc);
+    int64_t pcc_ctr_4 = pcc_lo;
+    int64_t pcc_ctr_4_stop = pcc_hi;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 > pcc_ctr_4_stop)) goto for_end_2;
+    k = pcc_ctr_4;
+    if ((k == 5LL)) {
+    rt_scope_reset(pcc_scope_5);
+    goto for_continue_3;
+    }
+    rt_int_mul_si(&t, &big, k);
+    rt_int_add(&pcc_tmp_1, &acc, &t);
+    rt_int_add_si(&acc, &pcc_tmp_1, pcc_licm_1);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += -1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_scope_reset(pcc_scope);
+    rt_int_swap(&acc, &pcc_ctx->acc);
+    rt_int_clear(&big);
+    rt_int_clear(&acc);
+    rt_int_clear(&t);
+    rt_int_clear(&pcc_tmp_1);
+    return rt_error_last()->code;
+}
+
+typedef struct {
+    int64_t pcc_lo, pcc_hi;
+    const rt_int* big;
+    rt_int lowest;
+} pcc_par_2_t;
+
+static rt_error_code_t pcc_par_2(void* pcc_arg) {
+    pcc_par_2_t* pcc_ctx = (pcc_par_2_t*)pcc_arg;
+    int64_t pcc_lo = 0;
+    int64_t pcc_hi = 0;
+    rt_int big; rt_int_init(&big);
+    rt_int lowest; rt_int_init(&lowest);
+    int64_t j = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_lo = pcc_ctx->pcc_lo; pcc_hi = pcc_ctx->pcc_hi;
+    rt_int_copy(&big, pcc_ctx->big);
+    rt_int_swap(&lowest, &pcc_ctx->lowest);
+    int64_t pcc_ctr_4 = pcc_lo;
+    int64_t pcc_ctr_4_stop = pcc_hi;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    j = pcc_ctr_4;
+    rt_int_sub_si(&pcc_tmp_1, &big, (j * 1000LL));
+    rt_math_min(&pcc_tmp_2, &lowest, &pcc_tmp_1);
+    rt_int_swap(&lowest, &pcc_tmp_2);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 7LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_scope_reset(pcc_scope);
+    rt_int_swap(&lowest, &pcc_ctx->lowest);
+    rt_int_clear(&big);
+    rt_int_clear(&lowest);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    return rt_error_last()->code;
+}
+
+typedef struct {
+    int64_t pcc_lo, pcc_hi;
+    rt_int grid;
+} pcc_par_3_t;
+
+static rt_error_code_t pcc_par_3(void* pcc_arg) {
+    pcc_par_3_t* pcc_ctx = (pcc_par_3_t*)pcc_arg;
+    int64_t pcc_lo = 0;
+    int64_t pcc_hi = 0;
+    rt_int grid; rt_int_init(&grid);
+    int64_t a = 0;
+    int64_t b = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_lo = pcc_ctx->pcc_lo; pcc_hi = pcc_ctx->pcc_hi;
+    rt_int_swap(&grid, &pcc_ctx->grid);
+    int64_t pcc_ctr_4 = pcc_lo;
+    int64_t pcc_ctr_4_stop = pcc_hi;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    a = pcc_ctr_4;
+    int64_t pcc_ctr_9 = 0LL;
+    int64_t pcc_ctr_9_stop = a;
+    rt_scope_t pcc_scope_10 = rt_scope_mark();
+    for_start_6:
+    if (!(pcc_ctr_9 < pcc_ctr_9_stop)) goto for_end_7;
+    b = pcc_ctr_9;
+    rt_int_add_si(&grid, &grid, (a * b));
+    for_continue_8:
+    rt_scope_reset(pcc_scope_10);
+    pcc_ctr_9 += 1LL;
+    goto for_start_6;
+    for_end_7:
+    rt_scope_reset(pcc_scope_10);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_scope_reset(pcc_scope);
+    rt_int_swap(&grid, &pcc_ctx->grid);
+    rt_int_clear(&grid);
+    return rt_error_last()->code;
+}
+
+typedef struct {
+    int64_t pcc_lo, pcc_hi;
+    rt_int neg;
+} pcc_par_4_t;
+
+static rt_error_code_t pcc_par_4(void* pcc_arg) {
+    pcc_par_4_t* pcc_ctx = (pcc_par_4_t*)pcc_arg;
+    int64_t pcc_lo = 0;
+    int64_t pcc_hi = 0;
+    rt_int neg; rt_int_init(&neg);
+    int64_t i = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_lo = pcc_ctx->pcc_lo; pcc_hi = pcc_ctx->pcc_hi;
+    rt_int_swap(&neg, &pcc_ctx->neg);
+    int64_t pcc_ctr_4 = pcc_lo;
+    int64_t pcc_ctr_4_stop = pcc_hi;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_sub_si(&neg, &neg, i);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_scope_reset(pcc_scope);
+    rt_int_swap(&neg, &pcc_ctx->neg);
+    rt_int_clear(&neg);
+    return rt_error_last()->code;
+}
+
+static int pcc_fn_collatz_si(int64_t* out, int64_t n) {
+    int64_t steps = 0;
+    steps = 0LL;
+    for (;;) {
+    if (!(n != 1LL)) break;
+    if ((n & 1LL) == 0LL) {
+    n = (n >> 1LL);
+    } else {
+    int64_t pcc_tmp_1;
+    if (rt_si_mul_overflow(3LL, n, &pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_2;
+    if (rt_si_add_overflow(pcc_tmp_1, 1LL, &pcc_tmp_2)) return 0;
+    n = pcc_tmp_2;
+    }
+    int64_t pcc_tmp_3;
+    if (rt_si_add_overflow(steps, 1LL, &pcc_tmp_3)) return 0;
+    steps = pcc_tmp_3;
+    }
+    *out = steps;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_collatz_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int steps; rt_int_init(&steps);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&steps, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 1LL);
+    if (!((pcc_tmp_1 != 0))) goto while_end_2;
+    rt_int_mod_pow2(&pcc_tmp_3, &n, 1);
+    int pcc_tmp_2 = rt_int_cmp_si(&pcc_tmp_3, 0LL);
+    if ((pcc_tmp_2 == 0)) {
+    rt_int_shr(&n, &n, 1);
+    } else {
+    rt_int_mul_si(&pcc_tmp_3, &n, 3LL);
+    rt_int_add_si(&n, &pcc_tmp_3, 1LL);
+    }
+    rt_int_add_si(&steps, &steps, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &steps);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&steps);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&n);
+}
+
+static int pcc_fn_sum_squares_si(int64_t* out, int64_t n) {
+    int64_t s = 0;
+    int64_t i = 0;
+    s = 0LL;
+    int64_t pcc_tmp_1 = 0LL, pcc_tmp_2 = n, pcc_tmp_3 = 1LL;
+    if (pcc_tmp_3 == 0) return 0;
+    while (pcc_tmp_3 > 0 ? pcc_tmp_1 < pcc_tmp_2 : pcc_tmp_1 > pcc_tmp_2) {
+    i = pcc_tmp_1;
+    int64_t pcc_tmp_4;
+    int64_t pcc_tmp_5;
+    if (rt_si_mul_overflow(i, i, &pcc_tmp_5)) return 0;
+    if (rt_si_add_overflow(s, pcc_tmp_5, &pcc_tmp_4)) return 0;
+    s = pcc_tmp_4;
+    for_next_1:
+    if (rt_si_add_overflow(pcc_tmp_1, pcc_tmp_3, &pcc_tmp_1)) break;
+    }
+    *out = s;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_sum_squares(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_sum_squares_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int s; rt_int_init(&s);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&s, 0LL);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_copy(&i, &pcc_tmp_1);
+    rt_int_copy(&pcc_tmp_1, &n);
+    rt_int_set_si(&pcc_tmp_2, 1LL);
+    int pcc_tmp_3 = rt_int_cmp(&pcc_tmp_2, &(rt_int){0});
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    for_start_1:
+    if (pcc_tmp_3 > 0) {
+        if (rt_int_cmp(&i, &pcc_tmp_1) >= 0) goto for_end_2;
+    } else {
+        if (rt_int_cmp(&i, &pcc_tmp_1) <= 0) goto for_end_2;
+    }
+    rt_int_mul(&pcc_tmp_4, &i, &i);
+    rt_int_add(&s, &s, &pcc_tmp_4);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_add(&i, &i, &pcc_tmp_2);
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_copy(out, &s);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&s);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_4);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int big; rt_int_init(&big);
+    rt_str label; rt_str_init(&label);
+    rt_int longest; rt_int_init(&longest);
+    rt_int total; rt_int_init(&total);
+    rt_int acc; rt_int_init(&acc);
+    int64_t pcc_licm_1 = 0;
+    rt_int lowest; rt_int_init(&lowest);
+    int64_t width = 0;
+    int64_t prev = 0;
+    rt_int chain; rt_int_init(&chain);
+    int64_t i = 0;
+    int64_t x = 0;
+    rt_int grid; rt_int_init(&grid);
+    rt_int neg; rt_int_init(&neg);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&big, &pcc_big_0);
+    rt_str_clear(&label);
+    label = pcc_lit_1;
+    rt_int_set_si(&longest, 0LL);
+    rt_int_set_si(&total, 0LL);
+    int64_t pcc_par_0_bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    pcc_par_0_t pcc_par_0_ctx[RT_POOL_FOR_MAX_CHUNKS];
+    size_t pcc_par_0_n = rt_pool_range_chunks(1LL, 3000LL, 1LL, 1, pcc_par_0_bounds);
+    for (size_t pcc_par_0_k = 0; pcc_par_0_k < pcc_par_0_n; pcc_par_0_k++) {
+        pcc_par_0_ctx[pcc_par_0_k].pcc_lo = pcc_par_0_bounds[pcc_par_0_k];
+        pcc_par_0_ctx[pcc_par_0_k].pcc_hi = pcc_par_0_bounds[pcc_par_0_k + 1];
+        rt_int_init(&pcc_par_0_ctx[pcc_par_0_k].longest); rt_int_copy(&pcc_par_0_ctx[pcc_par_0_k].longest, &longest);
+        rt_int_init(&pcc_par_0_ctx[pcc_par_0_k].total);
+    }
+    rt_pool_run(pcc_par_0, pcc_par_0_ctx, sizeof(pcc_par_0_t), pcc_par_0_n);
+    for (size_t pcc_par_0_k = 0; pcc_par_0_k < pcc_par_0_n; pcc_par_0_k++) {
+        rt_math_max(&longest, &longest, &pcc_par_0_ctx[pcc_par_0_k].longest); rt_int_clear(&pcc_par_0_ctx[pcc_par_0_k].longest);
+        rt_int_add(&total, &total, &pcc_par_0_ctx[pcc_par_0_k].total); rt_int_clear(&pcc_par_0_ctx[pcc_par_0_k].total);
+    }
+    rt_print_int(&longest);
+    rt_print_int(&total);
+    rt_int_set_si(&acc, 0LL);
+    pcc_licm_1 = (int64_t)rt_str_len(&label);
+    int64_t pcc_par_1_bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    pcc_par_1_t pcc_par_1_ctx[RT_POOL_FOR_MAX_CHUNKS];
+    size_t pcc_par_1_n = rt_pool_range_chunks(10LL, 0LL, -1LL, RT_POOL_FOR_GRAIN, pcc_par_1_bounds);
+    for (size_t pcc_par_1_k = 0; pcc_par_1_k < pcc_par_1_n; pcc_par_1_k++) {
+        pcc_par_1_ctx[pcc_par_1_k].pcc_lo = pcc_par_1_bounds[pcc_par_1_k];
+        pcc_par_1_ctx[pcc_par_1_k].pcc_hi = pcc_par_1_bounds[pcc_par_1_k + 1];
+        pcc_par_1_ctx[pcc_par_1_k].big = &big;
+        pcc_par_1_ctx[pcc_par_1_k].pcc_licm_1 = pcc_licm_1;
+        rt_int_init(&pcc_par_1_ctx[pcc_par_1_k].acc);
+    }
+    rt_pool_run(pcc_par_1, pcc_par_1_ctx, sizeof(pcc_par_1_t), pcc_par_1_n);
+    for (size_t pcc_par_1_k = 0; pcc_par_1_k < pcc_par_1_n; pcc_par_1_k++) {
+        rt_int_add(&acc, &acc, &pcc_par_1_ctx[pcc_par_1_k].acc); rt_int_clear(&pcc_par_1_ctx[pcc_par_1_k].acc);
+    }
+    rt_print_int(&acc);
+    rt_int_copy(&lowest, &pcc_big_2);
+    width = 7LL;
+    int64_t pcc_par_2_bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    pcc_par_2_t pcc_par_2_ctx[RT_POOL_FOR_MAX_CHUNKS];
+    size_t pcc_par_2_n = rt_pool_range_chunks(0LL, 100LL, width, RT_POOL_FOR_GRAIN, pcc_par_2_bounds);
+    for (size_t pcc_par_2_k = 0; pcc_par_2_k < pcc_par_2_n; pcc_par_2_k++) {
+        pcc_par_2_ctx[pcc_par_2_k].pcc_lo = pcc_par_2_bounds[pcc_par_2_k];
+        pcc_par_2_ctx[pcc_par_2_k].pcc_hi = pcc_par_2_bounds[pcc_par_2_k + 1];
+        pcc_par_2_ctx[pcc_par_2_k].big = &big;
+        rt_int_init(&pcc_par_2_ctx[pcc_par_2_k].lowest); rt_int_copy(&pcc_par_2_ctx[pcc_par_2_k].lowest, &lowest);
+    }
+    rt_pool_run(pcc_par_2, pcc_par_2_ctx, sizeof(pcc_par_2_t), pcc_par_2_n);
+    for (size_t pcc_par_2_k = 0; pcc_par_2_k < pcc_par_2_n; pcc_par_2_k++) {
+        rt_math_min(&lowest, &lowest, &pcc_par_2_ctx[pcc_par_2_k].lowest); rt_int_clear(&pcc_par_2_ctx[pcc_par_2_k].lowest);
+    }
+    rt_print_int(&lowest);
+    prev = 0LL;
+    rt_int_set_si(&chain, 0LL);
+    int64_t pcc_ctr_4 = 0LL;
+    int64_t pcc_ctr_4_stop = 10LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_add_si(&chain, &chain, prev);
+    prev = i;
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&chain);
+    int64_t pcc_tmp_1;
+    if (pcc_fn_sum_squares_si(&pcc_tmp_1, 100000LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 100000LL);
+        pcc_fn_sum_squares(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_2);
+    int64_t pcc_ctr_9 = 0LL;
+    int64_t pcc_ctr_9_stop = 5LL;
+    rt_scope_t pcc_scope_10 = rt_scope_mark();
+    for_start_6:
+    if (!(pcc_ctr_9 < pcc_ctr_9_stop)) goto for_end_7;
+    i = pcc_ctr_9;
+    x = (i * 2LL);
+    for_continue_8:
+    rt_scope_reset(pcc_scope_10);
+    pcc_ctr_9 += 1LL;
+    goto for_start_6;
+    for_end_7:
+    rt_scope_reset(pcc_scope_10);
+    rt_print_si(x);
+    rt_int_set_si(&grid, 0LL);
+    int64_t pcc_par_3_bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    pcc_par_3_t pcc_par_3_ctx[RT_POOL_FOR_MAX_CHUNKS];
+    size_t pcc_par_3_n = rt_pool_range_chunks(0LL, 20LL, 1LL, 1, pcc_par_3_bounds);
+    for (size_t pcc_par_3_k = 0; pcc_par_3_k < pcc_par_3_n; pcc_par_3_k++) {
+        pcc_par_3_ctx[pcc_par_3_k].pcc_lo = pcc_par_3_bounds[pcc_par_3_k];
+        pcc_par_3_ctx[pcc_par_3_k].pcc_hi = pcc_par_3_bounds[pcc_par_3_k + 1];
+        rt_int_init(&pcc_par_3_ctx[pcc_par_3_k].grid);
+    }
+    rt_pool_run(pcc_par_3, pcc_par_3_ctx, sizeof(pcc_par_3_t), pcc_par_3_n);
+    for (size_t pcc_par_3_k = 0; pcc_par_3_k < pcc_par_3_n; pcc_par_3_k++) {
+        rt_int_add(&grid, &grid, &pcc_par_3_ctx[pcc_par_3_k].grid); rt_int_clear(&pcc_par_3_ctx[pcc_par_3_k].grid);
+    }
+    rt_print_int(&grid);
+    rt_int_set_si(&neg, 0LL);
+    int64_t pcc_par_4_bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    pcc_par_4_t pcc_par_4_ctx[RT_POOL_FOR_MAX_CHUNKS];
+    size_t pcc_par_4_n = rt_pool_range_chunks(0LL, 100LL, 1LL, RT_POOL_FOR_GRAIN, pcc_par_4_bounds);
+    for (size_t pcc_par_4_k = 0; pcc_par_4_k < pcc_par_4_n; pcc_par_4_k++) {
+        pcc_par_4_ctx[pcc_par_4_k].pcc_lo = pcc_par_4_bounds[pcc_par_4_k];
+        pcc_par_4_ctx[pcc_par_4_k].pcc_hi = pcc_par_4_bounds[pcc_par_4_k + 1];
+        rt_int_init(&pcc_par_4_ctx[pcc_par_4_k].neg);
+    }
+    rt_pool_run(pcc_par_4, pcc_par_4_ctx, sizeof(pcc_par_4_t), pcc_par_4_n);
+    for (size_t pcc_par_4_k = 0; pcc_par_4_k < pcc_par_4_n; pcc_par_4_k++) {
+        rt_int_add(&neg, &neg, &pcc_par_4_ctx[pcc_par_4_k].neg); rt_int_clear(&pcc_par_4_ctx[pcc_par_4_k].neg);
+    }
+    rt_print_int(&neg);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&big);
+    rt_str_clear(&label);
+    rt_int_clear(&longest);
+    rt_int_clear(&total);
+    rt_int_clear(&acc);
+    rt_int_clear(&lowest);
+    rt_int_clear(&chain);
+    rt_int_clear(&grid);
+    rt_int_clear(&neg);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_collatz_si(int64_t* out, int64_t n);
+
+static rt_str pcc_lit_0;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("abcd", 4);
+}
+
+static int pcc_fn_collatz_si(int64_t* out, int64_t n) {
+    int64_t steps = 0;
+    steps = 0LL;
+    for (;;) {
+    if (!(n != 1LL)) break;
+    if ((n & 1LL) == 0LL) {
+    n = (n >> 1LL);
+    } else {
+    int64_t pcc_tmp_1;
+    if (rt_si_mul_overflow(3LL, n, &pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_2;
+    if (rt_si_add_overflow(pcc_tmp_1, 1LL, &pcc_tmp_2)) return 0;
+    n = pcc_tmp_2;
+    }
+    int64_t pcc_tmp_3;
+    if (rt_si_add_overflow(steps, 1LL, &pcc_tmp_3)) return 0;
+    steps = pcc_tmp_3;
+    }
+    *out = steps;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_collatz_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int steps; rt_int_init(&steps);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&steps, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 1LL);
+    if (!((pcc_tmp_1 != 0))) goto while_end_2;
+    rt_int_mod_pow2(&pcc_tmp_3, &n, 1);
+    int pcc_tmp_2 = rt_int_cmp_si(&pcc_tmp_3, 0LL);
+    if ((pcc_tmp_2 == 0)) {
+    rt_int_shr(&n, &n, 1);
+    } else {
+    rt_int_mul_si(&pcc_tmp_3, &n, 3LL);
+    rt_int_add_si(&n, &pcc_tmp_3, 1LL);
+    }
+    rt_int_add_si(&steps, &steps, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &steps);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&steps);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_str label; rt_str_init(&label);
+    rt_int longest; rt_int_init(&longest);
+    rt_int total; rt_int_init(&total);
+    int64_t i = 0;
+    rt_int c; rt_int_init(&c);
+    rt_int acc; rt_int_init(&acc);
+    int64_t pcc_licm_1 = 0;
+    int64_t k = 0;
+    int64_t lowest = 0;
+    int64_t j = 0;
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_str_clear(&label);
+    label = pcc_lit_0;
+    rt_int_set_si(&longest, 0LL);
+    rt_int_set_si(&total, 0LL);
+    int64_t pcc_ctr_4 = 1LL;
+    int64_t pcc_ctr_4_stop = 30000LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    int64_t pcc_tmp_1;
+    if (pcc_fn_collatz_si(&pcc_tmp_1, i)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, i);
+        pcc_fn_collatz(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_int_swap(&c, &pcc_tmp_2);
+    rt_math_max(&pcc_tmp_2, &longest, &c);
+    rt_int_swap(&longest, &pcc_tmp_2);
+    rt_int_add(&total, &total, &c);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&longest);
+    rt_print_int(&total);
+    rt_int_set_si(&acc, 0LL);
+    pcc_licm_1 = (int64_t)rt_str_len(&label);
+    int64_t pcc_ctr_9 = 100000LL;
+    int64_t pcc_ctr_9_stop = 0LL;
+    rt_scope_t pcc_scope_10 = rt_scope_mark();
+    for_start_6:
+    if (!(pcc_ctr_9 > pcc_ctr_9_stop)) goto for_end_7;
+    k = pcc_ctr_9;
+    if ((rt_math_mod_si(k, 5LL) == 0LL)) {
+    rt_scope_reset(pcc_scope_10);
+    goto for_continue_8;
+    }
+    rt_int_add_si(&pcc_tmp_2, &acc, (k * k));
+    rt_int_sub_si(&acc, &pcc_tmp_2, pcc_licm_1);
+    for_continue_8:
+    rt_scope_reset(pcc_scope_10);
+    pcc_ctr_9 += -3LL;
+    goto for_start_6;
+    for_end_7:
+    rt_scope_reset(pcc_scope_10);
+    rt_print_int(&acc);
+    lowest = 1000000LL;
+    int64_t pcc_ctr_14 = 0LL;
+    int64_t pcc_ctr_14_stop = 100000LL;
+    rt_scope_t pcc_scope_15 = rt_scope_mark();
+    for_start_11:
+    if (!(pcc_ctr_14 < pcc_ctr_14_stop)) goto for_end_12;
+    j = pcc_ctr_14;
+    lowest = rt_math_min_si(lowest, (rt_math_mod_si((j * 37LL), 1001LL) + 3LL));
+    for_continue_13:
+    rt_scope_reset(pcc_scope_15);
+    pcc_ctr_14 += 7LL;
+    goto for_start_11;
+    for_end_12:
+    rt_scope_reset(pcc_scope_15);
+    rt_print_si(lowest);
+    rt_scope_reset(pcc_scope);
+    rt_str_clear(&label);
+    rt_int_clear(&longest);
+    rt_int_clear(&total);
+    rt_int_clear(&c);
+    rt_int_clear(&acc);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    int64_t n = 0;
+    rt_int t; rt_int_init(&t);
+    int64_t pcc_licm_1 = 0;
+    int64_t i = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    n = 7LL;
+    rt_int_set_si(&t, 0LL);
+    pcc_licm_1 = ((n * n) * 2LL);
+    int64_t pcc_ctr_4 = -10LL;
+    int64_t pcc_ctr_4_stop = 10LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_add_si(&pcc_tmp_1, &t, (i >> 2LL));
+    rt_int_add_si(&pcc_tmp_1, &pcc_tmp_1, (i & 7LL));
+    rt_int_add_si(&t, &pcc_tmp_1, pcc_licm_1);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&t);
+    rt_print_si(-72057594037927936LL);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&t);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_print_si(7LL);
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "runtime.h"
+
+typedef struct {
+    long long pcc_lo, pcc_hi;
+    long long w;
+    long long s;
+    long long best;
+} pcc_par_0_t;
+
+static rt_error_code_t pcc_par_0(void* pcc_arg) {
+    pcc_par_0_t* pcc_ctx = (pcc_par_0_t*)pcc_arg;
+    long long pcc_lo = pcc_ctx->pcc_lo, pcc_hi = pcc_ctx->pcc_hi;
+    long long w = pcc_ctx->w;
+    long long s = pcc_ctx->s;
+    long long best = pcc_ctx->best;
+    long long i = 0;
+    long long t = 0;
+    {
+    const long long pcc_ctr_1_stop = pcc_hi;
+    const long long pcc_ctr_1_step = 3LL;
+    for (long long pcc_ctr_1 = pcc_lo; pcc_ctr_1 < pcc_ctr_1_stop; pcc_ctr_1 += pcc_ctr_1_step) {
+    i = pcc_ctr_1;
+    long long pcc_tmp_1;
+    pcc_tmp_1 = i % 7LL;
+    if ((i < 0) != (7LL < 0) && pcc_tmp_1 != 0) {
+        pcc_tmp_1 += 7LL;
+    }
+    int pcc_tmp_2 = (pcc_tmp_1 == 0LL);
+    if ((pcc_tmp_2 != 0)) {
+    continue;
+    }
+    long long pcc_tmp_3;
+    pcc_tmp_3 = i * i;
+    long long pcc_tmp_4;
+    pcc_tmp_4 = pcc_tmp_3 % 1000LL;
+    if ((pcc_tmp_3 < 0) != (1000LL < 0) && pcc_tmp_4 != 0) {
+        pcc_tmp_4 += 1000LL;
+    }
+    long long pcc_tmp_5;
+    pcc_tmp_5 = pcc_tmp_4 + w;
+    t = pcc_tmp_5;
+    long long pcc_tmp_6;
+    pcc_tmp_6 = s + t;
+    s = pcc_tmp_6;
+    long long pcc_tmp_7 = rt_math_max_si(best, t);
+    best = pcc_tmp_7;
+    }
+    }
+    pcc_ctx->s = s;
+    pcc_ctx->best = best;
+    return rt_error_last()->code;
+}
+
+int main(void) {
+    long long w = 3LL;
+    long long s = 0LL;
+    long long best = 0LL;
+    int64_t pcc_par_0_bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    pcc_par_0_t pcc_par_0_ctx[RT_POOL_FOR_MAX_CHUNKS];
+    size_t pcc_par_0_n = rt_pool_range_chunks(1LL, 20000LL, 3LL, RT_POOL_FOR_GRAIN, pcc_par_0_bounds);
+    for (size_t pcc_par_0_k = 0; pcc_par_0_k < pcc_par_0_n; pcc_par_0_k++) {
+        pcc_par_0_ctx[pcc_par_0_k].pcc_lo = pcc_par_0_bounds[pcc_par_0_k];
+        pcc_par_0_ctx[pcc_par_0_k].pcc_hi = pcc_par_0_bounds[pcc_par_0_k + 1];
+        pcc_par_0_ctx[pcc_par_0_k].w = w;
+        pcc_par_0_ctx[pcc_par_0_k].s = 0;
+        pcc_par_0_ctx[pcc_par_0_k].best = best;
+    }
+    rt_pool_run(pcc_par_0, pcc_par_0_ctx, sizeof(pcc_par_0_t), pcc_par_0_n);
+    for (size_t pcc_par_0_k = 0; pcc_par_0_k < pcc_par_0_n; pcc_par_0_k++) {
+        s += pcc_par_0_ctx[pcc_par_0_k].s;
+        best = rt_math_max_si(best, pcc_par_0_ctx[pcc_par_0_k].best);
+    }
+    rt_print_si(s);
+    rt_print_si(best);
+    return 0;
+}
\ No newline at end of file
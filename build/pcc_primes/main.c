@@ -0,0 +1,190 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_is_prime(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_is_prime_si(int64_t* out, int64_t n);
+
+typedef struct {
+    int64_t pcc_lo, pcc_hi;
+    rt_int count;
+    rt_int total;
+    int64_t biggest;
+} pcc_par_0_t;
+
+static rt_error_code_t pcc_par_0(void* pcc_arg) {
+    pcc_par_0_t* pcc_ctx = (pcc_par_0_t*)pcc_arg;
+    int64_t pcc_lo = 0;
+    int64_t pcc_hi = 0;
+    rt_int count; rt_int_init(&count);
+    rt_int total; rt_int_init(&total);
+    int64_t biggest = 0;
+    int64_t i = 0;
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_lo = pcc_ctx->pcc_lo; pcc_hi = pcc_ctx->pcc_hi;
+    rt_int_swap(&count, &pcc_ctx->count);
+    rt_int_swap(&total, &pcc_ctx->total);
+    biggest = pcc_ctx->biggest;
+    int64_t pcc_ctr_4 = pcc_lo;
+    int64_t pcc_ctr_4_stop = pcc_hi;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    int64_t pcc_tmp_1;
+    if (pcc_fn_is_prime_si(&pcc_tmp_1, i)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, i);
+        pcc_fn_is_prime(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    if (!rt_int_is_zero(&pcc_tmp_2)) {
+    rt_int_add_si(&count, &count, 1LL);
+    rt_int_add_si(&total, &total, i);
+    biggest = rt_math_max_si(biggest, i);
+    }
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_scope_reset(pcc_scope);
+    rt_int_swap(&count, &pcc_ctx->count);
+    rt_int_swap(&total, &pcc_ctx->total);
+    pcc_ctx->biggest = biggest;
+    rt_int_clear(&count);
+    rt_int_clear(&total);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return rt_error_last()->code;
+}
+
+static int pcc_fn_is_prime_si(int64_t* out, int64_t n) {
+    int64_t d = 0;
+    if (n < 2LL) {
+    *out = 0LL;
+    return 1;
+    }
+    if ((n & 1LL) == 0LL) {
+    if (n == 2LL) {
+    *out = 1LL;
+    return 1;
+    }
+    *out = 0LL;
+    return 1;
+    }
+    d = 3LL;
+    for (;;) {
+    int64_t pcc_tmp_1;
+    if (rt_si_mul_overflow(d, d, &pcc_tmp_1)) return 0;
+    if (!(pcc_tmp_1 <= n)) break;
+    int64_t pcc_tmp_2;
+    if (d == 0 || (d == -1 && n == INT64_MIN)) return 0;
+    pcc_tmp_2 = rt_math_mod_si(n, d);
+    if (pcc_tmp_2 == 0LL) {
+    *out = 0LL;
+    return 1;
+    }
+    int64_t pcc_tmp_3;
+    if (rt_si_add_overflow(d, 2LL, &pcc_tmp_3)) return 0;
+    d = pcc_tmp_3;
+    }
+    *out = 1LL;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_is_prime(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_is_prime_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int d; rt_int_init(&d);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 2LL);
+    if ((pcc_tmp_1 < 0)) {
+    rt_int_set_si(out, 0LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_mod_pow2(&pcc_tmp_3, &n, 1);
+    int pcc_tmp_2 = rt_int_cmp_si(&pcc_tmp_3, 0LL);
+    if ((pcc_tmp_2 == 0)) {
+    int pcc_tmp_4 = rt_int_cmp_si(&n, 2LL);
+    if ((pcc_tmp_4 == 0)) {
+    rt_int_set_si(out, 1LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_set_si(out, 0LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_set_si(&d, 3LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_mul(&pcc_tmp_3, &d, &d);
+    int pcc_tmp_5 = rt_int_cmp(&pcc_tmp_3, &n);
+    if (!((pcc_tmp_5 <= 0))) goto while_end_2;
+    rt_int_mod(&pcc_tmp_3, &n, &d);
+    int pcc_tmp_6 = rt_int_cmp_si(&pcc_tmp_3, 0LL);
+    if ((pcc_tmp_6 == 0)) {
+    rt_int_set_si(out, 0LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_add_si(&d, &d, 2LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_set_si(out, 1LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&d);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    rt_int count; rt_int_init(&count);
+    rt_int total; rt_int_init(&total);
+    int64_t biggest = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&count, 0LL);
+    rt_int_set_si(&total, 0LL);
+    biggest = 0LL;
+    int64_t pcc_par_0_bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    pcc_par_0_t pcc_par_0_ctx[RT_POOL_FOR_MAX_CHUNKS];
+    size_t pcc_par_0_n = rt_pool_range_chunks(2LL, 200000LL, 1LL, 1, pcc_par_0_bounds);
+    for (size_t pcc_par_0_k = 0; pcc_par_0_k < pcc_par_0_n; pcc_par_0_k++) {
+        pcc_par_0_ctx[pcc_par_0_k].pcc_lo = pcc_par_0_bounds[pcc_par_0_k];
+        pcc_par_0_ctx[pcc_par_0_k].pcc_hi = pcc_par_0_bounds[pcc_par_0_k + 1];
+        rt_int_init(&pcc_par_0_ctx[pcc_par_0_k].count);
+        rt_int_init(&pcc_par_0_ctx[pcc_par_0_k].total);
+        pcc_par_0_ctx[pcc_par_0_k].biggest = biggest;
+    }
+    rt_pool_run(pcc_par_0, pcc_par_0_ctx, sizeof(pcc_par_0_t), pcc_par_0_n);
+    for (size_t pcc_par_0_k = 0; pcc_par_0_k < pcc_par_0_n; pcc_par_0_k++) {
+        rt_int_add(&count, &count, &pcc_par_0_ctx[pcc_par_0_k].count); rt_int_clear(&pcc_par_0_ctx[pcc_par_0_k].count);
+        rt_int_add(&total, &total, &pcc_par_0_ctx[pcc_par_0_k].total); rt_int_clear(&pcc_par_0_ctx[pcc_par_0_k].total);
+        biggest = rt_math_max_si(biggest, pcc_par_0_ctx[pcc_par_0_k].biggest);
+    }
+    rt_print_int(&count);
+    rt_print_int(&total);
+    rt_print_si(biggest);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&count);
+    rt_int_clear(&total);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x00000000u, 0x00000000u, 0x00000040u};
+static rt_int pcc_big_0;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int x; rt_int_init(&x);
+    rt_int y; rt_int_init(&y);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&x, &pcc_big_0);
+    rt_int_mul(&y, &x, &x);
+    rt_print_int(&y);
+    rt_int_set_si(&pcc_tmp_1, 7LL);
+    rt_int_floordiv(&pcc_tmp_1, &y, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&y);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x00000000u, 0x00000000u, 0x00000040u};
+static rt_int pcc_big_0;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int x; rt_int_init(&x);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&x, &pcc_big_0);
+    rt_int_mul_si(&pcc_tmp_1, &x, 3LL);
+    rt_int_sub_si(&pcc_tmp_1, &pcc_tmp_1, 1LL);
+    rt_print_int(&pcc_tmp_1);
+    rt_str pcc_tmp_2 = rt_str_null(); rt_scope_str(&pcc_tmp_2);
+    rt_strbuf_reserve(&pcc_tmp_2, 1 + rt_int_to_buffer_size(&x));
+    rt_strbuf_append_bytes(&pcc_tmp_2, "a", 1);
+    rt_strbuf_append_int(&pcc_tmp_2, &x);
+    rt_print_str(pcc_tmp_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int n; rt_int_init(&n);
+    rt_str s; rt_str_init(&s);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_from_dec(&n, "12345678901234567890123");
+    rt_str pcc_tmp_1 = rt_str_from_int(&n); rt_scope_str(&pcc_tmp_1);
+    rt_print_str(pcc_tmp_1);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3); rt_scope_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 0LL);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2); rt_scope_int(&pcc_tmp_2);
+    rt_int_sub(&pcc_tmp_2, &pcc_tmp_3, &n);
+    rt_str pcc_tmp_4 = rt_str_from_int(&pcc_tmp_2); rt_scope_str(&pcc_tmp_4);
+    rt_print_str(pcc_tmp_4);
+    rt_str pcc_tmp_5 = rt_str_from_cstr("n="); rt_scope_str(&pcc_tmp_5);
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6); rt_scope_int(&pcc_tmp_6);
+    rt_int_mul(&pcc_tmp_6, &n, &n);
+    rt_str pcc_tmp_7 = rt_str_from_int(&pcc_tmp_6); rt_scope_str(&pcc_tmp_7);
+    rt_str pcc_tmp_8 = rt_str_concat(pcc_tmp_5, pcc_tmp_7); rt_scope_str(&pcc_tmp_8);
+    rt_str_clear(&s);
+    s = pcc_tmp_8; rt_str_init(&pcc_tmp_8);
+    rt_print_str(s);
+    rt_int pcc_tmp_9; rt_int_init(&pcc_tmp_9); rt_scope_int(&pcc_tmp_9);
+    rt_int_set_si(&pcc_tmp_9, 7LL);
+    rt_str pcc_tmp_10 = rt_str_from_int(&pcc_tmp_9); rt_scope_str(&pcc_tmp_10);
+    rt_print_str(pcc_tmp_10);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&n);
+    rt_str_clear(&s);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    int64_t x = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    x = 3LL;
+    rt_print_si(x);
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    int64_t x = 0;
+    int64_t y = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    x = 2LL;
+    y = ((x * 5LL) + 1LL);
+    rt_print_si(y);
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int x; rt_int_init(&x);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&x, 3LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&x, 0LL);
+    if (!((pcc_tmp_1 > 0))) goto while_end_2;
+    rt_print_int(&x);
+    rt_int_sub_si(&x, &x, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_print_si(0LL);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    return 0;
+}
\ No newline at end of file
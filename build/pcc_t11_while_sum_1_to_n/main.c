@@ -0,0 +1,30 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    int64_t n = 0;
+    rt_int i; rt_int_init(&i);
+    rt_int s; rt_int_init(&s);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    n = 5LL;
+    rt_int_set_si(&i, 1LL);
+    rt_int_set_si(&s, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&i, n);
+    if (!((pcc_tmp_1 <= 0))) goto while_end_2;
+    rt_int_add(&s, &s, &i);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_print_int(&s);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&i);
+    rt_int_clear(&s);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_sum_to(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_sum_to_si(int64_t* out, int64_t n);
+
+static int pcc_fn_sum_to_si(int64_t* out, int64_t n) {
+    int64_t i = 0;
+    int64_t s = 0;
+    i = 1LL;
+    s = 0LL;
+    for (;;) {
+    if (!(i <= n)) break;
+    int64_t pcc_tmp_1;
+    if (rt_si_add_overflow(s, i, &pcc_tmp_1)) return 0;
+    s = pcc_tmp_1;
+    int64_t pcc_tmp_2;
+    if (rt_si_add_overflow(i, 1LL, &pcc_tmp_2)) return 0;
+    i = pcc_tmp_2;
+    }
+    *out = s;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_sum_to(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_sum_to_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int i; rt_int_init(&i);
+    rt_int s; rt_int_init(&s);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&i, 1LL);
+    rt_int_set_si(&s, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp(&i, &n);
+    if (!((pcc_tmp_1 <= 0))) goto while_end_2;
+    rt_int_add(&s, &s, &i);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &s);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&i);
+    rt_int_clear(&s);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int64_t pcc_tmp_1;
+    if (pcc_fn_sum_to_si(&pcc_tmp_1, 5LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 5LL);
+        pcc_fn_sum_to(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
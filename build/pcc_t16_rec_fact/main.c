@@ -0,0 +1,73 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_fact(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_fact_si(int64_t* out, int64_t n);
+
+static int pcc_fn_fact_si(int64_t* out, int64_t n) {
+    if (n <= 1LL) {
+    *out = 1LL;
+    return 1;
+    } else {
+    int64_t pcc_tmp_1;
+    int64_t pcc_tmp_2;
+    if (rt_si_sub_overflow(n, 1LL, &pcc_tmp_2)) return 0;
+    int64_t pcc_tmp_3;
+    if (!pcc_fn_fact_si(&pcc_tmp_3, pcc_tmp_2)) return 0;
+    if (rt_si_mul_overflow(n, pcc_tmp_3, &pcc_tmp_1)) return 0;
+    *out = pcc_tmp_1;
+    return 1;
+    }
+    return 0;
+}
+
+static void pcc_fn_fact(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_fact_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 1LL);
+    if ((pcc_tmp_1 <= 0)) {
+    rt_int_set_si(out, 1LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    } else {
+    rt_int_sub_si(&pcc_tmp_2, &n, 1LL);
+    pcc_fn_fact(&pcc_tmp_3, &pcc_tmp_2);
+    rt_int_mul(&pcc_tmp_3, &n, &pcc_tmp_3);
+    rt_int_copy(out, &pcc_tmp_3);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int64_t pcc_tmp_1;
+    if (pcc_fn_fact_si(&pcc_tmp_1, 5LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 5LL);
+        pcc_fn_fact(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
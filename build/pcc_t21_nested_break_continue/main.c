@@ -0,0 +1,46 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int i; rt_int_init(&i);
+    rt_int j; rt_int_init(&j);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&i, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&i, 3LL);
+    if (!((pcc_tmp_1 < 0))) goto while_end_2;
+    rt_int_set_si(&j, 0LL);
+    rt_scope_t pcc_scope_6 = rt_scope_mark();
+    while_start_4:
+    rt_scope_reset(pcc_scope_6);
+    int pcc_tmp_2 = rt_int_cmp_si(&j, 5LL);
+    if (!((pcc_tmp_2 < 0))) goto while_end_5;
+    rt_int_add_si(&j, &j, 1LL);
+    int pcc_tmp_3 = rt_int_cmp_si(&j, 2LL);
+    if ((pcc_tmp_3 == 0)) {
+    rt_scope_reset(pcc_scope_6);
+    goto while_start_4;
+    }
+    int pcc_tmp_4 = rt_int_cmp_si(&j, 4LL);
+    if ((pcc_tmp_4 == 0)) {
+    rt_scope_reset(pcc_scope_6);
+    goto while_end_5;
+    }
+    rt_print_int(&j);
+    goto while_start_4;
+    while_end_5:
+    rt_scope_reset(pcc_scope_6);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&i);
+    rt_int_clear(&j);
+    return 0;
+}
\ No newline at end of file
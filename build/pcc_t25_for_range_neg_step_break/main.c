@@ -0,0 +1,33 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int s; rt_int_init(&s);
+    int64_t i = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&s, 0LL);
+    int64_t pcc_ctr_4 = 5LL;
+    int64_t pcc_ctr_4_stop = -1LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 > pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    if ((i == 2LL)) {
+    rt_scope_reset(pcc_scope_5);
+    goto for_end_2;
+    }
+    rt_int_add_si(&s, &s, i);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += -1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&s);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&s);
+    return 0;
+}
\ No newline at end of file
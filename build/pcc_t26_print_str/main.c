@@ -0,0 +1,19 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static rt_str pcc_lit_0;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("hi", 2);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_print_str(pcc_lit_0);
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
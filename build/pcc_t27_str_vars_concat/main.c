@@ -0,0 +1,33 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static rt_str pcc_lit_0;
+static rt_str pcc_lit_1;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("a", 1);
+    pcc_lit_1 = rt_str_intern_static("b", 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_str s; rt_str_init(&s);
+    rt_str t; rt_str_init(&t);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_str_clear(&s);
+    s = pcc_lit_0;
+    rt_str_clear(&t);
+    t = pcc_lit_1;
+    rt_str pcc_tmp_1 = rt_str_null(); rt_scope_str(&pcc_tmp_1);
+    rt_strbuf_reserve(&pcc_tmp_1, s.len + t.len);
+    rt_strbuf_append(&pcc_tmp_1, s);
+    rt_strbuf_append(&pcc_tmp_1, t);
+    rt_print_str(pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_str_clear(&s);
+    rt_str_clear(&t);
+    return 0;
+}
\ No newline at end of file
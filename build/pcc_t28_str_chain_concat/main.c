@@ -0,0 +1,28 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static rt_str pcc_lit_0;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("x", 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_str s; rt_str_init(&s);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_str_clear(&s);
+    s = pcc_lit_0;
+    rt_str pcc_tmp_1 = rt_str_null(); rt_scope_str(&pcc_tmp_1);
+    rt_strbuf_reserve(&pcc_tmp_1, s.len + 1 + 1);
+    rt_strbuf_append(&pcc_tmp_1, s);
+    rt_strbuf_append_bytes(&pcc_tmp_1, "y", 1);
+    rt_strbuf_append_bytes(&pcc_tmp_1, "z", 1);
+    rt_print_str(pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_str_clear(&s);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static rt_str pcc_lit_0;
+static rt_str pcc_lit_1;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("mid", 3);
+    pcc_lit_1 = rt_str_intern_static("x", 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    int64_t i = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int64_t pcc_ctr_4 = 0LL;
+    int64_t pcc_ctr_4_stop = 3LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    if ((i == 1LL)) {
+    rt_print_str(pcc_lit_0);
+    } else {
+    rt_print_str(pcc_lit_1);
+    }
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
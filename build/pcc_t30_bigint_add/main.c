@@ -0,0 +1,32 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x4e3f0ad2u, 0xc373e0eeu, 0x8ee90ff6u, 0x00000001u};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0xd1c67eeau, 0xffb62438u, 0x7748819du, 0x0000000cu};
+static rt_int pcc_big_1;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 4, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 4, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int a; rt_int_init(&a);
+    rt_int b; rt_int_init(&b);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&a, &pcc_big_0);
+    rt_int_copy(&b, &pcc_big_1);
+    rt_int_add(&pcc_tmp_1, &a, &b);
+    rt_print_int(&pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&b);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    int64_t a = 0;
+    int64_t b = 0;
+    rt_scope_t pcc_scope = rt_scope_mark();
+    a = 123456789LL;
+    b = 987654321LL;
+    rt_print_si((a * b));
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x63100000u, 0x6bc75e2du, 0x00000005u};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0x630fffffu, 0x6bc75e2du, 0x00000005u};
+static rt_int pcc_big_1;
+static rt_str pcc_lit_2;
+static rt_str pcc_lit_3;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 3, 1);
+    pcc_lit_2 = rt_str_intern_static("yes", 3);
+    pcc_lit_3 = rt_str_intern_static("no", 2);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int a; rt_int_init(&a);
+    rt_int b; rt_int_init(&b);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&a, &pcc_big_0);
+    rt_int_copy(&b, &pcc_big_1);
+    int pcc_tmp_1 = rt_int_cmp(&a, &b);
+    if ((pcc_tmp_1 > 0)) {
+    rt_print_str(pcc_lit_2);
+    } else {
+    rt_print_str(pcc_lit_3);
+    }
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&b);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x63100000u, 0x6bc75e2du, 0x00000005u};
+static rt_int pcc_big_0;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int a; rt_int_init(&a);
+    int64_t b = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&a, &pcc_big_0);
+    b = 1LL;
+    rt_int_sub_si(&pcc_tmp_1, &a, b);
+    rt_print_int(&pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x0000007bu, 0xb5640000u, 0xc40534fdu, 0x926687d2u, 0x6c3b15f9u, 0x00000044u};
+static rt_int pcc_big_0;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 6, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int a; rt_int_init(&a);
+    int64_t b = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&a, &pcc_big_0);
+    b = 97LL;
+    rt_int_set_si(&pcc_tmp_1, b);
+    rt_int_floordiv(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, b);
+    rt_int_mod(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
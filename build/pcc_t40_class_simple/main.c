@@ -0,0 +1,34 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+typedef struct {
+    rt_int x;
+    rt_int y;
+} pcc_class_Point;
+
+
+static pcc_class_Point* pcc_new_Point(void) {
+    pcc_class_Point* obj = malloc(sizeof(pcc_class_Point));
+    if (!obj) return NULL;
+    rt_int_init(&obj->x);
+    rt_int_init(&obj->y);
+    return obj;
+}
+
+static void pcc_delete_Point(pcc_class_Point* obj) {
+    if (!obj) return;
+    rt_int_clear(&obj->x);
+    rt_int_clear(&obj->y);
+    free(obj);
+}
+
+int main(void) {
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_class_Point* pcc_tmp_1 = pcc_new_Point();
+    pcc_class_Point* p = pcc_tmp_1;
+    rt_print_int(&p->x);
+    rt_scope_reset(pcc_scope);
+    return 0;
+}
\ No newline at end of file
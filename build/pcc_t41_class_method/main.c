@@ -0,0 +1,42 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+typedef struct {
+    rt_int value;
+} pcc_class_Counter;
+
+static void pcc_method_Counter_increment(pcc_class_Counter* self, rt_int* out);
+
+static pcc_class_Counter* pcc_new_Counter(void) {
+    pcc_class_Counter* obj = malloc(sizeof(pcc_class_Counter));
+    if (!obj) return NULL;
+    rt_int_init(&obj->value);
+    return obj;
+}
+
+static void pcc_delete_Counter(pcc_class_Counter* obj) {
+    if (!obj) return;
+    rt_int_clear(&obj->value);
+    free(obj);
+}
+
+static void pcc_method_Counter_increment(pcc_class_Counter* self, rt_int* out) {
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_add_si(&self->value, &self->value, 1LL);
+    rt_scope_reset(pcc_scope);
+}
+
+int main(void) {
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_class_Counter* pcc_tmp_1 = pcc_new_Counter();
+    pcc_class_Counter* c = pcc_tmp_1;
+    pcc_method_Counter_increment(c, &pcc_tmp_2);
+    pcc_method_Counter_increment(c, &pcc_tmp_2);
+    rt_print_int(&c->value);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    return 0;
+}
\ No newline at end of file
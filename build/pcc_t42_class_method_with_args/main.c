@@ -0,0 +1,58 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+typedef struct {
+    rt_int x;
+    rt_int y;
+} pcc_class_Point;
+
+static void pcc_method_Point_move(pcc_class_Point* self, rt_int* out, rt_int* pcc_p_dx, rt_int* pcc_p_dy);
+
+static pcc_class_Point* pcc_new_Point(void) {
+    pcc_class_Point* obj = malloc(sizeof(pcc_class_Point));
+    if (!obj) return NULL;
+    rt_int_init(&obj->x);
+    rt_int_init(&obj->y);
+    return obj;
+}
+
+static void pcc_delete_Point(pcc_class_Point* obj) {
+    if (!obj) return;
+    rt_int_clear(&obj->x);
+    rt_int_clear(&obj->y);
+    free(obj);
+}
+
+static void pcc_method_Point_move(pcc_class_Point* self, rt_int* out, rt_int* pcc_p_dx, rt_int* pcc_p_dy) {
+    rt_int dx; rt_int_init(&dx);
+    rt_int_copy(&dx, pcc_p_dx);
+    rt_int dy; rt_int_init(&dy);
+    rt_int_copy(&dy, pcc_p_dy);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_add(&self->x, &self->x, &dx);
+    rt_int_add(&self->y, &self->y, &dy);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&dx);
+    rt_int_clear(&dy);
+}
+
+int main(void) {
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    pcc_class_Point* pcc_tmp_1 = pcc_new_Point();
+    pcc_class_Point* p = pcc_tmp_1;
+    rt_int_set_si(&pcc_tmp_2, 3LL);
+    rt_int_set_si(&pcc_tmp_3, 4LL);
+    pcc_method_Point_move(p, &pcc_tmp_4, &pcc_tmp_2, &pcc_tmp_3);
+    rt_print_int(&p->x);
+    rt_print_int(&p->y);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&pcc_tmp_4);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static rt_str pcc_lit_0;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("Hello", 5);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_str s; rt_str_init(&s);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_str_clear(&s);
+    s = pcc_lit_0;
+    rt_print_si((int64_t)rt_str_len(&s));
+    rt_scope_reset(pcc_scope);
+    rt_str_clear(&s);
+    return 0;
+}
\ No newline at end of file
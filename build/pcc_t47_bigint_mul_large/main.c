@@ -0,0 +1,57 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int a; rt_int_init(&a);
+    rt_int i; rt_int_init(&i);
+    rt_int b; rt_int_init(&b);
+    rt_int c; rt_int_init(&c);
+    rt_int pcc_cse_1; rt_int_init(&pcc_cse_1);
+    rt_int d; rt_int_init(&d);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&a, 7LL);
+    rt_int_set_si(&i, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&i, 12LL);
+    if (!((pcc_tmp_1 < 0))) goto while_end_2;
+    rt_int_mul(&a, &a, &a);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_add_si(&b, &a, 123456789LL);
+    rt_int_mul(&c, &a, &b);
+    rt_int_set_si(&pcc_tmp_2, 999999937LL);
+    rt_int_mod(&pcc_tmp_2, &c, &pcc_tmp_2);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_mul(&pcc_cse_1, &a, &a);
+    rt_int_sub(&pcc_tmp_2, &pcc_cse_1, &c);
+    rt_int_mul_si(&pcc_tmp_3, &a, 123456789LL);
+    rt_int_add(&pcc_tmp_3, &pcc_tmp_2, &pcc_tmp_3);
+    rt_print_int(&pcc_tmp_3);
+    rt_int_mul(&d, &c, &c);
+    rt_int_set_si(&pcc_tmp_3, 999999937LL);
+    rt_int_mod(&pcc_tmp_3, &d, &pcc_tmp_3);
+    rt_print_int(&pcc_tmp_3);
+    rt_int_mul(&pcc_tmp_3, &pcc_cse_1, &b);
+    rt_int_mul(&pcc_tmp_3, &pcc_tmp_3, &b);
+    rt_int_sub(&pcc_tmp_3, &d, &pcc_tmp_3);
+    rt_print_int(&pcc_tmp_3);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&i);
+    rt_int_clear(&b);
+    rt_int_clear(&c);
+    rt_int_clear(&pcc_cse_1);
+    rt_int_clear(&d);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
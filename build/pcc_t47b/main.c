@@ -0,0 +1,56 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 7LL);
+    rt_int a; rt_int_init(&a);
+    rt_int_copy(&a, &pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int i; rt_int_init(&i);
+    rt_int_copy(&i, &pcc_tmp_2);
+    while_start_1:
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 12LL);
+    int pcc_tmp_4 = rt_int_cmp(&i, &pcc_tmp_3);
+    if (!((pcc_tmp_4 < 0))) goto while_end_2;
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5);
+    rt_int_mul(&pcc_tmp_5, &a, &a);
+    rt_int_copy(&a, &pcc_tmp_5);
+    rt_int pcc_tmp_6; rt_int_init(&pcc_tmp_6);
+    rt_int_set_si(&pcc_tmp_6, 1LL);
+    rt_int pcc_tmp_7; rt_int_init(&pcc_tmp_7);
+    rt_int_add(&pcc_tmp_7, &i, &pcc_tmp_6);
+    rt_int_copy(&i, &pcc_tmp_7);
+    goto while_start_1;
+    while_end_2:
+    rt_int pcc_tmp_8; rt_int_init(&pcc_tmp_8);
+    rt_int_set_si(&pcc_tmp_8, 1000000007LL);
+    rt_int pcc_tmp_9; rt_int_init(&pcc_tmp_9);
+    rt_int_mod(&pcc_tmp_9, &a, &pcc_tmp_8);
+    rt_print_int(&pcc_tmp_9);
+    rt_int pcc_tmp_10; rt_int_init(&pcc_tmp_10);
+    rt_int_set_si(&pcc_tmp_10, 123456789LL);
+    rt_int pcc_tmp_11; rt_int_init(&pcc_tmp_11);
+    rt_int_add(&pcc_tmp_11, &a, &pcc_tmp_10);
+    rt_int b; rt_int_init(&b);
+    rt_int_copy(&b, &pcc_tmp_11);
+    rt_int pcc_tmp_12; rt_int_init(&pcc_tmp_12);
+    rt_int_mul(&pcc_tmp_12, &a, &b);
+    rt_int c; rt_int_init(&c);
+    rt_int_copy(&c, &pcc_tmp_12);
+    rt_int pcc_tmp_13; rt_int_init(&pcc_tmp_13);
+    rt_int_mul(&pcc_tmp_13, &a, &a);
+    rt_int pcc_tmp_14; rt_int_init(&pcc_tmp_14);
+    rt_int_sub(&pcc_tmp_14, &c, &pcc_tmp_13);
+    rt_print_int(&pcc_tmp_14);
+    rt_int_clear(&a);
+    rt_int_clear(&i);
+    rt_int_clear(&b);
+    rt_int_clear(&c);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_gcd(rt_int* out, rt_int* pcc_p_m, rt_int* pcc_p_n);
+static int pcc_fn_gcd_si(int64_t* out, int64_t m, int64_t n);
+
+static const uint32_t pcc_big_0_words[] = {0xce3f0ad2u, 0x8ccff196u, 0x8c37b49cu, 0x3f87a437u, 0xbc1e6217u, 0xaaf504e4u, 0x00000013u};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0x1e5fc5ebu, 0x15b5a63fu, 0x000014eau};
+static rt_int pcc_big_1;
+static const uint32_t pcc_big_2_words[] = {0xdea00007u, 0x35c9adc5u, 0x00000036u};
+static rt_int pcc_big_2;
+static const uint32_t pcc_big_3_words[] = {0x00000000u, 0x5f655680u, 0x8943acc4u, 0xf050fe93u, 0x00000002u};
+static rt_int pcc_big_3;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 7, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 3, 1);
+    rt_int_init(&pcc_big_2); rt_int_from_words(&pcc_big_2, pcc_big_2_words, 3, 1);
+    rt_int_init(&pcc_big_3); rt_int_from_words(&pcc_big_3, pcc_big_3_words, 5, 1);
+}
+
+static int pcc_fn_gcd_si(int64_t* out, int64_t m, int64_t n) {
+    int64_t u = 0;
+    int64_t v = 0;
+    int64_t t = 0;
+    u = m;
+    v = n;
+    for (;;) {
+    if (!(v != 0LL)) break;
+    int64_t pcc_tmp_1;
+    if (v == 0 || (v == -1 && u == INT64_MIN)) return 0;
+    pcc_tmp_1 = rt_math_mod_si(u, v);
+    t = pcc_tmp_1;
+    u = v;
+    v = t;
+    }
+    *out = u;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_gcd(rt_int* out, rt_int* pcc_p_m, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_m, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_m, &pcc_si_m) == RT_OK && rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_gcd_si(&pcc_si_out, pcc_si_m, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int m; rt_int_init(&m);
+    rt_int_copy(&m, pcc_p_m);
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int u; rt_int_init(&u);
+    rt_int v; rt_int_init(&v);
+    rt_int t; rt_int_init(&t);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&u, &m);
+    rt_int_copy(&v, &n);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&v, 0LL);
+    if (!((pcc_tmp_1 != 0))) goto while_end_2;
+    rt_int_mod(&t, &u, &v);
+    rt_int_copy(&u, &v);
+    rt_int_copy(&v, &t);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &u);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&u);
+    rt_int_clear(&v);
+    rt_int_clear(&t);
+    rt_int_clear(&m);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int a; rt_int_init(&a);
+    rt_int b; rt_int_init(&b);
+    rt_int x; rt_int_init(&x);
+    rt_int i; rt_int_init(&i);
+    rt_int y; rt_int_init(&y);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&a, &pcc_big_0);
+    rt_int_copy(&b, &pcc_big_1);
+    rt_int_floordiv(&pcc_tmp_1, &a, &b);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_mod(&pcc_tmp_1, &a, &b);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &a);
+    rt_int_floordiv(&pcc_tmp_1, &pcc_tmp_1, &b);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &a);
+    rt_int_mod(&pcc_tmp_1, &pcc_tmp_1, &b);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &b);
+    rt_int_floordiv(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &b);
+    rt_int_mod(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &a);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_sub(&pcc_tmp_2, &pcc_tmp_2, &b);
+    rt_int_floordiv(&pcc_tmp_2, &pcc_tmp_1, &pcc_tmp_2);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_sub(&pcc_tmp_2, &pcc_tmp_2, &a);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &b);
+    rt_int_mod(&pcc_tmp_1, &pcc_tmp_2, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&x, 7LL);
+    rt_int_set_si(&i, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_3 = rt_int_cmp_si(&i, 10LL);
+    if (!((pcc_tmp_3 < 0))) goto while_end_2;
+    rt_int_mul(&x, &x, &x);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_mul(&pcc_tmp_1, &x, &pcc_big_2);
+    rt_int_add_si(&y, &pcc_tmp_1, 12345678901234567LL);
+    rt_int_floordiv(&pcc_tmp_1, &y, &x);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_mod(&pcc_tmp_1, &y, &x);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_mul_si(&pcc_tmp_1, &x, 600851475143LL);
+    rt_int_mul_si(&pcc_tmp_2, &x, 1000000007LL);
+    rt_int_mul_si(&pcc_tmp_2, &pcc_tmp_2, 3LL);
+    pcc_fn_gcd(&pcc_tmp_4, &pcc_tmp_1, &pcc_tmp_2);
+    rt_print_int(&pcc_tmp_4);
+    rt_int_set_si(&pcc_tmp_4, 64LL);
+    pcc_fn_gcd(&pcc_tmp_2, &pcc_big_3, &pcc_tmp_4);
+    rt_print_int(&pcc_tmp_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&b);
+    rt_int_clear(&x);
+    rt_int_clear(&i);
+    rt_int_clear(&y);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_4);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0xffffffffu, 0xffffffffu};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0x89e7ffffu, 0x8ac72304u};
+static rt_int pcc_big_1;
+static const uint32_t pcc_big_2_words[] = {0x00000000u, 0xe4000000u, 0x3eec8920u, 0x37e9f14du, 0xd6057673u, 0x97d4df19u, 0x00000001u};
+static rt_int pcc_big_2;
+static const uint32_t pcc_big_3_words[] = {0x89e80001u, 0x8ac72304u};
+static rt_int pcc_big_3;
+static const uint32_t pcc_big_4_words[] = {0x89e80000u, 0x8ac72304u};
+static rt_int pcc_big_4;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 2, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 2, 1);
+    rt_int_init(&pcc_big_2); rt_int_from_words(&pcc_big_2, pcc_big_2_words, 7, 1);
+    rt_int_init(&pcc_big_3); rt_int_from_words(&pcc_big_3, pcc_big_3_words, 2, 1);
+    rt_int_init(&pcc_big_4); rt_int_from_words(&pcc_big_4, pcc_big_4_words, 2, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int a; rt_int_init(&a);
+    rt_int b; rt_int_init(&b);
+    rt_int pcc_cse_1; rt_int_init(&pcc_cse_1);
+    rt_int c; rt_int_init(&c);
+    rt_int d; rt_int_init(&d);
+    rt_int x; rt_int_init(&x);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&a, &pcc_big_0);
+    rt_int_add_si(&b, &a, 1LL);
+    rt_print_int(&a);
+    rt_print_int(&b);
+    rt_int_mul(&pcc_cse_1, &b, &b);
+    rt_int_sub_si(&pcc_tmp_1, &pcc_cse_1, 1LL);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_add_si(&pcc_tmp_1, &a, 2LL);
+    rt_int_floordiv(&pcc_tmp_1, &pcc_cse_1, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_set_si(&pcc_tmp_2, 4294967297LL);
+    rt_int_mod(&pcc_tmp_2, &pcc_cse_1, &pcc_tmp_2);
+    rt_int_sub(&pcc_tmp_2, &pcc_tmp_1, &pcc_tmp_2);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_copy(&c, &pcc_big_1);
+    rt_int_add_si(&pcc_tmp_2, &c, 1LL);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_mul(&pcc_tmp_2, &c, &c);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_copy(&d, &pcc_big_2);
+    rt_int_sub_si(&pcc_tmp_2, &d, 1LL);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_mul(&pcc_tmp_2, &d, &d);
+    rt_int_add_si(&pcc_tmp_2, &pcc_tmp_2, 7LL);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_floordiv(&pcc_tmp_2, &d, &pcc_big_3);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_set_si(&x, 3LL);
+    rt_int_set_si(&i, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_3 = rt_int_cmp_si(&i, 9LL);
+    if (!((pcc_tmp_3 < 0))) goto while_end_2;
+    rt_int_mul(&x, &x, &x);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_print_int(&x);
+    rt_int_mod(&pcc_tmp_2, &x, &pcc_big_4);
+    rt_print_int(&pcc_tmp_2);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&b);
+    rt_int_clear(&pcc_cse_1);
+    rt_int_clear(&c);
+    rt_int_clear(&d);
+    rt_int_clear(&x);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_fib(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_fib_si(int64_t* out, int64_t n);
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_collatz_si(int64_t* out, int64_t n);
+static void pcc_fn_first_square_over(rt_int* out, rt_int* pcc_p_k);
+
+static const uint32_t pcc_big_0_words[] = {0xa0000000u, 0x6d7217cau, 0x431e0faeu, 0x00000001u};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0xae398115u, 0xaadfa328u, 0x6015fec5u, 0x5ce0e9a5u};
+static rt_int pcc_big_1;
+static rt_str pcc_lit_2;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 4, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 4, 1);
+    pcc_lit_2 = rt_str_intern_static("step", 4);
+}
+
+static int pcc_fn_fib_si(int64_t* out, int64_t n) {
+    if (n < 2LL) {
+    *out = n;
+    return 1;
+    }
+    int64_t pcc_tmp_1;
+    if (rt_si_sub_overflow(n, 1LL, &pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_2;
+    if (!pcc_fn_fib_si(&pcc_tmp_2, pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_3;
+    int64_t pcc_tmp_4;
+    if (rt_si_sub_overflow(n, 2LL, &pcc_tmp_4)) return 0;
+    int64_t pcc_tmp_5;
+    if (!pcc_fn_fib_si(&pcc_tmp_5, pcc_tmp_4)) return 0;
+    if (rt_si_add_overflow(pcc_tmp_2, pcc_tmp_5, &pcc_tmp_3)) return 0;
+    *out = pcc_tmp_3;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_fib(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_fib_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 2LL);
+    if ((pcc_tmp_1 < 0)) {
+    rt_int_copy(out, &n);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_sub_si(&pcc_tmp_2, &n, 1LL);
+    pcc_fn_fib(&pcc_tmp_3, &pcc_tmp_2);
+    rt_int_sub_si(&pcc_tmp_2, &n, 2LL);
+    pcc_fn_fib(&pcc_tmp_4, &pcc_tmp_2);
+    rt_int_add(&pcc_tmp_4, &pcc_tmp_3, &pcc_tmp_4);
+    rt_int_copy(out, &pcc_tmp_4);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&pcc_tmp_4);
+    rt_int_clear(&n);
+}
+
+static int pcc_fn_collatz_si(int64_t* out, int64_t n) {
+    int64_t steps = 0;
+    steps = 0LL;
+    for (;;) {
+    if (!(n != 1LL)) break;
+    if ((n & 1LL) == 0LL) {
+    n = (n >> 1LL);
+    } else {
+    int64_t pcc_tmp_1;
+    if (rt_si_mul_overflow(3LL, n, &pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_2;
+    if (rt_si_add_overflow(pcc_tmp_1, 1LL, &pcc_tmp_2)) return 0;
+    n = pcc_tmp_2;
+    }
+    int64_t pcc_tmp_3;
+    if (rt_si_add_overflow(steps, 1LL, &pcc_tmp_3)) return 0;
+    steps = pcc_tmp_3;
+    if (steps > 1000LL) {
+    *out = -1LL;
+    return 1;
+    }
+    }
+    *out = steps;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_collatz(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_collatz_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int steps; rt_int_init(&steps);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&steps, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 1LL);
+    if (!((pcc_tmp_1 != 0))) goto while_end_2;
+    rt_int_mod_pow2(&pcc_tmp_3, &n, 1);
+    int pcc_tmp_2 = rt_int_cmp_si(&pcc_tmp_3, 0LL);
+    if ((pcc_tmp_2 == 0)) {
+    rt_int_shr(&n, &n, 1);
+    } else {
+    rt_int_mul_si(&pcc_tmp_3, &n, 3LL);
+    rt_int_add_si(&n, &pcc_tmp_3, 1LL);
+    }
+    rt_int_add_si(&steps, &steps, 1LL);
+    int pcc_tmp_4 = rt_int_cmp_si(&steps, 1000LL);
+    if ((pcc_tmp_4 > 0)) {
+    rt_int_set_si(out, -1LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &steps);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&steps);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&n);
+}
+
+static void pcc_fn_first_square_over(rt_int* out, rt_int* pcc_p_k) {
+    rt_int k; rt_int_init(&k);
+    rt_int_copy(&k, pcc_p_k);
+    int64_t i = 0;
+    rt_int big; rt_int_init(&big);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int64_t pcc_ctr_4 = 1LL;
+    int64_t pcc_ctr_4_stop = 1000000LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_mul_si(&big, &pcc_big_0, (i * i));
+    int pcc_tmp_1 = rt_int_cmp(&big, &k);
+    if ((pcc_tmp_1 > 0)) {
+    rt_int_set_si(out, i);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_int_set_si(out, 0LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&big);
+    rt_int_clear(&k);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int t; rt_int_init(&t);
+    int64_t j = 0;
+    rt_str s; rt_str_init(&s);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int64_t pcc_tmp_1;
+    if (pcc_fn_fib_si(&pcc_tmp_1, 20LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_1);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 20LL);
+        pcc_fn_fib(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_2);
+    int64_t pcc_tmp_4;
+    if (pcc_fn_collatz_si(&pcc_tmp_4, 27LL)) {
+        rt_int_set_si(&pcc_tmp_2, pcc_tmp_4);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 27LL);
+        pcc_fn_collatz(&pcc_tmp_2, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_2);
+    pcc_fn_first_square_over(&pcc_tmp_2, &pcc_big_1);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_set_si(&t, 0LL);
+    int64_t pcc_ctr_4 = 0LL;
+    int64_t pcc_ctr_4_stop = 10LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    j = pcc_ctr_4;
+    if ((j == 7LL)) {
+    rt_scope_reset(pcc_scope_5);
+    goto for_end_2;
+    }
+    if (((j & 1LL) == 1LL)) {
+    rt_scope_reset(pcc_scope_5);
+    goto for_continue_3;
+    }
+    rt_str_clear(&s);
+    s = pcc_lit_2;
+    rt_print_str(s);
+    rt_int_add_si(&t, &t, j);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&t);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&t);
+    rt_str_clear(&s);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_horner(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_horner_si(int64_t* out, int64_t n);
+static void pcc_fn_weighted(rt_int* out, rt_int* pcc_p_n);
+static int pcc_fn_weighted_si(int64_t* out, int64_t n);
+
+static const uint32_t pcc_big_0_words[] = {0xdea00000u, 0x35c9adc5u, 0x00000036u};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0x4e3f0ad2u, 0xc373e0eeu, 0x8ee90ff6u, 0x00000001u};
+static rt_int pcc_big_1;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 4, 1);
+}
+
+static int pcc_fn_horner_si(int64_t* out, int64_t n) {
+    int64_t acc = 0;
+    int64_t i = 0;
+    acc = 0LL;
+    i = 0LL;
+    for (;;) {
+    if (!(i < n)) break;
+    int64_t pcc_tmp_1;
+    if (rt_si_mul_overflow(acc, 10LL, &pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_2;
+    if (rt_si_add_overflow(pcc_tmp_1, 7LL, &pcc_tmp_2)) return 0;
+    acc = pcc_tmp_2;
+    int64_t pcc_tmp_3;
+    if (rt_si_add_overflow(i, 1LL, &pcc_tmp_3)) return 0;
+    i = pcc_tmp_3;
+    }
+    *out = acc;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_horner(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_horner_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int acc; rt_int_init(&acc);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&acc, 0LL);
+    rt_int_set_si(&i, 0LL);
+    rt_scope_t pcc_scope_3 = rt_scope_mark();
+    while_start_1:
+    rt_scope_reset(pcc_scope_3);
+    int pcc_tmp_1 = rt_int_cmp(&i, &n);
+    if (!((pcc_tmp_1 < 0))) goto while_end_2;
+    rt_int_mul_si(&pcc_tmp_2, &acc, 10LL);
+    rt_int_add_si(&acc, &pcc_tmp_2, 7LL);
+    rt_int_add_si(&i, &i, 1LL);
+    goto while_start_1;
+    while_end_2:
+    rt_scope_reset(pcc_scope_3);
+    rt_int_copy(out, &acc);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&acc);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&n);
+}
+
+static int pcc_fn_weighted_si(int64_t* out, int64_t n) {
+    int64_t total = 0;
+    int64_t i = 0;
+    total = 0LL;
+    int64_t pcc_tmp_1;
+    if (rt_si_add_overflow(n, 1LL, &pcc_tmp_1)) return 0;
+    int64_t pcc_tmp_2 = 1LL, pcc_tmp_3 = pcc_tmp_1, pcc_tmp_4 = 1LL;
+    if (pcc_tmp_4 == 0) return 0;
+    while (pcc_tmp_4 > 0 ? pcc_tmp_2 < pcc_tmp_3 : pcc_tmp_2 > pcc_tmp_3) {
+    i = pcc_tmp_2;
+    int64_t pcc_tmp_5;
+    int64_t pcc_tmp_6;
+    if (rt_si_mul_overflow(i, 3LL, &pcc_tmp_6)) return 0;
+    if (rt_si_add_overflow(total, pcc_tmp_6, &pcc_tmp_5)) return 0;
+    total = pcc_tmp_5;
+    int64_t pcc_tmp_7;
+    int64_t pcc_tmp_8;
+    if (rt_si_mul_overflow(i, 1000000007LL, &pcc_tmp_8)) return 0;
+    if (rt_si_sub_overflow(total, pcc_tmp_8, &pcc_tmp_7)) return 0;
+    total = pcc_tmp_7;
+    for_next_1:
+    if (rt_si_add_overflow(pcc_tmp_2, pcc_tmp_4, &pcc_tmp_2)) break;
+    }
+    *out = total;
+    return 1;
+    return 0;
+}
+
+static void pcc_fn_weighted(rt_int* out, rt_int* pcc_p_n) {
+    int64_t pcc_si_out, pcc_si_n;
+    if (rt_int_to_si_checked(pcc_p_n, &pcc_si_n) == RT_OK && pcc_fn_weighted_si(&pcc_si_out, pcc_si_n)) {
+        rt_int_set_si(out, pcc_si_out);
+        return;
+    }
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int total; rt_int_init(&total);
+    rt_int i; rt_int_init(&i);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&total, 0LL);
+    rt_int_set_si(&pcc_tmp_1, 1LL);
+    rt_int_copy(&i, &pcc_tmp_1);
+    rt_int_add_si(&pcc_tmp_1, &n, 1LL);
+    rt_int_set_si(&pcc_tmp_2, 1LL);
+    int pcc_tmp_3 = rt_int_cmp(&pcc_tmp_2, &(rt_int){0});
+    rt_scope_t pcc_scope_4 = rt_scope_mark();
+    for_start_1:
+    if (pcc_tmp_3 > 0) {
+        if (rt_int_cmp(&i, &pcc_tmp_1) >= 0) goto for_end_2;
+    } else {
+        if (rt_int_cmp(&i, &pcc_tmp_1) <= 0) goto for_end_2;
+    }
+    rt_int_addmul_si(&total, &i, 3LL);
+    rt_int_addmul_si(&total, &i, -1000000007LL);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_add(&i, &i, &pcc_tmp_2);
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_4);
+    rt_int_copy(out, &total);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&total);
+    rt_int_clear(&i);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int x; rt_int_init(&x);
+    rt_int y; rt_int_init(&y);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&x, &pcc_big_0);
+    rt_int_add_si(&x, &x, 1LL);
+    rt_print_int(&x);
+    rt_int_mul_si(&x, &x, 3LL);
+    rt_print_int(&x);
+    rt_int_sub_si(&x, &x, 5LL);
+    rt_print_int(&x);
+    rt_int_copy(&y, &pcc_big_1);
+    rt_int_addmul_si(&x, &y, 999LL);
+    rt_print_int(&x);
+    rt_int_addmul_si(&x, &y, 7LL);
+    rt_print_int(&x);
+    rt_int_addmul_si(&x, &y, -2LL);
+    rt_print_int(&x);
+    rt_int_set_si(&pcc_tmp_1, 1000000007LL);
+    rt_int_mod(&pcc_tmp_1, &x, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    int64_t pcc_tmp_2;
+    if (pcc_fn_horner_si(&pcc_tmp_2, 25LL)) {
+        rt_int_set_si(&pcc_tmp_1, pcc_tmp_2);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 25LL);
+        pcc_fn_horner(&pcc_tmp_1, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_1);
+    int64_t pcc_tmp_4;
+    if (pcc_fn_weighted_si(&pcc_tmp_4, 100LL)) {
+        rt_int_set_si(&pcc_tmp_1, pcc_tmp_4);
+    } else {
+        rt_int_set_si(&pcc_tmp_3, 100LL);
+        pcc_fn_weighted(&pcc_tmp_1, &pcc_tmp_3);
+    }
+    rt_print_int(&pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&y);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_3);
+    return 0;
+}
\ No newline at end of file
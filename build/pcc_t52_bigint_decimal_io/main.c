@@ -0,0 +1,43 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x4a02386bu, 0x4bdf5bd3u, 0xf2cc528du, 0xf7b97e28u, 0xc2947b75u, 0x5e7ec7b9u, 0x60217092u, 0x02d3a28fu, 0x49572788u, 0xf01b8a39u, 0x57e8f8dcu, 0xdb590cd4u, 0x03bfb03au, 0x1594162cu, 0xba3d21dau, 0xf2e83c48u, 0x8c27112cu, 0x9a480a3bu, 0xc81e5189u, 0xda4c4c6bu, 0xe8cb18d1u, 0x4ca5d4e7u, 0xb688d985u, 0xc54d030bu, 0x8b3a3e8bu, 0xcdc66f05u, 0x59f70cd2u, 0xb2cb3437u, 0x32208ec1u, 0x123ed3d4u, 0x170350b5u, 0xa5c77d0cu, 0xbc906c75u, 0x25ecacebu, 0x28687f67u, 0x3d81bdfbu, 0x12e8a775u, 0xd0075e93u, 0x45a64caau, 0xa4f21271u, 0x14acf9d4u, 0x6c20ae98u, 0x3e7d73f1u, 0x2f34c58du, 0xc4c89864u, 0x0629ca54u, 0xb1feadbau, 0x5b059a19u, 0xd7f3aa02u, 0x8989e1bau, 0xe90f3359u, 0xd011ac89u, 0x453aef8eu, 0x1e996307u, 0x815464c7u, 0x0d8ba3c0u, 0x573ee2d2u, 0x301f4a81u, 0xd75120bfu, 0x2935a9e6u, 0x259727abu, 0x3f477831u, 0x9c756236u, 0x15c50473u, 0xfdb0b7d3u, 0xec304db6u, 0xfc00d67bu, 0xa09b2b67u, 0xa7210c78u, 0x894efeb2u, 0x90d57ab5u, 0x7d4f8fdau, 0x43ea209bu, 0xe7e0faceu, 0x661362b9u, 0xb7f16f9au, 0x7fd454f5u, 0xb8c165ebu, 0xb801bc92u, 0x061ffd92u, 0x15085587u, 0xf8b67f8fu, 0xf1df33beu, 0x06a84058u, 0x9727ce11u, 0x3fb180e9u, 0x511975a5u, 0xc8ad48fcu, 0x36f25ec6u, 0xaf2e3ffcu, 0x9406a551u, 0x5f26d36au, 0x1095b080u, 0xf3d5b189u, 0xb0f85a29u, 0x6f9aab0cu, 0x3ada4583u, 0x467a0cbau, 0x964e7183u, 0x81b851fbu, 0xd3a5dc24u, 0x86f645bdu, 0x498d8d6au, 0x695a0ca8u, 0xa2d75ef5u, 0xd16e0b48u, 0xe46793b7u, 0x3ebca4c1u, 0x920e0b2bu, 0xe1daf7c6u, 0x48439b37u, 0x3f260067u, 0x00cdf024u, 0x05908df3u, 0xe652a66cu, 0x8aafec4cu, 0x3893de9du, 0x29fae868u, 0xb382f6dcu, 0x459366dcu, 0x577a4a4au, 0xd16c073fu, 0x8b8a2faeu, 0x434402cau, 0xe42e4d88u, 0x914a0bceu, 0xd6267a4eu, 0x5bed6cf5u, 0x2fd5761au, 0xee0a1e4fu, 0xacfb550du, 0xdabc8464u, 0x9183654fu, 0x4ad63436u, 0x08de14a2u, 0xd506745fu, 0x698c2c72u, 0x95e4a56au, 0x0235bdadu, 0xbf66799bu, 0xe01ca6aeu, 0xa6417aa0u, 0xfc15c9bdu, 0xce4b64dbu, 0x9f77f50eu, 0x0000036au};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0fffffffu, 0xfda67a39u, 0xc5e2a0b1u, 0x0d8fdbfcu, 0xe2305c7au, 0x6cbb4abeu, 0x90d35051u, 0x8e559f6cu, 0xcd83584cu, 0xd7c82b0bu, 0x7d805ab7u, 0x65cdd454u, 0xecbbc37du, 0xa161ab5au, 0xbf0e4f1du, 0xe0b736a4u, 0x15c5653bu, 0xec519cc2u, 0x36f85228u, 0xcbfb9b9bu, 0x30c97fd7u, 0x32dd37a5u, 0x8eaa4a0eu, 0x93105b6eu, 0xc23a059au, 0x1b4dcbcfu, 0xe10098c7u, 0x756fa143u, 0x9c785e71u, 0x15fe5179u, 0x88c16b21u, 0xd63b7a9eu, 0x0533de95u, 0x83fe771cu, 0xeb6280d1u, 0x9216275fu, 0x2e9dd039u, 0x8afbab1eu, 0xa93a2431u, 0xa7ef7551u, 0x20c9dcb8u, 0x3cb6cf87u, 0xa2a2aba9u, 0x24c05f7eu, 0x94b32cb5u, 0xfbf7f62eu, 0x77c12b71u, 0x1220a59au, 0xf2ee913bu, 0x63dd1e28u, 0x673e9412u, 0x0028c6c9u};
+static rt_int pcc_big_1;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 146, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 73, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int a; rt_int_init(&a);
+    rt_int b; rt_int_init(&b);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&a, &pcc_big_0);
+    rt_int_copy(&b, &pcc_big_1);
+    rt_print_int(&a);
+    rt_print_int(&b);
+    rt_int_add_si(&pcc_tmp_1, &b, 1LL);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_mul_si(&pcc_tmp_1, &b, 1000LL);
+    rt_int_sub(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 1000000007LL);
+    rt_int_mod(&pcc_tmp_1, &a, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &a);
+    rt_print_int(&pcc_tmp_1);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&a);
+    rt_int_clear(&b);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
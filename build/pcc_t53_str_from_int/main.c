@@ -0,0 +1,89 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0x4e3f0ad2u, 0xc373e0eeu, 0x8ee90ff6u, 0x00000001u};
+static rt_int pcc_big_0;
+static rt_str pcc_lit_1;
+static rt_str pcc_lit_2;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 4, 1);
+    pcc_lit_1 = rt_str_intern_static("0", 1);
+    pcc_lit_2 = rt_str_intern_static("", 0);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int big; rt_int_init(&big);
+    rt_str s; rt_str_init(&s);
+    rt_str row; rt_str_init(&row);
+    int64_t i = 0;
+    rt_int power; rt_int_init(&power);
+    rt_str digits; rt_str_init(&digits);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&big, &pcc_big_0);
+    rt_str pcc_tmp_1 = rt_str_from_int(&big); rt_scope_str(&pcc_tmp_1);
+    rt_print_str(pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_2, 0LL);
+    rt_int_sub(&pcc_tmp_2, &pcc_tmp_2, &big);
+    rt_str pcc_tmp_3 = rt_str_from_int(&pcc_tmp_2); rt_scope_str(&pcc_tmp_3);
+    rt_print_str(pcc_tmp_3);
+    rt_print_str(pcc_lit_1);
+    rt_str pcc_tmp_4 = rt_str_null(); rt_scope_str(&pcc_tmp_4);
+    rt_int_mul(&pcc_tmp_2, &big, &big);
+    rt_strbuf_reserve(&pcc_tmp_4, 8 + rt_int_to_buffer_size(&pcc_tmp_2));
+    rt_strbuf_append_bytes(&pcc_tmp_4, "big*big=", 8);
+    rt_strbuf_append_int(&pcc_tmp_4, &pcc_tmp_2);
+    rt_str_clear(&s);
+    s = pcc_tmp_4; rt_str_init(&pcc_tmp_4);
+    rt_print_str(s);
+    rt_str_clear(&row);
+    row = pcc_lit_2;
+    int64_t pcc_ctr_4 = 1LL;
+    int64_t pcc_ctr_4_stop = 8LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_mul_si(&pcc_tmp_2, &big, i);
+    rt_strbuf_reserve(&row, rt_int_to_buffer_size(&pcc_tmp_2) + 1);
+    rt_strbuf_append_int(&row, &pcc_tmp_2);
+    rt_strbuf_append_bytes(&row, ",", 1);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_str(row);
+    rt_int_set_si(&power, 1LL);
+    int64_t pcc_ctr_9 = 0LL;
+    int64_t pcc_ctr_9_stop = 60LL;
+    rt_scope_t pcc_scope_10 = rt_scope_mark();
+    for_start_6:
+    if (!(pcc_ctr_9 < pcc_ctr_9_stop)) goto for_end_7;
+    i = pcc_ctr_9;
+    rt_int_mul_si(&power, &power, 1000LL);
+    for_continue_8:
+    rt_scope_reset(pcc_scope_10);
+    pcc_ctr_9 += 1LL;
+    goto for_start_6;
+    for_end_7:
+    rt_scope_reset(pcc_scope_10);
+    rt_str pcc_tmp_5 = rt_str_from_int(&power); rt_scope_str(&pcc_tmp_5);
+    rt_str_clear(&digits);
+    digits = pcc_tmp_5; rt_str_init(&pcc_tmp_5);
+    rt_print_si((int64_t)rt_str_len(&digits));
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&big);
+    rt_str_clear(&s);
+    rt_str_clear(&row);
+    rt_int_clear(&power);
+    rt_str_clear(&digits);
+    rt_int_clear(&pcc_tmp_2);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static const uint32_t pcc_big_0_words[] = {0xffffffffu, 0xffffffffu, 0xffffffffu, 0x7fffffffu};
+static rt_int pcc_big_0;
+static const uint32_t pcc_big_1_words[] = {0xdea00000u, 0x35c9adc5u, 0x00000036u};
+static rt_int pcc_big_1;
+static const uint32_t pcc_big_2_words[] = {0x0df36a83u, 0xb14e9f9bu, 0x00000006u};
+static rt_int pcc_big_2;
+
+static void pcc_init_literals(void) {
+    rt_int_init(&pcc_big_0); rt_int_from_words(&pcc_big_0, pcc_big_0_words, 4, 1);
+    rt_int_init(&pcc_big_1); rt_int_from_words(&pcc_big_1, pcc_big_1_words, 3, 1);
+    rt_int_init(&pcc_big_2); rt_int_from_words(&pcc_big_2, pcc_big_2_words, 3, 1);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_int p; rt_int_init(&p);
+    rt_int m; rt_int_init(&m);
+    rt_int x; rt_int_init(&x);
+    int64_t i = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_int pcc_tmp_4; rt_int_init(&pcc_tmp_4);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_copy(&p, &pcc_big_0);
+    rt_int_set_si(&pcc_tmp_1, 3LL);
+    rt_int_sub_si(&pcc_tmp_2, &p, 1LL);
+    rt_math_powmod(&pcc_tmp_3, &pcc_tmp_1, &pcc_tmp_2, &p);
+    rt_print_int(&pcc_tmp_3);
+    rt_int_set_si(&pcc_tmp_3, 2LL);
+    rt_math_powmod(&pcc_tmp_2, &pcc_tmp_3, &p, &p);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_copy(&m, &pcc_big_1);
+    rt_int_set_si(&pcc_tmp_2, 7LL);
+    rt_int_mul(&pcc_tmp_3, &m, &m);
+    rt_int_mul(&pcc_tmp_3, &pcc_tmp_3, &m);
+    rt_math_powmod(&pcc_tmp_1, &pcc_tmp_2, &pcc_tmp_3, &m);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&pcc_tmp_1, 1000003LL);
+    rt_int_add_si(&pcc_tmp_3, &m, 7LL);
+    rt_math_powmod(&pcc_tmp_2, &pcc_big_2, &pcc_tmp_1, &pcc_tmp_3);
+    rt_print_int(&pcc_tmp_2);
+    rt_int_set_si(&pcc_tmp_2, -5LL);
+    rt_int_set_si(&pcc_tmp_3, 77LL);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_int_sub(&pcc_tmp_1, &pcc_tmp_1, &m);
+    rt_int_sub_si(&pcc_tmp_1, &pcc_tmp_1, 7LL);
+    rt_math_powmod(&pcc_tmp_4, &pcc_tmp_2, &pcc_tmp_3, &pcc_tmp_1);
+    rt_print_int(&pcc_tmp_4);
+    rt_int_set_si(&pcc_tmp_4, 12345LL);
+    rt_int_set_si(&pcc_tmp_1, 0LL);
+    rt_math_powmod(&pcc_tmp_3, &pcc_tmp_4, &pcc_tmp_1, &p);
+    rt_print_int(&pcc_tmp_3);
+    rt_int_set_si(&x, 1LL);
+    int64_t pcc_ctr_4 = 1LL;
+    int64_t pcc_ctr_4_stop = 6LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_mul_si(&pcc_tmp_3, &x, 10LL);
+    rt_int_add_si(&pcc_tmp_3, &pcc_tmp_3, i);
+    rt_int_set_si(&pcc_tmp_1, (i * 1000LL));
+    rt_math_powmod(&pcc_tmp_4, &pcc_tmp_3, &pcc_tmp_1, &p);
+    rt_int_swap(&x, &pcc_tmp_4);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&x);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&p);
+    rt_int_clear(&m);
+    rt_int_clear(&x);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&pcc_tmp_4);
+    return 0;
+}
\ No newline at end of file
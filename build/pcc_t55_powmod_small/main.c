@@ -0,0 +1,90 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+static void pcc_fn_is_probable_prime(rt_int* out, rt_int* pcc_p_n);
+
+static void pcc_fn_is_probable_prime(rt_int* out, rt_int* pcc_p_n) {
+    rt_int n; rt_int_init(&n);
+    rt_int_copy(&n, pcc_p_n);
+    rt_int pcc_licm_1; rt_int_init(&pcc_licm_1);
+    int64_t a = 0;
+    rt_int pcc_tmp_3; rt_int_init(&pcc_tmp_3);
+    rt_int pcc_tmp_5; rt_int_init(&pcc_tmp_5);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    int pcc_tmp_1 = rt_int_cmp_si(&n, 2LL);
+    if ((pcc_tmp_1 < 0)) {
+    rt_int_set_si(out, 0LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    rt_int_sub_si(&pcc_licm_1, &n, 1LL);
+    int64_t pcc_ctr_4 = 2LL;
+    int64_t pcc_ctr_4_stop = 8LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    a = pcc_ctr_4;
+    rt_int_set_si(&pcc_tmp_3, a);
+    rt_int_mod(&pcc_tmp_3, &pcc_tmp_3, &n);
+    int pcc_tmp_2 = rt_int_cmp_si(&pcc_tmp_3, 0LL);
+    if ((pcc_tmp_2 != 0)) {
+    rt_int_set_si(&pcc_tmp_3, a);
+    rt_math_powmod(&pcc_tmp_5, &pcc_tmp_3, &pcc_licm_1, &n);
+    int pcc_tmp_4 = rt_int_cmp_si(&pcc_tmp_5, 1LL);
+    if ((pcc_tmp_4 != 0)) {
+    rt_int_set_si(out, 0LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    }
+    }
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_int_set_si(out, 1LL);
+    rt_scope_reset(pcc_scope);
+    goto pcc_exit;
+    pcc_exit:
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&pcc_licm_1);
+    rt_int_clear(&pcc_tmp_3);
+    rt_int_clear(&pcc_tmp_5);
+    rt_int_clear(&n);
+}
+
+int main(void) {
+    rt_int count; rt_int_init(&count);
+    int64_t n = 0;
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_int pcc_tmp_2; rt_int_init(&pcc_tmp_2);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&count, 0LL);
+    int64_t pcc_ctr_4 = 2LL;
+    int64_t pcc_ctr_4_stop = 2000LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    n = pcc_ctr_4;
+    rt_int_set_si(&pcc_tmp_1, n);
+    pcc_fn_is_probable_prime(&pcc_tmp_2, &pcc_tmp_1);
+    rt_int_add(&count, &count, &pcc_tmp_2);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&count);
+    rt_print_si(652541198LL);
+    rt_print_si(2LL);
+    rt_print_si(-2LL);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&count);
+    rt_int_clear(&pcc_tmp_1);
+    rt_int_clear(&pcc_tmp_2);
+    return 0;
+}
\ No newline at end of file
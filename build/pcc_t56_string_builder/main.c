@@ -0,0 +1,86 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+static rt_str pcc_lit_0;
+
+static void pcc_init_literals(void) {
+    pcc_lit_0 = rt_str_intern_static("", 0);
+}
+
+int main(void) {
+    pcc_init_literals();
+    rt_str s; rt_str_init(&s);
+    int64_t i = 0;
+    rt_str label; rt_str_init(&label);
+    rt_str t; rt_str_init(&t);
+    rt_str w; rt_str_init(&w);
+    rt_int n; rt_int_init(&n);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_str_clear(&s);
+    s = pcc_lit_0;
+    int64_t pcc_ctr_4 = 0LL;
+    int64_t pcc_ctr_4_stop = 12LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_strbuf_reserve(&s, 20 + 1);
+    rt_strbuf_append_si(&s, i);
+    rt_strbuf_append_bytes(&s, ",", 1);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_str(s);
+    rt_str pcc_tmp_1 = rt_str_null(); rt_scope_str(&pcc_tmp_1);
+    rt_strbuf_reserve(&pcc_tmp_1, 4 + 20 + 6 + 2 + 1);
+    rt_strbuf_append_bytes(&pcc_tmp_1, "len=", 4);
+    rt_strbuf_append_si(&pcc_tmp_1, (int64_t)rt_str_len(&s));
+    rt_strbuf_append_bytes(&pcc_tmp_1, " last=", 6);
+    rt_strbuf_append_bytes(&pcc_tmp_1, "11", 2);
+    rt_strbuf_append_bytes(&pcc_tmp_1, "!", 1);
+    rt_str_clear(&label);
+    label = pcc_tmp_1; rt_str_init(&pcc_tmp_1);
+    rt_print_str(label);
+    rt_str pcc_tmp_2 = rt_str_null(); rt_scope_str(&pcc_tmp_2);
+    rt_strbuf_reserve(&pcc_tmp_2, s.len + 1 + s.len);
+    rt_strbuf_append(&pcc_tmp_2, s);
+    rt_strbuf_append_bytes(&pcc_tmp_2, "|", 1);
+    rt_strbuf_append(&pcc_tmp_2, s);
+    rt_str_clear(&s);
+    s = pcc_tmp_2; rt_str_init(&pcc_tmp_2);
+    rt_print_str(s);
+    rt_str_clear(&t);
+    t = rt_str_share(s);
+    rt_strbuf_reserve(&s, 4);
+    rt_strbuf_append_bytes(&s, "tail", 4);
+    rt_print_str(t);
+    rt_print_str(s);
+    rt_str_clear(&w);
+    w = pcc_lit_0;
+    rt_int_set_si(&n, 0LL);
+    rt_scope_t pcc_scope_8 = rt_scope_mark();
+    while_start_6:
+    rt_scope_reset(pcc_scope_8);
+    int pcc_tmp_3 = rt_int_cmp_si(&n, 300LL);
+    if (!((pcc_tmp_3 < 0))) goto while_end_7;
+    rt_strbuf_reserve(&w, 2);
+    rt_strbuf_append_bytes(&w, "ab", 2);
+    rt_int_add_si(&n, &n, 1LL);
+    goto while_start_6;
+    while_end_7:
+    rt_scope_reset(pcc_scope_8);
+    rt_print_si((int64_t)rt_str_len(&w));
+    rt_scope_reset(pcc_scope);
+    rt_str_clear(&s);
+    rt_str_clear(&label);
+    rt_str_clear(&t);
+    rt_str_clear(&w);
+    rt_int_clear(&n);
+    return 0;
+}
\ No newline at end of file
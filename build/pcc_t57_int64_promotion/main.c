@@ -0,0 +1,65 @@
+// Generated by pcc MVP with BigInt support
+#include <stdio.h>
+#include <stdlib.h>
+#include "runtime.h"
+
+
+int main(void) {
+    rt_int x; rt_int_init(&x);
+    int64_t big = 0;
+    rt_int p; rt_int_init(&p);
+    int64_t i = 0;
+    rt_int s; rt_int_init(&s);
+    rt_int pcc_tmp_1; rt_int_init(&pcc_tmp_1);
+    rt_scope_t pcc_scope = rt_scope_mark();
+    rt_int_set_si(&x, 3037000499LL);
+    rt_int_mul(&pcc_tmp_1, &x, &x);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_add_si(&x, &x, 1LL);
+    rt_int_mul(&pcc_tmp_1, &x, &x);
+    rt_print_int(&pcc_tmp_1);
+    big = 9223372036854775807LL;
+    rt_int_set_si_add(&pcc_tmp_1, big, 1LL);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si_sub(&pcc_tmp_1, (0LL - big), 2LL);
+    rt_print_int(&pcc_tmp_1);
+    rt_int_set_si(&p, 1LL);
+    int64_t pcc_ctr_4 = 1LL;
+    int64_t pcc_ctr_4_stop = 26LL;
+    rt_scope_t pcc_scope_5 = rt_scope_mark();
+    for_start_1:
+    if (!(pcc_ctr_4 < pcc_ctr_4_stop)) goto for_end_2;
+    i = pcc_ctr_4;
+    rt_int_mul_si(&p, &p, i);
+    for_continue_3:
+    rt_scope_reset(pcc_scope_5);
+    pcc_ctr_4 += 1LL;
+    goto for_start_1;
+    for_end_2:
+    rt_scope_reset(pcc_scope_5);
+    rt_print_int(&p);
+    rt_int_set_si(&s, 0LL);
+    int64_t pcc_ctr_9 = 10LL;
+    int64_t pcc_ctr_9_stop = 0LL;
+    rt_scope_t pcc_scope_10 = rt_scope_mark();
+    for_start_6:
+    if (!(pcc_ctr_9 > pcc_ctr_9_stop)) goto for_end_7;
+    i = pcc_ctr_9;
+    rt_int_add_si(&pcc_tmp_1, &s, (i >> 2LL));
+    rt_int_sub_si(&s, &pcc_tmp_1, (i & 3LL));
+    for_continue_8:
+    rt_scope_reset(pcc_scope_10);
+    pcc_ctr_9 += -3LL;
+    goto for_start_6;
+    for_end_7:
+    rt_scope_reset(pcc_scope_10);
+    rt_print_int(&s);
+    rt_print_si(-4LL);
+    rt_print_si(2LL);
+    rt_scope_reset(pcc_scope);
+    rt_int_clear(&x);
+    rt_int_clear(&p);
+    rt_int_clear(&s);
+    rt_int_clear(&pcc_tmp_1);
+    return 0;
+}
\ No newline at end of file
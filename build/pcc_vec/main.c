@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "runtime.h"
+
+long long pcc_fn_sum_squares(long long n);
+long long pcc_fn_count_odd(long long n);
+
+long long pcc_fn_sum_squares(long long n) {
+    long long s = 0LL;
+    long long i = 0LL;
+for_start_1:
+    if (1LL > 0) {
+        if (i >= n) goto for_end_2;
+    } else {
+        if (i <= n) goto for_end_2;
+    }
+    long long pcc_tmp_1;
+    pcc_tmp_1 = i * i;
+    long long pcc_tmp_2;
+    pcc_tmp_2 = s + pcc_tmp_1;
+    s = pcc_tmp_2;
+for_continue_3:
+    i += 1LL;
+    goto for_start_1;
+for_end_2:
+    return s;
+    return 0;
+}
+
+long long pcc_fn_count_odd(long long n) {
+    long long c = 0LL;
+    long long i = 0LL;
+for_start_4:
+    if (1LL > 0) {
+        if (i >= n) goto for_end_5;
+    } else {
+        if (i <= n) goto for_end_5;
+    }
+    long long pcc_tmp_3;
+    pcc_tmp_3 = i & 1LL;
+    int pcc_tmp_4 = (pcc_tmp_3 == 1LL);
+    if ((pcc_tmp_4 != 0)) {
+    long long pcc_tmp_5;
+    pcc_tmp_5 = c + 1LL;
+    c = pcc_tmp_5;
+    }
+for_continue_6:
+    i += 1LL;
+    goto for_start_4;
+for_end_5:
+    return c;
+    return 0;
+}
+
+int main(void) {
+    long long pcc_tmp_6 = pcc_fn_sum_squares(100000LL);
+    printf("%lld\n", pcc_tmp_6);
+    long long pcc_tmp_7 = pcc_fn_count_odd(1000LL);
+    printf("%lld\n", pcc_tmp_7);
+    return 0;
+}
\ No newline at end of file
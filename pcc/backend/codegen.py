@@ -6,13 +6,15 @@ C source code that uses the runtime library for BigInt and string operations.
 """
 
 from dataclasses import dataclass
-from typing import List, Dict, Optional, Set, Tuple
+from typing import List, Dict, Optional, Set, Tuple, Union
 
 from ..ir import (
     ModuleIR, FunctionDef, ClassDef, Stmt, Expr,
     IntConst, StrConst, Var, BinOp, CmpOp, Call, AttributeAccess, MethodCall, ConstructorCall, BuiltinCall,
     Assign, AttrAssign, MethodCallStmt, Print, If, While, ForRange, Return, Break, Continue
 )
+from ..ir.ranges import RangeInfo, Interval, infer_ranges, for_range_counter, for_range_var
+from ..ir.parallel import ParallelLoop, find_parallel_loops, pure_functions
 
 
 @dataclass(frozen=True)
@@ -29,13 +31,72 @@ class _CodegenState:
     """Internal state for code generation.
 
     Tracks temporary variable and label counters to generate unique names,
-    and tracks the types of temporaries.
+    the types of temporaries, and the BigInt/string locals of the function
+    being emitted. Locals are declared once at the top of the function so
+    that loops and early returns never skip or repeat their initialization.
+    With range inference, integer variables proven to fit in 64 bits are
+    int64_t locals instead of BigInts.
+
+    BigInt temporaries come from a per-function pool, declared and cleared
+    like the locals. A temporary is live from the point it is taken until
+    its value is consumed, or at the latest until the statement that took
+    it ends; it then returns to the pool, so a later expression reuses it
+    together with its limb buffer instead of allocating a new one.
+
+    With --parallel, the independent range() loops of the body are emitted
+    as worker functions over chunks of the range, collected module-wide.
     """
 
-    def __init__(self) -> None:
+    def __init__(self, params: Optional[List[str]] = None,
+                 literals: Optional[Dict[Union[str, int], str]] = None,
+                 ranges: Optional[RangeInfo] = None,
+                 native_fns: Optional[Set[str]] = None,
+                 parallel: Optional[Dict[int, ParallelLoop]] = None,
+                 workers: Optional[List[List[str]]] = None) -> None:
         self.temp_counter = 0
         self.label_counter = 0
         self.temp_types: Dict[str, str] = {}  # temp_name -> type ("rt_int" or "rt_str")
+        self.params: Set[str] = set(params or [])
+        self.locals: Dict[str, str] = {}  # local name -> type, in declaration order
+        self.scoped_temps = 0  # string temporaries registered with rt_scope_* so far
+        self.uses_exit = False  # whether a return jumps to the exit label
+        self.literals = literals if literals is not None else {}  # string or big int -> name, module-wide
+        self.ranges = ranges  # native integer variables, or None without range inference
+        self.native_fns = native_fns or set()  # functions with an int64_t entry point
+        self.int_temps: List[str] = []  # pooled BigInt temporaries, in declaration order
+        self.free_int_temps: List[str] = []  # dead pooled temporaries, reused last-freed first
+        self.live_int_temps: Dict[str, int] = {}  # live temporary -> sequence number when taken
+        self.temp_seq = 0
+        self.parallel = parallel or {}  # id() of a parallel ForRange -> its analysis
+        self.workers = workers if workers is not None else []  # worker functions, module-wide
+
+    def literal(self, value: str) -> str:
+        """Get the interned module-level constant holding a string literal."""
+        if value not in self.literals:
+            self.literals[value] = f"pcc_lit_{len(self.literals)}"
+        return self.literals[value]
+
+    def big_int(self, value: int) -> str:
+        """Get the module-level constant holding an integer beyond int64_t."""
+        if value not in self.literals:
+            self.literals[value] = f"pcc_big_{len(self.literals)}"
+        return self.literals[value]
+
+    def declare_local(self, name: str, ctype: str) -> None:
+        """Record a local variable to be declared at function entry.
+
+        Args:
+            name: Variable name
+            ctype: The C type ("rt_int", "rt_str" or "int64_t")
+
+        Raises:
+            ValueError: If the variable was already declared with another type
+        """
+        prev = "rt_int" if name in self.params else self.locals.get(name)
+        if prev is None:
+            self.locals[name] = ctype
+        elif prev != ctype:
+            raise ValueError(f"Variable '{name}' is assigned both {prev} and {ctype} values")
 
     def next_temp(self, type_hint: str = "rt_int") -> str:
         """Generate a unique temporary variable name.
@@ -51,6 +112,44 @@ class _CodegenState:
         self.temp_types[temp_name] = type_hint
         return temp_name
 
+    def take_int_temp(self) -> str:
+        """Take a BigInt temporary from the pool, growing it if none is free.
+
+        Returns:
+            str: The temporary's name; it holds a stale value until written
+        """
+        if self.free_int_temps:
+            temp = self.free_int_temps.pop()
+        else:
+            temp = self.next_temp()
+            self.int_temps.append(temp)
+        self.live_int_temps[temp] = self.temp_seq
+        self.temp_seq += 1
+        return temp
+
+    def temp_mark(self) -> int:
+        """Mark the pool: temporaries taken after the mark are released with it."""
+        return self.temp_seq
+
+    def release_temps(self, mark: int) -> None:
+        """Return every temporary still live that was taken after a mark."""
+        for temp, seq in list(self.live_int_temps.items()):
+            if seq >= mark:
+                del self.live_int_temps[temp]
+                self.free_int_temps.append(temp)
+
+    def release_results(self, *results: str) -> None:
+        """Return the temporaries behind consumed expression results.
+
+        Results that are not pooled temporaries (variables, fields, strings)
+        are ignored.
+        """
+        for result in results:
+            temp = result[1:] if result.startswith("&") else result
+            if temp in self.live_int_temps:
+                del self.live_int_temps[temp]
+                self.free_int_temps.append(temp)
+
     def get_temp_type(self, temp_name: str) -> str:
         """Get the type of a temporary variable.
 
@@ -75,6 +174,36 @@ class _CodegenState:
         return f"{prefix}_{self.label_counter}"
 
 
+# Scope mark taken at function entry and the label all returns jump to
+_FN_SCOPE = "pcc_scope"
+_FN_EXIT = "pcc_exit"
+
+
+def _c_string_literal(value: str) -> str:
+    """Quote a Python string as a C string literal."""
+    escaped = value.replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n').replace('\t', '\\t')
+    return f'"{escaped}"'
+
+
+def _declare_str_temp(lines: List[str], state: _CodegenState, temp: str, init: str) -> None:
+    """Declare a string temporary owned by the innermost temporary scope."""
+    lines.append(f"    rt_str {temp} = {init}; rt_scope_str(&{temp});")
+    state.scoped_temps += 1
+
+
+def _hold_int(result: str, lines: List[str], state: _CodegenState) -> str:
+    """Get a pooled temporary holding an integer result for later statements.
+
+    A result already in a pooled temporary is kept as is; a variable or
+    field, which the loop body may reassign, is copied into a fresh one.
+    """
+    if result.startswith("&") and result[1:] in state.live_int_temps:
+        return result[1:]
+    temp = state.take_int_temp()
+    lines.append(f"    rt_int_copy(&{temp}, {result});")
+    return temp
+
+
 def _ctype_for_var(name: str, var_types: Dict[str, str]) -> str:
     """Get the C type for a variable.
 
@@ -105,6 +234,8 @@ def _expr_produces_string(expr: Expr, var_types: Dict[str, str]) -> bool:
         return True
     if isinstance(expr, Var):
         return var_types.get(expr.name) == "rt_str"
+    if isinstance(expr, BuiltinCall):
+        return expr.name == "str"
     if isinstance(expr, BinOp) and expr.op == "+":
         # String concatenation: both operands must be strings
         left_is_str = _expr_produces_string(expr.left, var_types)
@@ -113,6 +244,68 @@ def _expr_produces_string(expr: Expr, var_types: Dict[str, str]) -> bool:
     return False
 
 
+def _concat_parts(expr: Expr, var_types: Dict[str, str]) -> List[Expr]:
+    """Flatten a chain of string concatenations into its operands, in order.
+
+    a + b + c + d parses as ((a + b) + c) + d; building it pairwise would
+    allocate and copy every intermediate result.
+    """
+    if isinstance(expr, BinOp) and expr.op == "+" and _expr_produces_string(expr, var_types):
+        return _concat_parts(expr.left, var_types) + _concat_parts(expr.right, var_types)
+    return [expr]
+
+
+def _match_str_append(name: str, expr: Expr, var_types: Dict[str, str]) -> Optional[List[Expr]]:
+    """Match `s = s + x + ...` on a string variable s.
+
+    Returns the operands to append to s in place, or None. s must not
+    appear again on the right, since appending changes it before the
+    later operand is read.
+    """
+    if var_types.get(name) != "rt_str":
+        return None
+    parts = _concat_parts(expr, var_types)
+    if len(parts) < 2 or parts[0] != Var(name) or Var(name) in parts[1:]:
+        return None
+    return parts[1:]
+
+
+def _emit_concat_into(
+    target: str,
+    parts: List[Expr],
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> None:
+    """Append the concatenation of parts to the string builder target.
+
+    Every operand is evaluated first, so the final size is reserved once
+    before any byte is copied. Literals are appended as bytes and str(n)
+    is formatted straight into the builder, so neither needs a temporary.
+    """
+    pieces = []
+    for part in parts:
+        if isinstance(part, StrConst):
+            size = len(part.value.encode("utf-8"))
+            pieces.append((f"rt_strbuf_append_bytes(&{target}, {_c_string_literal(part.value)}, {size});",
+                           str(size)))
+        elif isinstance(part, BuiltinCall) and part.name == "str" \
+                and _native_range(part.args[0], state) is not None:
+            arg = _emit_native(part.args[0], lines, state, var_types, fn_sigs)
+            pieces.append((f"rt_strbuf_append_si(&{target}, {arg});", "20"))
+        elif isinstance(part, BuiltinCall) and part.name == "str":
+            arg = _emit_expr(part.args[0], lines, state, var_types, fn_sigs)
+            pieces.append((f"rt_strbuf_append_int(&{target}, {arg});", f"rt_int_to_buffer_size({arg})"))
+        else:
+            value = _emit_expr(part, lines, state, var_types, fn_sigs)
+            pieces.append((f"rt_strbuf_append(&{target}, {value});", f"{value}.len"))
+
+    lines.append(f"    rt_strbuf_reserve(&{target}, {' + '.join(size for _, size in pieces)});")
+    for append, _ in pieces:
+        lines.append(f"    {append}")
+
+
 def _emit_expr(
     expr: Expr,
     lines: List[str],
@@ -132,23 +325,25 @@ def _emit_expr(
     Returns:
         str: C expression string representing the result
     """
+    if _native_range(expr, state) is not None:
+        # Computed natively; widened to a BigInt only for this use
+        value = _emit_native(expr, lines, state, var_types, fn_sigs)
+        temp = state.take_int_temp()
+        lines.append(f"    rt_int_set_si(&{temp}, {value});")
+        return f"&{temp}"
+
     if isinstance(expr, IntConst):
-        temp = state.next_temp()
-        lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
-        # Check if value fits in int64_t
-        if -9223372036854775808 <= expr.value <= 9223372036854775807:
-            lines.append(f"    rt_int_set_si(&{temp}, {expr.value}LL);")
-        else:
-            # Use decimal string for large integers
-            lines.append(f'    rt_int_from_dec(&{temp}, "{expr.value}");')
+        k = _small_int(expr)
+        if k is None:
+            # Decoded at compile time, built once at startup, never written
+            return f"&{state.big_int(expr.value)}"
+        temp = state.take_int_temp()
+        lines.append(f"    rt_int_set_si(&{temp}, {_c_int64_literal(k)});")
         return f"&{temp}"
 
     if isinstance(expr, StrConst):
-        temp = state.next_temp()
-        # Escape the string for C (handle backslashes, quotes, newlines, etc.)
-        escaped = expr.value.replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n').replace('\t', '\\t')
-        lines.append(f'    rt_str {temp} = rt_str_from_cstr("{escaped}");')
-        return temp
+        # Interned at startup: no allocation, nothing to free
+        return state.literal(expr.value)
 
     if isinstance(expr, Var):
         ctype = _ctype_for_var(expr.name, var_types)
@@ -157,54 +352,45 @@ def _emit_expr(
         return f"&{expr.name}"
 
     if isinstance(expr, BinOp):
-        left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
-        right = _emit_expr(expr.right, lines, state, var_types, fn_sigs)
-        temp = state.next_temp()
-
-        # Check if this is a string concatenation
-        # Left operand is a string if it's a StrConst, a string Var, or a string temp
-        left_is_str = isinstance(expr.left, StrConst)
-        if isinstance(expr.left, Var) and var_types.get(expr.left.name) == "rt_str":
-            left_is_str = True
-        if isinstance(expr.left, BinOp):
-            # Recursively check if left sub-expression produces a string
-            left_is_str = _expr_produces_string(expr.left, var_types)
-
-        # Right operand is a string if it's a StrConst, a string Var, or a string temp
-        right_is_str = isinstance(expr.right, StrConst)
-        if isinstance(expr.right, Var) and var_types.get(expr.right.name) == "rt_str":
-            right_is_str = True
-        if isinstance(expr.right, BinOp):
-            # Recursively check if right sub-expression produces a string
-            right_is_str = _expr_produces_string(expr.right, var_types)
-
-        if left_is_str and right_is_str and expr.op == "+":
-            # String concatenation
+        if expr.op == "+" and _expr_produces_string(expr.left, var_types) \
+                and _expr_produces_string(expr.right, var_types):
+            # String concatenation: build the whole chain in one buffer
             temp = state.next_temp(type_hint="rt_str")
-            lines.append(f"    rt_str {temp} = rt_str_concat({left}, {right});")
+            _declare_str_temp(lines, state, temp, "rt_str_null()")
+            _emit_concat_into(temp, _concat_parts(expr, var_types), lines, state, var_types, fn_sigs)
             return temp
-        else:
-            # Integer arithmetic
-            lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
-            if expr.op == "+":
-                lines.append(f"    rt_int_add(&{temp}, {left}, {right});")
-            elif expr.op == "-":
-                lines.append(f"    rt_int_sub(&{temp}, {left}, {right});")
-            elif expr.op == "*":
-                lines.append(f"    rt_int_mul(&{temp}, {left}, {right});")
-            elif expr.op == "//":
-                lines.append(f"    rt_int_floordiv(&{temp}, {left}, {right});")
-            elif expr.op == "%":
-                lines.append(f"    rt_int_mod(&{temp}, {left}, {right});")
-            else:
-                raise ValueError(f"Unsupported binary operator: {expr.op}")
-            return f"&{temp}"
+
+        # Integer arithmetic; the result may land in a dead operand's temporary
+        func, left, right = _emit_int_binop_operands(expr, lines, state, var_types, fn_sigs)
+        temp = state.take_int_temp()
+        lines.append(f"    {func}(&{temp}, {left}, {right});")
+        return f"&{temp}"
 
     if isinstance(expr, CmpOp):
-        left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
-        right = _emit_expr(expr.right, lines, state, var_types, fn_sigs)
+        op = expr.op
+        left_native = _native_range(expr.left, state) is not None
+        right_native = _native_range(expr.right, state) is not None
+        if left_native and right_native:
+            left = _emit_native(expr.left, lines, state, var_types, fn_sigs)
+            right = _emit_native(expr.right, lines, state, var_types, fn_sigs)
+            return f"({left} {op} {right})"
+
         temp = state.next_temp()
-        lines.append(f"    int {temp} = rt_int_cmp({left}, {right});")
+        if right_native:
+            left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
+            right = _emit_native(expr.right, lines, state, var_types, fn_sigs)
+            lines.append(f"    int {temp} = rt_int_cmp_si({left}, {right});")
+        elif left_native:
+            # Compare the other way round: a < b is b > a
+            left = _emit_native(expr.left, lines, state, var_types, fn_sigs)
+            right = _emit_expr(expr.right, lines, state, var_types, fn_sigs)
+            lines.append(f"    int {temp} = rt_int_cmp_si({right}, {left});")
+            op = _FLIPPED_CMP.get(op, op)
+        else:
+            left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
+            right = _emit_expr(expr.right, lines, state, var_types, fn_sigs)
+            lines.append(f"    int {temp} = rt_int_cmp({left}, {right});")
+        state.release_results(left, right)
 
         op_map = {
             "==": f"({temp} == 0)",
@@ -214,7 +400,28 @@ def _emit_expr(
             ">": f"({temp} > 0)",
             ">=": f"({temp} >= 0)",
         }
-        return op_map.get(expr.op, f"({temp} == 0)")
+        return op_map.get(op, f"({temp} == 0)")
+
+    if isinstance(expr, Call) and expr.func in state.native_fns \
+            and all(_is_si_operand(arg, state) for arg in expr.args):
+        # Skip boxing the arguments unless the entry point gives up
+        args = [_emit_native(arg, lines, state, var_types, fn_sigs) for arg in expr.args]
+        value = state.next_temp()
+        temp = state.take_int_temp()
+        lines.append(f"    int64_t {value};")
+        lines.append(f"    if ({_native_fn_call(expr.func, '&' + value, args)}) {{")
+        lines.append(f"        rt_int_set_si(&{temp}, {value});")
+        lines.append("    } else {")
+        mark = state.temp_mark()
+        boxed = []
+        for arg in args:
+            box = state.take_int_temp()
+            lines.append(f"        rt_int_set_si(&{box}, {arg});")
+            boxed.append(f"&{box}")
+        lines.append(f"        pcc_fn_{expr.func}({', '.join([f'&{temp}'] + boxed)});")
+        lines.append("    }")
+        state.release_temps(mark)
+        return f"&{temp}"
 
     if isinstance(expr, Call):
         arg_exprs = []
@@ -222,11 +429,11 @@ def _emit_expr(
             arg_expr = _emit_expr(arg, lines, state, var_types, fn_sigs)
             arg_exprs.append(arg_expr)
 
-        temp = state.next_temp()
-        lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+        temp = state.take_int_temp()
 
         args_str = ", ".join(arg_exprs)
         lines.append(f"    pcc_fn_{expr.func}(&{temp}, {args_str});")
+        state.release_results(*arg_exprs)
         return f"&{temp}"
 
     if isinstance(expr, AttributeAccess):
@@ -245,11 +452,11 @@ def _emit_expr(
             arg_expr = _emit_expr(arg, lines, state, var_types, fn_sigs)
             arg_exprs.append(arg_expr)
 
-        temp = state.next_temp()
-        lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+        temp = state.take_int_temp()
 
         args_str = ", ".join(arg_exprs)
         lines.append(f"    pcc_method_{expr.obj}_{expr.method}({expr.obj}, &{temp}, {args_str});")
+        state.release_results(*arg_exprs)
         return f"&{temp}"
 
     if isinstance(expr, ConstructorCall):
@@ -265,88 +472,443 @@ def _emit_expr(
         return temp
 
     if isinstance(expr, BuiltinCall):
-        return _emit_builtin_call(expr, lines, state, var_types)
+        return _emit_builtin_call(expr, lines, state, var_types, fn_sigs)
 
     raise ValueError(f"Unsupported expression type: {type(expr).__name__}")
 
 
+def _emit_condition(
+    expr: Expr,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> str:
+    """Emit the test of an if or while as a C truth value.
+
+    A comparison already is one; an integer is true when non-zero and a
+    string when non-empty.
+    """
+    if isinstance(expr, CmpOp):
+        return _emit_expr(expr, lines, state, var_types, fn_sigs)
+    if isinstance(expr, IntConst):
+        return "1" if expr.value else "0"
+    if _native_range(expr, state) is not None:
+        return f"({_emit_native(expr, lines, state, var_types, fn_sigs)} != 0)"
+    result = _emit_expr(expr, lines, state, var_types, fn_sigs)
+    if _expr_produces_string(expr, var_types):
+        return f"(rt_str_len(&{result}) != 0)"
+    return f"!rt_int_is_zero({result})"
+
+
+# a op b is b flipped(op) a
+_FLIPPED_CMP = {"<": ">", "<=": ">=", ">": "<", ">=": "<="}
+
+# Runtime kernels for BinOp operators on two BigInts
+_INT_BINOP_FUNCS = {
+    "+": "rt_int_add",
+    "-": "rt_int_sub",
+    "*": "rt_int_mul",
+    "//": "rt_int_floordiv",
+    "%": "rt_int_mod",
+}
+
+_INT64_MIN = -9223372036854775808
+_INT64_MAX = 9223372036854775807
+
+
+def _small_int(expr: Expr) -> Optional[int]:
+    """Get the value of an integer constant that fits in int64_t, else None."""
+    if isinstance(expr, IntConst) and _INT64_MIN <= expr.value <= _INT64_MAX:
+        return expr.value
+    return None
+
+
+def _c_int64_literal(value: int) -> str:
+    """Format an int64_t value as a C literal (INT64_MIN has no literal form)."""
+    if value == _INT64_MIN:
+        return "INT64_MIN"
+    return f"{value}LL"
+
+
+def _native_range(expr: Expr, state: _CodegenState) -> Interval:
+    """Get the range of an integer expression that can be computed in int64_t.
+
+    Only with range inference, when it bounded the expression and every
+    intermediate result.
+
+    Returns:
+        The (lo, hi) range, or None if the expression needs BigInt
+    """
+    if state.ranges is None:
+        return None
+    return state.ranges.expr_range(expr)
+
+
+def _is_si_operand(expr: Expr, state: _CodegenState) -> bool:
+    """Check whether an operand can be passed to the *_si kernels as int64_t."""
+    return _small_int(expr) is not None or _native_range(expr, state) is not None
+
+
+def _is_native_var(name: str, state: _CodegenState) -> bool:
+    """Check whether a variable is an int64_t local."""
+    return state.ranges is not None and state.ranges.is_native(name)
+
+
+# C operators and runtime helpers for BinOp on int64_t operands
+_NATIVE_BINOPS = {
+    "+": "({l} + {r})",
+    "-": "({l} - {r})",
+    "*": "({l} * {r})",
+    "//": "rt_math_floordiv_si({l}, {r})",
+    "%": "rt_math_mod_si({l}, {r})",
+    ">>": "({l} >> {r})",  # arithmetic shift on every supported compiler: floor
+    "&": "({l} & {r})",  # int64_t is two's complement: the low bits, as %
+}
+
+# Runtime kernels for the shift and mask operators, taking a bit count
+_SHIFT_BINOPS = {
+    "<<": "rt_int_shl",
+    ">>": "rt_int_shr",
+    "&": "rt_int_mod_pow2",
+}
+
+# BigInt setters computing an int64_t op natively, promoting on overflow
+_PROMOTING_BINOPS = {
+    "+": "rt_int_set_si_add",
+    "-": "rt_int_set_si_sub",
+    "*": "rt_int_set_si_mul",
+}
+
+
+def _emit_native(
+    expr: Expr,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> str:
+    """Emit an expression with a native range as an int64_t C expression.
+
+    The range guarantees no step overflows, and that divisors are non-zero
+    (and not -1 under INT64_MIN), so plain C arithmetic is exact.
+    """
+    if isinstance(expr, IntConst):
+        return _c_int64_literal(expr.value)
+
+    if isinstance(expr, Var):
+        return expr.name
+
+    if isinstance(expr, BinOp):
+        left = _emit_native(expr.left, lines, state, var_types, fn_sigs)
+        if expr.op == "<<":
+            # A left shift of a negative value is undefined in C
+            return f"({left} * {_c_int64_literal(1 << expr.right.value)})"
+        right = _emit_native(expr.right, lines, state, var_types, fn_sigs)
+        return _NATIVE_BINOPS[expr.op].format(l=left, r=right)
+
+    if isinstance(expr, BuiltinCall):
+        if expr.name == "len":
+            arg = _emit_expr(expr.args[0], lines, state, var_types, fn_sigs)
+            return f"(int64_t)rt_str_len(&{arg})"
+        args = [_emit_native(arg, lines, state, var_types, fn_sigs) for arg in expr.args]
+        if expr.name == "int":
+            return args[0]
+        if expr.name == "abs":
+            return f"rt_math_abs_si({args[0]})"
+        if expr.name == "isqrt":
+            return f"rt_math_sqrt_si({args[0]})"
+        if expr.name in ("min", "max"):
+            result = args[0]
+            for arg in args[1:]:
+                result = f"rt_math_{expr.name}_si({result}, {arg})"
+            return result
+
+    raise ValueError(f"Expression has no native form: {type(expr).__name__}")
+
+
+def _emit_int_binop(
+    expr: BinOp,
+    dest: str,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> str:
+    """Emit the operands of an integer BinOp and return the line computing it.
+
+    Args:
+        expr: The integer BinOp to emit
+        dest: C pointer expression receiving the result
+        lines: List to append operand code to
+        state: Codegen state
+        var_types: Variable type mappings
+        fn_sigs: Function signatures
+
+    Returns:
+        str: The C statement that stores the result into dest
+    """
+    func, left, right = _emit_int_binop_operands(expr, lines, state, var_types, fn_sigs)
+    return f"    {func}({dest}, {left}, {right});"
+
+
+def _emit_int_binop_operands(
+    expr: BinOp,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> Tuple[str, str, str]:
+    """Emit the operands of an integer BinOp and pick the kernel combining them.
+
+    Operations with an int64-sized constant or native operand use the *_si
+    kernels so the operand never becomes a BigInt temporary, and native
+    operands of + - * with an unbounded result are combined natively with
+    an overflow check that promotes to BigInt.
+
+    The operands' temporaries are released, so the destination may be one
+    of them: all kernels accept dest aliasing an operand.
+
+    Returns:
+        (kernel, first operand, second operand) for kernel(dest, first, second)
+    """
+    if expr.op in _SHIFT_BINOPS:
+        left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
+        state.release_results(left)
+        bits = expr.right.value.bit_length() if expr.op == "&" else expr.right.value
+        return _SHIFT_BINOPS[expr.op], left, str(bits)
+
+    if expr.op not in _INT_BINOP_FUNCS:
+        raise ValueError(f"Unsupported binary operator: {expr.op}")
+
+    if (expr.op in _PROMOTING_BINOPS and _native_range(expr.left, state) is not None
+            and _native_range(expr.right, state) is not None):
+        left = _emit_native(expr.left, lines, state, var_types, fn_sigs)
+        right = _emit_native(expr.right, lines, state, var_types, fn_sigs)
+        return _PROMOTING_BINOPS[expr.op], left, right
+
+    left_si = _is_si_operand(expr.left, state)
+    right_si = _is_si_operand(expr.right, state)
+
+    if right_si and expr.op in ("+", "-", "*"):
+        left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
+        right = _emit_native(expr.right, lines, state, var_types, fn_sigs)
+        state.release_results(left)
+        return f"{_INT_BINOP_FUNCS[expr.op]}_si", left, right
+
+    if left_si and expr.op in ("+", "*"):
+        left = _emit_native(expr.left, lines, state, var_types, fn_sigs)
+        right = _emit_expr(expr.right, lines, state, var_types, fn_sigs)
+        state.release_results(right)
+        return f"{_INT_BINOP_FUNCS[expr.op]}_si", right, left
+
+    left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
+    right = _emit_expr(expr.right, lines, state, var_types, fn_sigs)
+    state.release_results(left, right)
+    return _INT_BINOP_FUNCS[expr.op], left, right
+
+
+def _match_addmul(target: Expr, expr: Expr) -> Optional[Tuple[Expr, int]]:
+    """Match target = target +/- y * k with k an int64 constant.
+
+    Returns:
+        (y, signed k) if the assignment can use rt_int_addmul_si, else None
+    """
+    if not isinstance(expr, BinOp) or expr.op not in ("+", "-"):
+        return None
+    if expr.left == target:
+        prod = expr.right
+    elif expr.op == "+" and expr.right == target:
+        prod = expr.left
+    else:
+        return None
+    if isinstance(prod, BinOp) and prod.op == "<<" and prod.right.value < 63:
+        # A multiplication by a power of two after strength reduction
+        prod = BinOp("*", prod.left, IntConst(1 << prod.right.value))
+    if not isinstance(prod, BinOp) or prod.op != "*":
+        return None
+
+    k = _small_int(prod.right)
+    y = prod.left
+    if k is None:
+        k = _small_int(prod.left)
+        y = prod.right
+    if k is None:
+        return None
+    if expr.op == "-":
+        k = -k
+        if k > _INT64_MAX:
+            return None
+    return y, k
+
+
+def _has_native_var_operand(expr: BinOp, state: _CodegenState) -> bool:
+    """Check for a non-constant operand of expr computed natively."""
+    return state.ranges is not None and any(
+        not isinstance(operand, IntConst) and _native_range(operand, state) is not None
+        for operand in (expr.left, expr.right))
+
+
+def _emit_int_store(
+    target: str,
+    target_expr: Expr,
+    expr: Expr,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> None:
+    """Emit code storing an integer expression into an existing BigInt.
+
+    Constants and arithmetic are computed directly into the target, the
+    pattern x = x + y * k becomes a single multiply-accumulate, and results
+    already held in a fresh temporary are moved by swapping buffers.
+
+    Args:
+        target: C pointer expression of the destination (e.g. "&x")
+        target_expr: IR expression reading the destination, for matching
+        expr: The expression to store
+        lines: List to append generated C lines to
+        state: Codegen state
+        var_types: Variable type mappings
+        fn_sigs: Function signatures
+    """
+    if _native_range(expr, state) is not None:
+        value = _emit_native(expr, lines, state, var_types, fn_sigs)
+        lines.append(f"    rt_int_set_si({target}, {value});")
+        return
+
+    if isinstance(expr, IntConst):
+        k = _small_int(expr)
+        if k is not None:
+            lines.append(f"    rt_int_set_si({target}, {_c_int64_literal(k)});")
+        else:
+            lines.append(f"    rt_int_copy({target}, &{state.big_int(expr.value)});")
+        return
+
+    addmul = _match_addmul(target_expr, expr)
+    if addmul is not None and not _has_native_var_operand(expr, state):
+        y, k = addmul
+        y_ptr = _emit_expr(y, lines, state, var_types, fn_sigs)
+        lines.append(f"    rt_int_addmul_si({target}, {y_ptr}, {_c_int64_literal(k)});")
+        return
+
+    if isinstance(expr, BinOp) and not _expr_produces_string(expr, var_types):
+        lines.append(_emit_int_binop(expr, target, lines, state, var_types, fn_sigs))
+        return
+
+    expr_result = _emit_expr(expr, lines, state, var_types, fn_sigs)
+    if isinstance(expr, Var) and var_types.get(expr.name) == "rt_str":
+        pass  # Type mismatch caught in frontend
+    elif expr_result.startswith("&pcc_tmp_"):
+        # The temporary is dead after this statement: take its buffer
+        lines.append(f"    rt_int_swap({target}, {expr_result});")
+    else:
+        lines.append(f"    rt_int_copy({target}, {expr_result});")
+
+
 def _emit_builtin_call(
     expr: BuiltinCall,
     lines: List[str],
     state: _CodegenState,
-    var_types: Dict[str, str]
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
 ) -> str:
     """Emit code for a builtin function call."""
+    if expr.name == 'str' and _native_range(expr.args[0], state) is not None:
+        value = _emit_native(expr.args[0], lines, state, var_types, fn_sigs)
+        temp = state.next_temp(type_hint="rt_str")
+        _declare_str_temp(lines, state, temp, f"rt_str_from_si({value})")
+        return temp
+
+    if expr.name == 'pow' and len(expr.args) == 2 and _native_range(expr.args[1], state) is not None:
+        base = _emit_expr(expr.args[0], lines, state, var_types, fn_sigs)
+        exp = _emit_native(expr.args[1], lines, state, var_types, fn_sigs)
+        temp = state.take_int_temp()
+        lines.append(f"    rt_math_pow(&{temp}, {base}, {exp});")
+        state.release_results(base)
+        return f"&{temp}"
+
     # Emit arguments
     arg_exprs = []
     for arg in expr.args:
-        arg_expr = _emit_expr(arg, lines, state, var_types)
+        arg_expr = _emit_expr(arg, lines, state, var_types, fn_sigs)
         arg_exprs.append(arg_expr)
 
-    if expr.name == 'len':
+    result = _emit_builtin_op(expr.name, arg_exprs, lines, state)
+    state.release_results(*arg_exprs)
+    return result
+
+
+def _emit_builtin_op(name: str, arg_exprs: List[str], lines: List[str], state: _CodegenState) -> str:
+    """Emit a builtin applied to already emitted arguments, taking its result temp."""
+    if name == 'len':
         # len() returns the length of a string
         arg = arg_exprs[0]
-        temp = state.next_temp(type_hint="rt_int")
-        lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
-        lines.append(f"    rt_int_set_si(&{temp}, rt_str_len({arg}));")
+        temp = state.take_int_temp()
+        lines.append(f"    rt_int_set_si(&{temp}, (int64_t)rt_str_len(&{arg}));")
         return f"&{temp}"
 
-    elif expr.name == 'abs':
+    elif name == 'abs':
         # abs() returns absolute value
         arg = arg_exprs[0]
-        temp = state.next_temp(type_hint="rt_int")
-        lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+        temp = state.take_int_temp()
         lines.append(f"    rt_math_abs(&{temp}, {arg});")
         return f"&{temp}"
 
-    elif expr.name == 'min':
+    elif name == 'min':
         # min() returns minimum of arguments
         if len(arg_exprs) == 2:
-            temp = state.next_temp(type_hint="rt_int")
-            lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+            temp = state.take_int_temp()
             lines.append(f"    rt_math_min(&{temp}, {arg_exprs[0]}, {arg_exprs[1]});")
             return f"&{temp}"
         else:
             raise ValueError("min() with more than 2 arguments not supported in HPF mode")
 
-    elif expr.name == 'max':
+    elif name == 'max':
         # max() returns maximum of arguments
         if len(arg_exprs) == 2:
-            temp = state.next_temp(type_hint="rt_int")
-            lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+            temp = state.take_int_temp()
             lines.append(f"    rt_math_max(&{temp}, {arg_exprs[0]}, {arg_exprs[1]});")
             return f"&{temp}"
         else:
             raise ValueError("max() with more than 2 arguments not supported in HPF mode")
 
-    elif expr.name == 'pow':
-        # pow() returns base^exp
+    elif name == 'pow':
+        # pow() returns base^exp, or base^exp mod m with a third argument
+        temp = state.take_int_temp()
         if len(arg_exprs) == 2:
-            temp = state.next_temp(type_hint="rt_int")
-            lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
-            # Get exponent as int64
-            lines.append(f"    int64_t exp; rt_int_to_si_checked({arg_exprs[1]}, &exp);")
-            lines.append(f"    rt_math_pow(&{temp}, {arg_exprs[0]}, exp);")
-            return f"&{temp}"
+            # Get exponent as int64 (one name per call site, C scopes are flat here)
+            exp = state.next_temp()
+            lines.append(f"    int64_t {exp} = 0; rt_int_to_si_checked({arg_exprs[1]}, &{exp});")
+            lines.append(f"    rt_math_pow(&{temp}, {arg_exprs[0]}, {exp});")
         else:
-            raise ValueError("pow() with 3 arguments not supported")
+            # Reduced on every step: the full power is never built
+            lines.append(f"    rt_math_powmod(&{temp}, {arg_exprs[0]}, {arg_exprs[1]}, {arg_exprs[2]});")
+        return f"&{temp}"
+
+    elif name == 'isqrt':
+        # isqrt() returns floor(sqrt(n))
+        arg = arg_exprs[0]
+        temp = state.take_int_temp()
+        lines.append(f"    rt_math_sqrt(&{temp}, {arg});")
+        return f"&{temp}"
 
-    elif expr.name == 'str':
+    elif name == 'str':
         # str() converts to string
         arg = arg_exprs[0]
         temp = state.next_temp(type_hint="rt_str")
-        lines.append(f"    rt_str {temp} = rt_str_from_int({arg});")
+        _declare_str_temp(lines, state, temp, f"rt_str_from_int({arg})")
         return temp
 
-    elif expr.name == 'int':
+    elif name == 'int':
         # int() converts to integer
         arg = arg_exprs[0]
-        temp = state.next_temp(type_hint="rt_int")
-        lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+        temp = state.take_int_temp()
         lines.append(f"    rt_int_copy(&{temp}, {arg});")
         return f"&{temp}"
 
-    raise ValueError(f"Unknown builtin: {expr.name}")
+    raise ValueError(f"Unknown builtin: {name}")
 
 
 def _collect_locals_in_stmt(stmt: Stmt) -> Set[Tuple[str, str]]:
@@ -381,6 +943,40 @@ def _collect_locals_in_stmt(stmt: Stmt) -> Set[Tuple[str, str]]:
     return locals_set
 
 
+def _emit_scoped_block(
+    stmts: List[Stmt],
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int],
+    in_loop: bool,
+    break_label: str,
+    continue_label: str,
+    loop_scope: str,
+    declared_vars: Set[str]
+) -> None:
+    """Emit a braced block, releasing its string temporaries before the closing brace.
+
+    Temporaries declared inside C braces die at the brace, so a block that
+    creates any gets its own scope mark and reset. Blocks without string
+    temporaries are emitted unchanged; BigInt temporaries are pooled at
+    function level and need no scope.
+    """
+    body: List[str] = []
+    before = state.scoped_temps
+    _emit_block(stmts, body, state, var_types, fn_sigs,
+                in_loop, break_label, continue_label, declared_vars, loop_scope)
+
+    if state.scoped_temps == before:
+        lines.extend(body)
+        return
+
+    scope = state.next_label("pcc_scope")
+    lines.append(f"    rt_scope_t {scope} = rt_scope_mark();")
+    lines.extend(body)
+    lines.append(f"    rt_scope_reset({scope});")
+
+
 def _emit_block(
     stmts: List[Stmt],
     lines: List[str],
@@ -390,7 +986,8 @@ def _emit_block(
     in_loop: bool = False,
     break_label: str = "",
     continue_label: str = "",
-    declared_vars: Optional[Set[str]] = None
+    declared_vars: Optional[Set[str]] = None,
+    loop_scope: str = ""
 ) -> None:
     """Emit code for a block of statements.
 
@@ -403,24 +1000,27 @@ def _emit_block(
         in_loop: Whether we're inside a loop
         break_label: Label to jump to for break statements
         continue_label: Label to jump to for continue statements
-        declared_vars: Set of variables already declared in current scope
+        declared_vars: Set of object variables already declared in current scope
+        loop_scope: Scope mark of the innermost loop, reset by break and continue
     """
     if declared_vars is None:
         declared_vars = set()
 
+    # A statement's temporaries are dead once the next one starts
+    mark = state.temp_mark()
     for stmt in stmts:
+        state.release_temps(mark)
         if isinstance(stmt, Assign):
-            expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
-
             if isinstance(stmt.expr, StrConst):
+                # Point the variable at the interned literal; appending to
+                # it later copies it into a buffer of its own
                 var_types[stmt.name] = "rt_str"
-                if stmt.name not in declared_vars:
-                    declared_vars.add(stmt.name)
-                    lines.append(f"    rt_str {stmt.name} = {expr_result};")
-                else:
-                    lines.append(f"    {stmt.name} = {expr_result};")
+                state.declare_local(stmt.name, "rt_str")
+                lines.append(f"    rt_str_clear(&{stmt.name});")
+                lines.append(f"    {stmt.name} = {state.literal(stmt.expr.value)};")
             elif isinstance(stmt.expr, ConstructorCall):
                 # Object assignment
+                expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
                 class_name = stmt.expr.class_name
                 var_types[stmt.name] = f"pcc_class_{class_name}"
                 if stmt.name not in declared_vars:
@@ -430,26 +1030,45 @@ def _emit_block(
                     # Clean up old object before assigning new one
                     lines.append(f"    pcc_delete_{class_name}({stmt.name});")
                     lines.append(f"    {stmt.name} = {expr_result};")
+            elif isinstance(stmt.expr, Var) and var_types.get(stmt.expr.name) == "rt_str":
+                # Share the bytes; either variable copies them before
+                # modifying them in place
+                if stmt.expr.name != stmt.name:
+                    var_types[stmt.name] = "rt_str"
+                    state.declare_local(stmt.name, "rt_str")
+                    lines.append(f"    rt_str_clear(&{stmt.name});")
+                    lines.append(f"    {stmt.name} = rt_str_share({stmt.expr.name});")
+            elif isinstance(stmt.expr, (BinOp, BuiltinCall)) and _expr_produces_string(stmt.expr, var_types):
+                appended = _match_str_append(stmt.name, stmt.expr, var_types)
+                if appended is not None:
+                    # s = s + ...: append in place; geometric growth makes
+                    # accumulating loops amortized linear
+                    _emit_concat_into(stmt.name, appended, lines, state, var_types, fn_sigs)
+                    continue
+                # Move the fresh string temporary into the variable; its
+                # scope entry is left holding an empty string
+                expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
+                var_types[stmt.name] = "rt_str"
+                state.declare_local(stmt.name, "rt_str")
+                lines.append(f"    rt_str_clear(&{stmt.name});")
+                lines.append(f"    {stmt.name} = {expr_result}; rt_str_init(&{expr_result});")
+            elif _is_native_var(stmt.name, state):
+                if _native_range(stmt.expr, state) is None:
+                    raise ValueError(f"No range for the value assigned to '{stmt.name}'")
+                var_types[stmt.name] = "rt_int"
+                state.declare_local(stmt.name, "int64_t")
+                value = _emit_native(stmt.expr, lines, state, var_types, fn_sigs)
+                lines.append(f"    {stmt.name} = {value};")
             else:
                 var_types[stmt.name] = "rt_int"
-                if stmt.name not in declared_vars:
-                    declared_vars.add(stmt.name)
-                    lines.append(f"    rt_int {stmt.name}; rt_int_init(&{stmt.name});")
-                    if isinstance(stmt.expr, Var) and var_types.get(stmt.expr.name) == "rt_str":
-                        pass  # Type mismatch caught in frontend
-                    else:
-                        lines.append(f"    rt_int_copy(&{stmt.name}, {expr_result});")
-                else:
-                    # Variable already declared, just copy the new value
-                    if isinstance(stmt.expr, Var) and var_types.get(stmt.expr.name) == "rt_str":
-                        pass  # Type mismatch caught in frontend
-                    else:
-                        lines.append(f"    rt_int_copy(&{stmt.name}, {expr_result});")
+                state.declare_local(stmt.name, "rt_int")
+                _emit_int_store(f"&{stmt.name}", Var(stmt.name), stmt.expr,
+                                lines, state, var_types, fn_sigs)
 
         elif isinstance(stmt, AttrAssign):
             # Attribute assignment: obj.attr = expr
-            expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
-            lines.append(f"    rt_int_copy(&{stmt.obj}->{stmt.attr}, {expr_result});")
+            _emit_int_store(f"&{stmt.obj}->{stmt.attr}", AttributeAccess(stmt.obj, stmt.attr),
+                            stmt.expr, lines, state, var_types, fn_sigs)
 
         elif isinstance(stmt, MethodCallStmt):
             # Method call as statement: obj.method(args)
@@ -458,8 +1077,7 @@ def _emit_block(
                 arg_expr = _emit_expr(arg, lines, state, var_types, fn_sigs)
                 arg_exprs.append(arg_expr)
 
-            temp = state.next_temp()
-            lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+            temp = state.take_int_temp()
 
             # Get the class name from the object variable type
             obj_type = var_types.get(stmt.obj, "")
@@ -475,6 +1093,10 @@ def _emit_block(
             else:
                 lines.append(f"    pcc_method_{class_name}_{stmt.method}({stmt.obj}, &{temp});")
 
+        elif isinstance(stmt, Print) and _native_range(stmt.expr, state) is not None:
+            value = _emit_native(stmt.expr, lines, state, var_types, fn_sigs)
+            lines.append(f"    rt_print_si({value});")
+
         elif isinstance(stmt, Print):
             expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
             # Check if it's a string expression
@@ -492,38 +1114,49 @@ def _emit_block(
                 lines.append(f"    rt_print_int({expr_result});")
 
         elif isinstance(stmt, If):
-            test_result = _emit_expr(stmt.test, lines, state, var_types, fn_sigs)
+            test_result = _emit_condition(stmt.test, lines, state, var_types, fn_sigs)
             lines.append(f"    if ({test_result}) {{")
 
             body_var_types = dict(var_types)
             body_declared = set(declared_vars)
-            _emit_block(stmt.body, lines, state, body_var_types, fn_sigs,
-                       in_loop, break_label, continue_label, body_declared)
+            _emit_scoped_block(stmt.body, lines, state, body_var_types, fn_sigs,
+                               in_loop, break_label, continue_label, loop_scope, body_declared)
 
             if stmt.orelse:
                 lines.append("    } else {")
                 else_var_types = dict(var_types)
                 else_declared = set(declared_vars)
-                _emit_block(stmt.orelse, lines, state, else_var_types, fn_sigs,
-                           in_loop, break_label, continue_label, else_declared)
+                _emit_scoped_block(stmt.orelse, lines, state, else_var_types, fn_sigs,
+                                   in_loop, break_label, continue_label, loop_scope, else_declared)
 
             lines.append("    }")
 
         elif isinstance(stmt, While):
             start_label = state.next_label("while_start")
             end_label = state.next_label("while_end")
+            scope = state.next_label("pcc_scope")
 
+            # String temporaries of the test and body are released on every back-edge
+            lines.append(f"    rt_scope_t {scope} = rt_scope_mark();")
             lines.append(f"    {start_label}:")
-            test_result = _emit_expr(stmt.test, lines, state, var_types, fn_sigs)
+            lines.append(f"    rt_scope_reset({scope});")
+            test_result = _emit_condition(stmt.test, lines, state, var_types, fn_sigs)
             lines.append(f"    if (!({test_result})) goto {end_label};")
 
             body_var_types = dict(var_types)
             body_declared = set(declared_vars)
             _emit_block(stmt.body, lines, state, body_var_types, fn_sigs,
-                       True, end_label, start_label, body_declared)
+                       True, end_label, start_label, body_declared, scope)
 
             lines.append(f"    goto {start_label};")
             lines.append(f"    {end_label}:")
+            lines.append(f"    rt_scope_reset({scope});")
+
+        elif isinstance(stmt, ForRange) and _parallel_plan(stmt, state, var_types) is not None:
+            _emit_parallel_for(stmt, lines, state, var_types, fn_sigs)
+
+        elif isinstance(stmt, ForRange) and _is_native_var(stmt.var, state):
+            _emit_native_for_range(stmt, lines, state, var_types, fn_sigs, declared_vars)
 
         elif isinstance(stmt, ForRange):
             start_label = state.next_label("for_start")
@@ -533,28 +1166,25 @@ def _emit_block(
             # Initialize loop variable
             start_result = _emit_expr(stmt.start, lines, state, var_types, fn_sigs)
             var_types[stmt.var] = "rt_int"
-            lines.append(f"    rt_int {stmt.var}; rt_int_init(&{stmt.var});")
+            state.declare_local(stmt.var, "rt_int")
             lines.append(f"    rt_int_copy(&{stmt.var}, {start_result});")
+            state.release_results(start_result)
 
-            # Initialize stop value
-            stop_temp = state.next_temp()
-            stop_result = _emit_expr(stmt.stop, lines, state, var_types, fn_sigs)
-            lines.append(f"    rt_int {stop_temp}; rt_int_init(&{stop_temp});")
-            lines.append(f"    rt_int_copy(&{stop_temp}, {stop_result});")
-
-            # Initialize step value
-            step_temp = state.next_temp()
-            step_result = _emit_expr(stmt.step, lines, state, var_types, fn_sigs)
-            lines.append(f"    rt_int {step_temp}; rt_int_init(&{step_temp});")
-            lines.append(f"    rt_int_copy(&{step_temp}, {step_result});")
+            # Stop and step stay live until the statement ends
+            stop_temp = _hold_int(_emit_expr(stmt.stop, lines, state, var_types, fn_sigs), lines, state)
+            step_temp = _hold_int(_emit_expr(stmt.step, lines, state, var_types, fn_sigs), lines, state)
 
-            # Check step direction
-            lines.append(f"    int {stop_temp}_cmp = rt_int_cmp(&{step_temp}, &(rt_int){{0}});")
+            # Check step direction (pooled names repeat, so the flag gets its own)
+            step_sign = state.next_temp()
+            lines.append(f"    int {step_sign} = rt_int_cmp(&{step_temp}, &(rt_int){{0}});")
 
+            # Bounds belong to the enclosing scope; body temporaries to the loop's
+            scope = state.next_label("pcc_scope")
+            lines.append(f"    rt_scope_t {scope} = rt_scope_mark();")
             lines.append(f"    {start_label}:")
 
             # Loop condition based on step direction
-            lines.append(f"    if ({stop_temp}_cmp > 0) {{")
+            lines.append(f"    if ({step_sign} > 0) {{")
             lines.append(f"        if (rt_int_cmp(&{stmt.var}, &{stop_temp}) >= 0) goto {end_label};")
             lines.append("    } else {")
             lines.append(f"        if (rt_int_cmp(&{stmt.var}, &{stop_temp}) <= 0) goto {end_label};")
@@ -563,29 +1193,334 @@ def _emit_block(
             body_var_types = dict(var_types)
             body_declared = set(declared_vars)
             _emit_block(stmt.body, lines, state, body_var_types, fn_sigs,
-                       True, end_label, continue_label_for, body_declared)
+                       True, end_label, continue_label_for, body_declared, scope)
 
             lines.append(f"    {continue_label_for}:")
+            lines.append(f"    rt_scope_reset({scope});")
             lines.append(f"    rt_int_add(&{stmt.var}, &{stmt.var}, &{step_temp});")
             lines.append(f"    goto {start_label};")
             lines.append(f"    {end_label}:")
-
-            lines.append(f"    rt_int_clear(&{stop_temp});")
-            lines.append(f"    rt_int_clear(&{step_temp});")
+            lines.append(f"    rt_scope_reset({scope});")
 
         elif isinstance(stmt, Return):
-            expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
-            lines.append(f"    rt_int_copy(out, {expr_result});")
+            if _native_range(stmt.expr, state) is not None:
+                value = _emit_native(stmt.expr, lines, state, var_types, fn_sigs)
+                lines.append(f"    rt_int_set_si(out, {value});")
+            else:
+                expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
+                lines.append(f"    rt_int_copy(out, {expr_result});")
+            # Release everything while the block's temporaries are still alive
+            lines.append(f"    rt_scope_reset({_FN_SCOPE});")
+            lines.append(f"    goto {_FN_EXIT};")
+            state.uses_exit = True
 
         elif isinstance(stmt, Break):
             if not in_loop or not break_label:
                 raise ValueError("Break outside of loop")
+            lines.append(f"    rt_scope_reset({loop_scope});")
             lines.append(f"    goto {break_label};")
 
         elif isinstance(stmt, Continue):
             if not in_loop or not continue_label:
                 raise ValueError("Continue outside of loop")
+            lines.append(f"    rt_scope_reset({loop_scope});")
             lines.append(f"    goto {continue_label};")
+    state.release_temps(mark)
+
+
+def _emit_native_for_range(
+    stmt: ForRange,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int],
+    declared_vars: Set[str]
+) -> None:
+    """Emit a range() loop whose variable is an int64_t local.
+
+    The loop runs on a hidden counter so that assigning to the variable in
+    the body does not change the iteration, as in Python. Range inference
+    proved the step nonzero with a fixed sign and the counter free of
+    overflow, including its final step past stop.
+    """
+    start = _native_range(stmt.start, state)
+    stop = _native_range(stmt.stop, state)
+    step = _native_range(stmt.step, state)
+    _, sign = for_range_counter(start, stop, step)
+    if sign == 0:
+        raise ValueError(f"No range for the loop variable '{stmt.var}'")
+
+    start_label = state.next_label("for_start")
+    end_label = state.next_label("for_end")
+    continue_label = state.next_label("for_continue")
+    counter = state.next_label("pcc_ctr")
+
+    var_types[stmt.var] = "rt_int"
+    state.declare_local(stmt.var, "int64_t")
+    start_value = _emit_native(stmt.start, lines, state, var_types, fn_sigs)
+    lines.append(f"    int64_t {counter} = {start_value};")
+    stop_value = _emit_native(stmt.stop, lines, state, var_types, fn_sigs)
+    lines.append(f"    int64_t {counter}_stop = {stop_value};")
+    if step[0] == step[1]:
+        step_value = _c_int64_literal(step[0])
+    else:
+        step_value = f"{counter}_step"
+        lines.append(f"    int64_t {step_value} = "
+                     f"{_emit_native(stmt.step, lines, state, var_types, fn_sigs)};")
+
+    scope = state.next_label("pcc_scope")
+    lines.append(f"    rt_scope_t {scope} = rt_scope_mark();")
+    lines.append(f"    {start_label}:")
+    cmp = "<" if sign > 0 else ">"
+    lines.append(f"    if (!({counter} {cmp} {counter}_stop)) goto {end_label};")
+    lines.append(f"    {stmt.var} = {counter};")
+
+    body_var_types = dict(var_types)
+    body_declared = set(declared_vars)
+    _emit_block(stmt.body, lines, state, body_var_types, fn_sigs,
+                True, end_label, continue_label, body_declared, scope)
+
+    lines.append(f"    {continue_label}:")
+    lines.append(f"    rt_scope_reset({scope});")
+    lines.append(f"    {counter} += {step_value};")
+    lines.append(f"    goto {start_label};")
+    lines.append(f"    {end_label}:")
+    lines.append(f"    rt_scope_reset({scope});")
+
+
+# Counter bounds of a worker's chunk, and the step if it is not a constant
+_PAR_LO = "pcc_lo"
+_PAR_HI = "pcc_hi"
+_PAR_STEP = "pcc_step"
+
+
+def _parallel_plan(
+    stmt: ForRange,
+    state: _CodegenState,
+    var_types: Dict[str, str]
+) -> Optional[List[Tuple[str, str, Optional[str]]]]:
+    """Get the variables a parallel loop passes to its workers, if it is emitted as one.
+
+    The loop must have been found parallel and have an int64_t counter.
+    Inputs may be integers or strings; integer reductions are BigInts,
+    except min and max, which stay within the range of their native
+    accumulator.
+
+    Returns:
+        (name, C type, reduction operator or None for an input) for each
+        variable, or None to emit the loop serially
+    """
+    loop = state.parallel.get(id(stmt))
+    if loop is None or not _is_native_var(stmt.var, state):
+        return None
+    plan = []
+    for name in loop.inputs:
+        ctype = "int64_t" if _is_native_var(name, state) else var_types.get(name, "rt_int")
+        if ctype not in ("int64_t", "rt_int", "rt_str"):
+            return None
+        plan.append((name, ctype, None))
+    for name, op in loop.reductions.items():
+        ctype = "int64_t" if _is_native_var(name, state) else var_types.get(name, "rt_int")
+        if ctype != "rt_int" and not (ctype == "int64_t" and op != "+"):
+            return None
+        plan.append((name, ctype, op))
+    return plan
+
+
+def _emit_parallel_for(
+    stmt: ForRange,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> None:
+    """Emit a range() loop with independent iterations as chunks run on the pool.
+
+    The range is split with rt_pool_range_chunks() and each chunk runs the
+    loop in a worker function, whose context holds the chunk's bounds, the
+    inputs and a partial result per reduction. Sums start from zero and
+    minima and maxima from the accumulator's value; the partial results are
+    combined in chunk order once every chunk is done.
+    """
+    plan = _parallel_plan(stmt, state, var_types)
+    loop = state.parallel[id(stmt)]
+    step = _native_range(stmt.step, state)
+    name = f"pcc_par_{len(state.workers)}"
+    state.workers.append(_emit_parallel_worker(name, stmt, plan, state, fn_sigs))
+
+    ctx, bounds, count, k = f"{name}_ctx", f"{name}_bounds", f"{name}_n", f"{name}_k"
+    start_value = _emit_native(stmt.start, lines, state, var_types, fn_sigs)
+    stop_value = _emit_native(stmt.stop, lines, state, var_types, fn_sigs)
+    step_value = _emit_native(stmt.step, lines, state, var_types, fn_sigs)
+    grain = "1" if loop.heavy else "RT_POOL_FOR_GRAIN"
+    lines.append(f"    int64_t {bounds}[RT_POOL_FOR_MAX_CHUNKS + 1];")
+    lines.append(f"    {name}_t {ctx}[RT_POOL_FOR_MAX_CHUNKS];")
+    lines.append(f"    size_t {count} = rt_pool_range_chunks({start_value}, {stop_value}, "
+                 f"{step_value}, {grain}, {bounds});")
+
+    lines.append(f"    for (size_t {k} = 0; {k} < {count}; {k}++) {{")
+    lines.append(f"        {ctx}[{k}].{_PAR_LO} = {bounds}[{k}];")
+    lines.append(f"        {ctx}[{k}].{_PAR_HI} = {bounds}[{k} + 1];")
+    if step[0] != step[1]:
+        lines.append(f"        {ctx}[{k}].{_PAR_STEP} = {step_value};")
+    for var, ctype, op in plan:
+        field = f"{ctx}[{k}].{var}"
+        if ctype == "int64_t":
+            lines.append(f"        {field} = {var};")
+        elif ctype == "rt_str":
+            # Shared here: a string with one reference is not safe to share from several threads
+            lines.append(f"        {field} = rt_str_share({var});")
+        elif op is None:
+            lines.append(f"        {field} = &{var};")
+        elif op == "+":
+            lines.append(f"        rt_int_init(&{field});")
+        else:
+            lines.append(f"        rt_int_init(&{field}); rt_int_copy(&{field}, &{var});")
+    lines.append("    }")
+    lines.append(f"    rt_pool_run({name}, {ctx}, sizeof({name}_t), {count});")
+
+    reductions = [(var, ctype, op) for var, ctype, op in plan if op is not None]
+    if not reductions:
+        return
+    lines.append(f"    for (size_t {k} = 0; {k} < {count}; {k}++) {{")
+    for var, ctype, op in reductions:
+        state.declare_local(var, ctype)
+        field = f"{ctx}[{k}].{var}"
+        if ctype == "int64_t":
+            lines.append(f"        {var} = rt_math_{op}_si({var}, {field});")
+        else:
+            func = "rt_int_add" if op == "+" else f"rt_math_{op}"
+            lines.append(f"        {func}(&{var}, &{var}, &{field}); rt_int_clear(&{field});")
+    lines.append("    }")
+
+
+def _emit_parallel_worker(
+    name: str,
+    stmt: ForRange,
+    plan: List[Tuple[str, str, Optional[str]]],
+    state: _CodegenState,
+    fn_sigs: Dict[str, int]
+) -> List[str]:
+    """Emit the context type and worker function of a parallel loop.
+
+    The worker runs the loop over its chunk of counter values with the
+    enclosing function's variable types. Inputs are copied into locals,
+    and each partial result is moved in at the start and out at the end.
+    """
+    start = _native_range(stmt.start, state)
+    stop = _native_range(stmt.stop, state)
+    step = _native_range(stmt.step, state)
+    env = dict(state.ranges.ranges)
+    env[_PAR_LO] = for_range_var(start, stop, step)
+    env[_PAR_HI] = stop
+    if step[0] == step[1]:
+        step_expr = IntConst(step[0])
+    else:
+        env[_PAR_STEP] = step
+        step_expr = Var(_PAR_STEP)
+
+    worker = _CodegenState(literals=state.literals, ranges=RangeInfo(env), native_fns=state.native_fns)
+    var_types: Dict[str, str] = {}
+    fields = [f"    int64_t {_PAR_LO}, {_PAR_HI};"]
+    entry = []
+    leave = []
+    for bound in (_PAR_LO, _PAR_HI, _PAR_STEP):
+        if bound in env:
+            worker.declare_local(bound, "int64_t")
+    entry.append(f"    {_PAR_LO} = pcc_ctx->{_PAR_LO}; {_PAR_HI} = pcc_ctx->{_PAR_HI};")
+    if _PAR_STEP in env:
+        fields.append(f"    int64_t {_PAR_STEP};")
+        entry.append(f"    {_PAR_STEP} = pcc_ctx->{_PAR_STEP};")
+    for var, ctype, op in plan:
+        var_types[var] = "rt_str" if ctype == "rt_str" else "rt_int"
+        worker.declare_local(var, ctype)
+        if ctype == "rt_int" and op is None:
+            fields.append(f"    const rt_int* {var};")
+            entry.append(f"    rt_int_copy(&{var}, pcc_ctx->{var});")
+        elif ctype == "rt_int":
+            fields.append(f"    rt_int {var};")
+            entry.append(f"    rt_int_swap(&{var}, &pcc_ctx->{var});")
+            leave.append(f"    rt_int_swap(&{var}, &pcc_ctx->{var});")
+        else:
+            # Strings are owned by the worker once shared, and cleared with its locals
+            fields.append(f"    {ctype} {var};")
+            entry.append(f"    {var} = pcc_ctx->{var};")
+            if op is not None:
+                leave.append(f"    pcc_ctx->{var} = {var};")
+
+    chunk = ForRange(stmt.var, Var(_PAR_LO), Var(_PAR_HI), step_expr, stmt.body, stmt.lineno)
+    body = _emit_body([chunk], worker, var_types, fn_sigs, entry, leave)
+
+    lines = ["typedef struct {"]
+    lines.extend(fields)
+    lines.append(f"}} {name}_t;")
+    lines.append("")
+    lines.append(f"static rt_error_code_t {name}(void* pcc_arg) {{")
+    lines.append(f"    {name}_t* pcc_ctx = ({name}_t*)pcc_arg;")
+    lines.extend(body)
+    lines.append("    return rt_error_last()->code;")
+    lines.append("}")
+    lines.append("")
+    return lines
+
+
+def _emit_body(
+    body: List[Stmt],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int],
+    entry: Optional[List[str]] = None,
+    leave: Optional[List[str]] = None
+) -> List[str]:
+    """Emit a function body with its locals, temporary scope and exit path.
+
+    Locals and pooled BigInt temporaries are declared and initialized up
+    front, string temporaries are released through the function scope, and
+    every return jumps to a single exit where the locals and the pool are
+    cleared.
+
+    Args:
+        body: Statements of the function body
+        state: Codegen state (with parameters already registered)
+        var_types: Variable type mappings
+        fn_sigs: Function signatures
+        entry: Lines run once the locals are initialized
+        leave: Lines run before the locals are cleared
+
+    Returns:
+        List of C code lines
+    """
+    body_lines: List[str] = []
+    _emit_block(body, body_lines, state, var_types, fn_sigs, declared_vars=set())
+
+    lines: List[str] = []
+    for name, ctype in state.locals.items():
+        if ctype == "rt_str":
+            lines.append(f"    rt_str {name}; rt_str_init(&{name});")
+        elif ctype == "int64_t":
+            lines.append(f"    int64_t {name} = 0;")
+        else:
+            lines.append(f"    rt_int {name}; rt_int_init(&{name});")
+    for temp in state.int_temps:
+        lines.append(f"    rt_int {temp}; rt_int_init(&{temp});")
+    lines.append(f"    rt_scope_t {_FN_SCOPE} = rt_scope_mark();")
+    lines.extend(entry or [])
+    lines.extend(body_lines)
+
+    if state.uses_exit:
+        lines.append(f"    {_FN_EXIT}:")
+    lines.append(f"    rt_scope_reset({_FN_SCOPE});")
+    lines.extend(leave or [])
+
+    # Cleanup locals
+    for name, ctype in state.locals.items():
+        if ctype == "rt_str":
+            lines.append(f"    rt_str_clear(&{name});")
+        elif ctype == "rt_int":
+            lines.append(f"    rt_int_clear(&{name});")
+    for temp in state.int_temps:
+        lines.append(f"    rt_int_clear(&{temp});")
+    return lines
 
 
 def _emit_class_struct(class_def: ClassDef) -> List[str]:
@@ -654,13 +1589,62 @@ def _emit_class_destructor(class_def: ClassDef) -> List[str]:
     return lines
 
 
-def _emit_method(class_def: ClassDef, fn: FunctionDef, fn_sigs: Dict[str, int]) -> List[str]:
+def _emit_literals(literals: Dict[Union[str, int], str]) -> List[str]:
+    """Emit the module's literal constants and their initializer.
+
+    Each string literal is interned once at startup, straight from its
+    static bytes, so using one never allocates and equal literals share a
+    pointer. Integers beyond int64_t are stored as 32-bit words decoded at
+    compile time and turned into BigInts once, without decimal parsing.
+
+    Args:
+        literals: Map from literal value to constant name
+
+    Returns:
+        List of C code lines
+    """
+    if not literals:
+        return []
+    lines = []
+    for value, name in literals.items():
+        if isinstance(value, str):
+            lines.append(f"static rt_str {name};")
+            continue
+        magnitude = abs(value)
+        words = [(magnitude >> shift) & 0xFFFFFFFF for shift in range(0, magnitude.bit_length(), 32)]
+        lines.append(f"static const uint32_t {name}_words[] = {{{', '.join(f'0x{w:08x}u' for w in words)}}};")
+        lines.append(f"static rt_int {name};")
+    lines.append("")
+    lines.append("static void pcc_init_literals(void) {")
+    for value, name in literals.items():
+        if isinstance(value, str):
+            size = len(value.encode("utf-8"))
+            lines.append(f"    {name} = rt_str_intern_static({_c_string_literal(value)}, {size});")
+        else:
+            count = (abs(value).bit_length() + 31) // 32
+            sign = -1 if value < 0 else 1
+            lines.append(f"    rt_int_init(&{name}); rt_int_from_words(&{name}, {name}_words, {count}, {sign});")
+    lines.append("}")
+    lines.append("")
+    return lines
+
+
+def _emit_method(class_def: ClassDef, fn: FunctionDef, fn_sigs: Dict[str, int],
+                 literals: Dict[Union[str, int], str], use_ranges: bool = False,
+                 native_fns: Optional[Set[str]] = None, pure_fns: Optional[Set[str]] = None,
+                 workers: Optional[List[List[str]]] = None) -> List[str]:
     """Emit C code for a method definition.
 
     Args:
         class_def: Class definition IR
         fn: Method definition IR
         fn_sigs: Function signatures map
+        literals: Literal constants of the module, added to as used
+        use_ranges: Whether to store integer locals with inferred 64-bit ranges
+                    as int64_t
+        native_fns: Functions with an int64_t entry point
+        pure_fns: With --parallel, the functions a parallel loop may call
+        workers: Worker functions of the module's parallel loops, added to
 
     Returns:
         List of C code lines
@@ -671,7 +1655,9 @@ def _emit_method(class_def: ClassDef, fn: FunctionDef, fn_sigs: Dict[str, int])
         params = ", " + params
     lines.append(f"static void pcc_method_{class_def.name}_{fn.name}(pcc_class_{class_def.name}* self, rt_int* out{params}) {{")
 
-    state = _CodegenState()
+    ranges = infer_ranges(fn.body, fn.params) if use_ranges else None
+    parallel = find_parallel_loops(fn.body, pure_fns) if pure_fns is not None and use_ranges else None
+    state = _CodegenState(fn.params, literals, ranges, native_fns, parallel, workers)
     var_types: Dict[str, str] = {}
 
     # 'self' is available in the method
@@ -683,29 +1669,32 @@ def _emit_method(class_def: ClassDef, fn: FunctionDef, fn_sigs: Dict[str, int])
         lines.append(f"    rt_int {p}; rt_int_init(&{p});")
         lines.append(f"    rt_int_copy(&{p}, pcc_p_{p});")
 
-    fn_declared: Set[str] = set()
-    _emit_block(fn.body, lines, state, var_types, fn_sigs, declared_vars=fn_declared)
+    lines.extend(_emit_body(fn.body, state, var_types, fn_sigs))
 
-    # Cleanup locals (excluding 'self' and parameters)
-    for name, ctype in var_types.items():
-        if name == "self" or name in fn.params:
-            continue
-        if ctype == "rt_str":
-            lines.append(f"    rt_str_clear(&{name});")
-        elif ctype == "rt_int":
-            lines.append(f"    rt_int_clear(&{name});")
+    # Cleanup parameters
+    for p in fn.params:
+        lines.append(f"    rt_int_clear(&{p});")
 
     lines.append("}")
     lines.append("")
     return lines
 
 
-def _emit_function(fn: FunctionDef, fn_sigs: Dict[str, int]) -> List[str]:
+def _emit_function(fn: FunctionDef, fn_sigs: Dict[str, int], literals: Dict[Union[str, int], str],
+                   use_ranges: bool = False, native_fns: Optional[Set[str]] = None,
+                   pure_fns: Optional[Set[str]] = None,
+                   workers: Optional[List[List[str]]] = None) -> List[str]:
     """Emit C code for a function definition.
 
     Args:
         fn: Function definition IR
         fn_sigs: Function signatures map
+        literals: Literal constants of the module, added to as used
+        use_ranges: Whether to store integer locals with inferred 64-bit ranges
+                    as int64_t
+        native_fns: Functions with an int64_t entry point, tried first
+        pure_fns: With --parallel, the functions a parallel loop may call
+        workers: Worker functions of the module's parallel loops, added to
 
     Returns:
         List of C code lines
@@ -713,8 +1702,12 @@ def _emit_function(fn: FunctionDef, fn_sigs: Dict[str, int]) -> List[str]:
     lines = []
     params = ", ".join([f"rt_int* pcc_p_{p}" for p in fn.params])
     lines.append(f"static void pcc_fn_{fn.name}(rt_int* out, {params}) {{")
+    if native_fns and fn.name in native_fns:
+        lines.extend(_emit_native_entry(fn))
 
-    state = _CodegenState()
+    ranges = infer_ranges(fn.body, fn.params) if use_ranges else None
+    parallel = find_parallel_loops(fn.body, pure_fns) if pure_fns is not None and use_ranges else None
+    state = _CodegenState(fn.params, literals, ranges, native_fns, parallel, workers)
     var_types: Dict[str, str] = {}
 
     # Initialize parameters
@@ -723,21 +1716,269 @@ def _emit_function(fn: FunctionDef, fn_sigs: Dict[str, int]) -> List[str]:
         lines.append(f"    rt_int {p}; rt_int_init(&{p});")
         lines.append(f"    rt_int_copy(&{p}, pcc_p_{p});")
 
-    fn_declared: Set[str] = set()
-    _emit_block(fn.body, lines, state, var_types, fn_sigs, declared_vars=fn_declared)
+    lines.extend(_emit_body(fn.body, state, var_types, fn_sigs))
 
-    # Cleanup locals
-    for name, ctype in var_types.items():
-        if ctype == "rt_str":
-            lines.append(f"    rt_str_clear(&{name});")
+    # Cleanup parameters
+    for p in fn.params:
+        lines.append(f"    rt_int_clear(&{p});")
+
+    lines.append("}")
+    lines.append("")
+    return lines
+
+
+# ==================== Native entry points ====================
+
+# Builtins a native entry point computes, with their arities
+_NATIVE_FN_BUILTINS = {"abs": 1, "int": 1, "min": 2, "max": 2}
+
+
+def _native_fn_expr_ok(expr: Expr, calls: Set[str]) -> bool:
+    """Check that an expression only computes integers, adding its callees to calls."""
+    if isinstance(expr, IntConst):
+        return _small_int(expr) is not None
+    if isinstance(expr, Var):
+        return True
+    if isinstance(expr, BinOp):
+        if expr.op in ("<<", ">>") and expr.right.value >= 63:
+            return False
+        if expr.op == "&" and _small_int(expr.right) is None:
+            return False
+        return _native_fn_expr_ok(expr.left, calls) and _native_fn_expr_ok(expr.right, calls)
+    if isinstance(expr, Call):
+        calls.add(expr.func)
+        return all(_native_fn_expr_ok(arg, calls) for arg in expr.args)
+    if isinstance(expr, BuiltinCall):
+        return _NATIVE_FN_BUILTINS.get(expr.name) == len(expr.args) \
+            and all(_native_fn_expr_ok(arg, calls) for arg in expr.args)
+    return False
+
+
+def _native_fn_test_ok(expr: Expr, calls: Set[str]) -> bool:
+    """Check an if or while test of an entry point: a comparison or an integer."""
+    if isinstance(expr, CmpOp):
+        return _native_fn_expr_ok(expr.left, calls) and _native_fn_expr_ok(expr.right, calls)
+    return _native_fn_expr_ok(expr, calls)
+
+
+def _native_fn_block_ok(stmts: List[Stmt], calls: Set[str]) -> bool:
+    """Check that a block only uses statements an entry point can emit."""
+    for stmt in stmts:
+        if isinstance(stmt, Assign):
+            ok = _native_fn_expr_ok(stmt.expr, calls)
+        elif isinstance(stmt, Return):
+            ok = stmt.expr is not None and _native_fn_expr_ok(stmt.expr, calls)
+        elif isinstance(stmt, If):
+            ok = _native_fn_test_ok(stmt.test, calls) and _native_fn_block_ok(stmt.body, calls) \
+                and _native_fn_block_ok(stmt.orelse, calls)
+        elif isinstance(stmt, While):
+            ok = _native_fn_test_ok(stmt.test, calls) and _native_fn_block_ok(stmt.body, calls)
+        elif isinstance(stmt, ForRange):
+            ok = all(_native_fn_expr_ok(e, calls) for e in (stmt.start, stmt.stop, stmt.step)) \
+                and _native_fn_block_ok(stmt.body, calls)
         else:
-            lines.append(f"    rt_int_clear(&{name});")
+            ok = isinstance(stmt, (Break, Continue))
+        if not ok:
+            return False
+    return True
+
+
+def _native_int_functions(functions: List[FunctionDef]) -> Set[str]:
+    """Find the functions that get an int64_t entry point.
+
+    Their locals and results are all integers and they have no effect
+    besides their result: no output, strings or objects, and they only call
+    each other. The entry point can therefore give up at any step that
+    would leave int64_t (or raise), and the BigInt version then makes the
+    whole call again.
+    """
+    callees: Dict[str, Set[str]] = {}
+    for fn in functions:
+        calls: Set[str] = set()
+        if _native_fn_block_ok(fn.body, calls):
+            callees[fn.name] = calls
+    found = set(callees)
+    changed = True
+    while changed:
+        changed = False
+        for name in sorted(found):
+            if not callees[name] <= found:
+                found.discard(name)
+                changed = True
+    return found
+
+
+def _native_fn_call(name: str, out: str, args: List[str]) -> str:
+    """C call of an entry point, non-zero when it computed the result."""
+    return f"pcc_fn_{name}_si({', '.join([out] + args)})"
+
+
+def _emit_checked(expr: Expr, lines: List[str], state: _CodegenState) -> str:
+    """Emit an int64_t expression of an entry point, giving up where it leaves int64_t."""
+    if isinstance(expr, IntConst):
+        return _c_int64_literal(expr.value)
 
+    if isinstance(expr, Var):
+        return expr.name
+
+    if isinstance(expr, BinOp):
+        left = _emit_checked(expr.left, lines, state)
+        if expr.op in (">>", "&"):
+            return _NATIVE_BINOPS[expr.op].format(l=left, r=_c_int64_literal(expr.right.value))
+        temp = state.next_temp()
+        lines.append(f"    int64_t {temp};")
+        if expr.op == "<<":
+            lines.append(f"    if (rt_si_mul_overflow({left}, {_c_int64_literal(1 << expr.right.value)}, &{temp})) return 0;")
+            return temp
+        right = _emit_checked(expr.right, lines, state)
+        checked = {"+": "add", "-": "sub", "*": "mul"}
+        if expr.op in checked:
+            lines.append(f"    if (rt_si_{checked[expr.op]}_overflow({left}, {right}, &{temp})) return 0;")
+            return temp
+        if _small_int(expr.right) in (None, 0, -1):
+            # Raises, or overflows for INT64_MIN // -1: left to the BigInt version
+            lines.append(f"    if ({right} == 0 || ({right} == -1 && {left} == INT64_MIN)) return 0;")
+        lines.append(f"    {temp} = {_NATIVE_BINOPS[expr.op].format(l=left, r=right)};")
+        return temp
+
+    if isinstance(expr, Call):
+        args = [_emit_checked(arg, lines, state) for arg in expr.args]
+        temp = state.next_temp()
+        lines.append(f"    int64_t {temp};")
+        lines.append(f"    if (!{_native_fn_call(expr.func, '&' + temp, args)}) return 0;")
+        return temp
+
+    if isinstance(expr, BuiltinCall):
+        args = [_emit_checked(arg, lines, state) for arg in expr.args]
+        if expr.name == "int":
+            return args[0]
+        if expr.name == "abs":
+            lines.append(f"    if ({args[0]} == INT64_MIN) return 0;")
+            return f"rt_math_abs_si({args[0]})"
+        return f"rt_math_{expr.name}_si({args[0]}, {args[1]})"
+
+    raise ValueError(f"Expression has no native form: {type(expr).__name__}")
+
+
+def _emit_checked_test(expr: Expr, lines: List[str], state: _CodegenState) -> str:
+    """Emit an if or while test of an entry point as a parenthesized C condition."""
+    if isinstance(expr, CmpOp):
+        left = _emit_checked(expr.left, lines, state)
+        right = _emit_checked(expr.right, lines, state)
+        return f"({left} {expr.op} {right})"
+    return f"({_emit_checked(expr, lines, state)} != 0)"
+
+
+def _emit_checked_block(stmts: List[Stmt], lines: List[str], state: _CodegenState,
+                        continue_stmt: str) -> None:
+    """Emit the statements of an entry point.
+
+    Args:
+        continue_stmt: C statement a continue becomes in the innermost loop
+    """
+    for stmt in stmts:
+        if isinstance(stmt, Assign):
+            value = _emit_checked(stmt.expr, lines, state)
+            if stmt.name not in state.params:
+                state.declare_local(stmt.name, "int64_t")
+            lines.append(f"    {stmt.name} = {value};")
+
+        elif isinstance(stmt, Return):
+            value = _emit_checked(stmt.expr, lines, state)
+            lines.append(f"    *out = {value};")
+            lines.append("    return 1;")
+
+        elif isinstance(stmt, If):
+            test = _emit_checked_test(stmt.test, lines, state)
+            lines.append(f"    if {test} {{")
+            _emit_checked_block(stmt.body, lines, state, continue_stmt)
+            if stmt.orelse:
+                lines.append("    } else {")
+                _emit_checked_block(stmt.orelse, lines, state, continue_stmt)
+            lines.append("    }")
+
+        elif isinstance(stmt, While):
+            # The test is re-emitted inside so that continue re-evaluates it
+            lines.append("    for (;;) {")
+            test = _emit_checked_test(stmt.test, lines, state)
+            lines.append(f"    if (!{test}) break;")
+            _emit_checked_block(stmt.body, lines, state, "continue;")
+            lines.append("    }")
+
+        elif isinstance(stmt, ForRange):
+            start = _emit_checked(stmt.start, lines, state)
+            stop = _emit_checked(stmt.stop, lines, state)
+            step = _emit_checked(stmt.step, lines, state)
+            counter, stop_var, step_var = state.next_temp(), state.next_temp(), state.next_temp()
+            next_label = state.next_label("for_next")
+            if stmt.var not in state.params:
+                state.declare_local(stmt.var, "int64_t")
+            lines.append(f"    int64_t {counter} = {start}, {stop_var} = {stop}, {step_var} = {step};")
+            lines.append(f"    if ({step_var} == 0) return 0;")
+            lines.append(f"    while ({step_var} > 0 ? {counter} < {stop_var} : {counter} > {stop_var}) {{")
+            lines.append(f"    {stmt.var} = {counter};")
+            _emit_checked_block(stmt.body, lines, state, f"goto {next_label};")
+            lines.append(f"    {next_label}:")
+            # Past INT64_MAX the counter is past any int64_t stop
+            lines.append(f"    if (rt_si_add_overflow({counter}, {step_var}, &{counter})) break;")
+            lines.append("    }")
+
+        elif isinstance(stmt, Break):
+            lines.append("    break;")
+
+        elif isinstance(stmt, Continue):
+            lines.append(f"    {continue_stmt}")
+
+
+def _native_fn_params(fn: FunctionDef) -> str:
+    """C parameter list of an entry point."""
+    return ", ".join(["int64_t* out"] + [f"int64_t {p}" for p in fn.params])
+
+
+def _emit_native_function(fn: FunctionDef) -> List[str]:
+    """Emit the int64_t entry point of a function.
+
+    It computes the function's result in int64_t arithmetic, checking every
+    step, and returns 1 with the result in *out; it returns 0 as soon as a
+    value would leave int64_t or an operation would raise, and the caller
+    then makes the call through the BigInt version instead.
+
+    Args:
+        fn: Function definition IR, one of _native_int_functions
+
+    Returns:
+        List of C code lines
+    """
+    state = _CodegenState(fn.params)
+    body: List[str] = []
+    _emit_checked_block(fn.body, body, state, "continue;")
+
+    lines = [f"static int pcc_fn_{fn.name}_si({_native_fn_params(fn)}) {{"]
+    for name in state.locals:
+        lines.append(f"    int64_t {name} = 0;")
+    lines.extend(body)
+    # Falling off the end returns None, which only the BigInt version has
+    lines.append("    return 0;")
     lines.append("}")
     lines.append("")
     return lines
 
 
+def _emit_native_entry(fn: FunctionDef) -> List[str]:
+    """Emit the start of a BigInt function that first tries its int64_t entry point."""
+    values = [f"pcc_si_{p}" for p in fn.params]
+    conds = [f"rt_int_to_si_checked(pcc_p_{p}, &pcc_si_{p}) == RT_OK" for p in fn.params]
+    conds.append(_native_fn_call(fn.name, "&pcc_si_out", values))
+    decls = ", ".join(["pcc_si_out"] + values)
+    return [
+        f"    int64_t {decls};",
+        f"    if ({' && '.join(conds)}) {{",
+        "        rt_int_set_si(out, pcc_si_out);",
+        "        return;",
+        "    }",
+    ]
+
+
 class CodeGenerator:
     """C code generator for pcc.
 
@@ -753,6 +1994,20 @@ class CodeGenerator:
         >>> print(c_source.c_source)
     """
 
+    def __init__(self, infer_ranges: bool = False, parallel: bool = False) -> None:
+        """Initialize the code generator.
+
+        Args:
+            infer_ranges: Store integer variables whose values provably fit
+                          in 64 bits as int64_t instead of BigInt, promoting
+                          results that may overflow
+            parallel: Run range() loops with independent iterations on the
+                      runtime thread pool; needs infer_ranges, since only
+                      loops with an int64_t counter are split
+        """
+        self.infer_ranges = infer_ranges
+        self.parallel = parallel
+
     def generate(self, module: ModuleIR) -> CSource:
         """Convert the IR module to C source code.
 
@@ -778,10 +2033,16 @@ class CodeGenerator:
         for class_def in module.classes:
             lines.extend(_emit_class_struct(class_def))
 
+        # Pure integer functions also get a checked int64_t entry point,
+        # which needs the int64_t locals of range inference to pay off
+        native_fns = _native_int_functions(module.functions) if self.infer_ranges else set()
+
         # Emit function forward declarations (prototypes)
         for fn in module.functions:
             params = ", ".join([f"rt_int* pcc_p_{p}" for p in fn.params])
             lines.append(f"static void pcc_fn_{fn.name}(rt_int* out, {params});")
+            if fn.name in native_fns:
+                lines.append(f"static int pcc_fn_{fn.name}_si({_native_fn_params(fn)});")
 
         # Emit method forward declarations
         for class_def in module.classes:
@@ -797,35 +2058,46 @@ class CodeGenerator:
             lines.extend(_emit_class_constructor(class_def))
             lines.extend(_emit_class_destructor(class_def))
 
+        # Function bodies are emitted first to collect the string literals
+        # and the workers of parallel loops
+        literals: Dict[Union[str, int], str] = {}
+        body: List[str] = []
+        pure_fns = pure_functions(module.functions) if self.parallel else None
+        workers: List[List[str]] = []
+
         # Emit function definitions
         for fn in module.functions:
-            lines.extend(_emit_function(fn, fn_sigs))
+            if fn.name in native_fns:
+                body.extend(_emit_native_function(fn))
+            body.extend(_emit_function(fn, fn_sigs, literals, self.infer_ranges, native_fns,
+                                       pure_fns, workers))
 
         # Emit method definitions
         for class_def in module.classes:
             for method in class_def.methods:
-                lines.extend(_emit_method(class_def, method, fn_sigs))
+                body.extend(_emit_method(class_def, method, fn_sigs, literals, self.infer_ranges,
+                                         native_fns, pure_fns, workers))
 
         # Emit main function
-        lines.append("int main(void) {")
-
-        state = _CodegenState()
+        ranges = infer_ranges(module.main) if self.infer_ranges else None
+        parallel = find_parallel_loops(module.main, pure_fns) \
+            if pure_fns is not None and self.infer_ranges else None
+        state = _CodegenState(literals=literals, ranges=ranges, native_fns=native_fns,
+                              parallel=parallel, workers=workers)
         var_types: Dict[str, str] = {}
 
-        main_declared: Set[str] = set()
-        _emit_block(module.main, lines, state, var_types, fn_sigs, declared_vars=main_declared)
-
-        # Cleanup main locals
-        for name, ctype in var_types.items():
-            if ctype == "rt_str":
-                lines.append(f"    rt_str_clear(&{name});")
-            elif ctype.startswith("pcc_class_"):
-                # Object pointers are not cleaned up here to avoid double-free
-                # They will be cleaned up when the program exits
-                pass
-            else:
-                lines.append(f"    rt_int_clear(&{name});")
+        # Object pointers are not cleaned up here to avoid double-free;
+        # they are released when the program exits
+        main_body = _emit_body(module.main, state, var_types, fn_sigs)
 
+        lines.extend(_emit_literals(literals))
+        for worker in workers:
+            lines.extend(worker)
+        lines.extend(body)
+        lines.append("int main(void) {")
+        if literals:
+            lines.append("    pcc_init_literals();")
+        lines.extend(main_body)
         lines.append("    return 0;")
         lines.append("}")
 
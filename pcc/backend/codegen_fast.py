@@ -13,6 +13,7 @@ from ..ir import (
     IntConst, StrConst, Var, BinOp, CmpOp, Call, AttributeAccess, MethodCall, ConstructorCall, BuiltinCall,
     Assign, AttrAssign, MethodCallStmt, Print, If, While, ForRange, Return, Break, Continue
 )
+from ..ir.parallel import ParallelLoop, find_parallel_loops, pure_functions
 
 
 @dataclass(frozen=True)
@@ -28,6 +29,10 @@ class _CodegenState:
         self.temp_counter = 0
         self.label_counter = 0
         self.temp_types: Dict[str, str] = {}  # temp_name -> type ("long long" or "rt_str")
+        self.literals: Dict[str, str] = {}  # string literal value -> constant name
+        self.parallel: Dict[int, ParallelLoop] = {}  # parallel loops of the body being emitted
+        self.workers: List[List[str]] = []  # worker functions of the parallel loops
+        self.hoisted: Optional[List[str]] = None  # declarations of the locals first assigned in a block
 
     def next_temp(self, type_hint: str = "long long") -> str:
         """Generate a unique temporary variable name."""
@@ -36,16 +41,28 @@ class _CodegenState:
         self.temp_types[temp_name] = type_hint
         return temp_name
 
+    def literal(self, value: str) -> str:
+        """Get the interned module-level constant holding a string literal."""
+        if value not in self.literals:
+            self.literals[value] = f"pcc_lit_{len(self.literals)}"
+        return self.literals[value]
+
     def get_temp_type(self, temp_name: str) -> str:
         """Get the type of a temporary variable."""
         return self.temp_types.get(temp_name, "long long")
 
     def next_label(self, prefix: str) -> str:
-        """Generate a unique label name."""
+        """Generate a unique label or local name."""
         self.label_counter += 1
         return f"{prefix}_{self.label_counter}"
 
 
+def _c_string_literal(value: str) -> str:
+    """Quote a Python string as a C string literal."""
+    escaped = value.replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n').replace('\t', '\\t')
+    return f'"{escaped}"'
+
+
 def _ctype_for_var(name: str, var_types: Dict[str, str]) -> str:
     """Get the C type for a variable."""
     return var_types.get(name, "long long")
@@ -61,9 +78,63 @@ def _expr_produces_string(expr: Expr, var_types: Dict[str, str]) -> bool:
         left_is_str = _expr_produces_string(expr.left, var_types)
         right_is_str = _expr_produces_string(expr.right, var_types)
         return left_is_str and right_is_str
+    if isinstance(expr, BuiltinCall):
+        return expr.name == "str"
     return False
 
 
+def _concat_parts(expr: Expr, var_types: Dict[str, str]) -> List[Expr]:
+    """Flatten a chain of string concatenations into its operands, in order."""
+    if isinstance(expr, BinOp) and expr.op == "+" and _expr_produces_string(expr, var_types):
+        return _concat_parts(expr.left, var_types) + _concat_parts(expr.right, var_types)
+    return [expr]
+
+
+def _match_str_append(name: str, expr: Expr, var_types: Dict[str, str]) -> Optional[List[Expr]]:
+    """Match `s = s + x + ...` on a string variable s, returning the operands to append."""
+    if var_types.get(name) != "rt_str":
+        return None
+    parts = _concat_parts(expr, var_types)
+    if len(parts) < 2 or parts[0] != Var(name) or Var(name) in parts[1:]:
+        return None
+    return parts[1:]
+
+
+def _emit_concat_into(
+    target: str,
+    parts: List[Expr],
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> None:
+    """Append the concatenation of parts to the string builder target.
+
+    The final size is reserved once; literals and str(n) are appended
+    without building a temporary string.
+    """
+    pieces = []
+    for part in parts:
+        if isinstance(part, StrConst):
+            size = len(part.value.encode("utf-8"))
+            pieces.append((f"rt_strbuf_append_bytes(&{target}, {_c_string_literal(part.value)}, {size});", str(size)))
+        elif isinstance(part, BuiltinCall) and part.name == "str":
+            arg = _emit_expr(part.args[0], lines, state, var_types, fn_sigs)
+            if arg.startswith("&"):
+                # Out-of-range literal or variable held as a BigInt
+                pieces.append((f"rt_strbuf_append_int(&{target}, {arg});", f"rt_int_to_buffer_size({arg})"))
+            else:
+                # 19 digits and a sign cover any long long
+                pieces.append((f"rt_strbuf_append_si(&{target}, {arg});", "20"))
+        else:
+            value = _emit_expr(part, lines, state, var_types, fn_sigs)
+            pieces.append((f"rt_strbuf_append(&{target}, {value});", f"{value}.len"))
+
+    lines.append(f"    rt_strbuf_reserve(&{target}, {' + '.join(size for _, size in pieces)});")
+    for append, _ in pieces:
+        lines.append(f"    {append}")
+
+
 def _needs_hpf(expr: Expr) -> bool:
     """Check if expression needs HPF (value exceeds 64-bit range)."""
     if isinstance(expr, IntConst):
@@ -94,10 +165,8 @@ def _emit_expr(
             return f"&{temp}"
 
     if isinstance(expr, StrConst):
-        temp = state.next_temp(type_hint="rt_str")
-        escaped = expr.value.replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n').replace('\t', '\\t')
-        lines.append(f'    rt_str {temp} = rt_str_from_cstr("{escaped}");')
-        return temp
+        # Interned at startup: no allocation, nothing to free
+        return state.literal(expr.value)
 
     if isinstance(expr, Var):
         ctype = _ctype_for_var(expr.name, var_types)
@@ -110,55 +179,50 @@ def _emit_expr(
             return expr.name
 
     if isinstance(expr, BinOp):
+        if expr.op == "+" and _expr_produces_string(expr, var_types):
+            # String concatenation: build the whole chain in one buffer
+            temp = state.next_temp(type_hint="rt_str")
+            lines.append(f"    rt_str {temp} = rt_str_null();")
+            _emit_concat_into(temp, _concat_parts(expr, var_types), lines, state, var_types, fn_sigs)
+            return temp
+
         left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
         right = _emit_expr(expr.right, lines, state, var_types, fn_sigs)
+
+        # Integer arithmetic - use native long long operations
+        temp = state.next_temp(type_hint="long long")
+        lines.append(f"    long long {temp};")
         
-        # Check if this is a string concatenation
-        left_is_str = isinstance(expr.left, StrConst)
-        if isinstance(expr.left, Var) and var_types.get(expr.left.name) == "rt_str":
-            left_is_str = True
-        if isinstance(expr.left, BinOp):
-            left_is_str = _expr_produces_string(expr.left, var_types)
-
-        right_is_str = isinstance(expr.right, StrConst)
-        if isinstance(expr.right, Var) and var_types.get(expr.right.name) == "rt_str":
-            right_is_str = True
-        if isinstance(expr.right, BinOp):
-            right_is_str = _expr_produces_string(expr.right, var_types)
-
-        if left_is_str and right_is_str and expr.op == "+":
-            # String concatenation
-            temp = state.next_temp(type_hint="rt_str")
-            lines.append(f"    rt_str {temp} = rt_str_concat({left}, {right});")
-            return temp
+        if expr.op == "+":
+            lines.append(f"    {temp} = {left} + {right};")
+        elif expr.op == "-":
+            lines.append(f"    {temp} = {left} - {right};")
+        elif expr.op == "*":
+            lines.append(f"    {temp} = {left} * {right};")
+        elif expr.op == "//":
+            # Python floor division: floor(a / b)
+            # C truncates toward zero, so we need to adjust for negative results
+            lines.append(f"    {temp} = {left} / {right};")
+            lines.append(f"    if (({left} < 0) != ({right} < 0) && {left} % {right} != 0) {{")
+            lines.append(f"        {temp} -= 1;")
+            lines.append(f"    }}")
+        elif expr.op == "%":
+            # Python modulo: result has same sign as divisor (always non-negative for positive divisor)
+            # C's % has same sign as dividend
+            lines.append(f"    {temp} = {left} % {right};")
+            lines.append(f"    if (({left} < 0) != ({right} < 0) && {temp} != 0) {{")
+            lines.append(f"        {temp} += {right};")
+            lines.append(f"    }}")
+        elif expr.op == "<<":
+            # Shifts and masks come from strength reduction, by a constant
+            lines.append(f"    {temp} = {left} * (1LL << {right});")
+        elif expr.op == ">>":
+            lines.append(f"    {temp} = {left} >> {right};")
+        elif expr.op == "&":
+            lines.append(f"    {temp} = {left} & {right};")
         else:
-            # Integer arithmetic - use native long long operations
-            temp = state.next_temp(type_hint="long long")
-            lines.append(f"    long long {temp};")
-            
-            if expr.op == "+":
-                lines.append(f"    {temp} = {left} + {right};")
-            elif expr.op == "-":
-                lines.append(f"    {temp} = {left} - {right};")
-            elif expr.op == "*":
-                lines.append(f"    {temp} = {left} * {right};")
-            elif expr.op == "//":
-                # Python floor division: floor(a / b)
-                # C truncates toward zero, so we need to adjust for negative results
-                lines.append(f"    {temp} = {left} / {right};")
-                lines.append(f"    if (({left} < 0) != ({right} < 0) && {left} % {right} != 0) {{")
-                lines.append(f"        {temp} -= 1;")
-                lines.append(f"    }}")
-            elif expr.op == "%":
-                # Python modulo: result has same sign as divisor (always non-negative for positive divisor)
-                # C's % has same sign as dividend
-                lines.append(f"    {temp} = {left} % {right};")
-                lines.append(f"    if (({left} < 0) != ({right} < 0) && {temp} != 0) {{")
-                lines.append(f"        {temp} += {right};")
-                lines.append(f"    }}")
-            else:
-                raise ValueError(f"Unsupported binary operator: {expr.op}")
-            return temp
+            raise ValueError(f"Unsupported binary operator: {expr.op}")
+        return temp
 
     if isinstance(expr, CmpOp):
         left = _emit_expr(expr.left, lines, state, var_types, fn_sigs)
@@ -168,28 +232,10 @@ def _emit_expr(
         return f"({temp} != 0)"
 
     if isinstance(expr, Call):
-        arg_exprs = []
-        for arg in expr.args:
-            # For function calls, arguments need to be passed as pointers
-            # So we need to store literals in temporaries
-            if isinstance(arg, IntConst):
-                # Create a temporary for the literal
-                temp_arg = state.next_temp(type_hint="long long")
-                lines.append(f"    long long {temp_arg} = {arg.value}LL;")
-                arg_exprs.append(f"&{temp_arg}")
-            elif isinstance(arg, Var):
-                # Variables need address-of operator
-                arg_exprs.append(f"&{_emit_expr(arg, lines, state, var_types, fn_sigs)}")
-            else:
-                # Other expressions - emit and take address
-                arg_expr = _emit_expr(arg, lines, state, var_types, fn_sigs)
-                arg_exprs.append(f"&{arg_expr}")
-
+        # Arguments and the result are passed by value, in registers
+        arg_exprs = [_emit_expr(arg, lines, state, var_types, fn_sigs) for arg in expr.args]
         temp = state.next_temp(type_hint="long long")
-        lines.append(f"    long long {temp};")
-
-        args_str = ", ".join(arg_exprs)
-        lines.append(f"    pcc_fn_{expr.func}(&{temp}, {args_str});")
+        lines.append(f"    long long {temp} = pcc_fn_{expr.func}({', '.join(arg_exprs)});")
         return temp
 
     if isinstance(expr, AttributeAccess):
@@ -300,8 +346,17 @@ def _emit_builtin_call(
             lines.append(f"    long long {temp} = rt_math_pow_si({arg_exprs[0]}, {arg_exprs[1]});")
             return temp
         elif len(arg_exprs) == 3:
-            # Three-argument pow() for modular exponentiation - not supported yet
-            raise ValueError("pow() with 3 arguments (modular) not supported")
+            # Modular exponentiation, reduced on every step
+            temp = state.next_temp(type_hint="long long")
+            lines.append(f"    long long {temp} = rt_math_powmod_si({arg_exprs[0]}, {arg_exprs[1]}, {arg_exprs[2]});")
+            return temp
+    
+    elif expr.name == 'isqrt':
+        # isqrt() returns floor(sqrt(n))
+        arg = arg_exprs[0]
+        temp = state.next_temp(type_hint="long long")
+        lines.append(f"    long long {temp} = rt_math_sqrt_si({arg});")
+        return temp
     
     elif expr.name == 'str':
         # str() converts to string
@@ -320,21 +375,64 @@ def _emit_builtin_call(
     raise ValueError(f"Unknown builtin: {expr.name}")
 
 
+def _new_var_type(expr: Expr, var_types: Dict[str, str]) -> str:
+    """C type of a variable first assigned an expression."""
+    if isinstance(expr, StrConst) or _expr_produces_string(expr, var_types):
+        return "rt_str"
+    if _needs_hpf(expr):
+        return "rt_int"
+    return "long long"
+
+
+def _hoist_local(name: str, ctype: str, state: _CodegenState) -> None:
+    """Declare a local before the outermost block being emitted."""
+    if ctype == "rt_str":
+        state.hoisted.append(f"    rt_str {name} = rt_str_null();")
+    elif ctype == "rt_int":
+        state.hoisted.append(f"    rt_int {name}; rt_int_init(&{name});")
+    else:
+        state.hoisted.append(f"    long long {name} = 0;")
+
+
 def _emit_stmt(
     stmt: Stmt,
     lines: List[str],
     state: _CodegenState,
     var_types: Dict[str, str],
     fn_sigs: Dict[str, int],
-    in_loop: bool = False,
-    break_label: Optional[str] = None,
-    continue_label: Optional[str] = None
+    in_loop: bool = False
 ) -> None:
     """Emit code for a statement."""
-    
+    if isinstance(stmt, (If, While, ForRange)) and state.hoisted is None:
+        # Blocks are C blocks: the locals they assign first are declared
+        # before the outermost one, where code after it can still see them
+        state.hoisted = []
+        block: List[str] = []
+        _emit_stmt(stmt, block, state, var_types, fn_sigs, in_loop)
+        lines.extend(state.hoisted)
+        lines.extend(block)
+        state.hoisted = None
+        return
+
     if isinstance(stmt, Assign):
-        expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
+        appended = _match_str_append(stmt.name, stmt.expr, var_types)
+        if appended is not None:
+            # s = s + ...: append in place with amortized growth
+            _emit_concat_into(stmt.name, appended, lines, state, var_types, fn_sigs)
+            return
+
+        if isinstance(stmt.expr, Var) and var_types.get(stmt.expr.name) == "rt_str":
+            # Take a reference rather than copy the struct: either variable
+            # then copies the bytes before appending to them in place
+            expr_result = f"rt_str_share({stmt.expr.name})"
+        else:
+            expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
         
+        if stmt.name not in var_types and state.hoisted is not None:
+            ctype = _new_var_type(stmt.expr, var_types)
+            var_types[stmt.name] = ctype
+            _hoist_local(stmt.name, ctype, state)
+
         # Check if variable already exists
         if stmt.name in var_types:
             # Variable already declared, just assign
@@ -380,79 +478,86 @@ def _emit_stmt(
             lines.append(f"    rt_print_int({expr_result});")
         else:
             # Print long long directly
-            lines.append(f"    printf(\"%lld\\n\", {expr_result});")
+            lines.append(f"    rt_print_si({expr_result});")
         return
 
     if isinstance(stmt, If):
         test_result = _emit_expr(stmt.test, lines, state, var_types, fn_sigs)
         lines.append(f"    if ({test_result}) {{")
         for s in stmt.body:
-            _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop, break_label, continue_label)
+            _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop)
         if stmt.orelse:
             lines.append("    } else {")
             for s in stmt.orelse:
-                _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop, break_label, continue_label)
+                _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop)
         lines.append("    }")
         return
 
     if isinstance(stmt, While):
-        start_label = state.next_label("while_start")
-        end_label = state.next_label("while_end")
-        lines.append(f"{start_label}:")
-        test_result = _emit_expr(stmt.test, lines, state, var_types, fn_sigs)
-        lines.append(f"    if (!({test_result})) goto {end_label};")
+        test_lines: List[str] = []
+        test_result = _emit_expr(stmt.test, test_lines, state, var_types, fn_sigs)
+        if test_lines:
+            # The test needs statements of its own: evaluate it at the top of each pass
+            lines.append("    for (;;) {")
+            lines.extend(test_lines)
+            lines.append(f"    if (!({test_result})) break;")
+        else:
+            lines.append(f"    while ({test_result}) {{")
         for s in stmt.body:
-            _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop=True, break_label=end_label, continue_label=start_label)
-        lines.append(f"    goto {start_label};")
-        lines.append(f"{end_label}:")
+            _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop=True)
+        lines.append("    }")
+        return
+
+    if isinstance(stmt, ForRange) and _parallel_plan(stmt, state, var_types) is not None:
+        _emit_parallel_for(stmt, lines, state, var_types, fn_sigs)
         return
 
     if isinstance(stmt, ForRange):
-        # Emit loop variable initialization
+        # A counter of its own, with the bounds and step in constants, makes
+        # a countable loop the C compiler can unroll and vectorize; the body
+        # may then also assign the loop variable, as in Python
+        if stmt.var not in var_types:
+            var_types[stmt.var] = "long long"
+            _hoist_local(stmt.var, "long long", state)
+        counter = state.next_label("pcc_ctr")
         start_result = _emit_expr(stmt.start, lines, state, var_types, fn_sigs)
-        var_types[stmt.var] = "long long"
-        lines.append(f"    long long {stmt.var} = {start_result};")
-        
-        # Get stop and step values
         stop_result = _emit_expr(stmt.stop, lines, state, var_types, fn_sigs)
         step_result = _emit_expr(stmt.step, lines, state, var_types, fn_sigs)
-        
-        start_label = state.next_label("for_start")
-        end_label = state.next_label("for_end")
-        continue_label = state.next_label("for_continue")
-        
-        lines.append(f"{start_label}:")
-        # Check step direction for loop condition
-        lines.append(f"    if ({step_result} > 0) {{")
-        lines.append(f"        if ({stmt.var} >= {stop_result}) goto {end_label};")
-        lines.append(f"    }} else {{")
-        lines.append(f"        if ({stmt.var} <= {stop_result}) goto {end_label};")
-        lines.append(f"    }}")
+        lines.append("    {")
+        lines.append(f"    const long long {counter}_stop = {stop_result};")
+        lines.append(f"    const long long {counter}_step = {step_result};")
+        if isinstance(stmt.step, IntConst) and stmt.step.value > 0:
+            test = f"{counter} < {counter}_stop"
+        elif isinstance(stmt.step, IntConst):
+            test = f"{counter} > {counter}_stop"
+        else:
+            test = f"{counter}_step > 0 ? {counter} < {counter}_stop : {counter} > {counter}_stop"
+        lines.append(f"    for (long long {counter} = {start_result}; {test}; {counter} += {counter}_step) {{")
+        lines.append(f"    {stmt.var} = {counter};")
         for s in stmt.body:
-            _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop=True, break_label=end_label, continue_label=continue_label)
-        lines.append(f"{continue_label}:")
-        lines.append(f"    {stmt.var} += {step_result};")
-        lines.append(f"    goto {start_label};")
-        lines.append(f"{end_label}:")
+            _emit_stmt(s, lines, state, var_types, fn_sigs, in_loop=True)
+        lines.append("    }")
+        lines.append("    }")
         return
 
     if isinstance(stmt, Return):
         if stmt.expr:
             expr_result = _emit_expr(stmt.expr, lines, state, var_types, fn_sigs)
-            lines.append(f"    *pcc_ret = {expr_result};")
-        lines.append("    return;")
+            lines.append(f"    return {expr_result};")
+        else:
+            lines.append("    return 0;")
         return
 
     if isinstance(stmt, Break):
-        if not in_loop or break_label is None:
+        if not in_loop:
             raise ValueError("break outside of loop")
-        lines.append(f"    goto {break_label};")
+        lines.append("    break;")
         return
 
     if isinstance(stmt, Continue):
-        if not in_loop or continue_label is None:
+        if not in_loop:
             raise ValueError("continue outside of loop")
-        lines.append(f"    goto {continue_label};")
+        lines.append("    continue;")
         return
 
     if isinstance(stmt, MethodCallStmt):
@@ -468,6 +573,112 @@ def _emit_stmt(
     raise ValueError(f"Unsupported statement: {type(stmt).__name__}")
 
 
+def _parallel_plan(
+    stmt: ForRange,
+    state: _CodegenState,
+    var_types: Dict[str, str]
+) -> Optional[List[Tuple[str, str, Optional[str]]]]:
+    """Get the variables a parallel loop passes to its workers, if it is emitted as one.
+
+    The step must be a non-zero constant, inputs long long or strings and
+    reductions long long variables that already exist.
+
+    Returns:
+        (name, C type, reduction operator or None for an input) for each
+        variable, or None to emit the loop serially
+    """
+    loop = state.parallel.get(id(stmt))
+    if loop is None or not isinstance(stmt.step, IntConst) or stmt.step.value == 0:
+        return None
+    plan = []
+    for name in loop.inputs:
+        ctype = _ctype_for_var(name, var_types)
+        if ctype not in ("long long", "rt_str"):
+            return None
+        plan.append((name, ctype, None))
+    for name, op in loop.reductions.items():
+        if var_types.get(name) != "long long":
+            return None
+        plan.append((name, "long long", op))
+    return plan
+
+
+def _emit_parallel_for(
+    stmt: ForRange,
+    lines: List[str],
+    state: _CodegenState,
+    var_types: Dict[str, str],
+    fn_sigs: Dict[str, int]
+) -> None:
+    """Emit a range() loop with independent iterations as chunks run on the pool.
+
+    Each chunk of counter values runs the loop in a worker function with a
+    context holding its bounds, the inputs and one partial result per
+    reduction, combined in chunk order afterwards. Sums wrap like the
+    serial loop, in whatever order the chunks add up.
+    """
+    plan = _parallel_plan(stmt, state, var_types)
+    loop = state.parallel[id(stmt)]
+    name = f"pcc_par_{len(state.workers)}"
+    ctx, bounds, count, k = f"{name}_ctx", f"{name}_bounds", f"{name}_n", f"{name}_k"
+
+    # The worker takes the labels and temporaries it needs from the same counters
+    worker_types: Dict[str, str] = {"pcc_lo": "long long", "pcc_hi": "long long"}
+    worker: List[str] = []
+    fields = ["    long long pcc_lo, pcc_hi;"]
+    for var, ctype, op in plan:
+        worker_types[var] = ctype
+        fields.append(f"    {ctype} {var};")
+        worker.append(f"    {ctype} {var} = pcc_ctx->{var};")
+    chunk = ForRange(stmt.var, Var("pcc_lo"), Var("pcc_hi"), stmt.step, stmt.body, stmt.lineno)
+    hoisted, state.hoisted = state.hoisted, None
+    _emit_stmt(chunk, worker, state, worker_types, fn_sigs, in_loop=False)
+    state.hoisted = hoisted
+    for var, ctype, op in plan:
+        if op is not None:
+            worker.append(f"    pcc_ctx->{var} = {var};")
+        elif ctype == "rt_str":
+            worker.append(f"    rt_str_clear(&{var});")
+
+    state.workers.append(
+        ["typedef struct {"] + fields + [f"}} {name}_t;", ""]
+        + [f"static rt_error_code_t {name}(void* pcc_arg) {{",
+           f"    {name}_t* pcc_ctx = ({name}_t*)pcc_arg;",
+           "    long long pcc_lo = pcc_ctx->pcc_lo, pcc_hi = pcc_ctx->pcc_hi;"]
+        + worker + ["    return rt_error_last()->code;", "}", ""])
+
+    start = _emit_expr(stmt.start, lines, state, var_types, fn_sigs)
+    stop = _emit_expr(stmt.stop, lines, state, var_types, fn_sigs)
+    grain = "1" if loop.heavy else "RT_POOL_FOR_GRAIN"
+    lines.append(f"    int64_t {bounds}[RT_POOL_FOR_MAX_CHUNKS + 1];")
+    lines.append(f"    {name}_t {ctx}[RT_POOL_FOR_MAX_CHUNKS];")
+    lines.append(f"    size_t {count} = rt_pool_range_chunks({start}, {stop}, {stmt.step.value}LL, {grain}, {bounds});")
+    lines.append(f"    for (size_t {k} = 0; {k} < {count}; {k}++) {{")
+    lines.append(f"        {ctx}[{k}].pcc_lo = {bounds}[{k}];")
+    lines.append(f"        {ctx}[{k}].pcc_hi = {bounds}[{k} + 1];")
+    for var, ctype, op in plan:
+        if ctype == "rt_str":
+            # Shared here: a string with one reference is not safe to share from several threads
+            lines.append(f"        {ctx}[{k}].{var} = rt_str_share({var});")
+        else:
+            # Sums start from zero, minima and maxima from the current value
+            lines.append(f"        {ctx}[{k}].{var} = {'0' if op == '+' else var};")
+    lines.append("    }")
+    lines.append(f"    rt_pool_run({name}, {ctx}, sizeof({name}_t), {count});")
+
+    reductions = [(var, op) for var, _, op in plan if op is not None]
+    if not reductions:
+        return
+    lines.append(f"    for (size_t {k} = 0; {k} < {count}; {k}++) {{")
+    for var, op in reductions:
+        field = f"{ctx}[{k}].{var}"
+        if op == "+":
+            lines.append(f"        {var} += {field};")
+        else:
+            lines.append(f"        {var} = rt_math_{op}_si({var}, {field});")
+    lines.append("    }")
+
+
 def _emit_function(
     func: FunctionDef,
     lines: List[str],
@@ -477,23 +688,26 @@ def _emit_function(
     """Emit code for a function definition."""
     var_types: Dict[str, str] = {}
     
-    # Parameters are long long by default - passed by pointer for consistency
-    params = [f"long long* pcc_{p}" for p in func.params]
-    params_str = ", ".join(params) if params else "void"
-    
-    lines.append(f"void pcc_fn_{func.name}(long long* pcc_ret, {params_str}) {{")
-    
-    # Copy parameters to local variables for easier access
+    # Parameters are passed by value and are the function's locals
     for param in func.params:
         var_types[param] = "long long"
-        lines.append(f"    long long {param} = *pcc_{param};")
+    
+    lines.append(f"{_function_prototype(func)} {{")
     
     for stmt in func.body:
         _emit_stmt(stmt, lines, state, var_types, fn_sigs, in_loop=False)
     
+    # Falling off the end has no int value; 0 keeps the result defined
+    lines.append("    return 0;")
     lines.append("}")
 
 
+def _function_prototype(func: FunctionDef) -> str:
+    """C prototype of a function: long long parameters and result, by value."""
+    params = ", ".join(f"long long {p}" for p in func.params) or "void"
+    return f"long long pcc_fn_{func.name}({params})"
+
+
 def _emit_class(cls: ClassDef, lines: List[str], state: _CodegenState) -> None:
     """Emit code for a class definition."""
     # Emit class struct and methods
@@ -501,10 +715,17 @@ def _emit_class(cls: ClassDef, lines: List[str], state: _CodegenState) -> None:
     lines.append(f"typedef struct {{ long long value; }} pcc_class_{cls.name};")
 
 
-def generate(module_ir: ModuleIR) -> CSource:
-    """Generate C source code from intermediate representation using fast native integers."""
+def generate(module_ir: ModuleIR, parallel: bool = False) -> CSource:
+    """Generate C source code from intermediate representation using fast native integers.
+
+    Args:
+        module_ir: The IR module
+        parallel: Run range() loops with independent iterations on the
+                  runtime thread pool
+    """
     lines: List[str] = []
     state = _CodegenState()
+    pure_fns = pure_functions(module_ir.functions) if parallel else None
     
     # Collect function signatures
     fn_sigs: Dict[str, int] = {}
@@ -528,27 +749,49 @@ def generate(module_ir: ModuleIR) -> CSource:
     
     # Emit forward declarations for all functions first
     for func in module_ir.functions:
-        params = [f"long long* pcc_{p}" for p in func.params]
-        params_str = ", ".join(params) if params else ""
-        lines.append(f"void pcc_fn_{func.name}(long long* pcc_ret, {params_str});")
+        lines.append(f"{_function_prototype(func)};")
     
     if module_ir.functions:
         lines.append("")
     
+    # Function bodies are emitted first to collect the string literals
+    body: List[str] = []
+    
     # Emit function definitions
     for func in module_ir.functions:
-        _emit_function(func, lines, state, fn_sigs)
-        lines.append("")
+        if pure_fns is not None:
+            state.parallel = find_parallel_loops(func.body, pure_fns)
+        _emit_function(func, body, state, fn_sigs)
+        body.append("")
     
     # Emit main function
-    lines.append("int main(void) {")
+    body.append("int main(void) {")
     
     var_types: Dict[str, str] = {}
+    main_start = len(body)
+    if pure_fns is not None:
+        state.parallel = find_parallel_loops(module_ir.main, pure_fns)
     
     for stmt in module_ir.main:
-        _emit_stmt(stmt, lines, state, var_types, fn_sigs, in_loop=False)
+        _emit_stmt(stmt, body, state, var_types, fn_sigs, in_loop=False)
     
-    lines.append("    return 0;")
-    lines.append("}")
+    body.append("    return 0;")
+    body.append("}")
+    
+    # Intern the literals once at startup, straight from their static bytes
+    if state.literals:
+        for name in state.literals.values():
+            lines.append(f"static rt_str {name};")
+        lines.append("")
+        lines.append("static void pcc_init_literals(void) {")
+        for value, name in state.literals.items():
+            size = len(value.encode("utf-8"))
+            lines.append(f"    {name} = rt_str_intern_static({_c_string_literal(value)}, {size});")
+        lines.append("}")
+        lines.append("")
+        body.insert(main_start, "    pcc_init_literals();")
+    for worker in state.workers:
+        lines.extend(worker)
+    lines.extend(body)
     
     return CSource(c_source="\n".join(lines))
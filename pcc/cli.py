@@ -6,10 +6,58 @@ for building Python files to executables.
 """
 
 import argparse
+import shlex
 import sys
 from pathlib import Path
+from typing import List, Tuple
 
 from .core import Compiler
+from .ir.optimize import OptimizationOptions
+from .utils.toolchain import OPT_MODES
+
+
+def _positive_int(text: str) -> int:
+    """Parse a command-line count that must be at least 1."""
+    value = int(text)
+    if value < 1:
+        raise argparse.ArgumentTypeError(f"must be at least 1: {text}")
+    return value
+
+
+def _opt_modes(text: str) -> tuple:
+    """Parse a comma-separated list of --opt build modes."""
+    modes = tuple(mode.strip() for mode in text.split(",") if mode.strip())
+    for mode in modes:
+        if mode not in OPT_MODES:
+            raise argparse.ArgumentTypeError(f"unknown mode {mode!r} (choose from {', '.join(OPT_MODES)})")
+    return modes
+
+
+def _read_manifest(manifest: Path, output_dir: Path) -> List[Tuple[Path, Path]]:
+    """Read a build manifest: one program per line, "input.py [output]".
+
+    Inputs are relative to the manifest's directory and outputs to the
+    output directory; the default output is named after the input. Blank
+    lines and # comments are ignored, and paths with spaces can be quoted.
+
+    Raises:
+        ValueError: If a line has more than two fields
+    """
+    builds = []
+    for lineno, line in enumerate(manifest.read_text(encoding="utf-8").splitlines(), 1):
+        fields = shlex.split(line, comments=True)
+        if not fields:
+            continue
+        if len(fields) > 2:
+            raise ValueError(f"{manifest}:{lineno}: expected 'input.py [output]', got {line.strip()!r}")
+        input_py = manifest.parent / fields[0]
+        builds.append((input_py, output_dir / (fields[1] if len(fields) == 2 else _exe_name(input_py))))
+    return builds
+
+
+def _exe_name(input_py: Path) -> str:
+    """Default executable name of a program built into an output directory."""
+    return input_py.stem + (".exe" if sys.platform == "win32" else "")
 
 
 def create_parser() -> argparse.ArgumentParser:
@@ -27,6 +75,15 @@ Examples:
   python -m pcc build input.py -o output.exe
   python -m pcc build input.py -o output.exe --toolchain msvc
   python -m pcc build input.py -o output --emit-c-only
+  python -m pcc build input.py -o output --release
+  python -m pcc build input.py -o output --threads 8
+  python -m pcc build input.py -o output --parallel
+  python -m pcc build input.py -o output --no-cache
+  python -m pcc build input.py -o output --opt=lto,native
+  python -m pcc build input.py -o output --profile
+  python -m pcc build input.py -o output --no-licm --no-cse
+  python -m pcc build a.py b.py c.py -o bin/ --jobs 8
+  python -m pcc build --manifest programs.txt -o bin/
         """
     )
 
@@ -35,18 +92,32 @@ Examples:
     # Build command
     build_parser = subparsers.add_parser(
         "build",
-        help="Build a Python file into an executable"
+        help="Build Python files into executables"
+    )
+    build_parser.add_argument(
+        "inputs",
+        nargs="*",
+        metavar="input",
+        help="Input Python file to compile; with several, each is built into the output directory"
     )
     build_parser.add_argument(
-        "input",
+        "--manifest",
         type=str,
-        help="Input Python file to compile"
+        metavar="FILE",
+        help="File listing programs to build into the output directory, one 'input.py [output]' per line"
     )
     build_parser.add_argument(
         "-o", "--output",
         required=True,
         type=str,
-        help="Output executable path"
+        help="Output executable path, or the output directory when building several programs"
+    )
+    build_parser.add_argument(
+        "-j", "--jobs",
+        type=_positive_int,
+        metavar="N",
+        help="Programs to build at the same time with several inputs or a manifest "
+             "(default: one per processor)"
     )
     build_parser.add_argument(
         "--toolchain",
@@ -69,12 +140,90 @@ Examples:
         type=int,
         choices=[1, 2],
         default=1,
-        help="Parser version to use: 1=AST-based (default), 2=tokenize-based"
+        help="Parser version to use: 1=AST-based (default), 2=token-based"
     )
-    build_parser.add_argument(
+    int_mode = build_parser.add_mutually_exclusive_group()
+    int_mode.add_argument(
         "--use-hpf",
         action="store_true",
-        help="Use High Precision Float (BigInt) support for arbitrary precision arithmetic"
+        help="Use High Precision Float (BigInt) for every integer, without 64-bit range inference"
+    )
+    int_mode.add_argument(
+        "--native-ints",
+        action="store_true",
+        help="Use plain 64-bit integers everywhere; faster to compile, but results wrap on overflow"
+    )
+    build_parser.add_argument(
+        "--release",
+        action="store_true",
+        help="Build with the release profile: runtime NULL checks become debug assertions (-DRT_RELEASE -DNDEBUG)"
+    )
+    build_parser.add_argument(
+        "--threads",
+        type=_positive_int,
+        metavar="N",
+        help="Threads for parallel BigInt multiplication and products (default: one per processor; "
+             "PCC_THREADS overrides it at run time)"
+    )
+    build_parser.add_argument(
+        "--parallel",
+        action="store_true",
+        help="Run range() loops with independent iterations or +/min/max reductions on the thread pool"
+    )
+    build_parser.add_argument(
+        "--opt",
+        type=_opt_modes,
+        default=(),
+        metavar="MODES",
+        help="Comma-separated build optimizations: lto (link-time optimization with the runtime), "
+             "pgo (profile one run of the program, then rebuild), native (target the build machine's CPU)"
+    )
+    build_parser.add_argument(
+        "--profile",
+        action="store_true",
+        help="Build in the runtime profiler (-DRT_PROFILE): at exit the program reports calls, time, "
+             "operand sizes and memory use on stderr (PCC_PROFILE=json for JSON, 0 for none; "
+             "PCC_PROFILE_FILE to write a file)"
+    )
+    build_parser.add_argument(
+        "--no-cache",
+        action="store_true",
+        help="Regenerate and recompile everything instead of reusing cached C, runtime libraries "
+             "and executables (cache directory: PCC_CACHE_DIR, default ~/.cache/pcc)"
+    )
+    optimizations = build_parser.add_argument_group(
+        "IR optimizations",
+        "Every pass is on by default; each can be turned off for A/B comparisons"
+    )
+    optimizations.add_argument(
+        "--no-fold",
+        action="store_true",
+        help="Disable constant folding and pruning of constant branches"
+    )
+    optimizations.add_argument(
+        "--no-strength-reduce",
+        action="store_true",
+        help="Disable rewriting * // %% by powers of two as shifts and masks"
+    )
+    optimizations.add_argument(
+        "--no-cse",
+        action="store_true",
+        help="Disable common-subexpression elimination"
+    )
+    optimizations.add_argument(
+        "--no-licm",
+        action="store_true",
+        help="Disable hoisting of loop-invariant expressions"
+    )
+    optimizations.add_argument(
+        "--no-inline",
+        action="store_true",
+        help="Disable inlining of small non-recursive functions"
+    )
+    optimizations.add_argument(
+        "--no-tail-calls",
+        action="store_true",
+        help="Keep self-recursive tail calls as calls instead of loops"
     )
 
     # Version command
@@ -95,20 +244,72 @@ def handle_build(args: argparse.Namespace) -> int:
     Returns:
         int: Exit code (0 for success, non-zero for failure)
     """
-    input_path = Path(args.input)
     output_path = Path(args.output)
+    if not args.inputs and not args.manifest:
+        print("[pcc] Error: no input files (give inputs or --manifest)", file=sys.stderr)
+        return 2
 
-    compiler = Compiler(parser_version=args.parser_version, use_hpf=args.use_hpf)
+    # One input without a manifest builds that program to the output path
+    batch = None
+    if len(args.inputs) > 1 or args.manifest:
+        batch = [(Path(name), output_path / _exe_name(Path(name))) for name in args.inputs]
+        if args.manifest:
+            try:
+                batch.extend(_read_manifest(Path(args.manifest), output_path))
+            except (OSError, ValueError) as e:
+                print(f"[pcc] Error: cannot read manifest: {e}", file=sys.stderr)
+                return 2
+
+    compiler = Compiler(
+        parser_version=args.parser_version,
+        use_hpf=args.use_hpf,
+        release=args.release,
+        threads=args.threads,
+        parallel=args.parallel,
+        native_ints=args.native_ints,
+        cache=not args.no_cache,
+        opt=args.opt,
+        profile=args.profile,
+        optimizations=OptimizationOptions(
+            fold_constants=not args.no_fold,
+            strength_reduce=not args.no_strength_reduce,
+            cse=not args.no_cse,
+            licm=not args.no_licm,
+            inline=not args.no_inline,
+            tail_calls=not args.no_tail_calls,
+        )
+    )
 
     if args.verbose:
-        print(f"[pcc] Building: {input_path}")
+        if batch is None:
+            print(f"[pcc] Building: {args.inputs[0]}")
+        else:
+            print(f"[pcc] Building: {len(batch)} programs, {args.jobs or 'one per processor'} at a time")
         print(f"[pcc] Output: {output_path}")
         print(f"[pcc] Toolchain: {args.toolchain}")
         print(f"[pcc] Parser version: {args.parser_version}")
         print(f"[pcc] Use HPF: {args.use_hpf}")
+        print(f"[pcc] Native ints: {args.native_ints}")
+        print(f"[pcc] Profile: {'release' if args.release else 'debug'}")
+        print(f"[pcc] Threads: {args.threads or 'one per processor'}")
+        print(f"[pcc] Parallel loops: {args.parallel}")
+        print(f"[pcc] Build cache: {'off' if args.no_cache else 'on'}")
+        print(f"[pcc] Build optimizations: {','.join(args.opt) or 'none'}")
+        print(f"[pcc] Runtime profiler: {'on' if args.profile else 'off'}")
+        flags = ("no_fold", "no_strength_reduce", "no_cse", "no_licm", "no_inline", "no_tail_calls")
+        disabled = [flag for flag in flags if getattr(args, flag)]
+        print(f"[pcc] Disabled optimizations: {', '.join(disabled) or 'none'}")
+
+    if batch is not None:
+        return _report_batch(batch, compiler.build_many(
+            batch,
+            toolchain=args.toolchain,
+            emit_c_only=args.emit_c_only,
+            jobs=args.jobs
+        ), args)
 
     result = compiler.build(
-        input_py=input_path,
+        input_py=Path(args.inputs[0]),
         out_exe=output_path,
         toolchain=args.toolchain,
         emit_c_only=args.emit_c_only
@@ -119,6 +320,8 @@ def handle_build(args: argparse.Namespace) -> int:
             print(f"[pcc] Generated C code: {result.c_source_path}")
         else:
             print(f"[pcc] Build successful: {result.executable_path}")
+            if args.verbose and result.cache_hit:
+                print("[pcc] Executable reused from the build cache")
         return 0
     else:
         print(f"[pcc] Error: {result.error_message}", file=sys.stderr)
@@ -127,6 +330,28 @@ def handle_build(args: argparse.Namespace) -> int:
         return 1
 
 
+def _report_batch(batch: List[Tuple[Path, Path]], results: list, args: argparse.Namespace) -> int:
+    """Print the outcome of each program of a multi-program build.
+
+    Returns:
+        int: Exit code (0 if every program was built, 1 otherwise)
+    """
+    failed = 0
+    for (input_py, _), result in zip(batch, results):
+        if not result.success:
+            failed += 1
+            print(f"[pcc] Error: {input_py}: {result.error_message}", file=sys.stderr)
+        elif args.emit_c_only:
+            print(f"[pcc] Generated C code: {result.c_source_path}")
+        else:
+            cached = " (from the build cache)" if args.verbose and result.cache_hit else ""
+            print(f"[pcc] Built {input_py}: {result.executable_path}{cached}")
+    if failed:
+        print(f"[pcc] {failed} of {len(batch)} programs failed", file=sys.stderr)
+        return 1
+    return 0
+
+
 def handle_version(args: argparse.Namespace) -> int:
     """Handle the version command.
 
@@ -7,17 +7,23 @@ parsing, code generation, and build processes.
 
 from __future__ import annotations
 
+import os
 import shutil
 import subprocess
+import tempfile
+from concurrent.futures import ProcessPoolExecutor
+from functools import lru_cache
 from pathlib import Path
 from dataclasses import dataclass
-from typing import Optional, Union
+from typing import List, Optional, Sequence, Tuple, Union
 
 from ..frontend.parser_v1 import Parser as ParserV1, ParseError as ParseErrorV1
 from ..frontend.parser_v2 import ParserV2, ParseError as ParseErrorV2
 from ..backend.codegen import CodeGenerator as CodeGeneratorHPF, CSource
 from ..backend.codegen_fast import generate as generate_fast
-from ..utils.toolchain import Toolchain, ToolchainDetector
+from ..ir.optimize import OptimizationOptions, optimize as optimize_ir
+from ..utils.cache import BuildCache, compiler_fingerprint, content_hash
+from ..utils.toolchain import OPT_MODES, Toolchain, ToolchainDetector
 
 
 @dataclass
@@ -29,11 +35,14 @@ class BuildResult:
         c_source_path: Path to the generated C source file (if applicable)
         executable_path: Path to the compiled executable (if applicable)
         error_message: Error message if the build failed
+        cache_hit: Whether the executable was copied from the build cache
+                   instead of being compiled
     """
     success: bool
     c_source_path: Optional[Path] = None
     executable_path: Optional[Path] = None
     error_message: Optional[str] = None
+    cache_hit: bool = False
 
 
 class Compiler:
@@ -44,7 +53,7 @@ class Compiler:
 
     Supports two parser versions:
     - Version 1: Uses Python's ast module (default)
-    - Version 2: Uses tokenize-based lexer with recursive descent parser
+    - Version 2: Uses a table-driven lexer with a recursive descent parser
 
     Example:
         >>> compiler = Compiler(parser_version=2)
@@ -55,13 +64,70 @@ class Compiler:
         ... )
     """
 
-    def __init__(self, parser_version: int = 2, use_hpf: bool = False):
+    # Preprocessor defines of the release build profile
+    RELEASE_DEFINES = ("RT_RELEASE", "NDEBUG")
+
+    # Preprocessor define of the runtime profiling probes
+    PROFILE_DEFINE = "RT_PROFILE"
+
+    # Runtime library sources, in link order
+    RUNTIME_SOURCES = (
+        "rt_bigint.c",
+        "rt_bigint_mul.c",
+        "rt_bigint_div.c",
+        "rt_bigint_conv.c",
+        "rt_string.c",
+        "rt_error.c",
+        "rt_math.c",
+        "rt_string_ex.c",
+        "rt_alloc.c",
+        "rt_pool.c",
+        "rt_profile.c",
+        "rt_io.c",
+    )
+
+    def __init__(self, parser_version: int = 2, use_hpf: bool = False, release: bool = False,
+                 native_ints: bool = False, optimizations: Optional[OptimizationOptions] = None,
+                 threads: Optional[int] = None, parallel: bool = False,
+                 cache: Union[bool, BuildCache] = True, opt: Sequence[str] = (),
+                 profile: bool = False):
         """Initialize the compiler.
 
+        By default integers have Python semantics: variables whose values
+        provably fit in 64 bits are native int64_t, everything else is a
+        BigInt, and native results that may overflow are promoted.
+
         Args:
             parser_version: Which parser to use (1 or 2). Default is 2.
-            use_hpf: Whether to use HPF (Heavy Precision Float) for integers.
-                     Default is False (uses fast native long long).
+            use_hpf: Whether to use HPF (Heavy Precision Float) BigInts for
+                     every integer, without range inference. Default is False.
+            native_ints: Whether to use plain long long for every integer,
+                         which wraps on overflow. Default is False.
+            release: Whether to build with the release profile, which turns
+                     the runtime's argument NULL checks into compiled-out
+                     assertions. Default is False.
+            optimizations: Which IR optimization passes to run between
+                           parsing and code generation. Default is all.
+            threads: Threads the runtime's parallel BigInt kernels use when
+                     PCC_THREADS is not set at run time. Default is one per
+                     processor; 1 keeps every operation serial.
+            parallel: Whether to run range() loops whose iterations are
+                      independent on the runtime thread pool, with
+                      per-thread partial sums, minima and maxima. With
+                      use_hpf no loop has the int64 counter this needs.
+                      Default is False.
+            cache: Whether to reuse generated C, runtime libraries and
+                   executables from the build cache, or the cache to use.
+                   Default is the one in the user cache directory.
+            opt: Build optimization modes from OPT_MODES: "lto" for
+                 link-time optimization across the program and the
+                 runtime, "pgo" to build twice with a profile of one run
+                 of the program in between, "native" for the instruction
+                 set of the build machine. Default is none.
+            profile: Whether to build the runtime's profiling probes in
+                     (-DRT_PROFILE): the executable reports the calls and
+                     time of the hot runtime entry points and its memory
+                     use at exit, as PCC_PROFILE selects. Default is False.
         """
         if parser_version == 1:
             self._parser = ParserV1()
@@ -71,9 +137,26 @@ class Compiler:
             self._parser_version = 2
         else:
             raise ValueError(f"Invalid parser version: {parser_version}. Use 1 or 2.")
+        if use_hpf and native_ints:
+            raise ValueError("use_hpf and native_ints are mutually exclusive")
+        if threads is not None and threads < 1:
+            raise ValueError(f"Invalid thread count: {threads}. Use 1 or more.")
+        for mode in opt:
+            if mode not in OPT_MODES:
+                raise ValueError(f"Invalid optimization mode: {mode}. Use one of {', '.join(OPT_MODES)}.")
 
         self._use_hpf = use_hpf
-        self._codegen_hpf = CodeGeneratorHPF()
+        self._release = release
+        self._native_ints = native_ints
+        self._optimizations = optimizations or OptimizationOptions()
+        self._threads = threads
+        self._parallel = parallel
+        self._opt = tuple(sorted(set(opt)))
+        self._profile = profile
+        if cache is True:
+            cache = BuildCache()
+        self._cache: Optional[BuildCache] = cache or None
+        self._codegen_hpf = CodeGeneratorHPF(infer_ranges=not use_hpf, parallel=parallel)
         self._toolchain_detector = ToolchainDetector()
 
     def parse(self, source: str, filename: str = "<input>"):
@@ -91,6 +174,17 @@ class Compiler:
         """
         return self._parser.parse(source, filename)
 
+    def optimize(self, module_ir):
+        """Run the enabled IR optimization passes.
+
+        Args:
+            module_ir: The intermediate representation from parse()
+
+        Returns:
+            ModuleIR: The optimized intermediate representation
+        """
+        return optimize_ir(module_ir, self._optimizations)
+
     def generate_c(self, module_ir) -> CSource:
         """Generate C code from IR.
 
@@ -100,17 +194,17 @@ class Compiler:
         Returns:
             CSource: The generated C source code
         """
-        if self._use_hpf:
-            return self._codegen_hpf.generate(module_ir)
-        else:
-            return generate_fast(module_ir)
+        if self._native_ints:
+            return generate_fast(module_ir, parallel=self._parallel)
+        return self._codegen_hpf.generate(module_ir)
 
     def build(
         self,
         input_py: Path,
         out_exe: Path,
         toolchain: str = "auto",
-        emit_c_only: bool = False
+        emit_c_only: bool = False,
+        build_dir: Optional[Path] = None
     ) -> BuildResult:
         """Build a Python file into an executable.
 
@@ -119,6 +213,8 @@ class Compiler:
             out_exe: Path for the output executable
             toolchain: Toolchain to use ("auto", "msvc", "clang-cl", "gcc")
             emit_c_only: If True, only generate C code without compiling
+            build_dir: Directory for the generated C source. Default is
+                       build/pcc_<input name> in the repository.
 
         Returns:
             BuildResult: The result of the build operation
@@ -136,37 +232,34 @@ class Compiler:
                 error_message=f"Input must be a .py file: {input_py}"
             )
 
-        # Parse Python source
         try:
             source = input_py.read_text(encoding="utf-8")
-            module_ir = self._parser.parse(source, filename=str(input_py))
-        except (ParseErrorV1, ParseErrorV2) as e:
+        except OSError as e:
             return BuildResult(
                 success=False,
-                error_message=f"Parse error: {e}"
-            )
-        except Exception as e:
-            return BuildResult(
-                success=False,
-                error_message=f"Unexpected error during parsing: {e}"
+                error_message=f"Cannot read {input_py}: {e}"
             )
 
-        # Generate C code
-        try:
-            c_source = self.generate_c(module_ir)
-        except Exception as e:
-            return BuildResult(
-                success=False,
-                error_message=f"Code generation error: {e}"
-            )
-
-        # Write C source to file
+        # Generated C only depends on the source and the options
+        c_key = self._codegen_key(source)
+        c_text = self._cache.read_text("c", c_key, ".c") if self._cache else None
+        if c_text is None:
+            generated = self._generate(source, input_py)
+            if isinstance(generated, BuildResult):
+                return generated
+            c_text = generated.c_source
+            if self._cache:
+                self._cache.write_text("c", c_key, ".c", c_text)
+
+        # Write C source to file, leaving an unchanged one untouched
         root = self._repo_root()
-        build_dir = root / "build" / f"pcc_{input_py.stem}"
+        if build_dir is None:
+            build_dir = root / "build" / f"pcc_{input_py.stem}"
         build_dir.mkdir(parents=True, exist_ok=True)
 
         main_c = build_dir / "main.c"
-        main_c.write_text(c_source.c_source, encoding="utf-8")
+        if not main_c.is_file() or main_c.read_text(encoding="utf-8") != c_text:
+            main_c.write_text(c_text, encoding="utf-8")
 
         if emit_c_only:
             return BuildResult(
@@ -190,14 +283,39 @@ class Compiler:
                 )
             toolchain = detected.value
 
+        unsupported = [mode for mode in self._opt
+                       if mode not in self._toolchain_detector.supported_opt_modes(Toolchain(toolchain))]
+        if unsupported:
+            return BuildResult(
+                success=False,
+                c_source_path=main_c,
+                error_message=f"Toolchain {toolchain} does not support --opt={','.join(unsupported)}"
+            )
+
+        # An executable built from the same C with the same runtime is reused as is
+        runtime_key = self._runtime_key(toolchain, root) if self._cache else None
+        if self._cache:
+            exe_key = content_hash(c_text, runtime_key)
+            cached_exe = self._cache.get("exe", exe_key)
+            if cached_exe is not None:
+                shutil.copy2(cached_exe, out_exe)
+                return BuildResult(
+                    success=True,
+                    c_source_path=main_c,
+                    executable_path=out_exe,
+                    cache_hit=True
+                )
+
         # Run build
-        result = self._compile(main_c, out_exe, toolchain, root)
+        result = self._compile(main_c, out_exe, toolchain, root, runtime_key)
         if result != 0:
             return BuildResult(
                 success=False,
                 c_source_path=main_c,
                 error_message=f"Compilation failed with exit code {result}"
             )
+        if self._cache:
+            self._cache.put_file("exe", exe_key, "", out_exe)
 
         return BuildResult(
             success=True,
@@ -205,12 +323,127 @@ class Compiler:
             executable_path=out_exe
         )
 
+    def build_many(
+        self,
+        builds: Sequence[Tuple[Path, Path]],
+        toolchain: str = "auto",
+        emit_c_only: bool = False,
+        jobs: Optional[int] = None
+    ) -> List[BuildResult]:
+        """Build several Python files at once on a pool of worker processes.
+
+        Each worker parses, generates C and runs the C compiler for one
+        program at a time. The toolchain is detected and the runtime
+        library built (or found in the build cache) before the workers
+        start, so that every program links the same cached library.
+
+        Args:
+            builds: (input Python file, output executable) pairs
+            toolchain: Toolchain to use ("auto", "msvc", "clang-cl", "gcc")
+            emit_c_only: If True, only generate C code without compiling
+            jobs: Programs to build at the same time. Default is one per
+                  processor; 1 builds them one after another in this
+                  process.
+
+        Returns:
+            One BuildResult per pair, in order
+        """
+        if not builds:
+            return []
+        if not emit_c_only:
+            toolchain = self._prepare_runtime(toolchain)
+
+        # Programs with the same file name get C source directories of their own
+        root = self._repo_root()
+        stems = [Path(input_py).stem for input_py, _ in builds]
+        tasks = []
+        for index, (input_py, out_exe) in enumerate(builds):
+            name = f"pcc_{stems[index]}"
+            if stems.count(stems[index]) > 1:
+                name += f"_{index}"
+            tasks.append((Path(input_py), Path(out_exe), toolchain, emit_c_only, root / "build" / name))
+
+        jobs = min(jobs or os.cpu_count() or 1, len(tasks))
+        if jobs == 1:
+            return [self.build(*task) for task in tasks]
+        with ProcessPoolExecutor(max_workers=jobs, initializer=_init_worker, initargs=(self,)) as pool:
+            return list(pool.map(_build_in_worker, tasks))
+
+    def _prepare_runtime(self, toolchain: str) -> str:
+        """Detect the toolchain and put the runtime library in the build cache.
+
+        Returns:
+            The detected toolchain, or toolchain as given when detection
+            fails; each build then reports the problem
+        """
+        if toolchain == "auto":
+            detected = self._toolchain_detector.detect()
+            if detected is None:
+                return toolchain
+            toolchain = detected.value
+        if not self._cache or "pgo" in self._opt:
+            return toolchain
+        supported = self._toolchain_detector.supported_opt_modes(Toolchain(toolchain))
+        if any(mode not in supported for mode in self._opt):
+            return toolchain
+        root = self._repo_root()
+        runtime_dir = root / "runtime"
+        try:
+            self._runtime_library(toolchain, self._runtime_key(toolchain, root),
+                                  [runtime_dir / name for name in self.RUNTIME_SOURCES], runtime_dir)
+        except RuntimeError:
+            pass  # no compiler: every build reports it
+        return toolchain
+
+    def _generate(self, source: str, input_py: Path) -> Union[CSource, BuildResult]:
+        """Parse, optimize and generate C for a program.
+
+        Returns:
+            The generated C, or a failed BuildResult describing the error
+        """
+        # Parse Python source
+        try:
+            module_ir = self._parser.parse(source, filename=str(input_py))
+        except (ParseErrorV1, ParseErrorV2) as e:
+            return BuildResult(
+                success=False,
+                error_message=f"Parse error: {e}"
+            )
+        except Exception as e:
+            return BuildResult(
+                success=False,
+                error_message=f"Unexpected error during parsing: {e}"
+            )
+
+        # Optimize the IR and generate C code
+        try:
+            module_ir = self.optimize(module_ir)
+        except Exception as e:
+            return BuildResult(
+                success=False,
+                error_message=f"Optimization error: {e}"
+            )
+
+        try:
+            return self.generate_c(module_ir)
+        except Exception as e:
+            return BuildResult(
+                success=False,
+                error_message=f"Code generation error: {e}"
+            )
+
+    def _codegen_key(self, source: str) -> str:
+        """Cache key of the C generated for a program with the current options."""
+        options = (self._parser_version, self._use_hpf, self._native_ints, self._parallel, self._optimizations)
+        return content_hash(compiler_fingerprint(), repr(options), source)
+
     def _compile(
         self,
         main_c: Path,
         out_exe: Path,
         toolchain: str,
-        root: Path
+        root: Path,
+        runtime_key: Optional[str] = None
     ) -> int:
         """Compile C source to executable.
 
@@ -219,6 +452,9 @@ class Compiler:
             out_exe: Path for the output executable
             toolchain: Toolchain to use
             root: Repository root path
+            runtime_key: Cache key of the runtime library from
+                         _runtime_key(), to link the cached library instead
+                         of compiling the runtime sources
 
         Returns:
             int: Exit code from the compiler
@@ -227,22 +463,34 @@ class Compiler:
         runtime_inc = runtime_dir
 
         # Modular runtime source files
-        runtime_sources = [
-            runtime_dir / "rt_bigint.c",
-            runtime_dir / "rt_string.c",
-            runtime_dir / "rt_error.c",
-            runtime_dir / "rt_math.c",
-            runtime_dir / "rt_string_ex.c",
-        ]
-
+        runtime_sources = [runtime_dir / name for name in self.RUNTIME_SOURCES]
+        if "pgo" in self._opt:
+            # The runtime is profiled along with the program, so it is built from source
+            return self._compile_pgo(main_c, out_exe, toolchain, runtime_sources, runtime_inc)
+        if runtime_key is not None:
+            library = self._runtime_library(toolchain, runtime_key, runtime_sources, runtime_inc)
+            if library is not None:
+                runtime_sources = [library]
+        return self._link(main_c, out_exe, toolchain, runtime_sources, runtime_inc)
+
+    def _link(
+        self,
+        main_c: Path,
+        out_exe: Path,
+        toolchain: str,
+        runtime_sources: list[Path],
+        runtime_inc: Path,
+        phase_flags: Sequence[str] = ()
+    ) -> int:
+        """Compile and link with the toolchain's command line; phase_flags are the PGO phase's."""
         if toolchain in ("msvc", "clang-cl"):
-            return self._compile_msvc_style(main_c, out_exe, toolchain, runtime_sources, runtime_inc)
+            return self._compile_msvc_style(main_c, out_exe, toolchain, runtime_sources, runtime_inc, phase_flags)
         elif toolchain == "gcc":
-            return self._compile_gcc(main_c, out_exe, runtime_sources, runtime_inc)
+            return self._compile_gcc(main_c, out_exe, runtime_sources, runtime_inc, phase_flags)
         else:
             raise ValueError(f"Unknown toolchain: {toolchain}")
 
-    def _compile_msvc_style(
+    def _compile_pgo(
         self,
         main_c: Path,
         out_exe: Path,
@@ -250,29 +498,158 @@ class Compiler:
         runtime_sources: list[Path],
         runtime_inc: Path
     ) -> int:
-        """Compile using MSVC-style command line (cl.exe or clang-cl)."""
+        """Build instrumented, run the program once as training, then build with its profile.
+
+        Programs take no input, so the training run is the program itself,
+        with its output discarded.
+
+        Returns:
+            int: Exit code of the failing compile, or of the final one
+        """
+        profile_dir = Path(tempfile.mkdtemp(prefix="pcc-pgo-"))
+        if toolchain == "gcc":
+            generate = [f"-fprofile-generate={profile_dir}"]
+            use = [f"-fprofile-use={profile_dir}", "-fprofile-correction", "-Wno-missing-profile"]
+        else:
+            pgd = profile_dir / f"{out_exe.stem}.pgd"
+            generate = [f"/GENPROFILE:PGD={pgd}"]
+            use = [f"/USEPROFILE:PGD={pgd}"]
+        try:
+            result = self._link(main_c, out_exe, toolchain, runtime_sources, runtime_inc, generate)
+            if result != 0:
+                return result
+            # The training run keeps a --profile build's report to itself
+            subprocess.run([str(out_exe)], stdout=subprocess.DEVNULL, cwd=profile_dir,
+                           env={**os.environ, "PCC_PROFILE": "0"})
+            return self._link(main_c, out_exe, toolchain, runtime_sources, runtime_inc, use)
+        finally:
+            shutil.rmtree(profile_dir, ignore_errors=True)
+
+    def _runtime_key(self, toolchain: str, root: Path) -> str:
+        """Cache key of the runtime library: its sources and headers, the compiler and its flags."""
+        runtime_dir = root / "runtime"
+        parts = [toolchain, _compiler_identity(self._c_compiler(toolchain)), *self._opt]
+        parts.extend(self._cflags(toolchain, Path("runtime")))
+        for path in sorted(runtime_dir.glob("*.h")) + [runtime_dir / name for name in self.RUNTIME_SOURCES]:
+            parts.extend((path.name, path.read_bytes()))
+        return content_hash(*parts)
+
+    def _runtime_library(
+        self,
+        toolchain: str,
+        key: str,
+        runtime_sources: list[Path],
+        runtime_inc: Path
+    ) -> Optional[Path]:
+        """Get the cached static runtime library, building it on a miss.
+
+        Returns:
+            Path of the library, or None if it cannot be built (no archiver,
+            or a compile error the full build will report)
+        """
+        suffix = ".lib" if toolchain in ("msvc", "clang-cl") else ".a"
+        library = self._cache.get("lib", key, suffix)
+        if library is not None:
+            return library
+
         if toolchain == "msvc":
-            compiler = "cl.exe"
-            if not shutil.which(compiler):
-                raise RuntimeError("cl.exe not found. Install Visual Studio Build Tools.")
+            archiver = [shutil.which("lib.exe") or "lib.exe", "/nologo"]
+            if "lto" in self._opt:
+                archiver.append("/LTCG")
+        elif toolchain == "clang-cl":
+            archiver = [shutil.which("llvm-lib.exe") or shutil.which("llvm-lib") or "llvm-lib", "/nologo"]
+        elif "lto" in self._opt:
+            # Only the GCC wrapper indexes LTO objects
+            archiver = [shutil.which("gcc-ar") or "gcc-ar", "rcs"]
         else:
+            archiver = [shutil.which("ar") or shutil.which("gcc-ar") or "ar", "rcs"]
+        if not shutil.which(archiver[0]):
+            return None
+
+        work = self._cache.temp_dir()
+        try:
+            objects = []
+            compiler = self._c_compiler(toolchain)
+            flags = self._cflags(toolchain, runtime_inc)
+            for src in runtime_sources:
+                if toolchain in ("msvc", "clang-cl"):
+                    obj = work / f"{src.stem}.obj"
+                    cmd = [compiler, *flags, "/c", str(src), f"/Fo{obj}"]
+                else:
+                    obj = work / f"{src.stem}.o"
+                    cmd = [compiler, *flags, "-c", str(src), "-o", str(obj)]
+                if subprocess.run(cmd, capture_output=True, text=True).returncode != 0:
+                    return None
+                objects.append(str(obj))
+            archive = work / f"pcc_rt{suffix}"
+            if toolchain in ("msvc", "clang-cl"):
+                cmd = [*archiver, f"/OUT:{archive}", *objects]
+            else:
+                cmd = [*archiver, str(archive), *objects]
+            if subprocess.run(cmd, capture_output=True, text=True).returncode != 0:
+                return None
+            return self._cache.put_file("lib", key, suffix, archive)
+        finally:
+            shutil.rmtree(work, ignore_errors=True)
+
+    def _c_compiler(self, toolchain: str) -> str:
+        """Get the path of a toolchain's C compiler.
+
+        Raises:
+            RuntimeError: If the compiler is not installed
+        """
+        if toolchain == "msvc":
+            if not shutil.which("cl.exe"):
+                raise RuntimeError("cl.exe not found. Install Visual Studio Build Tools.")
+            return "cl.exe"
+        if toolchain == "clang-cl":
             compiler = shutil.which("clang-cl.exe") or shutil.which("clang-cl")
             if not compiler:
                 raise RuntimeError("clang-cl not found. Install LLVM.")
+            return compiler
+        gcc = shutil.which("gcc") or shutil.which("gcc.exe")
+        if not gcc:
+            raise RuntimeError("gcc not found. Install GCC or MinGW-w64.")
+        return gcc
 
-        cmd = [
-            compiler,
-            "/nologo",
-            "/O2",
-            "/W3",
-            "/TC",
-            "/I", str(runtime_inc),
-            str(main_c),
-        ]
-        # Add modular runtime sources
+    def _cflags(self, toolchain: str, runtime_inc: Path) -> list[str]:
+        """Get the flags every translation unit is compiled with."""
+        if toolchain in ("msvc", "clang-cl"):
+            flags = ["/nologo", "/O2", "/W3", "/TC", "/I", str(runtime_inc)]
+            flags.extend(f"/D{name}" for name in self._defines())
+            if "lto" in self._opt or "pgo" in self._opt:
+                flags.append("/GL")
+            if "native" in self._opt:
+                flags.append("/clang:-march=native")
+        else:
+            flags = ["-O2", "-Wall", "-std=c11", "-pthread", "-I", str(runtime_inc)]
+            flags.extend(f"-D{name}" for name in self._defines())
+            if "lto" in self._opt:
+                flags.append("-flto=auto")
+            if "native" in self._opt:
+                flags.append("-march=native")
+        return flags
+
+    def _compile_msvc_style(
+        self,
+        main_c: Path,
+        out_exe: Path,
+        toolchain: str,
+        runtime_sources: list[Path],
+        runtime_inc: Path,
+        phase_flags: Sequence[str] = ()
+    ) -> int:
+        """Compile using MSVC-style command line (cl.exe or clang-cl); phase_flags go to the linker."""
+        cmd = [self._c_compiler(toolchain)]
+        cmd.extend(self._cflags(toolchain, runtime_inc))
+        cmd.append(str(main_c))
+        # Add modular runtime sources, or the prebuilt library
         cmd.extend(str(src) for src in runtime_sources)
         # Add linker options
         cmd.extend(["/link", f"/OUT:{str(out_exe)}"])
+        if "lto" in self._opt or "pgo" in self._opt:
+            cmd.append("/LTCG")
+        cmd.extend(phase_flags)
 
         result = subprocess.run(cmd, capture_output=True, text=True)
         if result.returncode != 0:
@@ -285,22 +662,15 @@ class Compiler:
         main_c: Path,
         out_exe: Path,
         runtime_sources: list[Path],
-        runtime_inc: Path
+        runtime_inc: Path,
+        phase_flags: Sequence[str] = ()
     ) -> int:
-        """Compile using GCC."""
-        gcc = shutil.which("gcc") or shutil.which("gcc.exe")
-        if not gcc:
-            raise RuntimeError("gcc not found. Install GCC or MinGW-w64.")
-
-        cmd = [
-            gcc,
-            "-O2",
-            "-Wall",
-            "-std=c11",
-            "-I", str(runtime_inc),
-            str(main_c),
-        ]
-        # Add modular runtime sources
+        """Compile using GCC; phase_flags are added to the compile flags."""
+        cmd = [self._c_compiler("gcc")]
+        cmd.extend(self._cflags("gcc", runtime_inc))
+        cmd.extend(phase_flags)
+        cmd.append(str(main_c))
+        # Add modular runtime sources, or the prebuilt library
         cmd.extend(str(src) for src in runtime_sources)
         # Add output option
         cmd.extend(["-o", str(out_exe)])
@@ -311,7 +681,42 @@ class Compiler:
             print(result.stderr)
         return result.returncode
 
+    def _defines(self) -> tuple[str, ...]:
+        """Get the preprocessor defines of the selected build profile and options."""
+        defines = self.RELEASE_DEFINES if self._release else ()
+        if self._threads is not None:
+            defines += (f"RT_POOL_DEFAULT_THREADS={self._threads}",)
+        if self._profile:
+            defines += (self.PROFILE_DEFINE,)
+        return defines
+
     @staticmethod
     def _repo_root() -> Path:
         """Get the repository root directory."""
         return Path(__file__).resolve().parent.parent.parent
+
+
+# The Compiler of a build_many() worker process
+_worker_compiler: Optional[Compiler] = None
+
+
+def _init_worker(compiler: Compiler) -> None:
+    """Keep the compiler a build_many() worker process builds with."""
+    global _worker_compiler
+    _worker_compiler = compiler
+
+
+def _build_in_worker(task: tuple) -> BuildResult:
+    """Run one build_many() build in a worker process."""
+    return _worker_compiler.build(*task)
+
+
+@lru_cache(maxsize=None)
+def _compiler_identity(compiler: str) -> str:
+    """Version banner of a C compiler, so that an upgrade invalidates cached builds."""
+    try:
+        result = subprocess.run([compiler, "--version"], capture_output=True, text=True)
+    except OSError:
+        return compiler
+    # cl.exe has no --version, but prints its banner before complaining
+    return f"{compiler}\n{result.stdout}{result.stderr}"
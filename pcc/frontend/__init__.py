@@ -1,8 +1,8 @@
 """
-Frontend module for pcc - Version 2 with tokenize-based lexer.
+Frontend module for pcc - Version 2 with a table-driven lexer.
 
 This module provides the lexer and parser components for the pcc compiler.
-Version 2 uses Python's standard library `tokenize` module for robust tokenization.
+Version 2 tokenizes with one compiled regular expression over each source line.
 """
 
 from .lexer import Lexer, Token, TokenType, LexerError
@@ -1,15 +1,17 @@
 """
 Lexer module for pcc - Version 2.
 
-This module provides a robust tokenizer using Python's standard library `tokenize` module.
-It converts Python source code into a stream of tokens for the parser.
+This module provides a table-driven tokenizer for the Python subset pcc
+compiles. One compiled regular expression recognizes every kind of token
+at the current position and the name of the group that matched selects
+the token to emit; indentation, brackets and strings spanning lines are
+tracked per physical line. The tokens, positions and lines are the ones
+Python's `tokenize` module produces, on every Python version.
 """
 
-import tokenize
-import io
-from dataclasses import dataclass
+import re
 from enum import Enum, auto
-from typing import List, Iterator, Optional, Tuple
+from typing import List, Iterator, NamedTuple
 
 
 class TokenType(Enum):
@@ -64,10 +66,13 @@ class TokenType(Enum):
     # def, class, if, else, elif, while, for, in, return, pass, break, continue, print
 
 
-@dataclass(frozen=True)
-class Token:
+class Token(NamedTuple):
     """Represents a token in the source code.
     
+    Immutable. A named tuple rather than a frozen dataclass because the
+    lexer creates one per token and tuples are several times cheaper to
+    create.
+    
     Attributes:
         type: The token type
         value: The string value of the token
@@ -101,11 +106,63 @@ class LexerError(Exception):
         return self.message
 
 
+# Every operator and delimiter of Python, so that the longest one is
+# matched, and reported when pcc does not support it
+_PY_OPERATORS = (
+    "!=", "%", "%=", "&", "&=", "(", ")", "*", "**", "**=", "*=", "+", "+=", ",",
+    "-", "-=", "->", ".", "...", "/", "//", "//=", "/=", ":", ":=", ";", "<", "<<",
+    "<<=", "<=", "=", "==", ">", ">=", ">>", ">>=", "@", "@=", "[", "]", "^", "^=",
+    "{", "|", "|=", "}", "~",
+)
+
+_DIGITS = r"[0-9](?:_?[0-9])*"
+_EXPONENT = r"[eE][-+]?" + _DIGITS
+_FLOAT = rf"(?:{_DIGITS}\.(?:{_DIGITS})?|\.{_DIGITS})(?:{_EXPONENT})?|{_DIGITS}{_EXPONENT}"
+_INT = r"0[xX](?:_?[0-9a-fA-F])+|0[bB](?:_?[01])+|0[oO](?:_?[0-7])+|0(?:_?0)*|[1-9](?:_?[0-9])*"
+_STRING_PREFIX = r"(?:[bB][rR]?|[rR][bBfF]?|[uU]|[fF][rR]?)?"
+_OPERATOR = "|".join(re.escape(op) for op in sorted(_PY_OPERATORS, key=len, reverse=True))
+
+# One token, after any whitespace, at a position in a physical line. The
+# group that matches names the kind of token; alternatives are tried in
+# the order Python's tokenizer tries them. "string" is a one-line string,
+# or its first line when it ends with a backslash-newline; "triple" is
+# the opening quotes of a triple-quoted string.
+_TOKEN_RE = re.compile(rf"""
+    [ \f\t]*
+    (?:
+        (?P<cont>\\\r?\n)
+      | (?P<end>\Z)
+      | (?P<comment>\#[^\r\n]*)
+      | (?P<triple>{_STRING_PREFIX}(?:'''|\"\"\"))
+      | (?P<number>{_DIGITS}[jJ]|(?:{_FLOAT})[jJ]?|{_INT})
+      | (?P<newline>\r?\n)
+      | (?P<op>{_OPERATOR})
+      | (?P<string>{_STRING_PREFIX}(?:'[^\n'\\]*(?:\\.[^\n'\\]*)*(?:'|\\\r?\n)
+                                  |"[^\n"\\]*(?:\\.[^\n"\\]*)*(?:"|\\\r?\n)))
+      | (?P<name>\w+)
+    )
+""", re.VERBOSE)
+
+# The rest of a string that continues on a later line, by its quotes
+_STRING_END_RE = {
+    "'": re.compile(r"[^'\\]*(?:\\.[^'\\]*)*'"),
+    '"': re.compile(r'[^"\\]*(?:\\.[^"\\]*)*"'),
+    "'''": re.compile(r"[^'\\]*(?:(?:\\.|'(?!''))[^'\\]*)*'''"),
+    '"""': re.compile(r'[^"\\]*(?:(?:\\.|"(?!""))[^"\\]*)*"""'),
+}
+
+_INDENT_RE = re.compile(r"[ \t\f]*")
+
+# Column of each indentation character: spaces count one, tabs advance to
+# the next multiple of 8 and form feeds start over
+_TAB_SIZE = 8
+
+
 class Lexer:
     """Lexer for tokenizing Python source code.
     
-    Uses Python's standard library `tokenize` module for robust tokenization.
-    Converts Python source code into a stream of Token objects.
+    Converts Python source code into a stream of Token objects with a
+    table-driven scanner (see _TOKEN_RE).
     
     Example:
         >>> lexer = Lexer()
@@ -114,22 +171,6 @@ class Lexer:
         ...     print(token)
     """
     
-    # Mapping from tokenize module types to our TokenType
-    _TOKEN_TYPE_MAP = {
-        tokenize.NUMBER: TokenType.NUMBER,
-        tokenize.STRING: TokenType.STRING,
-        tokenize.NAME: TokenType.NAME,
-        tokenize.OP: None,  # Handled separately
-        tokenize.NEWLINE: TokenType.NEWLINE,
-        tokenize.NL: TokenType.NL,
-        tokenize.COMMENT: TokenType.COMMENT,
-        tokenize.ENCODING: TokenType.ENCODING,
-        tokenize.ENDMARKER: TokenType.ENDMARKER,
-        tokenize.INDENT: TokenType.INDENT,
-        tokenize.DEDENT: TokenType.DEDENT,
-        tokenize.ERRORTOKEN: None,  # Handled separately
-    }
-    
     # Operator mapping
     _OP_MAP = {
         '+': TokenType.PLUS,
@@ -156,6 +197,13 @@ class Lexer:
         '.': TokenType.DOT,
     }
     
+    # Token type of the remaining _TOKEN_RE groups that are one token as matched
+    _GROUP_TYPES = {
+        'number': TokenType.NUMBER,
+        'string': TokenType.STRING,
+        'comment': TokenType.COMMENT,
+    }
+    
     # Python keywords that are valid in pcc
     _KEYWORDS = {
         'def', 'class', 'if', 'else', 'elif', 'while', 'for', 'in',
@@ -183,33 +231,7 @@ class Lexer:
         Raises:
             LexerError: If tokenization fails
         """
-        self._filename = filename
-        
-        try:
-            # Use StringIO for string-based tokenization
-            readline = io.StringIO(source).readline
-            
-            tokens = []
-            for tok_type, tok_value, (lineno, col_offset), _, line in tokenize.generate_tokens(readline):
-                token = self._convert_token(tok_type, tok_value, lineno, col_offset, line)
-                if token is not None:
-                    tokens.append(token)
-            
-            return tokens
-            
-        except tokenize.TokenError as e:
-            # Extract line number from error message if available
-            msg = str(e)
-            lineno = 0
-            if '(' in msg and ')' in msg:
-                try:
-                    lineno_str = msg.split('(')[1].split(',')[0]
-                    lineno = int(lineno_str)
-                except (ValueError, IndexError):
-                    pass
-            raise LexerError(f"Tokenization error: {msg}", lineno, 0, "")
-        except SyntaxError as e:
-            raise LexerError(f"Syntax error: {e}", e.lineno or 0, e.offset or 0, e.text or "")
+        return list(self.tokenize_iter(source, filename))
     
     def tokenize_iter(self, source: str, filename: str = "<input>") -> Iterator[Token]:
         """Tokenize Python source code lazily.
@@ -225,69 +247,134 @@ class Lexer:
             LexerError: If tokenization fails
         """
         self._filename = filename
+        match_token = _TOKEN_RE.match
+        op_map = self._OP_MAP
+        group_types = self._GROUP_TYPES
+        NAME, NEWLINE, NL = TokenType.NAME, TokenType.NEWLINE, TokenType.NL
         
-        try:
-            readline = io.StringIO(source).readline
+        lines = source.split("\n")
+        last = lines.pop()
+        lines = [line + "\n" for line in lines]
+        if last:
+            lines.append(last)
             
-            for tok_type, tok_value, (lineno, col_offset), _, line in tokenize.generate_tokens(readline):
-                token = self._convert_token(tok_type, tok_value, lineno, col_offset, line)
-                if token is not None:
-                    yield token
-                    
-        except tokenize.TokenError as e:
-            raise LexerError(f"Tokenization error: {e}")
-        except SyntaxError as e:
-            raise LexerError(f"Syntax error: {e}", e.lineno or 0, e.offset or 0, e.text or "")
-    
-    def _convert_token(self, tok_type: int, tok_value: str, lineno: int, 
-                       col_offset: int, line: str) -> Optional[Token]:
-        """Convert a tokenize module token to our Token format.
+        indents = [0]
+        depth = 0            # brackets open
+        continued = False    # a backslash-newline ended the previous line
+        string = None        # (end pattern, text, lines, lineno, col, needs backslash) of an open string
+        previous = ""        # the line before the current one
+        eof_lineno = len(lines) + 1
         
-        Args:
-            tok_type: Token type from tokenize module
-            tok_value: Token string value
-            lineno: Line number
-            col_offset: Column offset
-            line: Full line containing the token
+        for lineno, line in enumerate(lines, 1):
+            pos, end = 0, len(line)
             
-        Returns:
-            Token object or None if token should be skipped
-        """
-        # Handle ERRORTOKEN
-        if tok_type == tokenize.ERRORTOKEN:
-            if tok_value.strip():
-                raise LexerError(f"Invalid character: {tok_value!r}", lineno, col_offset, line)
-            return None
-        
-        # Handle operators
-        if tok_type == tokenize.OP:
-            if tok_value in self._OP_MAP:
-                return Token(
-                    type=self._OP_MAP[tok_value],
-                    value=tok_value,
-                    lineno=lineno,
-                    col_offset=col_offset,
-                    line=line
-                )
+            if string is not None:
+                end_re, text, text_lines, str_lineno, str_col, needs_backslash = string
+                match = end_re.match(line)
+                if match is None:
+                    if needs_backslash and not line.endswith(("\\\n", "\\\r\n")):
+                        raise LexerError("Unterminated string literal", str_lineno, str_col, text_lines)
+                    string = (end_re, text + line, text_lines + line, str_lineno, str_col, needs_backslash)
+                    previous = line
+                    continue
+                pos = match.end()
+                yield Token(TokenType.STRING, text + line[:pos], str_lineno, str_col, text_lines + line)
+                string = None
+                
+            elif depth == 0 and not continued:
+                # A new statement: measure its indentation
+                pos = _INDENT_RE.match(line).end()
+                column = 0
+                for char in line[:pos]:
+                    if char == " ":
+                        column += 1
+                    elif char == "\t":
+                        column = (column // _TAB_SIZE + 1) * _TAB_SIZE
+                    else:
+                        column = 0
+                if pos == end:
+                    # Trailing whitespace without a newline ends the input
+                    eof_lineno = lineno
+                    break
+                if line[pos] in "#\r\n":
+                    # Comments and blank lines do not change the indentation
+                    if line[pos] == "#":
+                        comment = line[pos:].rstrip("\r\n")
+                        yield Token(TokenType.COMMENT, comment, lineno, pos, line)
+                        pos += len(comment)
+                    yield Token(TokenType.NL, line[pos:], lineno, pos, line)
+                    previous = line
+                    continue
+                if column > indents[-1]:
+                    indents.append(column)
+                    yield Token(TokenType.INDENT, line[:pos], lineno, 0, line)
+                while column < indents[-1]:
+                    if column not in indents:
+                        raise LexerError("Syntax error: unindent does not match any outer indentation level",
+                                         lineno, pos, line)
+                    indents.pop()
+                    yield Token(TokenType.DEDENT, "", lineno, pos, line)
+                    
             else:
-                raise LexerError(f"Unsupported operator: {tok_value!r}", lineno, col_offset, line)
-        
-        # Handle other token types
-        if tok_type in self._TOKEN_TYPE_MAP:
-            our_type = self._TOKEN_TYPE_MAP[tok_type]
-            if our_type is None:
-                return None  # Skip this token type
+                continued = False
+                
+            while pos < end:
+                match = match_token(line, pos)
+                if match is None:
+                    char = line[pos]
+                    if not char.isspace():
+                        raise LexerError(f"Invalid character: {char!r}", lineno, pos, line)
+                    pos += 1
+                    continue
+                kind = match.lastgroup
+                start = match.start(kind)
+                pos = match.end()
+                value = line[start:pos]
+                
+                if kind == "name":
+                    if not (value.isascii() or value[0].isidentifier()):
+                        # Python's tokenizer takes a word starting with another character for an operator
+                        raise LexerError(f"Unsupported operator: {value!r}", lineno, start, line)
+                    yield Token(NAME, value, lineno, start, line)
+                elif kind == "op":
+                    token_type = op_map.get(value)
+                    if token_type is None:
+                        raise LexerError(f"Unsupported operator: {value!r}", lineno, start, line)
+                    if value in "([{":
+                        depth += 1
+                    elif value in ")]}":
+                        depth -= 1
+                    yield Token(token_type, value, lineno, start, line)
+                elif kind == "newline":
+                    yield Token(NL if depth > 0 else NEWLINE, value, lineno, start, line)
+                elif kind == "string" and value[-1] == "\n":
+                    quote = value.lstrip("bBrRuUfF")[0]
+                    string = (_STRING_END_RE[quote], value, line, lineno, start, True)
+                    break
+                elif kind == "triple":
+                    end_re = _STRING_END_RE[value[-3:]]
+                    match = end_re.match(line, pos)
+                    if match is None:
+                        string = (end_re, line[start:], line, lineno, start, False)
+                        break
+                    pos = match.end()
+                    yield Token(TokenType.STRING, line[start:pos], lineno, start, line)
+                elif kind == "cont":
+                    continued = True
+                elif kind != "end":
+                    yield Token(group_types[kind], value, lineno, start, line)
+            previous = line
             
-            return Token(
-                type=our_type,
-                value=tok_value,
-                lineno=lineno,
-                col_offset=col_offset,
-                line=line
-            )
-        
-        # Unknown token type
-        raise LexerError(f"Unknown token type: {tok_type}", lineno, col_offset, line)
+        if string is not None:
+            raise LexerError("Tokenization error: EOF in multi-line string", string[3], string[4], string[2])
+        if depth or continued:
+            raise LexerError("Tokenization error: EOF in multi-line statement", eof_lineno, 0, "")
+        # A last line without a newline still ends its statement
+        if previous and previous[-1] not in "\r\n" and not previous.strip().startswith("#"):
+            yield Token(TokenType.NEWLINE, "", eof_lineno - 1, len(previous), "")
+        for _ in indents[1:]:
+            yield Token(TokenType.DEDENT, "", eof_lineno, 0, "")
+        yield Token(TokenType.ENDMARKER, "", eof_lineno, 0, "")
     
     def is_keyword(self, name: str) -> bool:
         """Check if a name is a keyword.
@@ -517,7 +517,7 @@ class Parser:
         return CmpOp(op_s, left, right)
 
     # Builtin functions that don't need to be defined
-    _BUILTINS = {'len', 'abs', 'min', 'max', 'pow', 'str', 'int'}
+    _BUILTINS = {'len', 'abs', 'min', 'max', 'pow', 'str', 'int', 'isqrt'}
 
     def _parse_call(self, node: ast.Call, defined: Set[str]) -> Expr:
         """Parse a function call, method call, constructor call, or builtin call."""
@@ -548,8 +548,8 @@ class Parser:
         if fname == "print":
             raise ParseError("print(...) is only supported as a statement, not as an expression")
 
-        # Check if it's a builtin function
-        if fname in self._BUILTINS:
+        # Check if it's a builtin function (a user definition shadows it)
+        if fname in self._BUILTINS and fname not in self._fn_sigs:
             if node.keywords:
                 raise ParseError("Keyword arguments are not supported in builtin calls")
             args = [self._parse_expr(a, defined) for a in node.args]
@@ -586,6 +586,7 @@ class Parser:
             'abs': 1,
             'str': 1,
             'int': 1,
+            'isqrt': 1,
             'pow': (2, 3),  # 2 or 3 args
             'min': (1, None),  # 1 or more
             'max': (1, None),  # 1 or more
@@ -1,7 +1,7 @@
 """
 Parser module for pcc - Version 2.
 
-This module provides a recursive descent parser that works with the tokenize-based lexer.
+This module provides a recursive descent parser that works with the table-driven lexer.
 It converts tokens into pcc's Intermediate Representation (IR).
 """
 
@@ -32,7 +32,7 @@ class ParseError(Exception):
 class ParserV2:
     """Recursive descent parser for pcc - Version 2.
     
-    Works with the tokenize-based lexer to parse Python source code
+    Works with the table-driven lexer to parse Python source code
     into pcc's Intermediate Representation (IR).
     
     Example:
@@ -756,7 +756,7 @@ class ParserV2:
         raise ParseError(f"Unexpected token: {token}", token.lineno, token.col_offset)
     
     # Builtin functions that don't need to be defined
-    _BUILTINS = {'len', 'abs', 'min', 'max', 'pow', 'str', 'int'}
+    _BUILTINS = {'len', 'abs', 'min', 'max', 'pow', 'str', 'int', 'isqrt'}
     
     def _parse_call(self, name: str, defined: Set[str]) -> Expr:
         """Parse function call, constructor call, or builtin call."""
@@ -772,8 +772,8 @@ class ParserV2:
         
         self._expect(TokenType.RPAR)
         
-        # Check if it's a builtin function
-        if name in self._BUILTINS:
+        # Check if it's a builtin function (a user definition shadows it)
+        if name in self._BUILTINS and name not in self._fn_sigs:
             return self._parse_builtin(name, args)
         
         # Check if it's a constructor call
@@ -798,6 +798,7 @@ class ParserV2:
             'abs': 1,
             'str': 1,
             'int': 1,
+            'isqrt': 1,
             'pow': (2, 3),  # 2 or 3 args
             'min': (1, None),  # 1 or more
             'max': (1, None),  # 1 or more
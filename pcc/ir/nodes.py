@@ -46,7 +46,10 @@ class BinOp:
     """Binary operation expression.
 
     Attributes:
-        op: The operator ("+", "-", "*", "//", "%")
+        op: The operator ("+", "-", "*", "//", "%"), or one introduced by
+            strength reduction with a constant right operand: "<<" and ">>"
+            (shifts by that many bits, floor semantics) and "&" (mask with
+            2^k - 1, the same as % 2^k)
         left: Left operand expression
         right: Right operand expression
     """
@@ -0,0 +1,749 @@
+"""
+IR optimization passes for pcc.
+
+Rewrites a parsed module before code generation. The passes keep what the
+program prints, including where it stops with an error, and each one can
+be switched off on its own to measure what it buys:
+
+- Constant folding evaluates operators and builtins over constants of any
+  size, drops identity operations and prunes branches whose condition is
+  constant.
+- Strength reduction turns multiplication, floor division and modulo by a
+  power of two into the shift and mask operators "<<", ">>" and "&".
+- Common-subexpression elimination computes a repeated multiplicative
+  expression once per run of straight-line statements.
+- Loop-invariant code motion computes the expressions of a loop that no
+  iteration changes once, before the loop.
+- Inlining replaces calls of small non-recursive functions whose body is
+  a single return with the returned expression.
+- Tail-call elimination turns a function's calls of itself in tail
+  position into a jump back to its start.
+
+Expressions are only moved or shared when evaluating them has no effect
+and cannot raise. Their values are kept in new local variables named
+pcc_cse_N, pcc_licm_N and pcc_tail_N.
+"""
+
+from dataclasses import dataclass, replace
+from math import isqrt
+from typing import Callable, Dict, List, Optional, Set, Tuple
+
+from .nodes import (
+    Stmt, Expr,
+    IntConst, StrConst, Var, BinOp, CmpOp, Call, AttributeAccess, MethodCall, ConstructorCall, BuiltinCall,
+    Assign, AttrAssign, MethodCallStmt, Print, If, While, ForRange, Return,
+    Break, Continue, FunctionDef, ModuleIR,
+)
+
+# Largest power, in bits, that constant folding computes at compile time
+_MAX_FOLDED_POW_BITS = 1 << 16
+
+# Builtins without side effects
+_PURE_BUILTINS = {"len", "abs", "min", "max", "pow", "str", "int", "isqrt"}
+
+# Builtins that cannot raise on operands of the right type
+_TOTAL_BUILTINS = {"len", "abs", "min", "max", "str", "int"}
+
+# Largest returned expression, in nodes, of a function that is inlined
+_MAX_INLINE_NODES = 24
+
+
+@dataclass(frozen=True)
+class OptimizationOptions:
+    """Which optimization passes to run.
+
+    Attributes:
+        fold_constants: Evaluate constant expressions and prune constant branches
+        strength_reduce: Replace * // % by powers of two with shifts and masks
+        cse: Share repeated expressions within straight-line code
+        licm: Hoist loop-invariant expressions out of loops
+        inline: Inline calls of small non-recursive functions
+        tail_calls: Turn self-recursive tail calls into loops
+    """
+    fold_constants: bool = True
+    strength_reduce: bool = True
+    cse: bool = True
+    licm: bool = True
+    inline: bool = True
+    tail_calls: bool = True
+
+    @classmethod
+    def disabled(cls) -> "OptimizationOptions":
+        """Options that leave the IR unchanged."""
+        return cls(fold_constants=False, strength_reduce=False, cse=False, licm=False,
+                   inline=False, tail_calls=False)
+
+
+def optimize(module: ModuleIR, options: Optional[OptimizationOptions] = None) -> ModuleIR:
+    """Run the enabled optimization passes over every body of a module.
+
+    Args:
+        module: Parsed module
+        options: Passes to run (all of them by default)
+
+    Returns:
+        The optimized module; the input is not modified
+    """
+    options = options or OptimizationOptions()
+    if options.inline:
+        module = _inline_module(module)
+    functions = [_optimize_function(fn, options, is_method=False) for fn in module.functions]
+    classes = [replace(cls, methods=[_optimize_function(m, options, is_method=True) for m in cls.methods])
+               for cls in module.classes]
+    main = _optimize_body(module.main, options, _TempNames())
+    return ModuleIR(functions=functions, classes=classes, main=main)
+
+
+def _optimize_function(fn: FunctionDef, options: OptimizationOptions, is_method: bool) -> FunctionDef:
+    """Optimize one function or method body.
+
+    Methods are left out of tail-call elimination: a plain call of the
+    method's name in its body calls the module-level function of that name.
+    """
+    names = _TempNames()
+    body = fn.body
+    if options.tail_calls and not is_method:
+        body = _eliminate_tail_calls(fn, names)
+    return replace(fn, body=_optimize_body(body, options, names))
+
+
+def _optimize_body(body: List[Stmt], options: OptimizationOptions, names: "_TempNames") -> List[Stmt]:
+    """Run the passes over one function body, in dependency order."""
+    if options.fold_constants:
+        body = _map_block(body, _fold_expr, _fold_stmt)
+    if options.strength_reduce:
+        body = _map_block(body, _reduce_expr)
+    if options.licm:
+        body = _hoist_block(body, names)
+    if options.cse:
+        body = _cse_block(body, names)
+    return body
+
+
+class _TempNames:
+    """Generator of the variable names of one function body's new temporaries."""
+
+    def __init__(self) -> None:
+        self.counter = 0
+
+    def next(self, prefix: str) -> str:
+        self.counter += 1
+        return f"pcc_{prefix}_{self.counter}"
+
+
+# ==================== Traversal ====================
+
+def _map_expr(expr: Expr, fn: Callable[[Expr], Expr]) -> Expr:
+    """Rewrite an expression bottom-up: fn sees each node with rewritten children."""
+    if isinstance(expr, (BinOp, CmpOp)):
+        expr = replace(expr, left=_map_expr(expr.left, fn), right=_map_expr(expr.right, fn))
+    elif isinstance(expr, (Call, MethodCall, ConstructorCall, BuiltinCall)):
+        expr = replace(expr, args=[_map_expr(arg, fn) for arg in expr.args])
+    return fn(expr)
+
+
+def _map_stmt_exprs(stmt: Stmt, fn: Callable[[Expr], Expr]) -> Stmt:
+    """Apply fn to the expressions a statement evaluates itself (not its body)."""
+    if isinstance(stmt, (Assign, AttrAssign, Print, Return)):
+        return replace(stmt, expr=fn(stmt.expr))
+    if isinstance(stmt, MethodCallStmt):
+        return replace(stmt, args=[fn(arg) for arg in stmt.args])
+    if isinstance(stmt, (If, While)):
+        return replace(stmt, test=fn(stmt.test))
+    if isinstance(stmt, ForRange):
+        return replace(stmt, start=fn(stmt.start), stop=fn(stmt.stop), step=fn(stmt.step))
+    return stmt
+
+
+def _map_block(
+    stmts: List[Stmt],
+    expr_fn: Callable[[Expr], Expr],
+    stmt_fn: Optional[Callable[[Stmt], List[Stmt]]] = None,
+) -> List[Stmt]:
+    """Rewrite every expression of a block bottom-up, nested blocks included.
+
+    stmt_fn, if given, then replaces each rewritten statement with a list
+    of statements.
+    """
+    result: List[Stmt] = []
+    for stmt in stmts:
+        stmt = _map_stmt_exprs(stmt, lambda e: _map_expr(e, expr_fn))
+        if isinstance(stmt, If):
+            stmt = replace(stmt, body=_map_block(stmt.body, expr_fn, stmt_fn),
+                           orelse=_map_block(stmt.orelse, expr_fn, stmt_fn))
+        elif isinstance(stmt, (While, ForRange)):
+            stmt = replace(stmt, body=_map_block(stmt.body, expr_fn, stmt_fn))
+        result.extend(stmt_fn(stmt) if stmt_fn else [stmt])
+    return result
+
+
+def _stmt_exprs(stmt: Stmt) -> List[Expr]:
+    """Expressions a statement evaluates itself (not its body)."""
+    found: List[Expr] = []
+    _map_stmt_exprs(stmt, lambda e: found.append(e) or e)
+    return found
+
+
+def _reads(expr: Expr) -> Set[str]:
+    """Names of the variables an expression reads."""
+    if isinstance(expr, Var):
+        return {expr.name}
+    if isinstance(expr, (BinOp, CmpOp)):
+        return _reads(expr.left) | _reads(expr.right)
+    if isinstance(expr, (Call, MethodCall, ConstructorCall, BuiltinCall)):
+        names: Set[str] = set()
+        for arg in expr.args:
+            names |= _reads(arg)
+        if isinstance(expr, MethodCall):
+            names.add(expr.obj)
+        return names
+    if isinstance(expr, AttributeAccess):
+        return {expr.obj}
+    return set()
+
+
+def _assigned(stmts: List[Stmt]) -> Set[str]:
+    """Names of the variables a block assigns, nested blocks included."""
+    names: Set[str] = set()
+    for stmt in stmts:
+        if isinstance(stmt, Assign):
+            names.add(stmt.name)
+        elif isinstance(stmt, If):
+            names |= _assigned(stmt.body) | _assigned(stmt.orelse)
+        elif isinstance(stmt, While):
+            names |= _assigned(stmt.body)
+        elif isinstance(stmt, ForRange):
+            names.add(stmt.var)
+            names |= _assigned(stmt.body)
+    return names
+
+
+def _is_pure(expr: Expr) -> bool:
+    """Check that evaluating an expression has no side effects (it may raise)."""
+    if isinstance(expr, (IntConst, StrConst, Var)):
+        return True
+    if isinstance(expr, (BinOp, CmpOp)):
+        return _is_pure(expr.left) and _is_pure(expr.right)
+    if isinstance(expr, BuiltinCall):
+        return expr.name in _PURE_BUILTINS and all(_is_pure(arg) for arg in expr.args)
+    # Calls may print; attributes may be changed by any method call
+    return False
+
+
+def _is_safe(expr: Expr) -> bool:
+    """Check that an expression is pure and cannot raise, so it may be moved."""
+    if not _is_pure(expr):
+        return False
+    if isinstance(expr, (BinOp, CmpOp)):
+        if isinstance(expr, BinOp) and expr.op in ("//", "%"):
+            if not (isinstance(expr.right, IntConst) and expr.right.value != 0):
+                return False
+        return _is_safe(expr.left) and _is_safe(expr.right)
+    if isinstance(expr, BuiltinCall):
+        return expr.name in _TOTAL_BUILTINS and all(_is_safe(arg) for arg in expr.args)
+    return True
+
+
+def _key(expr: Expr) -> str:
+    """Hashable identity of an expression (nodes with argument lists are not)."""
+    return repr(expr)
+
+
+# ==================== Constant folding ====================
+
+def _fold_expr(expr: Expr) -> Expr:
+    """Fold one node whose children are already folded."""
+    if isinstance(expr, BinOp):
+        return _fold_binop(expr)
+    if isinstance(expr, BuiltinCall):
+        return _fold_builtin(expr)
+    return expr
+
+
+def _fold_binop(expr: BinOp) -> Expr:
+    left, right = expr.left, expr.right
+    if isinstance(left, StrConst) and isinstance(right, StrConst) and expr.op == "+":
+        return StrConst(left.value + right.value)
+
+    if isinstance(left, IntConst) and isinstance(right, IntConst):
+        a, b = left.value, right.value
+        if expr.op == "+":
+            return IntConst(a + b)
+        if expr.op == "-":
+            return IntConst(a - b)
+        if expr.op == "*":
+            return IntConst(a * b)
+        if expr.op == "//" and b != 0:
+            return IntConst(a // b)
+        if expr.op == "%" and b != 0:
+            return IntConst(a % b)
+        return expr  # division by zero raises at run time
+
+    # Identities; an operand is only dropped if evaluating it has no effect
+    a = left.value if isinstance(left, IntConst) else None
+    b = right.value if isinstance(right, IntConst) else None
+    if expr.op in ("+", "-") and b == 0:
+        return left
+    if expr.op == "+" and a == 0:
+        return right
+    if expr.op in ("*", "//") and b == 1:
+        return left
+    if expr.op == "*" and a == 1:
+        return right
+    if expr.op == "*" and (a == 0 and _is_pure(right) or b == 0 and _is_pure(left)):
+        return IntConst(0)
+    if expr.op == "%" and b == 1 and _is_pure(left):
+        return IntConst(0)
+    return expr
+
+
+def _fold_builtin(expr: BuiltinCall) -> Expr:
+    args = expr.args
+    if expr.name == "len" and len(args) == 1 and isinstance(args[0], StrConst):
+        # Strings are measured in UTF-8 bytes, as rt_str_len() does
+        return IntConst(len(args[0].value.encode("utf-8")))
+    if not args or not all(isinstance(arg, IntConst) for arg in args):
+        return expr
+
+    values = [arg.value for arg in args]
+    if expr.name == "abs" and len(values) == 1:
+        return IntConst(abs(values[0]))
+    if expr.name == "int" and len(values) == 1:
+        return args[0]
+    if expr.name == "str" and len(values) == 1:
+        return StrConst(str(values[0]))
+    if expr.name == "min" and len(values) >= 2:
+        return IntConst(min(values))
+    if expr.name == "max" and len(values) >= 2:
+        return IntConst(max(values))
+    if expr.name == "isqrt" and len(values) == 1 and values[0] >= 0:
+        return IntConst(isqrt(values[0]))
+    if expr.name == "pow" and len(values) == 2:
+        base, exp = values
+        if exp >= 0 and max(base.bit_length(), 1) * exp <= _MAX_FOLDED_POW_BITS:
+            return IntConst(base ** exp)
+    if expr.name == "pow" and len(values) == 3:
+        base, exp, mod = values
+        if exp >= 0 and mod != 0:
+            return IntConst(pow(base, exp, mod))
+    return expr
+
+
+def _const_truth(test: Expr) -> Optional[bool]:
+    """Truth value of a folded condition, or None if it is not constant."""
+    if isinstance(test, IntConst):
+        return test.value != 0
+    if isinstance(test, CmpOp) and isinstance(test.left, IntConst) and isinstance(test.right, IntConst):
+        a, b = test.left.value, test.right.value
+        return {
+            "==": a == b, "!=": a != b,
+            "<": a < b, "<=": a <= b,
+            ">": a > b, ">=": a >= b,
+        }[test.op]
+    return None
+
+
+def _fold_stmt(stmt: Stmt) -> List[Stmt]:
+    """Prune the dead side of a branch, or a loop, with a constant condition."""
+    if isinstance(stmt, If):
+        truth = _const_truth(stmt.test)
+        if truth is not None:
+            return stmt.body if truth else stmt.orelse
+    if isinstance(stmt, While) and _const_truth(stmt.test) is False:
+        return []
+    return [stmt]
+
+
+# ==================== Strength reduction ====================
+
+def _power_of_two(expr: Expr) -> Optional[int]:
+    """Exponent k of a constant 2^k with k >= 1, else None."""
+    if isinstance(expr, IntConst) and expr.value > 1 and expr.value & (expr.value - 1) == 0:
+        return expr.value.bit_length() - 1
+    return None
+
+
+def _reduce_expr(expr: Expr) -> Expr:
+    """Replace a multiplication, floor division or modulo by 2^k.
+
+    x * 2^k is x << k, and since both round toward negative infinity,
+    x // 2^k is x >> k and x % 2^k is x & (2^k - 1).
+    """
+    if not isinstance(expr, BinOp):
+        return expr
+    k = _power_of_two(expr.right)
+    if expr.op == "*":
+        if k is not None:
+            return BinOp("<<", expr.left, IntConst(k))
+        k = _power_of_two(expr.left)
+        if k is not None:
+            return BinOp("<<", expr.right, IntConst(k))
+    elif expr.op == "//" and k is not None:
+        return BinOp(">>", expr.left, IntConst(k))
+    elif expr.op == "%" and k is not None:
+        return BinOp("&", expr.left, IntConst(expr.right.value - 1))
+    return expr
+
+
+# ==================== Loop-invariant code motion ====================
+
+def _hoist_block(stmts: List[Stmt], names: _TempNames) -> List[Stmt]:
+    """Hoist the invariant expressions of every loop in a block.
+
+    Inner loops are processed first, so an expression invariant in several
+    nested loops moves out one loop at a time.
+    """
+    result: List[Stmt] = []
+    for stmt in stmts:
+        if isinstance(stmt, If):
+            stmt = replace(stmt, body=_hoist_block(stmt.body, names),
+                           orelse=_hoist_block(stmt.orelse, names))
+        elif isinstance(stmt, (While, ForRange)):
+            stmt = replace(stmt, body=_hoist_block(stmt.body, names))
+            hoisted, stmt = _hoist_loop(stmt, names)
+            result.extend(hoisted)
+        result.append(stmt)
+    return result
+
+
+def _hoist_loop(loop: Stmt, names: _TempNames) -> Tuple[List[Stmt], Stmt]:
+    """Move the invariant expressions of one loop into assignments before it.
+
+    Returns:
+        (assignments to place before the loop, rewritten loop)
+    """
+    changed = _assigned(loop.body)
+    if isinstance(loop, ForRange):
+        changed.add(loop.var)
+
+    temps: Dict[str, str] = {}  # expression key -> temporary
+    hoisted: List[Stmt] = []
+
+    def hoist(expr: Expr) -> Expr:
+        if isinstance(expr, (IntConst, StrConst, Var)):
+            return expr
+        # Comparisons stay in place: a condition is cheapest where it is tested
+        if not isinstance(expr, CmpOp) and _is_safe(expr) and not _reads(expr) & changed:
+            key = _key(expr)
+            if key not in temps:
+                temps[key] = names.next("licm")
+                hoisted.append(Assign(temps[key], expr))
+            return Var(temps[key])
+        # Not invariant as a whole: try its operands
+        if isinstance(expr, (BinOp, CmpOp)):
+            return replace(expr, left=hoist(expr.left), right=hoist(expr.right))
+        if isinstance(expr, (Call, MethodCall, ConstructorCall, BuiltinCall)):
+            return replace(expr, args=[hoist(arg) for arg in expr.args])
+        return expr
+
+    def rewrite(stmts: List[Stmt]) -> List[Stmt]:
+        out: List[Stmt] = []
+        for stmt in stmts:
+            if isinstance(stmt, Assign) and stmt.name.startswith("pcc_licm_") \
+                    and not _reads(stmt.expr) & changed:
+                # Hoisted out of an inner loop, and invariant here too: move
+                # the definition, its only assignment, instead of copying it
+                hoisted.append(stmt)
+                continue
+            stmt = _map_stmt_exprs(stmt, hoist)
+            if isinstance(stmt, If):
+                stmt = replace(stmt, body=rewrite(stmt.body), orelse=rewrite(stmt.orelse))
+            elif isinstance(stmt, (While, ForRange)):
+                stmt = replace(stmt, body=rewrite(stmt.body))
+            out.append(stmt)
+        return out
+
+    if isinstance(loop, While):
+        loop = replace(loop, test=hoist(loop.test), body=rewrite(loop.body))
+    else:
+        loop = replace(loop, body=rewrite(loop.body))
+    return hoisted, loop
+
+
+# ==================== Common-subexpression elimination ====================
+
+def _cse_cost(expr: Expr) -> int:
+    """Rough cost of a candidate expression, or 0 if it is not one.
+
+    Candidates are arithmetic trees over variables and constants; sharing
+    only pays off once they cost more than a single addition.
+    """
+    if isinstance(expr, (IntConst, Var)):
+        return 0
+    if not isinstance(expr, BinOp):
+        return -1
+    left, right = _cse_cost(expr.left), _cse_cost(expr.right)
+    if left < 0 or right < 0:
+        return -1
+    return left + right + (2 if expr.op in ("*", "//", "%") else 1)
+
+
+def _subexprs(expr: Expr) -> List[Expr]:
+    """All subexpressions of an expression, outermost first."""
+    found = [expr]
+    if isinstance(expr, (BinOp, CmpOp)):
+        found += _subexprs(expr.left) + _subexprs(expr.right)
+    elif isinstance(expr, (Call, MethodCall, ConstructorCall, BuiltinCall)):
+        for arg in expr.args:
+            found += _subexprs(arg)
+    return found
+
+
+def _size(expr: Expr) -> int:
+    return len(_subexprs(expr))
+
+
+def _cse_block(stmts: List[Stmt], names: _TempNames) -> List[Stmt]:
+    """Share repeated expressions between the statements of a block.
+
+    An expression stays available from its first evaluation until a
+    statement assigns one of the variables it reads. Nested blocks are
+    processed on their own; a while loop's condition is not shared, since
+    it is evaluated again after the body.
+    """
+    stmts = [_cse_nested(stmt, names) for stmt in stmts]
+
+    # Occurrences per available value: (key, generation) -> statement indices
+    occurrences: Dict[Tuple[str, int], List[int]] = {}
+    exprs: Dict[str, Expr] = {}
+    generation: Dict[str, int] = {}  # key -> generation of its current value
+    for i, stmt in enumerate(stmts):
+        if not isinstance(stmt, While):
+            for top in _stmt_exprs(stmt):
+                for sub in _subexprs(top):
+                    if _cse_cost(sub) >= 2 and _is_safe(sub):
+                        key = _key(sub)
+                        exprs[key] = sub
+                        occurrences.setdefault((key, generation.get(key, 0)), []).append(i)
+        killed = _assigned([stmt])
+        if killed:
+            for key, expr in exprs.items():
+                if _reads(expr) & killed:
+                    generation[key] = generation.get(key, 0) + 1
+
+    # Largest expressions first; the subexpressions of a shared expression
+    # are then evaluated once for all of its occurrences
+    counts = {value: len(at) for value, at in occurrences.items()}
+    shared: Dict[Tuple[str, int], str] = {}
+    for value in sorted(counts, key=lambda v: -_size(exprs[v[0]])):
+        if counts[value] < 2:
+            continue
+        shared[value] = names.next("cse")
+        for sub in _subexprs(exprs[value[0]])[1:]:
+            inner = (_key(sub), value[1])
+            if inner in counts:
+                counts[inner] -= counts[value] - 1
+    if not shared:
+        return stmts
+
+    # Values available at each statement
+    defs_before: Dict[int, List[Tuple[str, int]]] = {}
+    live: Dict[int, Dict[str, str]] = {}
+    for value, temp in shared.items():
+        at = occurrences[value]
+        defs_before.setdefault(at[0], []).append(value)
+        for i in range(at[0], at[-1] + 1):
+            live.setdefault(i, {})[value[0]] = temp
+
+    def share(expr: Expr, available: Dict[str, str]) -> Expr:
+        temp = available.get(_key(expr))
+        if temp is not None:
+            return Var(temp)
+        if isinstance(expr, (BinOp, CmpOp)):
+            return replace(expr, left=share(expr.left, available), right=share(expr.right, available))
+        if isinstance(expr, (Call, MethodCall, ConstructorCall, BuiltinCall)):
+            return replace(expr, args=[share(arg, available) for arg in expr.args])
+        return expr
+
+    result: List[Stmt] = []
+    for i, stmt in enumerate(stmts):
+        available = live.get(i, {})
+        # Smaller shared values first, so larger ones can use them
+        for value in sorted(defs_before.get(i, []), key=lambda v: _size(exprs[v[0]])):
+            expr = exprs[value[0]]
+            inner = {k: t for k, t in available.items() if k != value[0]}
+            result.append(Assign(shared[value], share(expr, inner)))
+        if available and not isinstance(stmt, While):
+            stmt = _map_stmt_exprs(stmt, lambda e: share(e, available))
+        result.append(stmt)
+    return result
+
+
+def _cse_nested(stmt: Stmt, names: _TempNames) -> Stmt:
+    if isinstance(stmt, If):
+        return replace(stmt, body=_cse_block(stmt.body, names), orelse=_cse_block(stmt.orelse, names))
+    if isinstance(stmt, (While, ForRange)):
+        return replace(stmt, body=_cse_block(stmt.body, names))
+    return stmt
+
+
+# ==================== Inlining ====================
+
+def _calls(expr: Expr) -> Set[str]:
+    """Names of the functions an expression calls."""
+    return {sub.func for sub in _subexprs(expr) if isinstance(sub, Call)}
+
+
+def _block_exprs(stmts: List[Stmt]) -> List[Expr]:
+    """Every expression a block evaluates, nested blocks included."""
+    found: List[Expr] = []
+    for stmt in stmts:
+        found += _stmt_exprs(stmt)
+        if isinstance(stmt, If):
+            found += _block_exprs(stmt.body) + _block_exprs(stmt.orelse)
+        elif isinstance(stmt, (While, ForRange)):
+            found += _block_exprs(stmt.body)
+    return found
+
+
+def _inline_module(module: ModuleIR) -> ModuleIR:
+    """Inline the calls of every small single-return function.
+
+    A function qualifies if its body is one return of an expression of at
+    most _MAX_INLINE_NODES nodes that cannot reach a call of the function
+    again. Functions left without callers are dropped.
+    """
+    bodies = {fn.name: fn for fn in module.functions}
+    graph = {fn.name: {c for e in _block_exprs(fn.body) for c in _calls(e)} for fn in module.functions}
+
+    def reaches(start: str, target: str) -> bool:
+        seen, todo = set(), [start]
+        while todo:
+            name = todo.pop()
+            for callee in graph.get(name, ()):
+                if callee == target:
+                    return True
+                if callee not in seen:
+                    seen.add(callee)
+                    todo.append(callee)
+        return False
+
+    inlinable = {
+        fn.name: fn for fn in module.functions
+        if len(fn.body) == 1 and isinstance(fn.body[0], Return)
+        and _size(fn.body[0].expr) <= _MAX_INLINE_NODES and not reaches(fn.name, fn.name)
+    }
+    if not inlinable:
+        return module
+
+    expanded: Dict[str, Expr] = {}
+
+    def expand(name: str) -> Expr:
+        # Callees first: the call graph among these functions is acyclic
+        if name not in expanded:
+            expanded[name] = _map_expr(inlinable[name].body[0].expr, inline_call)
+        return expanded[name]
+
+    def inline_call(expr: Expr) -> Expr:
+        if not isinstance(expr, Call) or expr.func not in inlinable:
+            return expr
+        fn = inlinable[expr.func]
+        if len(expr.args) != len(fn.params):
+            return expr
+        body = expand(expr.func)
+        if _size(body) > _MAX_INLINE_NODES:
+            return expr
+        return _substitute_params(body, fn.params, expr.args) or expr
+
+    def inline_block(stmts: List[Stmt]) -> List[Stmt]:
+        return _map_block(stmts, inline_call)
+
+    functions = [replace(fn, body=inline_block(fn.body)) for fn in module.functions]
+    classes = [replace(cls, methods=[replace(m, body=inline_block(m.body)) for m in cls.methods])
+               for cls in module.classes]
+    main = inline_block(module.main)
+
+    # Drop inlined functions no call site needs any more
+    called: Set[str] = set()
+    for block in [fn.body for fn in functions] + [m.body for cls in classes for m in cls.methods] + [main]:
+        for expr in _block_exprs(block):
+            called |= _calls(expr)
+    functions = [fn for fn in functions if fn.name not in inlinable or fn.name in called]
+    return ModuleIR(functions=functions, classes=classes, main=main)
+
+
+def _substitute_params(body: Expr, params: List[str], args: List[Expr]) -> Optional[Expr]:
+    """Bind a function's parameters to call arguments inside its returned expression.
+
+    The arguments are evaluated at their uses instead of before the call,
+    so an argument other than a variable or constant must be safe to move
+    and used exactly once (or safe to drop and not used at all).
+
+    Returns:
+        The expression computing the call, or None if it cannot be inlined
+    """
+    uses: Dict[str, int] = {p: 0 for p in params}
+    for sub in _subexprs(body):
+        if isinstance(sub, Var) and sub.name in uses:
+            uses[sub.name] += 1
+    for param, arg in zip(params, args):
+        if isinstance(arg, (IntConst, StrConst, Var)):
+            continue
+        if uses[param] > 1 or not _is_safe(arg):
+            return None
+
+    binding = dict(zip(params, args))
+    return _map_expr(body, lambda e: binding[e.name] if isinstance(e, Var) and e.name in binding else e)
+
+
+# ==================== Tail calls ====================
+
+def _eliminate_tail_calls(fn: FunctionDef, names: _TempNames) -> List[Stmt]:
+    """Turn the returns of a call of fn itself into a loop over its body.
+
+    A return of a self-call outside any loop assigns the arguments to the
+    parameters and continues a loop wrapping the whole body; a path that
+    reaches the end of the body breaks out of it, so it still falls off the
+    end of the function.
+    """
+    found = []
+
+    def rewrite(stmts: List[Stmt]) -> List[Stmt]:
+        out: List[Stmt] = []
+        for stmt in stmts:
+            if isinstance(stmt, Return) and isinstance(stmt.expr, Call) and stmt.expr.func == fn.name \
+                    and len(stmt.expr.args) == len(fn.params):
+                out += _rebind_params(fn.params, stmt.expr.args, names)
+                out.append(Continue(fn.lineno))
+                found.append(stmt)
+            elif isinstance(stmt, If):
+                out.append(replace(stmt, body=rewrite(stmt.body), orelse=rewrite(stmt.orelse)))
+            else:
+                # Loops are left alone: continue would resume them instead
+                out.append(stmt)
+        return out
+
+    body = rewrite(fn.body)
+    if not found:
+        return fn.body
+    if not _always_returns(body):
+        body = body + [Break(fn.lineno)]
+    return [While(IntConst(1), body)]
+
+
+def _rebind_params(params: List[str], args: List[Expr], names: _TempNames) -> List[Stmt]:
+    """Assign call arguments to the parameters as if all were evaluated first."""
+    pending: List[Tuple[str, Expr]] = [(p, a) for p, a in zip(params, args) if a != Var(p)]
+    stmts: List[Stmt] = []
+    direct: List[Stmt] = []
+    for i, (param, arg) in enumerate(pending):
+        if any(param in _reads(later) for _, later in pending[i + 1:]):
+            # A later argument reads the old value: keep the new one aside
+            temp = names.next("tail")
+            stmts.append(Assign(temp, arg))
+            direct.append(Assign(param, Var(temp)))
+        else:
+            stmts.append(Assign(param, arg))
+    return stmts + direct
+
+
+def _always_returns(stmts: List[Stmt]) -> bool:
+    """Check that every path through a block ends in a return or continue."""
+    if not stmts:
+        return False
+    last = stmts[-1]
+    if isinstance(last, (Return, Continue)):
+        return True
+    if isinstance(last, If):
+        return _always_returns(last.body) and _always_returns(last.orelse)
+    return False
@@ -0,0 +1,295 @@
+"""
+Loop parallelism analysis for pcc.
+
+Finds the range() loops whose iterations can run in any order, on any
+thread, with the same result. Every variable the body assigns must be
+one of:
+
+- private: each iteration writes it before reading it, and nothing after
+  the loop reads the value the last iteration left (the loop variable is
+  one of these);
+- a reduction: it only appears as the accumulator of r = r + x (or any
+  chain of + and - in which r is added once), r = min(r, x) or
+  r = max(r, x), with a single kind of operator, so that per-thread
+  partial results can be combined in any order.
+
+The other variables the body reads are inputs, which no iteration
+changes. The body may not print, return, break out of the loop, touch
+objects or call functions that do any of these. Only the outermost loop
+of a nest is reported; its inner loops run serially inside each
+iteration.
+"""
+
+from dataclasses import dataclass
+from typing import Dict, List, Optional, Set, Tuple
+
+from .nodes import (
+    Stmt, Expr,
+    IntConst, StrConst, Var, BinOp, CmpOp, Call, BuiltinCall,
+    Assign, AttrAssign, MethodCallStmt, Print, If, While, ForRange, Return,
+    Break, Continue, FunctionDef,
+)
+from .optimize import _PURE_BUILTINS, _assigned, _reads, _stmt_exprs
+
+
+@dataclass(frozen=True)
+class ParallelLoop:
+    """A range() loop whose iterations are independent.
+
+    Attributes:
+        inputs: Variables the body reads and no iteration assigns, in order
+                of first use
+        reductions: Map from accumulator to its operator ("+", "min" or
+                    "max"; subtraction accumulates with "+")
+        heavy: Whether the body calls a function or has an inner loop, so
+               that a few iterations are already worth a thread
+    """
+    inputs: List[str]
+    reductions: Dict[str, str]
+    heavy: bool
+
+
+def pure_functions(functions: List[FunctionDef]) -> Set[str]:
+    """Find the functions a parallel loop body may call.
+
+    They neither print nor touch objects and only call each other; their
+    locals are their own, so calls on several threads cannot interfere.
+    """
+    callees: Dict[str, Set[str]] = {}
+    for fn in functions:
+        calls: Set[str] = set()
+        if _block_ok(fn.body, calls, allow_return=True):
+            callees[fn.name] = calls
+    found = set(callees)
+    changed = True
+    while changed:
+        changed = False
+        for name in sorted(found):
+            if not callees[name] <= found:
+                found.discard(name)
+                changed = True
+    return found
+
+
+def find_parallel_loops(body: List[Stmt], pure_fns: Set[str]) -> Dict[int, ParallelLoop]:
+    """Find the parallel range() loops of a function body (or the main script).
+
+    Args:
+        body: Statements of the function
+        pure_fns: Functions the loops may call, from pure_functions()
+
+    Returns:
+        Map from id() of each parallel ForRange statement to its analysis
+    """
+    found: Dict[int, ParallelLoop] = {}
+    _find_in_block(body, [], pure_fns, found)
+    return found
+
+
+def _find_in_block(stmts: List[Stmt], after: List[Stmt], pure_fns: Set[str],
+                   found: Dict[int, ParallelLoop]) -> None:
+    """Look for parallel loops in a block; after is what may run once it completes."""
+    for index, stmt in enumerate(stmts):
+        rest = stmts[index + 1:] + after
+        if isinstance(stmt, ForRange):
+            loop = _analyze_loop(stmt, rest, pure_fns)
+            if loop is not None:
+                found[id(stmt)] = loop
+                continue
+        if isinstance(stmt, If):
+            _find_in_block(stmt.body, rest, pure_fns, found)
+            _find_in_block(stmt.orelse, rest, pure_fns, found)
+        elif isinstance(stmt, (While, ForRange)):
+            # The next iteration runs the whole loop again
+            _find_in_block(stmt.body, [stmt] + rest, pure_fns, found)
+
+
+def _analyze_loop(loop: ForRange, after: List[Stmt], pure_fns: Set[str]) -> Optional[ParallelLoop]:
+    """Check that a loop's iterations are independent and classify its variables."""
+    calls: Set[str] = set()
+    if not _block_ok(loop.body, calls, allow_return=False) or not calls <= pure_fns:
+        return None
+
+    reductions = _reductions(loop.body)
+    if reductions is None:
+        return None
+    written = _assigned(loop.body) | {loop.var}
+    for name in written - set(reductions):
+        if name != loop.var and _reads_before_write(loop.body, name, False)[0]:
+            return None  # carries a value from one iteration to the next
+        if _reads_before_write(after, name, False)[0]:
+            return None  # the last iteration's value is used later
+
+    inputs: List[str] = []
+    for name in _reads_in_order(loop.body):
+        if name not in written and name not in inputs:
+            inputs.append(name)
+    heavy = bool(calls) or any(isinstance(stmt, (While, ForRange)) for stmt in _walk(loop.body))
+    return ParallelLoop(inputs, reductions, heavy)
+
+
+def _additive_terms(expr: Expr, sign: int = 1) -> List[Tuple[int, Expr]]:
+    """Flatten a chain of + and - into its signed terms."""
+    if isinstance(expr, BinOp) and expr.op in ("+", "-"):
+        right_sign = sign if expr.op == "+" else -sign
+        return _additive_terms(expr.left, sign) + _additive_terms(expr.right, right_sign)
+    return [(sign, expr)]
+
+
+def _reduction_of(stmt: Assign) -> Optional[Tuple[str, List[Expr]]]:
+    """Match r = r + x (any sum with r as a term added once), r = min(r, x) or r = max(r, x).
+
+    Returns:
+        (operator, the other operands), or None if the statement is no
+        reduction of its target
+    """
+    acc = Var(stmt.name)
+    expr = stmt.expr
+    if isinstance(expr, BinOp) and expr.op in ("+", "-"):
+        terms = _additive_terms(expr)
+        if terms.count((1, acc)) == 1:
+            return "+", [term for term in terms if term != (1, acc)]
+        return None
+    if isinstance(expr, BuiltinCall) and expr.name in ("min", "max") and len(expr.args) == 2:
+        if expr.args[0] == acc:
+            return expr.name, [expr.args[1]]
+        if expr.args[1] == acc:
+            return expr.name, [expr.args[0]]
+    return None
+
+
+def _reductions(body: List[Stmt]) -> Optional[Dict[str, str]]:
+    """Find the reduction variables of a loop body.
+
+    A variable is one when every statement assigning it is a reduction
+    with the same operator and nothing else reads it.
+
+    Returns:
+        Map from accumulator to operator, or None if some accumulator is
+        also assigned or read another way
+    """
+    ops: Dict[str, str] = {}
+    other_writes: Set[str] = set()
+    other_reads: Set[str] = set()
+    for stmt in _walk(body):
+        match = _reduction_of(stmt) if isinstance(stmt, Assign) else None
+        operand_reads = set().union(*(_reads(e) for e in match[1])) if match else set()
+        if match is not None and stmt.name not in operand_reads:
+            if ops.setdefault(stmt.name, match[0]) != match[0]:
+                return None
+            other_reads |= operand_reads
+            continue
+        if isinstance(stmt, Assign):
+            other_writes.add(stmt.name)
+        elif isinstance(stmt, ForRange):
+            other_writes.add(stmt.var)
+        for expr in _stmt_exprs(stmt):
+            other_reads |= _reads(expr)
+    if (other_writes | other_reads) & set(ops):
+        return None
+    return ops
+
+
+def _reads_before_write(stmts: List[Stmt], name: str, defined: bool) -> Tuple[bool, bool]:
+    """Check whether running a block may read a variable before writing it.
+
+    Loops may run zero times and a branch may be skipped, so only writes on
+    every path count. Code after a break, continue or return is still
+    searched for reads but its writes are ignored; that only errs towards
+    reporting a read.
+
+    Args:
+        stmts: The block
+        name: The variable
+        defined: Whether the variable is written when the block starts
+
+    Returns:
+        (whether a read may come first, whether it is written at the end)
+    """
+    jumped = False
+    for stmt in stmts:
+        if not defined and any(name in _reads(expr) for expr in _stmt_exprs(stmt)):
+            return True, defined
+        if isinstance(stmt, Assign):
+            if stmt.name == name and not jumped:
+                defined = True
+        elif isinstance(stmt, If):
+            in_body, body_defined = _reads_before_write(stmt.body, name, defined)
+            in_else, else_defined = _reads_before_write(stmt.orelse, name, defined)
+            if in_body or in_else:
+                return True, defined
+            if not jumped:
+                defined = body_defined and else_defined
+        elif isinstance(stmt, While):
+            if _reads_before_write(stmt.body, name, defined)[0]:
+                return True, defined
+        elif isinstance(stmt, ForRange):
+            if _reads_before_write(stmt.body, name, defined or stmt.var == name)[0]:
+                return True, defined
+        elif isinstance(stmt, (Break, Continue, Return)):
+            jumped = True
+    return False, defined
+
+
+def _block_ok(stmts: List[Stmt], calls: Set[str], allow_return: bool, depth: int = 0) -> bool:
+    """Check that a block has no effect but assigning its variables.
+
+    Args:
+        stmts: The block
+        calls: Set the called functions are added to
+        allow_return: Whether return is allowed (in a function body)
+        depth: Number of loops around the block inside the analyzed code;
+               break is only allowed inside one
+    """
+    for stmt in stmts:
+        if isinstance(stmt, (Print, AttrAssign, MethodCallStmt)):
+            return False
+        if isinstance(stmt, Return) and not allow_return:
+            return False
+        if isinstance(stmt, Break) and depth == 0:
+            return False
+        if not all(_expr_ok(expr, calls) for expr in _stmt_exprs(stmt)):
+            return False
+        if isinstance(stmt, If):
+            if not (_block_ok(stmt.body, calls, allow_return, depth)
+                    and _block_ok(stmt.orelse, calls, allow_return, depth)):
+                return False
+        elif isinstance(stmt, (While, ForRange)):
+            if not _block_ok(stmt.body, calls, allow_return, depth + 1):
+                return False
+    return True
+
+
+def _expr_ok(expr: Expr, calls: Set[str]) -> bool:
+    """Check that an expression only computes values, adding its callees to calls."""
+    if expr is None or isinstance(expr, (IntConst, StrConst, Var)):
+        return True
+    if isinstance(expr, (BinOp, CmpOp)):
+        return _expr_ok(expr.left, calls) and _expr_ok(expr.right, calls)
+    if isinstance(expr, BuiltinCall):
+        return expr.name in _PURE_BUILTINS and all(_expr_ok(arg, calls) for arg in expr.args)
+    if isinstance(expr, Call):
+        calls.add(expr.func)
+        return all(_expr_ok(arg, calls) for arg in expr.args)
+    # Objects are shared between iterations
+    return False
+
+
+def _walk(stmts: List[Stmt]):
+    """Yield every statement of a block, nested ones included."""
+    for stmt in stmts:
+        yield stmt
+        if isinstance(stmt, If):
+            yield from _walk(stmt.body)
+            yield from _walk(stmt.orelse)
+        elif isinstance(stmt, (While, ForRange)):
+            yield from _walk(stmt.body)
+
+
+def _reads_in_order(stmts: List[Stmt]) -> List[str]:
+    """Names a block reads, in order of first appearance."""
+    names: List[str] = []
+    for stmt in _walk(stmts):
+        for expr in _stmt_exprs(stmt):
+            names.extend(sorted(_reads(expr) - set(names)))
+    return names
@@ -0,0 +1,303 @@
+"""
+Integer range inference for pcc.
+
+Computes, for every integer variable of a function body, an interval that
+contains every value the variable can hold. Variables whose interval fits
+in int64_t can be stored as native integers; everything else stays a
+BigInt.
+
+The analysis is flow-insensitive: a variable's range is the union of the
+ranges of all values assigned to it, iterated to a fixed point. A range
+that keeps growing (an accumulator, a counter of a while loop) is widened
+to unbounded after a few rounds. Intermediate results are bounded too, so
+an expression with a finite range can be evaluated entirely in int64_t
+without overflow.
+"""
+
+from math import isqrt
+from typing import Dict, Iterator, List, Optional, Set, Tuple
+
+from .nodes import (
+    Stmt, Expr,
+    IntConst, StrConst, Var, BinOp, CmpOp, Call, AttributeAccess, MethodCall, ConstructorCall, BuiltinCall,
+    Assign, If, While, ForRange,
+)
+
+INT64_MIN = -(1 << 63)
+INT64_MAX = (1 << 63) - 1
+
+# Closed interval [lo, hi] within int64_t; None means unbounded
+Interval = Optional[Tuple[int, int]]
+
+# Updates a variable's range may take before it is widened to unbounded
+_WIDEN_AFTER = 4
+
+
+def _bounded(lo: int, hi: int) -> Interval:
+    """Build an interval, or None if it leaves int64_t."""
+    if lo < INT64_MIN or hi > INT64_MAX:
+        return None
+    return (lo, hi)
+
+
+def _join(a: Interval, b: Interval) -> Interval:
+    """Smallest interval containing both a and b."""
+    if a is None or b is None:
+        return None
+    return (min(a[0], b[0]), max(a[1], b[1]))
+
+
+def _floordiv_range(a: Tuple[int, int], b: Tuple[int, int]) -> Interval:
+    """Range of a // b for a divisor range that excludes zero.
+
+    Floor division is monotonic in each operand while the divisor keeps its
+    sign, so the extremes are at the corners.
+    """
+    if b[0] <= 0 <= b[1]:
+        return None
+    corners = [x // y for x in a for y in b]
+    return _bounded(min(corners), max(corners))
+
+
+def _mod_range(a: Tuple[int, int], b: Tuple[int, int]) -> Interval:
+    """Range of a % b for a divisor range that excludes zero."""
+    if b[0] > 0:
+        if a[0] >= 0:
+            return (0, min(a[1], b[1] - 1))
+        return (0, b[1] - 1)
+    if b[1] < 0:
+        if a[1] <= 0:
+            return (max(a[0], b[0] + 1), 0)
+        return (b[0] + 1, 0)
+    return None
+
+
+def _binop_range(op: str, a: Interval, b: Interval) -> Interval:
+    """Range of an integer BinOp over operand ranges."""
+    if a is None or b is None:
+        return None
+    if op == "+":
+        return _bounded(a[0] + b[0], a[1] + b[1])
+    if op == "-":
+        return _bounded(a[0] - b[1], a[1] - b[0])
+    if op == "*":
+        corners = [x * y for x in a for y in b]
+        return _bounded(min(corners), max(corners))
+    if op == "//":
+        return _floordiv_range(a, b)
+    if op == "%":
+        return _mod_range(a, b)
+    # Shifts and masks only take a constant right operand
+    if op == "<<":
+        return _binop_range("*", a, _bounded(1 << b[0], 1 << b[0]))
+    if op == ">>":
+        scale = _bounded(1 << b[0], 1 << b[0])
+        return _floordiv_range(a, scale) if scale is not None else None
+    if op == "&":
+        return (0, min(a[1], b[0]) if a[0] >= 0 else b[0])
+    return None
+
+
+def for_range_counter(start: Interval, stop: Interval, step: Interval) -> Tuple[Interval, int]:
+    """Range of a range() loop's counter and the sign of its step.
+
+    The counter runs from start and takes one step past the last value
+    inside the range before the loop exits, so that value must fit too.
+
+    Returns:
+        (counter range, +1 or -1), or (None, 0) if the step may be zero,
+        may change sign, or the counter may overflow
+    """
+    if start is None or stop is None or step is None:
+        return None, 0
+    if step[0] > 0:
+        counter, sign = _bounded(min(start[0], stop[0]), max(start[1], stop[1] - 1 + step[1])), 1
+    elif step[1] < 0:
+        counter, sign = _bounded(min(start[0], stop[0] + 1 + step[0]), max(start[1], stop[1])), -1
+    else:
+        return None, 0
+    return (counter, sign) if counter is not None else (None, 0)
+
+
+def for_range_var(start: Interval, stop: Interval, step: Interval) -> Interval:
+    """Range of the loop variable of a range() loop inside its body."""
+    counter, sign = for_range_counter(start, stop, step)
+    if counter is None:
+        return None
+    if sign > 0:
+        return _bounded(start[0], max(start[0], stop[1] - 1))
+    return _bounded(min(start[1], stop[0] + 1), start[1])
+
+
+def _walk(stmts: List[Stmt]) -> Iterator[Stmt]:
+    """Yield every statement of a body, nested ones included."""
+    for stmt in stmts:
+        yield stmt
+        if isinstance(stmt, If):
+            yield from _walk(stmt.body)
+            yield from _walk(stmt.orelse)
+        elif isinstance(stmt, (While, ForRange)):
+            yield from _walk(stmt.body)
+
+
+class RangeInfo:
+    """Result of range inference over one function body.
+
+    Attributes:
+        ranges: Map from native variable name to its range; variables not
+                listed are BigInts (or not integers at all)
+    """
+
+    def __init__(self, ranges: Dict[str, Tuple[int, int]]) -> None:
+        self.ranges = ranges
+
+    def is_native(self, name: str) -> bool:
+        """Check whether a variable can be stored as an int64_t."""
+        return name in self.ranges
+
+    def expr_range(self, expr: Expr) -> Interval:
+        """Range of an integer expression, or None if it is not bounded.
+
+        A bounded expression can be evaluated in int64_t, all of its
+        intermediate results included.
+        """
+        return _expr_range(expr, self.ranges)
+
+
+def _expr_range(expr: Expr, env: Dict[str, Interval]) -> Interval:
+    """Range of an expression given the ranges of the variables it reads."""
+    if isinstance(expr, IntConst):
+        return _bounded(expr.value, expr.value)
+    if isinstance(expr, Var):
+        return env.get(expr.name)
+    if isinstance(expr, BinOp):
+        return _binop_range(expr.op, _expr_range(expr.left, env), _expr_range(expr.right, env))
+    if isinstance(expr, BuiltinCall):
+        return _builtin_range(expr, env)
+    # Calls, attributes, objects, strings and comparisons
+    return None
+
+
+def _builtin_range(expr: BuiltinCall, env: Dict[str, Interval]) -> Interval:
+    """Range of an integer builtin call."""
+    if expr.name == "len":
+        return (0, INT64_MAX)
+    args = [_expr_range(arg, env) for arg in expr.args]
+    if not args or any(a is None for a in args):
+        return None
+    if expr.name == "int" and len(args) == 1:
+        return args[0]
+    if expr.name == "abs" and len(args) == 1:
+        lo, hi = args[0]
+        if lo >= 0:
+            return (lo, hi)
+        if hi <= 0:
+            return _bounded(-hi, -lo)
+        return _bounded(0, max(-lo, hi))
+    if expr.name == "min" and len(args) >= 2:
+        return (min(a[0] for a in args), min(a[1] for a in args))
+    if expr.name == "max" and len(args) >= 2:
+        return (max(a[0] for a in args), max(a[1] for a in args))
+    if expr.name == "isqrt" and len(args) == 1 and args[0][0] >= 0:
+        return (isqrt(args[0][0]), isqrt(args[0][1]))
+    return None
+
+
+def _is_string(expr: Expr, str_vars: Set[str]) -> bool:
+    """Check whether an expression produces a string."""
+    if isinstance(expr, StrConst):
+        return True
+    if isinstance(expr, Var):
+        return expr.name in str_vars
+    if isinstance(expr, BuiltinCall):
+        return expr.name == "str"
+    if isinstance(expr, BinOp) and expr.op == "+":
+        return _is_string(expr.left, str_vars) and _is_string(expr.right, str_vars)
+    return False
+
+
+def infer_ranges(body: List[Stmt], params: Optional[List[str]] = None) -> RangeInfo:
+    """Infer the ranges of the integer variables of a function body.
+
+    Parameters and the results of calls, methods and attributes are
+    unbounded, so only values computed locally from constants, lengths and
+    range() loops end up native.
+
+    Args:
+        body: Statements of the function (or of the main script)
+        params: Parameter names of the function
+
+    Returns:
+        RangeInfo with the variables that fit in int64_t
+    """
+    stmts = list(_walk(body))
+
+    # Strings and objects first: their variables are never native
+    str_vars: Set[str] = set()
+    other_vars: Set[str] = set(params or [])
+    changed = True
+    while changed:
+        changed = False
+        for stmt in stmts:
+            if isinstance(stmt, Assign) and stmt.name not in str_vars and _is_string(stmt.expr, str_vars):
+                str_vars.add(stmt.name)
+                changed = True
+    for stmt in stmts:
+        if isinstance(stmt, Assign) and isinstance(stmt.expr, (ConstructorCall, AttributeAccess)):
+            other_vars.add(stmt.name)
+        if isinstance(stmt, Assign) and isinstance(stmt.expr, CmpOp):
+            other_vars.add(stmt.name)
+
+    # Integer definitions: (variable, range of the assigned value from env)
+    defs: List[Tuple[str, object]] = []
+    for stmt in stmts:
+        if isinstance(stmt, Assign) and stmt.name not in str_vars:
+            defs.append((stmt.name, stmt.expr))
+        elif isinstance(stmt, ForRange):
+            defs.append((stmt.var, stmt))
+
+    # Absent from env = no value seen yet; None = unbounded
+    env: Dict[str, Interval] = {name: None for name in other_vars | str_vars}
+    updates: Dict[str, int] = {}
+    changed = True
+    while changed:
+        changed = False
+        for name, source in defs:
+            if isinstance(source, ForRange):
+                value = _loop_var_range(source, env)
+            else:
+                value = _expr_range(source, env) if _reads_known(source, env) else ()
+            if value == ():
+                continue  # reads a variable with no value yet
+            old = env.get(name, ())
+            new = value if old == () else _join(old, value)
+            if new == old:
+                continue
+            updates[name] = updates.get(name, 0) + 1
+            if updates[name] > _WIDEN_AFTER:
+                new = None
+            env[name] = new
+            changed = True
+
+    return RangeInfo({name: r for name, r in env.items()
+                      if r is not None and name not in other_vars and name not in str_vars})
+
+
+def _loop_var_range(loop: ForRange, env: Dict[str, Interval]):
+    """Range of a range() loop variable, () if its bounds are not known yet."""
+    parts = (loop.start, loop.stop, loop.step)
+    if not all(_reads_known(e, env) for e in parts):
+        return ()
+    start, stop, step = (_expr_range(e, env) for e in parts)
+    return for_range_var(start, stop, step)
+
+
+def _reads_known(expr: Expr, env: Dict[str, Interval]) -> bool:
+    """Check that every variable an expression reads has a value in env."""
+    if isinstance(expr, Var):
+        return expr.name in env
+    if isinstance(expr, (BinOp, CmpOp)):
+        return _reads_known(expr.left, env) and _reads_known(expr.right, env)
+    if isinstance(expr, (Call, MethodCall, ConstructorCall, BuiltinCall)):
+        return all(_reads_known(arg, env) for arg in expr.args)
+    return True
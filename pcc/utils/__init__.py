@@ -4,11 +4,15 @@ Utility modules for pcc.
 This package contains utility functions and helpers used throughout the compiler.
 """
 
-from .toolchain import Toolchain, ToolchainDetector
+from .toolchain import OPT_MODES, Toolchain, ToolchainDetector
 from .settings import Settings
+from .cache import BuildCache, content_hash
 
 __all__ = [
+    "OPT_MODES",
     "Toolchain",
     "ToolchainDetector",
     "Settings",
+    "BuildCache",
+    "content_hash",
 ]
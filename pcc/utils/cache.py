@@ -0,0 +1,138 @@
+"""
+Content-addressed build cache for pcc.
+
+Artifacts live under the user cache directory, each named by a SHA-256 of
+everything that determines its contents:
+
+- generated C, by the Python source, the compiler's own sources and the
+  code generation options;
+- runtime libraries, by the runtime sources, the toolchain and its flags;
+- executables, by the generated C and the runtime library key.
+
+Entries are written to a temporary file and renamed into place, so builds
+running at the same time never see a partial artifact. Nothing is ever
+invalidated: a change to any input changes the key. The directory can be
+deleted at any time to reclaim space.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import os
+import shutil
+import sys
+import tempfile
+from functools import lru_cache
+from pathlib import Path
+from typing import Optional, Union
+
+
+def default_cache_dir() -> Path:
+    """Get the cache directory: $PCC_CACHE_DIR, else the platform's user cache directory."""
+    override = os.environ.get("PCC_CACHE_DIR")
+    if override:
+        return Path(override)
+    if sys.platform == "win32" and os.environ.get("LOCALAPPDATA"):
+        return Path(os.environ["LOCALAPPDATA"]) / "pcc" / "cache"
+    base = os.environ.get("XDG_CACHE_HOME") or Path.home() / ".cache"
+    return Path(base) / "pcc"
+
+
+def content_hash(*parts: Union[str, bytes]) -> str:
+    """Hash a sequence of strings or byte strings; each part is length-prefixed."""
+    digest = hashlib.sha256()
+    for part in parts:
+        data = part.encode("utf-8") if isinstance(part, str) else part
+        digest.update(len(data).to_bytes(8, "little"))
+        digest.update(data)
+    return digest.hexdigest()
+
+
+@lru_cache(maxsize=None)
+def compiler_fingerprint() -> str:
+    """Hash of the pcc version and every source file of the pcc package.
+
+    Generated C depends on the code generator as much as on the program,
+    so edits to pcc invalidate it even without a version bump.
+    """
+    from .. import __version__
+    package = Path(__file__).resolve().parent.parent
+    parts = [__version__]
+    for path in sorted(package.rglob("*.py")):
+        parts.append(path.relative_to(package).as_posix())
+        parts.append(path.read_bytes())
+    return content_hash(*parts)
+
+
+class BuildCache:
+    """A directory of artifacts grouped by kind and named by content hash.
+
+    Example:
+        >>> cache = BuildCache()
+        >>> key = content_hash(source)
+        >>> c_text = cache.read_text("c", key, ".c")
+        >>> if c_text is None:
+        ...     cache.write_text("c", key, ".c", generate(source))
+    """
+
+    def __init__(self, root: Optional[Path] = None):
+        """Initialize the cache.
+
+        Args:
+            root: Cache directory, default_cache_dir() if None; created on
+                  the first write
+        """
+        self.root = Path(root) if root is not None else default_cache_dir()
+
+    def path(self, kind: str, key: str, suffix: str = "") -> Path:
+        """Get where the entry for a key is stored, whether or not it exists."""
+        return self.root / kind / key[:2] / f"{key}{suffix}"
+
+    def get(self, kind: str, key: str, suffix: str = "") -> Optional[Path]:
+        """Get the path of a cached entry, or None if there is none."""
+        path = self.path(kind, key, suffix)
+        return path if path.is_file() else None
+
+    def read_text(self, kind: str, key: str, suffix: str = "") -> Optional[str]:
+        """Get the text of a cached entry, or None if there is none."""
+        path = self.get(kind, key, suffix)
+        return path.read_text(encoding="utf-8") if path is not None else None
+
+    def write_text(self, kind: str, key: str, suffix: str, text: str) -> Path:
+        """Store text as the entry for a key.
+
+        Returns:
+            Path of the entry
+        """
+        return self._install(kind, key, suffix, lambda tmp: tmp.write_text(text, encoding="utf-8"))
+
+    def put_file(self, kind: str, key: str, suffix: str, source: Path) -> Path:
+        """Store a copy of a file, permission bits included, as the entry for a key.
+
+        Returns:
+            Path of the entry
+        """
+        return self._install(kind, key, suffix, lambda tmp: shutil.copy2(source, tmp))
+
+    def temp_dir(self) -> Path:
+        """Create a scratch directory inside the cache, on the same file system as the entries.
+
+        The caller removes it when done.
+        """
+        self.root.mkdir(parents=True, exist_ok=True)
+        return Path(tempfile.mkdtemp(prefix="tmp-", dir=self.root))
+
+    def _install(self, kind: str, key: str, suffix: str, fill) -> Path:
+        """Write an entry through fill(temporary path), then rename it into place."""
+        path = self.path(kind, key, suffix)
+        path.parent.mkdir(parents=True, exist_ok=True)
+        fd, tmp_name = tempfile.mkstemp(prefix=".tmp-", dir=path.parent)
+        os.close(fd)
+        tmp = Path(tmp_name)
+        try:
+            fill(tmp)
+            os.replace(tmp, path)
+        finally:
+            if tmp.exists():
+                tmp.unlink()
+        return path
@@ -6,8 +6,12 @@ C compilers (MSVC, clang-cl, GCC).
 """
 
 import shutil
+import subprocess
+import tempfile
 from enum import Enum
-from typing import Optional
+from functools import lru_cache
+from pathlib import Path
+from typing import FrozenSet, Optional, Tuple
 
 
 class Toolchain(Enum):
@@ -17,6 +21,24 @@ class Toolchain(Enum):
     GCC = "gcc"
 
 
+# Build optimization modes of `pcc build --opt`
+OPT_MODES = ("lto", "pgo", "native")
+
+# GCC flags whose acceptance shows support for each mode
+_GCC_PROBE_FLAGS = {
+    "lto": ("-flto=auto",),
+    "pgo": ("-fprofile-generate",),
+    "native": ("-march=native",),
+}
+
+# Modes cl.exe and clang-cl always support: /GL with /LTCG, /GENPROFILE
+# with /USEPROFILE, and clang's -march=native passed through /clang:
+_MSVC_STYLE_MODES = {
+    "msvc": frozenset({"lto", "pgo"}),
+    "clang-cl": frozenset({"native"}),
+}
+
+
 class ToolchainDetector:
     """Detects available C compilers on the system.
 
@@ -96,3 +118,36 @@ class ToolchainDetector:
             list: List of available Toolchain enums
         """
         return [tc for tc in Toolchain if self.is_available(tc)]
+
+    def supported_opt_modes(self, toolchain: Toolchain) -> FrozenSet[str]:
+        """Get the `--opt` modes a toolchain can build with.
+
+        GCC is asked whether it compiles and links a trivial program with
+        each mode's flags, since LTO and profiling support are optional
+        parts of an installation.
+
+        Args:
+            toolchain: The toolchain to check
+
+        Returns:
+            frozenset: Names from OPT_MODES; empty if the toolchain is not installed
+        """
+        compiler = self.get_compiler_path(toolchain)
+        if compiler is None:
+            return frozenset()
+        if toolchain == Toolchain.GCC:
+            return frozenset(mode for mode in OPT_MODES if _gcc_accepts(compiler, _GCC_PROBE_FLAGS[mode]))
+        return _MSVC_STYLE_MODES[toolchain.value]
+
+
+@lru_cache(maxsize=None)
+def _gcc_accepts(gcc: str, flags: Tuple[str, ...]) -> bool:
+    """Check whether GCC builds a trivial program with some flags."""
+    with tempfile.TemporaryDirectory(prefix="pcc-probe-") as work:
+        probe = Path(work) / "probe.c"
+        probe.write_text("int main(void) { return 0; }\n", encoding="utf-8")
+        cmd = [gcc, *flags, str(probe), "-o", str(Path(work) / "probe")]
+        try:
+            return subprocess.run(cmd, capture_output=True, cwd=work).returncode == 0
+        except OSError:
+            return False
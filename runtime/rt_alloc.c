@@ -0,0 +1,208 @@
+/*
+ * Memory allocation implementation for pcc runtime.
+ *
+ * Both the size-class free lists and the temporary stack are per-thread,
+ * so no locking is needed: a block freed on another thread simply joins
+ * that thread's free list.
+ */
+
+#include "rt_alloc.h"
+#include "rt_profile.h"
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if (RT_MEM_MIN_BLOCK & (RT_MEM_MIN_BLOCK - 1)) || (RT_MEM_MAX_BLOCK & (RT_MEM_MAX_BLOCK - 1))
+#error "RT_MEM_MIN_BLOCK and RT_MEM_MAX_BLOCK must be powers of two"
+#endif
+#if RT_MEM_MIN_BLOCK < 16 || RT_MEM_MAX_BLOCK < RT_MEM_MIN_BLOCK
+#error "RT_MEM_MIN_BLOCK must be at least 16 and at most RT_MEM_MAX_BLOCK"
+#endif
+
+/* ==================== Size-Class Pool ==================== */
+
+/* Upper bound on the number of classes MIN, 2*MIN, ..., MAX */
+#define RT_MEM_CLASS_SLOTS (sizeof(size_t) * CHAR_BIT)
+
+/* Free blocks are linked through their first word */
+typedef struct rt_mem_block {
+    struct rt_mem_block* next;
+} rt_mem_block;
+
+typedef struct {
+    rt_mem_block* head[RT_MEM_CLASS_SLOTS];
+    unsigned count[RT_MEM_CLASS_SLOTS];
+} rt_mem_pool;
+
+static RT_THREAD_LOCAL rt_mem_pool rt_pool;
+
+#ifndef RT_MEM_NO_POOL
+/* Class index for a pooled size (size <= RT_MEM_MAX_BLOCK) */
+static unsigned rt_mem_class(size_t size) {
+    if (size <= RT_MEM_MIN_BLOCK) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    unsigned bits = (unsigned)(sizeof(unsigned long long) * CHAR_BIT)
+                  - (unsigned)__builtin_clzll((unsigned long long)(size - 1));
+    return bits - (unsigned)__builtin_ctzll(RT_MEM_MIN_BLOCK);
+#else
+    unsigned c = 0;
+    size_t block = RT_MEM_MIN_BLOCK;
+    while (block < size) {
+        block <<= 1;
+        c++;
+    }
+    return c;
+#endif
+}
+#endif
+
+size_t rt_mem_usable_size(size_t size) {
+#ifdef RT_MEM_NO_POOL
+    return size;
+#else
+    if (size > RT_MEM_MAX_BLOCK) return size;
+    return (size_t)RT_MEM_MIN_BLOCK << rt_mem_class(size);
+#endif
+}
+
+void* rt_mem_alloc(size_t size) {
+    RT_PROF_MEM(RT_PROF_MEM_ALLOC, rt_mem_usable_size(size), 0);
+#ifdef RT_MEM_NO_POOL
+    RT_PROF_MEM(RT_PROF_SYS_MALLOC, 0, 0);
+    return malloc(size ? size : 1);
+#else
+    if (size > RT_MEM_MAX_BLOCK) {
+        RT_PROF_MEM(RT_PROF_SYS_MALLOC, 0, 0);
+        return malloc(size);
+    }
+
+    unsigned c = rt_mem_class(size);
+    rt_mem_block* blk = rt_pool.head[c];
+    if (blk) {
+        rt_pool.head[c] = blk->next;
+        rt_pool.count[c]--;
+        return blk;
+    }
+    RT_PROF_MEM(RT_PROF_SYS_MALLOC, 0, 0);
+    return malloc((size_t)RT_MEM_MIN_BLOCK << c);
+#endif
+}
+
+void rt_mem_free(void* p, size_t size) {
+    if (!p) return;
+    RT_PROF_MEM(RT_PROF_MEM_FREE, 0, rt_mem_usable_size(size));
+#ifdef RT_MEM_NO_POOL
+    (void)size;
+    RT_PROF_MEM(RT_PROF_SYS_FREE, 0, 0);
+    free(p);
+#else
+    if (size > RT_MEM_MAX_BLOCK) {
+        RT_PROF_MEM(RT_PROF_SYS_FREE, 0, 0);
+        free(p);
+        return;
+    }
+
+    unsigned c = rt_mem_class(size);
+    if (rt_pool.count[c] >= RT_MEM_CACHE_BLOCKS) {
+        RT_PROF_MEM(RT_PROF_SYS_FREE, 0, 0);
+        free(p);
+        return;
+    }
+    rt_mem_block* blk = (rt_mem_block*)p;
+    blk->next = rt_pool.head[c];
+    rt_pool.head[c] = blk;
+    rt_pool.count[c]++;
+#endif
+}
+
+/*
+ * With profiling, a realloc() that moves the block to another size class
+ * also counts as the allocation and the free it is made of.
+ */
+void* rt_mem_realloc(void* p, size_t old_size, size_t new_size) {
+    if (!p) return rt_mem_alloc(new_size);
+#ifdef RT_MEM_NO_POOL
+    RT_PROF_MEM(RT_PROF_MEM_REALLOC, new_size, old_size);
+    RT_PROF_MEM(RT_PROF_SYS_REALLOC, 0, 0);
+    return realloc(p, new_size ? new_size : 1);
+#else
+    if (old_size > RT_MEM_MAX_BLOCK && new_size > RT_MEM_MAX_BLOCK) {
+        RT_PROF_MEM(RT_PROF_MEM_REALLOC, new_size, old_size);
+        RT_PROF_MEM(RT_PROF_SYS_REALLOC, 0, 0);
+        return realloc(p, new_size);
+    }
+    RT_PROF_MEM(RT_PROF_MEM_REALLOC, 0, 0);
+    if (old_size <= RT_MEM_MAX_BLOCK && new_size <= RT_MEM_MAX_BLOCK &&
+        rt_mem_class(old_size) == rt_mem_class(new_size)) {
+        return p;
+    }
+
+    void* q = rt_mem_alloc(new_size);
+    if (!q) return NULL;
+    memcpy(q, p, old_size < new_size ? old_size : new_size);
+    rt_mem_free(p, old_size);
+    return q;
+#endif
+}
+
+/* ==================== Temporary Scopes ==================== */
+
+RT_THREAD_LOCAL rt_scope_stack rt_scope_temps;
+
+rt_error_code_t rt_scope_push_slow(void* obj, int is_str) {
+    rt_scope_stack* st = &rt_scope_temps;
+    if (st->len == st->cap) {
+        size_t new_cap = st->cap ? st->cap * 2 : 64;
+        rt_scope_entry* grown = (rt_scope_entry*)realloc(st->items, new_cap * sizeof(rt_scope_entry));
+        if (!grown) {
+            RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to grow temporary scope stack");
+            return RT_ERROR_NOMEM;
+        }
+        st->items = grown;
+        st->cap = new_cap;
+    }
+
+    st->items[st->len].obj = obj;
+    st->items[st->len].is_str = is_str;
+    st->len++;
+    return RT_OK;
+}
+
+void rt_scope_reset(rt_scope_t mark) {
+    rt_scope_stack* st = &rt_scope_temps;
+    while (st->len > mark) {
+        rt_scope_entry* e = &st->items[--st->len];
+        if (e->is_str) {
+            rt_str_clear((rt_str*)e->obj);
+            continue;
+        }
+
+        /* Inline rt_int_clear: most temporaries never leave inline storage */
+        rt_int* x = (rt_int*)e->obj;
+        if (x->digits != x->small) {
+            rt_mem_free(x->digits, x->cap * sizeof(rt_limb_t));
+            x->digits = x->small;
+            x->cap = RT_INT_INLINE_LIMBS;
+        }
+        x->sign = 0;
+        x->len = 0;
+    }
+}
+
+void rt_mem_trim(void) {
+    for (size_t c = 0; c < RT_MEM_CLASS_SLOTS; c++) {
+        while (rt_pool.head[c]) {
+            rt_mem_block* blk = rt_pool.head[c];
+            rt_pool.head[c] = blk->next;
+            RT_PROF_MEM(RT_PROF_SYS_FREE, 0, 0);
+            free(blk);
+        }
+        rt_pool.count[c] = 0;
+    }
+
+    if (rt_scope_temps.len == 0) {
+        free(rt_scope_temps.items);
+        rt_scope_temps.items = NULL;
+        rt_scope_temps.cap = 0;
+    }
+}
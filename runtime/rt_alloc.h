@@ -0,0 +1,150 @@
+/*
+ * Memory allocation module for pcc runtime.
+ *
+ * Provides a pooled allocator for BigInt limb buffers and string data, and
+ * temporary scopes that release generated-code temporaries in bulk.
+ *
+ * Small blocks are rounded up to power-of-two size classes and recycled
+ * through per-class free lists, so the allocate/release churn of loop
+ * temporaries is served without reaching malloc. Frees are sized: callers
+ * pass back the size they allocated (or any size in the same class).
+ */
+
+#pragma once
+
+#include "rt_config.h"
+#include "rt_error.h"
+#include "rt_bigint.h"
+#include "rt_string.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/* ==================== Pooled Allocation ==================== */
+
+/**
+ * Allocate a block of at least size bytes.
+ *
+ * @param size Requested size in bytes
+ * @return Pointer to the block, or NULL on allocation failure
+ */
+void* rt_mem_alloc(size_t size) RT_MALLOC;
+
+/**
+ * Resize a block, preserving min(old_size, new_size) bytes of contents.
+ * Blocks that stay within their size class are returned unchanged.
+ *
+ * @param p Block from rt_mem_alloc (may be NULL)
+ * @param old_size Size the block was allocated with
+ * @param new_size New size in bytes
+ * @return Pointer to the resized block, or NULL on failure (p is left intact)
+ */
+void* rt_mem_realloc(void* p, size_t old_size, size_t new_size);
+
+/**
+ * Release a block to its size-class free list.
+ *
+ * @param p Block from rt_mem_alloc (may be NULL)
+ * @param size Size the block was allocated with
+ */
+void rt_mem_free(void* p, size_t size);
+
+/**
+ * Get the number of bytes actually reserved for a request of size bytes.
+ * Callers may use the whole block, e.g. to round up a capacity.
+ *
+ * @param size Requested size in bytes
+ * @return Usable size of the block rt_mem_alloc(size) returns
+ */
+size_t rt_mem_usable_size(size_t size);
+
+/**
+ * Return all cached free blocks of the calling thread to the system.
+ * Threads other than the main one call this before exiting.
+ */
+void rt_mem_trim(void);
+
+/* ==================== Temporary Scopes ==================== */
+
+/* Position in the temporary stack, as returned by rt_scope_mark() */
+typedef size_t rt_scope_t;
+
+/* Registered temporary: a BigInt or a string to clear on reset */
+typedef struct {
+    void* obj;
+    int is_str;
+} rt_scope_entry;
+
+/* Per-thread stack of registered temporaries */
+typedef struct {
+    rt_scope_entry* items;
+    size_t len;
+    size_t cap;
+} rt_scope_stack;
+
+extern RT_THREAD_LOCAL rt_scope_stack rt_scope_temps;
+
+/**
+ * Register a temporary, growing the stack if needed. Generated code uses
+ * the typed wrappers rt_scope_int() and rt_scope_str() instead.
+ *
+ * @param obj BigInt or string to register
+ * @param is_str Non-zero if obj is an rt_str
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_scope_push_slow(void* obj, int is_str);
+
+/**
+ * Mark the current top of the temporary stack.
+ *
+ * @return Mark to pass to rt_scope_reset()
+ */
+static inline rt_scope_t rt_scope_mark(void) {
+    return rt_scope_temps.len;
+}
+
+/**
+ * Clear every temporary registered since mark, newest first.
+ *
+ * @param mark Mark from rt_scope_mark()
+ */
+void rt_scope_reset(rt_scope_t mark);
+
+/**
+ * Register an initialized BigInt to be cleared by the next reset below it.
+ * The object must stay alive until then.
+ *
+ * @param x BigInt to register
+ * @return RT_OK on success, error code on failure
+ */
+static inline rt_error_code_t rt_scope_int(rt_int* x) {
+    rt_scope_stack* st = &rt_scope_temps;
+    if (st->len == st->cap) return rt_scope_push_slow(x, 0);
+    st->items[st->len].obj = x;
+    st->items[st->len].is_str = 0;
+    st->len++;
+    return RT_OK;
+}
+
+/**
+ * Register an initialized string to be cleared by the next reset below it.
+ * The object must stay alive until then.
+ *
+ * @param s String to register
+ * @return RT_OK on success, error code on failure
+ */
+static inline rt_error_code_t rt_scope_str(rt_str* s) {
+    rt_scope_stack* st = &rt_scope_temps;
+    if (st->len == st->cap) return rt_scope_push_slow(s, 1);
+    st->items[st->len].obj = s;
+    st->items[st->len].is_str = 1;
+    st->len++;
+    return RT_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
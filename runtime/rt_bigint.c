@@ -1,63 +1,54 @@
 /*
  * BigInt runtime module implementation for pcc.
  *
- * Provides arbitrary-precision integer arithmetic using base 10^9 representation.
+ * Provides arbitrary-precision integer arithmetic using binary limbs
+ * (base 2^RT_INT_LIMB_BITS); decimal text is converted at the edges
+ * (see rt_bigint_conv.c).
  */
 
 #include "rt_bigint.h"
+#include "rt_bigint_internal.h"
+#include "rt_alloc.h"
+#include "rt_io.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-/* Base for BigInt representation: 10^9 */
-#ifndef RT_INT_BASE
-#define RT_INT_BASE 1000000000U
-#endif
-#define RT_INT_BASE_DIGITS 9
-
 /* ==================== Internal Helpers ==================== */
 
-/* Ensure BigInt has enough capacity */
-static rt_error_code_t rt_int_ensure_cap(rt_int* x, size_t new_cap) {
-    if (new_cap <= x->cap) return RT_OK;
+/* Ensure BigInt has enough capacity, moving inline values to the pool */
+rt_error_code_t rt_int_ensure_cap(rt_int* x, size_t new_cap) {
+    if (RT_LIKELY(new_cap <= x->cap)) return RT_OK;
 
-    /* Double capacity strategy */
+    /* Double capacity strategy, rounded up to the whole pool block */
     size_t alloc_cap = x->cap * 2;
     if (alloc_cap < new_cap) alloc_cap = new_cap;
     if (alloc_cap < 4) alloc_cap = 4;
-
-    uint32_t* new_digits = (uint32_t*)realloc(x->digits, alloc_cap * sizeof(uint32_t));
-    RT_CHECK_NULL(new_digits, "digits realloc");
+    alloc_cap = rt_mem_usable_size(alloc_cap * sizeof(rt_limb_t)) / sizeof(rt_limb_t);
+    RT_PROF_GROW(RT_PROF_GROW_INT, alloc_cap * sizeof(rt_limb_t));
+
+    rt_limb_t* new_digits;
+    if (x->digits == x->small) {
+        new_digits = (rt_limb_t*)rt_mem_alloc(alloc_cap * sizeof(rt_limb_t));
+        RT_CHECK_ALLOC(new_digits, "BigInt digits");
+        memcpy(new_digits, x->small, x->cap * sizeof(rt_limb_t));
+    } else {
+        new_digits = (rt_limb_t*)rt_mem_realloc(x->digits, x->cap * sizeof(rt_limb_t),
+                                                alloc_cap * sizeof(rt_limb_t));
+        RT_CHECK_ALLOC(new_digits, "BigInt digits");
+    }
 
     /* Zero new capacity area */
-    memset(new_digits + x->cap, 0, (alloc_cap - x->cap) * sizeof(uint32_t));
+    memset(new_digits + x->cap, 0, (alloc_cap - x->cap) * sizeof(rt_limb_t));
 
     x->digits = new_digits;
     x->cap = alloc_cap;
     return RT_OK;
 }
 
-/* Normalize BigInt (remove leading zeros, fix sign) */
-static void rt_int_normalize(rt_int* x) {
-    while (x->len > 0 && x->digits[x->len - 1] == 0) {
-        x->len--;
-    }
-    if (x->len == 0) {
-        x->sign = 0;
-    }
-}
-
 /* Compare absolute values: returns -1, 0, or 1 */
 static int rt_int_cmp_abs(const rt_int* a, const rt_int* b) {
-    if (a->len != b->len) {
-        return (a->len < b->len) ? -1 : 1;
-    }
-    for (size_t i = a->len; i-- > 0;) {
-        if (a->digits[i] != b->digits[i]) {
-            return (a->digits[i] < b->digits[i]) ? -1 : 1;
-        }
-    }
-    return 0;
+    return rt_limbs_cmp(a->digits, a->len, b->digits, b->len);
 }
 
 /* ==================== Lifecycle ==================== */
@@ -67,37 +58,52 @@ rt_error_code_t rt_int_init(rt_int* x) {
 
     x->sign = 0;
     x->len = 0;
-    x->cap = 0;
-    x->digits = NULL;
+    x->cap = RT_INT_INLINE_LIMBS;
+    x->digits = x->small;
+    memset(x->small, 0, sizeof(x->small));
     return RT_OK;
 }
 
 void rt_int_clear(rt_int* x) {
     if (x == NULL) return;
 
-    free(x->digits);
-    x->digits = NULL;
+    if (x->digits != x->small) rt_mem_free(x->digits, x->cap * sizeof(rt_limb_t));
+    x->digits = x->small;
     x->sign = 0;
     x->len = 0;
-    x->cap = 0;
+    x->cap = RT_INT_INLINE_LIMBS;
 }
 
 rt_error_code_t rt_int_copy(rt_int* dst, const rt_int* src) {
     RT_CHECK_NULL(dst, "dst");
     RT_CHECK_NULL(src, "src");
 
+    if (dst == src) return RT_OK;
+
     rt_error_code_t err = rt_int_ensure_cap(dst, src->len);
-    if (err != RT_OK) return err;
+    if (RT_UNLIKELY(err != RT_OK)) return err;
 
-    memcpy(dst->digits, src->digits, src->len * sizeof(uint32_t));
+    if (src->len) memcpy(dst->digits, src->digits, src->len * sizeof(rt_limb_t));
     dst->len = src->len;
     dst->sign = src->sign;
     return RT_OK;
 }
 
+void rt_int_swap(rt_int* a, rt_int* b) {
+    if (a == b) return;
+
+    rt_int t = *a;
+    *a = *b;
+    *b = t;
+
+    /* Inline values moved with the struct; point them at their new home */
+    if (a->digits == b->small) a->digits = a->small;
+    if (b->digits == a->small) b->digits = b->small;
+}
+
 /* ==================== Set/Convert ==================== */
 
-rt_error_code_t rt_int_set_si(rt_int* x, int64_t v) {
+rt_error_code_t rt_int_set_si_general(rt_int* x, int64_t v) {
     RT_CHECK_NULL(x, "x");
 
     /* Handle zero */
@@ -107,30 +113,29 @@ rt_error_code_t rt_int_set_si(rt_int* x, int64_t v) {
         return RT_OK;
     }
 
-    /* Determine sign */
+    /* Determine sign; negating in unsigned arithmetic keeps INT64_MIN exact */
+    uint64_t uv;
     if (v < 0) {
         x->sign = -1;
-        v = -v;
+        uv = 0 - (uint64_t)v;
     } else {
         x->sign = 1;
+        uv = (uint64_t)v;
     }
 
     /* Store absolute value */
-    uint64_t uv = (uint64_t)v;
     size_t needed = 0;
-    uint64_t tmp = uv;
-    do {
+    for (uint64_t tmp = uv; tmp > 0; tmp = (uint64_t)((rt_dlimb_t)tmp >> RT_INT_LIMB_BITS)) {
         needed++;
-        tmp /= RT_INT_BASE;
-    } while (tmp > 0);
+    }
 
     rt_error_code_t err = rt_int_ensure_cap(x, needed);
-    if (err != RT_OK) return err;
+    if (RT_UNLIKELY(err != RT_OK)) return err;
 
     x->len = needed;
     for (size_t i = 0; i < needed; i++) {
-        x->digits[i] = (uint32_t)(uv % RT_INT_BASE);
-        uv /= RT_INT_BASE;
+        x->digits[i] = (rt_limb_t)uv;
+        uv = (uint64_t)((rt_dlimb_t)uv >> RT_INT_LIMB_BITS);
     }
 
     return RT_OK;
@@ -139,6 +144,7 @@ rt_error_code_t rt_int_set_si(rt_int* x, int64_t v) {
 rt_error_code_t rt_int_from_dec(rt_int* x, const char* dec) {
     RT_CHECK_NULL(x, "x");
     RT_CHECK_NULL(dec, "dec");
+    RT_PROF_SCOPE(RT_PROF_INT_FROM_DEC);
 
     /* Skip whitespace */
     while (*dec == ' ' || *dec == '\t') dec++;
@@ -175,30 +181,32 @@ rt_error_code_t rt_int_from_dec(rt_int* x, const char* dec) {
         return RT_ERROR_INVALID;
     }
 
-    /* Initialize result */
-    rt_error_code_t err = rt_int_init(x);
-    if (err != RT_OK) return err;
-
-    x->sign = sign;
-
-    /* Process digits from left to right */
-    for (const char* p = dec; *p >= '0' && *p <= '9'; p++) {
-        int digit = *p - '0';
+    rt_error_code_t err = rt_int_from_dec_abs(x, dec, num_digits);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+    if (x->len) x->sign = sign;
+    return RT_OK;
+}
 
-        /* Multiply current value by 10 and add digit */
-        uint64_t carry = (uint64_t)digit;
-        for (size_t i = 0; i < x->len || carry > 0; i++) {
-            if (i >= x->len) {
-                err = rt_int_ensure_cap(x, i + 1);
-                if (err != RT_OK) return err;
-                x->len = i + 1;
-            }
-            uint64_t prod = (uint64_t)x->digits[i] * 10 + carry;
-            x->digits[i] = (uint32_t)(prod % RT_INT_BASE);
-            carry = prod / RT_INT_BASE;
+rt_error_code_t rt_int_from_words(rt_int* x, const uint32_t* words, size_t n, int sign) {
+    RT_CHECK_NULL(x, "x");
+    RT_CHECK_NULL(words, "words");
+
+    /* Pack the words into limbs: one or two words per limb */
+    const size_t per_limb = RT_INT_LIMB_BITS / 32;
+    size_t limbs = (n + per_limb - 1) / per_limb;
+    rt_error_code_t err = rt_int_ensure_cap(x, limbs);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+
+    for (size_t i = 0; i < limbs; i++) {
+        rt_limb_t v = 0;
+        for (size_t j = 0; j < per_limb && i * per_limb + j < n; j++) {
+            v |= (rt_limb_t)words[i * per_limb + j] << (32 * j);
         }
+        x->digits[i] = v;
     }
 
+    x->len = limbs;
+    x->sign = sign < 0 ? -1 : 1;
     rt_int_normalize(x);
     return RT_OK;
 }
@@ -213,13 +221,13 @@ rt_error_code_t rt_int_to_si_checked(const rt_int* a, int64_t* out) {
     }
 
     /* Check if value fits in int64_t */
-    if (a->len > 2) {
+    if (a->len * RT_INT_LIMB_BITS > 64) {
         return RT_ERROR_OVERFLOW;
     }
 
     uint64_t val = 0;
     for (size_t i = a->len; i-- > 0;) {
-        val = val * RT_INT_BASE + a->digits[i];
+        val = (uint64_t)(((rt_dlimb_t)val << RT_INT_LIMB_BITS) | a->digits[i]);
     }
 
     /* Check overflow for positive */
@@ -238,7 +246,7 @@ rt_error_code_t rt_int_to_si_checked(const rt_int* a, int64_t* out) {
 
 /* ==================== Comparison ==================== */
 
-int rt_int_cmp(const rt_int* a, const rt_int* b) {
+int rt_int_cmp_general(const rt_int* a, const rt_int* b) {
     if (a == NULL || b == NULL) return 0;
 
     /* Handle zeros */
@@ -255,57 +263,100 @@ int rt_int_cmp(const rt_int* a, const rt_int* b) {
     }
 
     /* Same sign - compare absolute values */
+    if (a->len == 1 && b->len == 1) {
+        rt_limb_t x = a->digits[0];
+        rt_limb_t y = b->digits[0];
+        int cmp = (x > y) - (x < y);
+        return (a->sign > 0) ? cmp : -cmp;
+    }
     int cmp = rt_int_cmp_abs(a, b);
     return (a->sign > 0) ? cmp : -cmp;
 }
 
-int rt_int_is_zero(const rt_int* x) {
-    if (x == NULL) return 1;
-    return (x->sign == 0 || x->len == 0);
-}
-
 /* ==================== Arithmetic ==================== */
 
-rt_error_code_t rt_int_add(rt_int* out, const rt_int* a, const rt_int* b) {
-    RT_CHECK_NULL(out, "out");
-    RT_CHECK_NULL(a, "a");
-    RT_CHECK_NULL(b, "b");
-
-    /* Handle zeros */
-    if (rt_int_is_zero(a)) return rt_int_copy(out, b);
-    if (rt_int_is_zero(b)) return rt_int_copy(out, a);
+/* Store |v| in limbs and return a read-only view of v over them */
+static rt_int rt_int_si_view(rt_limb_t limbs[RT_INT_SI_LIMBS], int64_t v) {
+    uint64_t uv = (v < 0) ? 0 - (uint64_t)v : (uint64_t)v;
+    for (size_t i = 0; i < RT_INT_SI_LIMBS; i++) {
+        limbs[i] = (rt_limb_t)uv;
+        uv = (uint64_t)((rt_dlimb_t)uv >> RT_INT_LIMB_BITS);
+    }
 
-    /* Same sign - add absolute values */
-    if (a->sign == b->sign) {
-        size_t max_len = (a->len > b->len) ? a->len : b->len;
-        rt_error_code_t err = rt_int_ensure_cap(out, max_len + 1);
-        if (err != RT_OK) return err;
+    rt_int view = rt_limbs_view(limbs, RT_INT_SI_LIMBS);
+    if (v < 0) view.sign = -1;
+    return view;
+}
 
-        uint64_t carry = 0;
-        for (size_t i = 0; i < max_len || carry; i++) {
-            uint64_t sum = carry;
-            if (i < a->len) sum += a->digits[i];
-            if (i < b->len) sum += b->digits[i];
+int rt_int_cmp_si_general(const rt_int* a, int64_t b) {
+    if (a == NULL) return 0;
 
-            out->digits[i] = (uint32_t)(sum % RT_INT_BASE);
-            carry = sum / RT_INT_BASE;
+    /* Values of one limb were compared inline */
+    rt_limb_t limbs[RT_INT_SI_LIMBS];
+    rt_int bv = rt_int_si_view(limbs, b);
+    return rt_int_cmp(a, &bv);
+}
 
-            if (i >= out->len) out->len = i + 1;
+/*
+ * out = a + b_sign * |b|. Taking b's sign separately lets subtraction share
+ * this path without building a shallow copy of b, so out may alias a or b.
+ */
+static rt_error_code_t rt_int_add_signed(rt_int* out, const rt_int* a, const rt_int* b, int b_sign) {
+    /* Handle zeros */
+    if (rt_int_is_zero(b)) return rt_int_copy(out, a);
+    if (rt_int_is_zero(a)) {
+        rt_error_code_t err = rt_int_copy(out, b);
+        out->sign = b_sign;
+        return err;
+    }
+
+    /* Single-limb operands: the result fits the inline buffer */
+    if (RT_LIKELY(a->len == 1 && b->len == 1)) {
+        rt_limb_t x = a->digits[0];
+        rt_limb_t y = b->digits[0];
+        rt_error_code_t err = rt_int_ensure_cap(out, 2);
+        if (RT_UNLIKELY(err != RT_OK)) return err;
+
+        if (a->sign == b_sign) {
+            rt_limb_t sum = x + y;
+            out->digits[0] = sum;
+            out->digits[1] = (sum < x);
+            out->len = 1 + (sum < x);
+            out->sign = b_sign;
+        } else {
+            out->digits[0] = (x >= y) ? x - y : y - x;
+            out->len = (x != y);
+            out->sign = (x == y) ? 0 : (x > y) ? a->sign : b_sign;
         }
+        return RT_OK;
+    }
 
-        out->sign = a->sign;
-        rt_int_normalize(out);
+    /* Same sign - add absolute values */
+    if (a->sign == b_sign) {
+        const rt_int* larger = (a->len >= b->len) ? a : b;
+        const rt_int* smaller = (a->len >= b->len) ? b : a;
+        size_t n = larger->len;
+
+        rt_error_code_t err = rt_int_ensure_cap(out, n + 1);
+        if (RT_UNLIKELY(err != RT_OK)) return err;
+
+        rt_limb_t carry = rt_limbs_add(out->digits, larger->digits, n, smaller->digits, smaller->len);
+        out->digits[n] = carry;
+        out->len = n + carry;
+        out->sign = b_sign;
         return RT_OK;
     }
 
     /* Different signs - subtract smaller from larger */
     const rt_int* larger = a;
     const rt_int* smaller = b;
+    int result_sign = a->sign;
     int cmp = rt_int_cmp_abs(a, b);
 
     if (cmp < 0) {
         larger = b;
         smaller = a;
+        result_sign = b_sign;
     } else if (cmp == 0) {
         /* Equal magnitude, opposite sign = zero */
         out->sign = 0;
@@ -314,45 +365,37 @@ rt_error_code_t rt_int_add(rt_int* out, const rt_int* a, const rt_int* b) {
     }
 
     rt_error_code_t err = rt_int_ensure_cap(out, larger->len);
-    if (err != RT_OK) return err;
-
-    int64_t borrow = 0;
-    for (size_t i = 0; i < larger->len; i++) {
-        int64_t diff = (int64_t)larger->digits[i] - borrow;
-        if (i < smaller->len) diff -= smaller->digits[i];
-
-        if (diff < 0) {
-            diff += RT_INT_BASE;
-            borrow = 1;
-        } else {
-            borrow = 0;
-        }
-
-        out->digits[i] = (uint32_t)diff;
-    }
+    if (RT_UNLIKELY(err != RT_OK)) return err;
 
+    rt_limbs_sub(out->digits, larger->digits, larger->len, smaller->digits, smaller->len);
     out->len = larger->len;
-    out->sign = larger->sign;
+    out->sign = result_sign;
     rt_int_normalize(out);
     return RT_OK;
 }
 
-rt_error_code_t rt_int_sub(rt_int* out, const rt_int* a, const rt_int* b) {
+rt_error_code_t rt_int_add_general(rt_int* out, const rt_int* a, const rt_int* b) {
     RT_CHECK_NULL(out, "out");
     RT_CHECK_NULL(a, "a");
     RT_CHECK_NULL(b, "b");
 
-    /* a - b = a + (-b) */
-    rt_int b_neg = *b;
-    b_neg.sign = -b->sign;
+    return rt_int_add_signed(out, a, b, b->sign);
+}
 
-    return rt_int_add(out, a, &b_neg);
+rt_error_code_t rt_int_sub_general(rt_int* out, const rt_int* a, const rt_int* b) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+    RT_CHECK_NULL(b, "b");
+
+    /* a - b = a + (-b) */
+    return rt_int_add_signed(out, a, b, -b->sign);
 }
 
 rt_error_code_t rt_int_mul(rt_int* out, const rt_int* a, const rt_int* b) {
     RT_CHECK_NULL(out, "out");
     RT_CHECK_NULL(a, "a");
     RT_CHECK_NULL(b, "b");
+    RT_PROF_SCOPE_LIMBS(RT_PROF_INT_MUL, a->len < b->len ? a->len : b->len);
 
     /* Handle zeros */
     if (rt_int_is_zero(a) || rt_int_is_zero(b)) {
@@ -361,25 +404,58 @@ rt_error_code_t rt_int_mul(rt_int* out, const rt_int* a, const rt_int* b) {
         return RT_OK;
     }
 
+    /* Single-limb operands: the double-limb product fits the inline buffer */
+    if (RT_LIKELY(a->len == 1 && b->len == 1)) {
+        rt_dlimb_t p = (rt_dlimb_t)a->digits[0] * b->digits[0];
+        int sign = a->sign * b->sign;
+        rt_error_code_t err = rt_int_ensure_cap(out, 2);
+        if (RT_UNLIKELY(err != RT_OK)) return err;
+
+        out->digits[0] = (rt_limb_t)p;
+        out->digits[1] = (rt_limb_t)(p >> RT_INT_LIMB_BITS);
+        out->len = 1 + (out->digits[1] != 0);
+        out->sign = sign;
+        return RT_OK;
+    }
+
+    if (a == b) {
+        return rt_int_sqr(out, a);
+    }
+
+    /* One single-limb factor: a linear pass, which may run in place */
+    if (a->len == 1 || b->len == 1) {
+        const rt_int* big = (a->len == 1) ? b : a;
+        rt_limb_t m = (a->len == 1) ? a->digits[0] : b->digits[0];
+        int sign = a->sign * b->sign;
+        size_t n = big->len;
+
+        rt_error_code_t err = rt_int_ensure_cap(out, n + 1);
+        if (RT_UNLIKELY(err != RT_OK)) return err;
+
+        rt_limb_t carry = rt_limbs_mul_1(out->digits, big->digits, n, m);
+        out->digits[n] = carry;
+        out->len = n + (carry != 0);
+        out->sign = sign;
+        return RT_OK;
+    }
+
+    /* The product kernels write out while reading a and b */
+    if (out == a || out == b) {
+        rt_int t;
+        rt_int_init(&t);
+        rt_error_code_t err = rt_int_mul(&t, a, b);
+        if (err == RT_OK) rt_int_swap(out, &t);
+        rt_int_clear(&t);
+        return err;
+    }
+
     size_t result_len = a->len + b->len;
     rt_error_code_t err = rt_int_ensure_cap(out, result_len);
-    if (err != RT_OK) return err;
-
-    /* Clear result digits */
-    memset(out->digits, 0, result_len * sizeof(uint32_t));
-
-    /* Multiply */
-    for (size_t i = 0; i < a->len; i++) {
-        uint64_t carry = 0;
-        for (size_t j = 0; j < b->len || carry; j++) {
-            uint64_t prod = out->digits[i + j] + carry;
-            if (j < b->len) {
-                prod += (uint64_t)a->digits[i] * b->digits[j];
-            }
-            out->digits[i + j] = (uint32_t)(prod % RT_INT_BASE);
-            carry = prod / RT_INT_BASE;
-        }
-    }
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+
+    /* Schoolbook, Karatsuba or Toom-3 depending on operand sizes */
+    err = rt_limbs_mul(out->digits, a->digits, a->len, b->digits, b->len);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
 
     out->len = result_len;
     out->sign = a->sign * b->sign;
@@ -387,6 +463,227 @@ rt_error_code_t rt_int_mul(rt_int* out, const rt_int* a, const rt_int* b) {
     return RT_OK;
 }
 
+rt_error_code_t rt_int_sqr(rt_int* out, const rt_int* a) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+    RT_PROF_SCOPE_LIMBS(RT_PROF_INT_SQR, a->len);
+
+    if (rt_int_is_zero(a)) {
+        out->sign = 0;
+        out->len = 0;
+        return RT_OK;
+    }
+
+    if (out == a) {
+        rt_int t;
+        rt_int_init(&t);
+        rt_error_code_t err = rt_int_sqr(&t, a);
+        if (err == RT_OK) rt_int_swap(out, &t);
+        rt_int_clear(&t);
+        return err;
+    }
+
+    size_t result_len = 2 * a->len;
+    rt_error_code_t err = rt_int_ensure_cap(out, result_len);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+
+    err = rt_limbs_sqr(out->digits, a->digits, a->len);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+
+    out->len = result_len;
+    out->sign = 1;
+    rt_int_normalize(out);
+    return RT_OK;
+}
+
+rt_error_code_t rt_int_add_si(rt_int* out, const rt_int* a, int64_t b) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+
+    rt_limb_t limbs[RT_INT_SI_LIMBS];
+    rt_int bv = rt_int_si_view(limbs, b);
+    return rt_int_add_signed(out, a, &bv, bv.sign);
+}
+
+rt_error_code_t rt_int_sub_si(rt_int* out, const rt_int* a, int64_t b) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+
+    /* The view holds |b| exactly, so -INT64_MIN needs no special case */
+    rt_limb_t limbs[RT_INT_SI_LIMBS];
+    rt_int bv = rt_int_si_view(limbs, b);
+    return rt_int_add_signed(out, a, &bv, -bv.sign);
+}
+
+rt_error_code_t rt_int_mul_si(rt_int* out, const rt_int* a, int64_t b) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+
+    rt_limb_t limbs[RT_INT_SI_LIMBS];
+    rt_int bv = rt_int_si_view(limbs, b);
+    return rt_int_mul(out, a, &bv);
+}
+
+rt_error_code_t rt_int_addmul_si(rt_int* out, const rt_int* a, int64_t b) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+
+    if (b == 0 || rt_int_is_zero(a)) return RT_OK;
+
+    /* x += x * b is x * (b + 1) */
+    if (out == a && b != INT64_MAX) {
+        return rt_int_mul_si(out, a, b + 1);
+    }
+
+    rt_limb_t limbs[RT_INT_SI_LIMBS];
+    rt_int bv = rt_int_si_view(limbs, b);
+    int prod_sign = a->sign * bv.sign;
+
+    /* Same sign and a one-limb factor: accumulate straight into out */
+    if (out != a && bv.len == 1 && (out->sign == 0 || out->sign == prod_sign)) {
+        size_t an = a->len;
+        size_t n = (out->len > an ? out->len : an) + 1;
+        size_t old_len = out->len;
+
+        rt_error_code_t err = rt_int_ensure_cap(out, n);
+        if (RT_UNLIKELY(err != RT_OK)) return err;
+        memset(out->digits + old_len, 0, (n - old_len) * sizeof(rt_limb_t));
+
+        rt_limb_t carry = rt_limbs_addmul_1(out->digits, a->digits, an, limbs[0]);
+        rt_limbs_add(out->digits + an, out->digits + an, n - an, &carry, 1);
+        out->len = n;
+        out->sign = prod_sign;
+        rt_int_normalize(out);
+        return RT_OK;
+    }
+
+    /* Opposite signs (or out aliasing a): form the product separately */
+    rt_int t;
+    rt_int_init(&t);
+    rt_error_code_t err = rt_int_mul(&t, a, &bv);
+    if (err == RT_OK) err = rt_int_add(out, out, &t);
+    rt_int_clear(&t);
+    return err;
+}
+
+rt_error_code_t rt_int_shl(rt_int* out, const rt_int* a, size_t bits) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+
+    if (a->len == 0) {
+        out->sign = 0;
+        out->len = 0;
+        return RT_OK;
+    }
+
+    size_t n = a->len;
+    size_t limbs = bits / RT_INT_LIMB_BITS;
+    unsigned s = (unsigned)(bits % RT_INT_LIMB_BITS);
+    int sign = a->sign;
+
+    /* Growing out may move a's limbs when they alias */
+    const rt_limb_t* src = a->digits;
+    rt_error_code_t err = rt_int_ensure_cap(out, n + limbs + 1);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+    if (out == a) src = out->digits;
+
+    memmove(out->digits + limbs, src, n * sizeof(rt_limb_t));
+    memset(out->digits, 0, limbs * sizeof(rt_limb_t));
+    rt_limb_t top = 0;
+    if (s) top = rt_limbs_lshift(out->digits + limbs, out->digits + limbs, n, s);
+    out->digits[n + limbs] = top;
+
+    out->len = n + limbs + 1;
+    out->sign = sign;
+    rt_int_normalize(out);
+    return RT_OK;
+}
+
+rt_error_code_t rt_int_shr(rt_int* out, const rt_int* a, size_t bits) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+
+    size_t limbs = bits / RT_INT_LIMB_BITS;
+    unsigned s = (unsigned)(bits % RT_INT_LIMB_BITS);
+    int sign = a->sign;
+
+    /* Negative values round down whenever a set bit is shifted out */
+    int inexact = 0;
+    if (sign < 0) {
+        for (size_t i = 0; i < limbs && i < a->len && !inexact; i++) {
+            inexact = (a->digits[i] != 0);
+        }
+        if (s && limbs < a->len && (a->digits[limbs] & (((rt_limb_t)1 << s) - 1))) {
+            inexact = 1;
+        }
+    }
+
+    if (limbs >= a->len) {
+        return rt_int_set_si(out, sign < 0 ? -1 : 0);
+    }
+
+    size_t n = a->len - limbs;
+    const rt_limb_t* src = a->digits;
+    rt_error_code_t err = rt_int_ensure_cap(out, n);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+    if (out == a) src = out->digits;
+
+    memmove(out->digits, src + limbs, n * sizeof(rt_limb_t));
+    if (s) rt_limbs_rshift(out->digits, out->digits, n, s);
+
+    out->len = n;
+    out->sign = sign;
+    rt_int_normalize(out);
+    if (inexact) return rt_int_sub_si(out, out, 1);
+    return RT_OK;
+}
+
+rt_error_code_t rt_int_mod_pow2(rt_int* out, const rt_int* a, size_t bits) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(a, "a");
+
+    size_t limbs = (bits + RT_INT_LIMB_BITS - 1) / RT_INT_LIMB_BITS;
+    unsigned s = (unsigned)(bits % RT_INT_LIMB_BITS);
+    int sign = a->sign;
+
+    if (sign == 0 || bits == 0) {
+        out->sign = 0;
+        out->len = 0;
+        return RT_OK;
+    }
+
+    /* Low bits of |a|; a negative value then fills the whole modulus */
+    size_t n = a->len < limbs ? a->len : limbs;
+    size_t len = sign < 0 ? limbs : n;
+    const rt_limb_t* src = a->digits;
+    rt_error_code_t err = rt_int_ensure_cap(out, len);
+    if (RT_UNLIKELY(err != RT_OK)) return err;
+    if (out == a) src = out->digits;
+
+    memmove(out->digits, src, n * sizeof(rt_limb_t));
+    if (sign < 0) {
+        /* 2^bits - (|a| mod 2^bits) is the two's complement of the low bits */
+        memset(out->digits + n, 0, (limbs - n) * sizeof(rt_limb_t));
+        rt_limb_t carry = 1;
+        for (size_t i = 0; i < limbs; i++) {
+            rt_limb_t v = ~out->digits[i] + carry;
+            carry = (carry && v == 0);
+            out->digits[i] = v;
+        }
+    }
+    if (s && len == limbs) out->digits[limbs - 1] &= ((rt_limb_t)1 << s) - 1;
+
+    out->len = len;
+    out->sign = 1;
+    rt_int_normalize(out);
+    return RT_OK;
+}
+
+size_t rt_int_bit_length(const rt_int* x) {
+    if (x->len == 0) return 0;
+    return x->len * RT_INT_LIMB_BITS - rt_limb_clz(x->digits[x->len - 1]);
+}
+
 rt_error_code_t rt_int_floordiv(rt_int* out, const rt_int* a, const rt_int* b) {
     rt_int dummy;
     rt_int_init(&dummy);
@@ -406,6 +703,7 @@ rt_error_code_t rt_int_mod(rt_int* out, const rt_int* a, const rt_int* b) {
 rt_error_code_t rt_int_divmod(rt_int* q, rt_int* r, const rt_int* a, const rt_int* b) {
     RT_CHECK_NULL(a, "a");
     RT_CHECK_NULL(b, "b");
+    RT_PROF_SCOPE_LIMBS(RT_PROF_INT_DIVMOD, b->len);
 
     if (rt_int_is_zero(b)) {
         RT_SET_ERROR(RT_ERROR_DIVZERO, "Division by zero");
@@ -425,109 +723,174 @@ rt_error_code_t rt_int_divmod(rt_int* q, rt_int* r, const rt_int* a, const rt_in
         return RT_OK;
     }
 
-    /* Simple case: single digit divisor */
-    if (b->len == 1 && b->digits[0] < RT_INT_BASE) {
-        if (q) {
-            rt_error_code_t err = rt_int_ensure_cap(q, a->len);
-            if (err != RT_OK) return err;
-        }
+    int a_sign = a->sign;
+    int b_sign = b->sign;
+    rt_int qt, rt;
+    rt_int_init(&qt);
+    rt_int_init(&rt);
 
-        uint64_t divisor = b->digits[0];
-        uint64_t rem = 0;
-
-        for (size_t i = a->len; i-- > 0;) {
-            uint64_t dividend = rem * RT_INT_BASE + a->digits[i];
-            if (q) {
-                q->digits[i] = (uint32_t)(dividend / divisor);
-            }
-            rem = dividend % divisor;
-        }
+    /* Divide magnitudes into temporaries so q and r may alias a or b */
+    rt_error_code_t err = rt_int_divrem_abs(q ? &qt : NULL, &rt, a, b);
+    if (err != RT_OK) goto cleanup;
 
+    /*
+     * Python floor semantics: when the signs differ and the division is
+     * inexact, round the quotient toward -inf (|q| + 1) and take the
+     * remainder from the other end (|b| - |r|) so it has b's sign.
+     */
+    if (a_sign != b_sign && !rt_int_is_zero(&rt)) {
         if (q) {
-            q->len = a->len;
-            q->sign = a->sign * b->sign;
-            rt_int_normalize(q);
+            rt_int one;
+            rt_int_init(&one);
+            rt_int_set_si(&one, 1);
+            err = rt_int_add(&qt, &qt, &one);
+            rt_int_clear(&one);
+            if (err != RT_OK) goto cleanup;
         }
-
         if (r) {
-            rt_error_code_t err = rt_int_set_si(r, (int64_t)rem);
-            if (err != RT_OK) return err;
-            r->sign = a->sign;
-            if (rem == 0) r->sign = 0;
-        }
-
-        /* Adjust for Python-style floor division */
-        /* If there's a remainder and signs differ, adjust q and r */
-        if (rem != 0 && a->sign != b->sign) {
-            if (q) {
-                /* q = q - 1 */
-                rt_int one;
-                rt_int_init(&one);
-                rt_int_set_si(&one, 1);
-                rt_int_sub(q, q, &one);
-                rt_int_clear(&one);
-            }
-            if (r) {
-                /* r = r + b (to give r the same sign as b) */
-                rt_int_add(r, r, b);
-            }
+            rt_int b_abs = rt_limbs_view(b->digits, b->len);
+            err = rt_int_sub(&rt, &b_abs, &rt);
+            if (err != RT_OK) goto cleanup;
         }
+    }
 
-        return RT_OK;
+    if (q) {
+        err = rt_int_copy(q, &qt);
+        if (err != RT_OK) goto cleanup;
+        if (q->len) q->sign = a_sign * b_sign;
+    }
+    if (r) {
+        err = rt_int_copy(r, &rt);
+        if (err != RT_OK) goto cleanup;
+        if (r->len) r->sign = b_sign;
     }
 
-    /* General case - use long division algorithm */
-    /* For now, return error for complex division */
-    RT_SET_ERROR(RT_ERROR_INVALID, "Complex division not yet implemented");
-    return RT_ERROR_INVALID;
+cleanup:
+    rt_int_clear(&qt);
+    rt_int_clear(&rt);
+    return err;
 }
 
 /* ==================== I/O ==================== */
 
-void rt_print_int(const rt_int* a) {
-    if (a == NULL) {
-        printf("null\n");
-        return;
-    }
+size_t rt_int_to_buffer_size(const rt_int* a) {
+    /* Sign, digits and terminator */
+    return (a->sign < 0) + rt_int_dec_digits_bound(a) + 1;
+}
+
+/*
+ * Write a into buf, which holds rt_int_to_buffer_size(a) bytes, with a
+ * terminator; *out_len receives the length without it.
+ */
+static rt_error_code_t rt_int_format(char* buf, const rt_int* a, size_t* out_len) {
+    char* digits = buf;
+    if (a->sign < 0) *digits++ = '-';
 
+    size_t len = 1;
     if (a->sign == 0 || a->len == 0) {
-        printf("0\n");
-        return;
+        digits[0] = '0';
+    } else {
+        rt_error_code_t err = rt_int_to_dec_abs(digits, a, &len);
+        if (RT_UNLIKELY(err != RT_OK)) return err;
     }
+    digits[len] = '\0';
+    *out_len = (size_t)(digits - buf) + len;
+    return RT_OK;
+}
 
-    if (a->sign < 0) {
-        printf("-");
+size_t rt_int_to_buffer(char* buf, size_t size, const rt_int* a) {
+    if (buf == NULL || a == NULL) {
+        RT_SET_ERROR(RT_ERROR_INVALID, "NULL pointer passed to rt_int_to_buffer");
+        return 0;
     }
 
-    /* Print most significant digit without leading zeros */
-    printf("%u", a->digits[a->len - 1]);
-
-    /* Print remaining digits with leading zeros */
-    for (size_t i = a->len - 1; i-- > 0;) {
-        printf("%09u", a->digits[i]);
+    size_t len = 0;
+    size_t need = rt_int_to_buffer_size(a);
+    if (size >= need) {
+        return rt_int_format(buf, a, &len) == RT_OK ? len : 0;
     }
 
-    printf("\n");
+    /* The bound may exceed the exact length by one: format aside and copy */
+    char small[128];
+    char* tmp = (need <= sizeof(small)) ? small : (char*)rt_mem_alloc(need);
+    if (tmp == NULL) {
+        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate decimal buffer");
+        return 0;
+    }
+    if (rt_int_format(tmp, a, &len) == RT_OK && len < size) {
+        memcpy(buf, tmp, len + 1);
+    } else {
+        if (len >= size) RT_SET_ERROR(RT_ERROR_OVERFLOW, "Buffer too small for decimal conversion");
+        len = 0;
+    }
+    if (tmp != small) rt_mem_free(tmp, need);
+    return len;
 }
 
-rt_error_code_t rt_int_fprint(FILE* fp, const rt_int* a) {
-    RT_CHECK_NULL(fp, "fp");
-    RT_CHECK_NULL(a, "a");
+/* Largest decimal form formatted in place in the stdout buffer */
+#define RT_INT_OUT_INPLACE 1024
 
-    if (a->sign == 0 || a->len == 0) {
-        fprintf(fp, "0");
-        return RT_OK;
+/*
+ * Format a BigInt followed by end, if non-zero, and emit it in one write:
+ * to stdout through the output buffer, formatting in place when short, and
+ * to other streams from a buffer (on the stack for typical sizes).
+ */
+static rt_error_code_t rt_int_write(FILE* fp, const rt_int* a, char end) {
+    size_t cap = rt_int_to_buffer_size(a) + 1;
+    size_t len = 0;
+    rt_error_code_t err;
+
+    if (fp == stdout && cap <= RT_INT_OUT_INPLACE) {
+        char* out = rt_out_reserve(cap);
+        err = rt_int_format(out, a, &len);
+        if (err == RT_OK && end) out[len++] = end;
+        rt_error_code_t written = rt_out_commit(out + (err == RT_OK ? len : 0));
+        return (err == RT_OK) ? written : err;
+    }
+
+    char small[128];
+    char* buf = (cap <= sizeof(small)) ? small : (char*)rt_mem_alloc(cap);
+    RT_CHECK_ALLOC(buf, "decimal buffer");
+
+    err = rt_int_format(buf, a, &len);
+    if (err == RT_OK) {
+        if (end) buf[len++] = end;
+        if (fp == stdout) {
+            err = rt_out_write(buf, len);
+        } else {
+            fwrite(buf, 1, len, fp);
+        }
     }
 
-    if (a->sign < 0) {
-        fprintf(fp, "-");
+    if (buf != small) rt_mem_free(buf, cap);
+    return err;
+}
+
+void rt_print_int(const rt_int* a) {
+    if (a == NULL) {
+        rt_out_write("null\n", 5);
+        return;
     }
 
-    fprintf(fp, "%u", a->digits[a->len - 1]);
+    rt_int_write(stdout, a, '\n');
+}
 
-    for (size_t i = a->len - 1; i-- > 0;) {
-        fprintf(fp, "%09u", a->digits[i]);
-    }
+void rt_print_si(int64_t v) {
+    /* Same digits and single write as rt_print_int(), without a BigInt */
+    char buf[24];
+    char* end = buf + sizeof(buf);
+    char* p = rt_fmt_si(end - 1, v);
+    end[-1] = '\n';
+
+    size_t len = (size_t)(end - p);
+    char* out = rt_out_reserve(len);
+    memcpy(out, p, len);
+    rt_out_commit(out + len);
+}
 
-    return RT_OK;
+rt_error_code_t rt_int_fprint(FILE* fp, const rt_int* a) {
+    RT_CHECK_NULL(fp, "fp");
+    RT_CHECK_NULL(a, "a");
+
+    return rt_int_write(fp, a, '\0');
 }
@@ -8,6 +8,7 @@
 
 #include "rt_config.h"
 #include "rt_error.h"
+#include "rt_profile.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,12 +19,33 @@ extern "C" {
 #include <limits.h>
 #include <stdio.h>
 
-/* BigInt structure using base 10^9 representation */
+/* One binary BigInt digit (limb) of RT_INT_LIMB_BITS bits */
+#if RT_INT_LIMB_BITS == 64
+typedef uint64_t rt_limb_t;
+#else
+typedef uint32_t rt_limb_t;
+#endif
+
+/* Limbs stored inside the struct: 128 bits, enough for any 64x64-bit product */
+#define RT_INT_INLINE_LIMBS (128 / RT_INT_LIMB_BITS)
+
+/* Limbs needed for the magnitude of an int64_t */
+#define RT_INT_SI_LIMBS (64 / RT_INT_LIMB_BITS)
+
+/*
+ * BigInt structure using base 2^RT_INT_LIMB_BITS representation.
+ *
+ * Small values live in the inline buffer with digits pointing at it, so
+ * they never touch the heap; digits moves to a heap buffer only when a
+ * value outgrows it. Because digits may point into the struct itself, an
+ * rt_int must not be copied by value - use rt_int_copy instead.
+ */
 typedef struct {
-    int sign;          /* -1, 0, +1 (0 indicates zero value) */
-    size_t len;        /* Number of used digits */
-    size_t cap;        /* Allocated capacity */
-    uint32_t* digits;  /* Little-endian base 1e9 limbs */
+    int sign;           /* -1, 0, +1 (0 indicates zero value) */
+    size_t len;         /* Number of used digits */
+    size_t cap;         /* Allocated capacity */
+    rt_limb_t* digits;  /* Little-endian binary limbs (small or heap) */
+    rt_limb_t small[RT_INT_INLINE_LIMBS];  /* Inline storage for small values */
 } rt_int;
 
 /* ==================== Lifecycle ==================== */
@@ -52,8 +74,27 @@ void rt_int_clear(rt_int* x);
  */
 rt_error_code_t rt_int_copy(rt_int* dst, const rt_int* src) RT_NONNULL;
 
+/**
+ * Exchange the values of two BigInts without copying heap limbs.
+ *
+ * @param a First BigInt
+ * @param b Second BigInt
+ */
+void rt_int_swap(rt_int* a, rt_int* b) RT_NONNULL;
+
 /* ==================== Set/Convert ==================== */
 
+/*
+ * The hottest operations on small values - setting from an int64_t,
+ * comparisons, the zero test and addition - are inline in this header:
+ * operands of one or two limbs are handled here and anything else calls
+ * the *_general routine in rt_bigint.c, which also reports a NULL
+ * argument. Call the inline functions, not the general ones.
+ */
+
+/* General case of rt_int_set_si() */
+rt_error_code_t rt_int_set_si_general(rt_int* x, int64_t v);
+
 /**
  * Set BigInt from a signed 64-bit integer.
  *
@@ -61,7 +102,22 @@ rt_error_code_t rt_int_copy(rt_int* dst, const rt_int* src) RT_NONNULL;
  * @param v Value to set
  * @return RT_OK on success, error code on failure
  */
-rt_error_code_t rt_int_set_si(rt_int* x, int64_t v) RT_NONNULL;
+static inline rt_error_code_t rt_int_set_si(rt_int* x, int64_t v) {
+    if (RT_LIKELY(x != NULL && x->cap >= RT_INT_SI_LIMBS)) {
+        /* Negating in unsigned arithmetic keeps INT64_MIN exact */
+        uint64_t uv = (v < 0) ? 0 - (uint64_t)v : (uint64_t)v;
+        x->sign = (v > 0) - (v < 0);
+        x->digits[0] = (rt_limb_t)uv;
+#if RT_INT_SI_LIMBS == 1
+        x->len = (uv != 0);
+#else
+        x->digits[1] = (rt_limb_t)(uv >> 32);
+        x->len = (uv >> 32) ? 2 : (uv != 0);
+#endif
+        return RT_OK;
+    }
+    return rt_int_set_si_general(x, v);
+}
 
 /**
  * Parse BigInt from decimal string.
@@ -72,6 +128,18 @@ rt_error_code_t rt_int_set_si(rt_int* x, int64_t v) RT_NONNULL;
  */
 rt_error_code_t rt_int_from_dec(rt_int* x, const char* dec) RT_NONNULL;
 
+/**
+ * Set BigInt from its magnitude as little-endian 32-bit words, independent
+ * of the limb size. Used for constants the compiler decoded ahead of time.
+ *
+ * @param x BigInt to set
+ * @param words Magnitude, least significant word first
+ * @param n Number of words
+ * @param sign -1 for a negative value, otherwise positive
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_from_words(rt_int* x, const uint32_t* words, size_t n, int sign) RT_NONNULL;
+
 /**
  * Convert BigInt to signed 64-bit if it fits.
  *
@@ -83,6 +151,32 @@ rt_error_code_t rt_int_to_si_checked(const rt_int* a, int64_t* out) RT_NONNULL;
 
 /* ==================== Comparison ==================== */
 
+/* General cases of rt_int_cmp_si() and rt_int_cmp() */
+int rt_int_cmp_si_general(const rt_int* a, int64_t b);
+int rt_int_cmp_general(const rt_int* a, const rt_int* b);
+
+/**
+ * Compare a BigInt with a signed 64-bit integer.
+ *
+ * @param a BigInt
+ * @param b Integer
+ * @return -1 if a < b, 0 if a == b, +1 if a > b
+ */
+static inline int rt_int_cmp_si(const rt_int* a, int64_t b) {
+#if RT_INT_SI_LIMBS == 1
+    if (RT_LIKELY(a != NULL && a->len <= 1)) {
+        int64_t av = 0;
+        if (a->len == 1 && a->sign != 0) {
+            rt_limb_t m = a->digits[0];
+            if (m > (rt_limb_t)INT64_MAX + (a->sign < 0)) return a->sign;
+            av = (a->sign < 0) ? (int64_t)(0 - (uint64_t)m) : (int64_t)m;
+        }
+        return (av > b) - (av < b);
+    }
+#endif
+    return rt_int_cmp_si_general(a, b);
+}
+
 /**
  * Compare two BigInts.
  *
@@ -90,7 +184,26 @@ rt_error_code_t rt_int_to_si_checked(const rt_int* a, int64_t* out) RT_NONNULL;
  * @param b Second BigInt
  * @return -1 if a < b, 0 if a == b, +1 if a > b
  */
-int rt_int_cmp(const rt_int* a, const rt_int* b) RT_NONNULL;
+static inline int rt_int_cmp(const rt_int* a, const rt_int* b) {
+    if (RT_LIKELY(a != NULL && b != NULL && a->len <= 2 && b->len <= 2)) {
+        int sa = a->len ? a->sign : 0;
+        int sb = b->len ? b->sign : 0;
+        if (sa != sb) return (sa > sb) - (sa < sb);
+        if (sa == 0) return 0;
+
+        /* Same sign: the longer magnitude is larger, else compare top down */
+        int cmp;
+        if (a->len != b->len) {
+            cmp = (a->len > b->len) ? 1 : -1;
+        } else {
+            size_t i = a->len - 1;
+            if (i == 1 && a->digits[1] == b->digits[1]) i = 0;
+            cmp = (a->digits[i] > b->digits[i]) - (a->digits[i] < b->digits[i]);
+        }
+        return (sa > 0) ? cmp : -cmp;
+    }
+    return rt_int_cmp_general(a, b);
+}
 
 /**
  * Check if BigInt is zero.
@@ -98,10 +211,48 @@ int rt_int_cmp(const rt_int* a, const rt_int* b) RT_NONNULL;
  * @param x BigInt to check
  * @return 1 if zero, 0 otherwise
  */
-int rt_int_is_zero(const rt_int* x) RT_NONNULL;
+static inline int rt_int_is_zero(const rt_int* x) {
+    return x == NULL || x->sign == 0 || x->len == 0;
+}
 
 /* ==================== Arithmetic ==================== */
 
+/*
+ * All arithmetic functions accept an out that aliases any input, so
+ * rt_int_add(&x, &x, &y) and rt_int_mul(&x, &x, &x) update x in place.
+ */
+
+/* General cases of rt_int_add() and rt_int_sub() */
+rt_error_code_t rt_int_add_general(rt_int* out, const rt_int* a, const rt_int* b);
+rt_error_code_t rt_int_sub_general(rt_int* out, const rt_int* a, const rt_int* b);
+
+/*
+ * out = a + b_sign * |b| for non-zero single-limb operands, when out has
+ * room for the two-limb result. Returns 0, leaving out untouched, for
+ * any other operands.
+ */
+static inline int rt_int_add_small(rt_int* out, const rt_int* a, const rt_int* b, int b_sign) {
+    if (!(out != NULL && a != NULL && b != NULL && out->cap >= 2 &&
+          a->len == 1 && b->len == 1 && a->sign != 0 && b_sign != 0)) {
+        return 0;
+    }
+    rt_limb_t x = a->digits[0];
+    rt_limb_t y = b->digits[0];
+    int a_sign = a->sign;
+    if (a_sign == b_sign) {
+        rt_limb_t sum = x + y;
+        out->digits[0] = sum;
+        out->digits[1] = (sum < x);
+        out->len = 1 + (sum < x);
+        out->sign = b_sign;
+    } else {
+        out->digits[0] = (x >= y) ? x - y : y - x;
+        out->len = (x != y);
+        out->sign = (x == y) ? 0 : (x > y) ? a_sign : b_sign;
+    }
+    return 1;
+}
+
 /**
  * Add two BigInts: out = a + b
  *
@@ -110,7 +261,11 @@ int rt_int_is_zero(const rt_int* x) RT_NONNULL;
  * @param b Second operand
  * @return RT_OK on success, error code on failure
  */
-rt_error_code_t rt_int_add(rt_int* out, const rt_int* a, const rt_int* b) RT_NONNULL;
+static inline rt_error_code_t rt_int_add(rt_int* out, const rt_int* a, const rt_int* b) {
+    RT_PROF_SCOPE(RT_PROF_INT_ADD);
+    if (RT_LIKELY(b != NULL && rt_int_add_small(out, a, b, b->sign))) return RT_OK;
+    return rt_int_add_general(out, a, b);
+}
 
 /**
  * Subtract two BigInts: out = a - b
@@ -120,11 +275,18 @@ rt_error_code_t rt_int_add(rt_int* out, const rt_int* a, const rt_int* b) RT_NON
  * @param b Second operand
  * @return RT_OK on success, error code on failure
  */
-rt_error_code_t rt_int_sub(rt_int* out, const rt_int* a, const rt_int* b) RT_NONNULL;
+static inline rt_error_code_t rt_int_sub(rt_int* out, const rt_int* a, const rt_int* b) {
+    RT_PROF_SCOPE(RT_PROF_INT_SUB);
+    if (RT_LIKELY(b != NULL && rt_int_add_small(out, a, b, -b->sign))) return RT_OK;
+    return rt_int_sub_general(out, a, b);
+}
 
 /**
  * Multiply two BigInts: out = a * b
  *
+ * Selects schoolbook, Karatsuba or Toom-3 multiplication by operand length
+ * (see the RT_INT_*_THRESHOLD settings in rt_config.h).
+ *
  * @param out Result BigInt (must be initialized)
  * @param a First operand
  * @param b Second operand
@@ -132,6 +294,106 @@ rt_error_code_t rt_int_sub(rt_int* out, const rt_int* a, const rt_int* b) RT_NON
  */
 rt_error_code_t rt_int_mul(rt_int* out, const rt_int* a, const rt_int* b) RT_NONNULL;
 
+/**
+ * Square a BigInt: out = a * a
+ *
+ * Uses dedicated squaring kernels that are faster than a general multiply.
+ * rt_int_mul(out, a, a) is routed here automatically.
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param a Operand
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_sqr(rt_int* out, const rt_int* a) RT_NONNULL;
+
+/**
+ * Add a signed 64-bit integer: out = a + b
+ *
+ * Only the carry chain is walked when out aliases a, so x += k is
+ * amortized O(1).
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param a BigInt operand
+ * @param b Integer operand
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_add_si(rt_int* out, const rt_int* a, int64_t b) RT_NONNULL;
+
+/**
+ * Subtract a signed 64-bit integer: out = a - b
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param a BigInt operand
+ * @param b Integer operand
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_sub_si(rt_int* out, const rt_int* a, int64_t b) RT_NONNULL;
+
+/**
+ * Multiply by a signed 64-bit integer: out = a * b
+ *
+ * A single linear pass over a when |b| fits in one limb.
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param a BigInt operand
+ * @param b Integer operand
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_mul_si(rt_int* out, const rt_int* a, int64_t b) RT_NONNULL;
+
+/**
+ * Multiply and accumulate: out = out + a * b
+ *
+ * The product is added limb by limb without a temporary when it has the
+ * sign of out (or out is zero).
+ *
+ * @param out Accumulator BigInt (must be initialized)
+ * @param a BigInt operand
+ * @param b Integer operand
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_addmul_si(rt_int* out, const rt_int* a, int64_t b) RT_NONNULL;
+
+/**
+ * Shift left by a number of bits: out = a * 2^bits
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param a BigInt operand
+ * @param bits Shift amount
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_shl(rt_int* out, const rt_int* a, size_t bits) RT_NONNULL;
+
+/**
+ * Shift right by a number of bits, rounding toward negative infinity:
+ * out = a >> bits (as in Python)
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param a BigInt operand
+ * @param bits Shift amount
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_shr(rt_int* out, const rt_int* a, size_t bits) RT_NONNULL;
+
+/**
+ * Remainder modulo a power of two, with the sign of the divisor:
+ * out = a % 2^bits (as in Python, so 0 <= out < 2^bits)
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param a BigInt operand
+ * @param bits Exponent of the modulus
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_int_mod_pow2(rt_int* out, const rt_int* a, size_t bits) RT_NONNULL;
+
+/**
+ * Get the number of bits of |x| (0 for zero), as int.bit_length().
+ *
+ * @param x BigInt to measure
+ * @return Bit length of the magnitude
+ */
+size_t rt_int_bit_length(const rt_int* x) RT_NONNULL;
+
 /**
  * Divide two BigInts (floor division): out = a // b
  *
@@ -155,16 +417,123 @@ rt_error_code_t rt_int_mod(rt_int* out, const rt_int* a, const rt_int* b) RT_NON
 /**
  * Combined division and modulo: a = q * b + r
  *
+ * Follows Python semantics: q is rounded toward negative infinity and r
+ * takes the sign of b. Uses Knuth's Algorithm D, switching to recursive
+ * Burnikel-Ziegler division for long operands. q and r may alias a or b.
+ *
  * @param q Quotient (can be NULL if not needed)
  * @param r Remainder (can be NULL if not needed)
  * @param a Dividend
  * @param b Divisor (must not be zero)
  * @return RT_OK on success, RT_ERROR_DIVZERO if b is zero
  */
-rt_error_code_t rt_int_divmod(rt_int* q, rt_int* r, const rt_int* a, const rt_int* b) RT_NONNULL;
+rt_error_code_t rt_int_divmod(rt_int* q, rt_int* r, const rt_int* a, const rt_int* b);
+
+/* ==================== Checked Native Arithmetic ==================== */
+
+/*
+ * int64_t arithmetic that reports overflow instead of wrapping. Each
+ * stores the wrapped result in *r and returns non-zero on overflow.
+ */
+static inline int rt_si_add_overflow(int64_t a, int64_t b, int64_t* r) {
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    return __builtin_add_overflow(a, b, r);
+#else
+    *r = (int64_t)((uint64_t)a + (uint64_t)b);
+    return (b > 0 && a > INT64_MAX - b) || (b < 0 && a < INT64_MIN - b);
+#endif
+}
+
+static inline int rt_si_sub_overflow(int64_t a, int64_t b, int64_t* r) {
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    return __builtin_sub_overflow(a, b, r);
+#else
+    *r = (int64_t)((uint64_t)a - (uint64_t)b);
+    return (b < 0 && a > INT64_MAX + b) || (b > 0 && a < INT64_MIN + b);
+#endif
+}
+
+static inline int rt_si_mul_overflow(int64_t a, int64_t b, int64_t* r) {
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    return __builtin_mul_overflow(a, b, r);
+#else
+    *r = (int64_t)((uint64_t)a * (uint64_t)b);
+    if (a == 0 || b == 0) return 0;
+    if ((a == -1 && b == INT64_MIN) || (b == -1 && a == INT64_MIN)) return 1;
+    return *r / b != a;
+#endif
+}
+
+/**
+ * Set x = a + b. The sum is computed natively and only a result that
+ * overflows int64_t takes the BigInt path.
+ *
+ * @param x BigInt to set
+ * @param a First operand
+ * @param b Second operand
+ * @return RT_OK on success, error code on failure
+ */
+static inline rt_error_code_t rt_int_set_si_add(rt_int* x, int64_t a, int64_t b) {
+    int64_t r;
+    if (RT_LIKELY(!rt_si_add_overflow(a, b, &r))) return rt_int_set_si(x, r);
+    rt_error_code_t err = rt_int_set_si(x, a);
+    return err != RT_OK ? err : rt_int_add_si(x, x, b);
+}
+
+/**
+ * Set x = a - b, promoting to BigInt only on int64_t overflow.
+ *
+ * @param x BigInt to set
+ * @param a First operand
+ * @param b Second operand
+ * @return RT_OK on success, error code on failure
+ */
+static inline rt_error_code_t rt_int_set_si_sub(rt_int* x, int64_t a, int64_t b) {
+    int64_t r;
+    if (RT_LIKELY(!rt_si_sub_overflow(a, b, &r))) return rt_int_set_si(x, r);
+    rt_error_code_t err = rt_int_set_si(x, a);
+    return err != RT_OK ? err : rt_int_sub_si(x, x, b);
+}
+
+/**
+ * Set x = a * b, promoting to BigInt only on int64_t overflow.
+ *
+ * @param x BigInt to set
+ * @param a First operand
+ * @param b Second operand
+ * @return RT_OK on success, error code on failure
+ */
+static inline rt_error_code_t rt_int_set_si_mul(rt_int* x, int64_t a, int64_t b) {
+    int64_t r;
+    if (RT_LIKELY(!rt_si_mul_overflow(a, b, &r))) return rt_int_set_si(x, r);
+    rt_error_code_t err = rt_int_set_si(x, a);
+    return err != RT_OK ? err : rt_int_mul_si(x, x, b);
+}
 
 /* ==================== I/O ==================== */
 
+/**
+ * Get a buffer size sufficient for rt_int_to_buffer(): sign, decimal digits
+ * and terminator. Computed from the bit length, so it may exceed the exact
+ * requirement by one byte.
+ *
+ * @param a BigInt to format
+ * @return Buffer size in bytes
+ */
+size_t rt_int_to_buffer_size(const rt_int* a) RT_NONNULL;
+
+/**
+ * Write BigInt in decimal into a caller-provided buffer, NUL-terminated.
+ * Does not allocate when size >= rt_int_to_buffer_size(a).
+ *
+ * @param buf Destination buffer
+ * @param size Size of buf in bytes
+ * @param a BigInt to format
+ * @return Number of characters written (excluding the terminator),
+ *         or 0 on failure (e.g. buf too small)
+ */
+size_t rt_int_to_buffer(char* buf, size_t size, const rt_int* a);
+
 /**
  * Print BigInt to stdout with newline.
  *
@@ -172,6 +541,14 @@ rt_error_code_t rt_int_divmod(rt_int* q, rt_int* r, const rt_int* a, const rt_in
  */
 void rt_print_int(const rt_int* a) RT_NONNULL;
 
+/**
+ * Print a signed 64-bit integer to stdout with newline, as rt_print_int()
+ * prints the equal BigInt.
+ *
+ * @param v Value to print
+ */
+void rt_print_si(int64_t v);
+
 /**
  * Print BigInt to file.
  *
@@ -0,0 +1,223 @@
+/*
+ * BigInt radix conversion for pcc.
+ *
+ * Limbs are binary, so decimal text is converted on input and output.
+ * Short numbers are converted a limb-sized chunk of digits at a time
+ * (multiplying or dividing by RT_INT_DEC_BASE); long ones are split
+ * recursively by the powers 10^(RT_INT_DEC_DIGITS * 2^k), which makes both
+ * directions O(M(n) log n) through the fast multiplier and divider. The
+ * crossover is RT_INT_DEC_DC_THRESHOLD in rt_config.h.
+ */
+
+#include "rt_bigint_internal.h"
+#include "rt_io.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* The base case must cover everything below 10^(2 * RT_INT_DEC_DIGITS) */
+#if RT_INT_DEC_DC_THRESHOLD < 4
+#error "RT_INT_DEC_DC_THRESHOLD must be at least 4 limbs"
+#endif
+
+/* Number of digits written by a padded conversion at recursion level k */
+#define RT_DEC_LEVEL_DIGITS(k) ((size_t)(2 * RT_INT_DEC_DIGITS) << (k))
+
+size_t rt_int_dec_digits_bound(const rt_int* a) {
+    if (a->len == 0) return 1;
+    size_t bits = a->len * RT_INT_LIMB_BITS - rt_limb_clz(a->digits[a->len - 1]);
+    /* log10(2) < 0.30103, split to avoid overflow on huge values */
+    return bits / 100000 * 30103 + (bits % 100000) * 30103 / 100000 + 2;
+}
+
+/*
+ * Schoolbook conversion of |x| (at most RT_INT_DEC_DC_THRESHOLD limbs).
+ * With pad set, writes exactly width digits with leading zeros; otherwise
+ * writes the significant digits only. Returns the number of digits written.
+ */
+static size_t rt_dec_basecase(char* out, const rt_int* x, size_t width, int pad) {
+    rt_limb_t t[RT_INT_DEC_DC_THRESHOLD];
+    size_t n = x->len;
+    if (n) memcpy(t, x->digits, n * sizeof(rt_limb_t));
+
+    if (!pad) width = rt_int_dec_digits_bound(x);
+
+    size_t pos = width;
+    while (pos > 0) {
+        rt_limb_t chunk = 0;
+        if (n > 0) {
+            chunk = rt_limbs_divrem_1(t, t, n, RT_INT_DEC_BASE);
+            n = rt_limbs_normalized_len(t, n);
+        }
+        size_t take = (pos < RT_INT_DEC_DIGITS) ? pos : RT_INT_DEC_DIGITS;
+        pos -= take;
+        rt_fmt_digits(out + pos, (uint64_t)chunk, take);
+    }
+
+    if (pad) return width;
+
+    /* Strip the leading zeros of the unpadded form, keeping at least one */
+    size_t skip = 0;
+    while (skip + 1 < width && out[skip] == '0') skip++;
+    memmove(out, out + skip, width - skip);
+    return width - skip;
+}
+
+/*
+ * Write x < pow[k + 1] at *cur, advancing it. Padded output is exactly
+ * RT_DEC_LEVEL_DIGITS(k) digits; the split is x = q * pow[k] + r with both
+ * halves written at level k - 1 and only the leftmost chain unpadded.
+ */
+static rt_error_code_t rt_dec_rec(char** cur, const rt_int* x, const rt_int* pow,
+                                  size_t k, int pad) {
+    if (x->len <= RT_INT_DEC_DC_THRESHOLD) {
+        *cur += rt_dec_basecase(*cur, x, RT_DEC_LEVEL_DIGITS(k), pad);
+        return RT_OK;
+    }
+
+    if (!pad && rt_limbs_cmp(x->digits, x->len, pow[k].digits, pow[k].len) < 0) {
+        return rt_dec_rec(cur, x, pow, k - 1, 0);
+    }
+
+    rt_int q, r;
+    rt_int_init(&q);
+    rt_int_init(&r);
+
+    rt_error_code_t err = rt_int_divrem_abs(&q, &r, x, &pow[k]);
+    if (err == RT_OK) err = rt_dec_rec(cur, &q, pow, k - 1, pad);
+    if (err == RT_OK) err = rt_dec_rec(cur, &r, pow, k - 1, 1);
+
+    rt_int_clear(&q);
+    rt_int_clear(&r);
+    return err;
+}
+
+/*
+ * Append the next power to pow[0..*levels), where pow[k] is
+ * 10^(RT_INT_DEC_DIGITS * 2^k). On failure *levels is still the number of
+ * initialized entries to clear.
+ */
+static rt_error_code_t rt_dec_push_power(rt_int* pow, size_t* levels) {
+    size_t k = *levels;
+    rt_int_init(&pow[k]);
+    *levels = k + 1;
+    if (k > 0) return rt_int_sqr(&pow[k], &pow[k - 1]);
+
+    rt_error_code_t err = rt_int_ensure_cap(&pow[0], 1);
+    if (err != RT_OK) return err;
+    pow[0].digits[0] = RT_INT_DEC_BASE;
+    pow[0].len = 1;
+    pow[0].sign = 1;
+    return RT_OK;
+}
+
+rt_error_code_t rt_int_to_dec_abs(char* buf, const rt_int* a, size_t* out_len) {
+    RT_PROF_SCOPE(RT_PROF_INT_TO_DEC);
+    if (a->len <= RT_INT_DEC_DC_THRESHOLD) {
+        *out_len = rt_dec_basecase(buf, a, 0, 0);
+        return RT_OK;
+    }
+
+    /* pow[k] = 10^(RT_INT_DEC_DIGITS * 2^k), up to the first with pow[k]^2 > a */
+    rt_int pow[sizeof(size_t) * CHAR_BIT];
+    size_t levels = 0;
+    rt_error_code_t err = rt_dec_push_power(pow, &levels);
+    while (err == RT_OK && 2 * pow[levels - 1].len - 1 <= a->len) {
+        err = rt_dec_push_power(pow, &levels);
+    }
+
+    if (err == RT_OK) {
+        char* cur = buf;
+        err = rt_dec_rec(&cur, a, pow, levels - 1, 0);
+        *out_len = (size_t)(cur - buf);
+    }
+
+    for (size_t i = 0; i < levels; i++) {
+        rt_int_clear(&pow[i]);
+    }
+    return err;
+}
+
+/* ==================== Decimal Input ==================== */
+
+/*
+ * Schoolbook parse of n digits into x, one RT_INT_DEC_DIGITS chunk at a
+ * time: x = x * 10^chunk + value. The first chunk takes the remainder so
+ * every later one is full.
+ */
+static rt_error_code_t rt_dec_parse_basecase(rt_int* x, const char* s, size_t n) {
+    /* 10^DIGITS < 2^BITS bounds the length */
+    rt_error_code_t err = rt_int_ensure_cap(x, n / RT_INT_DEC_DIGITS + 1);
+    if (err != RT_OK) return err;
+    x->len = 0;
+
+    size_t chunk = n % RT_INT_DEC_DIGITS;
+    if (chunk == 0) chunk = RT_INT_DEC_DIGITS;
+
+    for (; n > 0; n -= chunk, chunk = RT_INT_DEC_DIGITS) {
+        rt_limb_t value = 0;
+        rt_limb_t scale = 1;
+        for (size_t i = 0; i < chunk; i++) {
+            value = value * 10 + (rt_limb_t)(*s++ - '0');
+            scale *= 10;
+        }
+
+        rt_limb_t carry = rt_limbs_mul_1(x->digits, x->digits, x->len, scale);
+        for (size_t i = 0; value && i < x->len; i++) {
+            rt_limb_t sum = x->digits[i] + value;
+            value = (sum < value);
+            x->digits[i] = sum;
+        }
+        carry += value;
+        if (carry) x->digits[x->len++] = carry;
+    }
+
+    x->sign = 1;
+    rt_int_normalize(x);
+    return RT_OK;
+}
+
+/*
+ * Parse n digits with n <= 2 * RT_INT_DEC_DIGITS * 2^k: the low
+ * RT_INT_DEC_DIGITS * 2^k digits (the largest such split below n) form r,
+ * the rest form q, and x = q * pow[k] + r.
+ */
+static rt_error_code_t rt_dec_parse_rec(rt_int* x, const char* s, size_t n,
+                                        const rt_int* pow, size_t k) {
+    if (n <= (size_t)RT_INT_DEC_DC_THRESHOLD * RT_INT_DEC_DIGITS) {
+        return rt_dec_parse_basecase(x, s, n);
+    }
+    while (((size_t)RT_INT_DEC_DIGITS << k) >= n) k--;
+
+    size_t low = (size_t)RT_INT_DEC_DIGITS << k;
+    rt_int r;
+    rt_int_init(&r);
+
+    rt_error_code_t err = rt_dec_parse_rec(x, s, n - low, pow, k);
+    if (err == RT_OK) err = rt_dec_parse_rec(&r, s + (n - low), low, pow, k);
+    if (err == RT_OK) err = rt_int_mul(x, x, &pow[k]);
+    if (err == RT_OK) err = rt_int_add(x, x, &r);
+
+    rt_int_clear(&r);
+    return err;
+}
+
+rt_error_code_t rt_int_from_dec_abs(rt_int* x, const char* digits, size_t n) {
+    if (n <= (size_t)RT_INT_DEC_DC_THRESHOLD * RT_INT_DEC_DIGITS) {
+        return rt_dec_parse_basecase(x, digits, n);
+    }
+
+    /* pow[k] for every split level, up to the last with 10^(DIGITS * 2^k) < 10^n */
+    rt_int pow[sizeof(size_t) * CHAR_BIT];
+    size_t levels = 0;
+    rt_error_code_t err = rt_dec_push_power(pow, &levels);
+    while (err == RT_OK && ((size_t)RT_INT_DEC_DIGITS << levels) < n) {
+        err = rt_dec_push_power(pow, &levels);
+    }
+
+    if (err == RT_OK) err = rt_dec_parse_rec(x, digits, n, pow, levels - 1);
+
+    for (size_t i = 0; i < levels; i++) {
+        rt_int_clear(&pow[i]);
+    }
+    return err;
+}
@@ -0,0 +1,334 @@
+/*
+ * BigInt division engine for pcc.
+ *
+ * Magnitude division for rt_int_divmod: single-limb divisors use a short
+ * division loop, medium operands use Knuth's Algorithm D and long operands
+ * use Burnikel-Ziegler recursive division, which turns the work into
+ * multiplications that go through the Karatsuba/Toom-3 dispatcher. The
+ * crossover is RT_INT_DIV_BZ_THRESHOLD in rt_config.h.
+ */
+
+#include "rt_bigint_internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* The recursion halves the divisor; Algorithm D needs at least two limbs */
+#if RT_INT_DIV_BZ_THRESHOLD < 4
+#error "RT_INT_DIV_BZ_THRESHOLD must be at least 4 limbs"
+#endif
+
+/* ==================== Helpers ==================== */
+
+/* x = x - 1 for x > 0 */
+static void rt_int_decrement(rt_int* x) {
+    const rt_limb_t one = 1;
+    rt_limbs_sub(x->digits, x->digits, x->len, &one, 1);
+    rt_int_normalize(x);
+}
+
+/*
+ * out = hi * BASE^k + lo (BASE = 2^RT_INT_LIMB_BITS), where lo holds lon <= k limbs (NULL when lon is 0).
+ * hi must be non-negative; out must not alias hi or lo.
+ */
+static rt_error_code_t rt_int_compose(rt_int* out, const rt_int* hi, size_t k,
+                                      const rt_limb_t* lo, size_t lon) {
+    size_t len = hi->len ? k + hi->len : lon;
+    rt_error_code_t err = rt_int_ensure_cap(out, len);
+    if (err != RT_OK) return err;
+
+    if (lon) memcpy(out->digits, lo, lon * sizeof(rt_limb_t));
+    if (hi->len) {
+        memset(out->digits + lon, 0, (k - lon) * sizeof(rt_limb_t));
+        memcpy(out->digits + k, hi->digits, hi->len * sizeof(rt_limb_t));
+    }
+    out->len = len;
+    out->sign = 1;
+    rt_int_normalize(out);
+    return RT_OK;
+}
+
+/* ==================== Algorithm D ==================== */
+
+/*
+ * Knuth's Algorithm D (TAOCP 4.3.1). u has un + 1 limbs, v has n >= 2 limbs
+ * with the top bit of v[n - 1] set, and u < v * BASE^(un - n + 1). On return
+ * q holds the un - n + 1 quotient limbs and u[0..n) the remainder.
+ */
+static void rt_limbs_divrem_knuth(rt_limb_t* q, rt_limb_t* u, size_t un,
+                                  const rt_limb_t* v, size_t n) {
+    const rt_limb_t vtop = v[n - 1];
+    const rt_limb_t vnext = v[n - 2];
+
+    for (size_t j = un - n + 1; j-- > 0;) {
+        /* Estimate qhat from the top two limbs, then refine with the third */
+        rt_dlimb_t num = ((rt_dlimb_t)u[j + n] << RT_INT_LIMB_BITS) | u[j + n - 1];
+        rt_dlimb_t qhat = num / vtop;
+        rt_dlimb_t rhat = num % vtop;
+        while ((qhat >> RT_INT_LIMB_BITS) != 0 ||
+               qhat * vnext > ((rhat << RT_INT_LIMB_BITS) | u[j + n - 2])) {
+            qhat--;
+            rhat += vtop;
+            if ((rhat >> RT_INT_LIMB_BITS) != 0) break;
+        }
+
+        /* u[j..j+n] -= qhat * v */
+        rt_limb_t carry = 0;
+        rt_limb_t borrow = 0;
+        for (size_t i = 0; i < n; i++) {
+            rt_dlimb_t p = qhat * v[i] + carry;
+            carry = (rt_limb_t)(p >> RT_INT_LIMB_BITS);
+            rt_limb_t lo = (rt_limb_t)p;
+            rt_limb_t ui = u[i + j];
+            rt_limb_t diff = ui - lo;
+            u[i + j] = diff - borrow;
+            borrow = (ui < lo) | (diff < borrow);
+        }
+
+        rt_dlimb_t top = (rt_dlimb_t)carry + borrow;
+        if (u[j + n] >= top) {
+            u[j + n] -= (rt_limb_t)top;
+        } else {
+            /* qhat was one too large (probability ~2/BASE): add v back */
+            qhat--;
+            rt_limbs_add(u + j, u + j, n, v, n);
+            u[j + n] = 0;
+        }
+
+        q[j] = (rt_limb_t)qhat;
+    }
+}
+
+/* q, r = a divmod b for a >= 0 and a normalized n-limb divisor b */
+static rt_error_code_t rt_int_divrem_knuth(rt_int* q, rt_int* r, const rt_int* a,
+                                           const rt_limb_t* b, size_t n) {
+    if (rt_limbs_cmp(a->digits, a->len, b, n) < 0) {
+        q->sign = 0;
+        q->len = 0;
+        return rt_int_copy(r, a);
+    }
+
+    size_t qn = a->len - n + 1;
+    rt_error_code_t err = rt_int_ensure_cap(r, a->len + 1);
+    if (err != RT_OK) return err;
+    err = rt_int_ensure_cap(q, qn);
+    if (err != RT_OK) return err;
+
+    /* The remainder is computed in place in r's buffer */
+    memcpy(r->digits, a->digits, a->len * sizeof(rt_limb_t));
+    r->digits[a->len] = 0;
+    rt_limbs_divrem_knuth(q->digits, r->digits, a->len, b, n);
+
+    q->len = qn;
+    q->sign = 1;
+    rt_int_normalize(q);
+    r->len = n;
+    r->sign = 1;
+    rt_int_normalize(r);
+    return RT_OK;
+}
+
+/* ==================== Burnikel-Ziegler ==================== */
+
+/*
+ * Recursive division (Burnikel-Ziegler, in the formulation of Brent and
+ * Zimmermann's RecursiveDivRem). b is a normalized n-limb divisor and
+ * a < b * BASE^n. The quotient is split into a high and a low half, each
+ * obtained by recursively dividing by the high half of b and correcting
+ * with one multiplication by the low half; with b normalized the
+ * correction loops run at most twice.
+ */
+static rt_error_code_t rt_int_divrem_rec(rt_int* q, rt_int* r, const rt_int* a,
+                                         const rt_limb_t* b, size_t n) {
+    if (n < RT_INT_DIV_BZ_THRESHOLD || a->len < n + RT_INT_DIV_BZ_THRESHOLD) {
+        return rt_int_divrem_knuth(q, r, a, b, n);
+    }
+
+    size_t k = (a->len - n) / 2;
+    rt_int vb = rt_limbs_view(b, n);
+    rt_int b0 = rt_limbs_view(b, k);
+    rt_int ahi = rt_limbs_view(a->digits + 2 * k, a->len - 2 * k);
+    rt_int q1, r1, q0, r0, t, a1, a1hi;
+    rt_error_code_t err;
+
+    rt_int_init(&q1);
+    rt_int_init(&r1);
+    rt_int_init(&q0);
+    rt_int_init(&r0);
+    rt_int_init(&t);
+    rt_int_init(&a1);
+
+    /* High half: q1 = floor(a / BASE^(2k) / b1), a1 = a - q1 * b * BASE^k */
+    err = rt_int_divrem_rec(&q1, &r1, &ahi, b + k, n - k);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_compose(&a1, &r1, 2 * k, a->digits, 2 * k);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_mul(&t, &q1, &b0);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_compose(&r1, &t, k, NULL, 0);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_sub(&a1, &a1, &r1);
+    if (err != RT_OK) goto cleanup;
+    if (a1.sign < 0) {
+        err = rt_int_compose(&t, &vb, k, NULL, 0);
+        if (err != RT_OK) goto cleanup;
+        while (a1.sign < 0) {
+            err = rt_int_add(&a1, &a1, &t);
+            if (err != RT_OK) goto cleanup;
+            rt_int_decrement(&q1);
+        }
+    }
+
+    /* Low half: same step on a1 < b * BASE^k */
+    a1hi = rt_limbs_view(a1.len > k ? a1.digits + k : a1.digits, a1.len > k ? a1.len - k : 0);
+    err = rt_int_divrem_rec(&q0, &r0, &a1hi, b + k, n - k);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_compose(r, &r0, k, a1.digits, a1.len < k ? a1.len : k);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_mul(&t, &q0, &b0);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_sub(r, r, &t);
+    if (err != RT_OK) goto cleanup;
+    while (r->sign < 0) {
+        err = rt_int_add(r, r, &vb);
+        if (err != RT_OK) goto cleanup;
+        rt_int_decrement(&q0);
+    }
+
+    err = rt_int_compose(q, &q1, k, q0.digits, q0.len);
+
+cleanup:
+    rt_int_clear(&q1);
+    rt_int_clear(&r1);
+    rt_int_clear(&q0);
+    rt_int_clear(&r0);
+    rt_int_clear(&t);
+    rt_int_clear(&a1);
+    return err;
+}
+
+/*
+ * Divide an arbitrarily long a by a normalized n-limb b. Dividends longer
+ * than 2n limbs are consumed in n-limb blocks from the top, each block
+ * being one 2n-by-n recursive division.
+ */
+static rt_error_code_t rt_int_divrem_bz(rt_int* q, rt_int* r, const rt_int* a,
+                                        const rt_limb_t* b, size_t n) {
+    if (a->len <= 2 * n) {
+        return rt_int_divrem_rec(q, r, a, b, n);
+    }
+
+    size_t qn = a->len - n + 1;
+    size_t pos = a->len - n;
+    rt_int cur = rt_limbs_view(a->digits + pos, n);
+    rt_int qc, rc;
+    rt_error_code_t err = rt_int_ensure_cap(q, qn);
+    if (err != RT_OK) return err;
+    memset(q->digits, 0, qn * sizeof(rt_limb_t));
+
+    rt_int_init(&qc);
+    rt_int_init(&rc);
+
+    err = rt_int_divrem_rec(&qc, r, &cur, b, n);
+    if (err != RT_OK) goto cleanup;
+    if (qc.len) q->digits[pos] = qc.digits[0];
+
+    while (pos > 0) {
+        size_t s = pos < n ? pos : n;
+        pos -= s;
+        err = rt_int_compose(&rc, r, s, a->digits + pos, s);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_divrem_rec(&qc, r, &rc, b, n);
+        if (err != RT_OK) goto cleanup;
+        memcpy(q->digits + pos, qc.digits, qc.len * sizeof(rt_limb_t));
+    }
+
+    q->len = qn;
+    q->sign = 1;
+    rt_int_normalize(q);
+
+cleanup:
+    rt_int_clear(&qc);
+    rt_int_clear(&rc);
+    return err;
+}
+
+/* ==================== Dispatcher ==================== */
+
+rt_error_code_t rt_int_divrem_abs(rt_int* q, rt_int* r, const rt_int* a, const rt_int* b) {
+    size_t n = b->len;
+    rt_int qt, rt, u, v;
+    rt_error_code_t err = RT_OK;
+
+    if (rt_limbs_cmp(a->digits, a->len, b->digits, n) < 0) {
+        if (q) {
+            q->sign = 0;
+            q->len = 0;
+        }
+        if (r) {
+            err = rt_int_copy(r, a);
+            r->sign = r->len ? 1 : 0;
+        }
+        return err;
+    }
+
+    rt_int_init(&qt);
+    rt_int_init(&rt);
+    rt_int_init(&u);
+    rt_int_init(&v);
+    if (!q) q = &qt;
+    if (!r) r = &rt;
+
+    if (n == 1) {
+        size_t qn = a->len;
+        err = rt_int_ensure_cap(q, qn);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_ensure_cap(r, 1);
+        if (err != RT_OK) goto cleanup;
+        r->digits[0] = rt_limbs_divrem_1(q->digits, a->digits, a->len, b->digits[0]);
+        r->len = 1;
+        r->sign = 1;
+        rt_int_normalize(r);
+        q->len = qn;
+        q->sign = 1;
+        rt_int_normalize(q);
+        goto cleanup;
+    }
+
+    /* Shift both operands so the divisor's top bit is set */
+    unsigned shift = rt_limb_clz(b->digits[n - 1]);
+    err = rt_int_ensure_cap(&u, a->len + 1);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_ensure_cap(&v, n);
+    if (err != RT_OK) goto cleanup;
+    if (shift) {
+        u.digits[a->len] = rt_limbs_lshift(u.digits, a->digits, a->len, shift);
+        rt_limbs_lshift(v.digits, b->digits, n, shift);
+    } else {
+        memcpy(u.digits, a->digits, a->len * sizeof(rt_limb_t));
+        u.digits[a->len] = 0;
+        memcpy(v.digits, b->digits, n * sizeof(rt_limb_t));
+    }
+    u.len = a->len + 1;
+    u.sign = 1;
+    rt_int_normalize(&u);
+
+    if (n < RT_INT_DIV_BZ_THRESHOLD || u.len - n < RT_INT_DIV_BZ_THRESHOLD) {
+        err = rt_int_divrem_knuth(q, r, &u, v.digits, n);
+    } else {
+        err = rt_int_divrem_bz(q, r, &u, v.digits, n);
+    }
+    if (err != RT_OK) goto cleanup;
+
+    /* Undo the normalization shift on the remainder */
+    if (shift) {
+        rt_limbs_rshift(r->digits, r->digits, r->len, shift);
+        rt_int_normalize(r);
+    }
+
+cleanup:
+    rt_int_clear(&qt);
+    rt_int_clear(&rt);
+    rt_int_clear(&u);
+    rt_int_clear(&v);
+    return err;
+}
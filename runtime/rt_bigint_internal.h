@@ -0,0 +1,137 @@
+/*
+ * Internal limb-level kernels for the pcc BigInt runtime.
+ *
+ * These functions operate on raw little-endian limb arrays and are shared
+ * between the BigInt translation units. They are not part of the public
+ * runtime API and are not included by runtime.h.
+ *
+ * Conventions:
+ * - Lengths are in limbs; operands may carry leading zero limbs.
+ * - Unless stated otherwise, the result array must not overlap the inputs.
+ */
+
+#pragma once
+
+#include "rt_config.h"
+#include "rt_error.h"
+#include "rt_bigint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Double-width limb for products and two-limb dividends */
+#if RT_INT_LIMB_BITS == 64
+__extension__ typedef unsigned __int128 rt_dlimb_t;
+#else
+typedef uint64_t rt_dlimb_t;
+#endif
+
+/* Count leading zero bits of a non-zero limb */
+static inline unsigned rt_limb_clz(rt_limb_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+#if RT_INT_LIMB_BITS == 64
+    return (unsigned)__builtin_clzll(x);
+#else
+    return (unsigned)__builtin_clz(x);
+#endif
+#else
+    unsigned n = 0;
+    while (!(x & ((rt_limb_t)1 << (RT_INT_LIMB_BITS - 1)))) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/* Compare two limb arrays of possibly different lengths: -1, 0 or +1 */
+int rt_limbs_cmp(const rt_limb_t* a, size_t an, const rt_limb_t* b, size_t bn);
+
+/* r = a + b, requires an >= bn; r has an limbs and may alias a. Returns carry. */
+rt_limb_t rt_limbs_add(rt_limb_t* r, const rt_limb_t* a, size_t an, const rt_limb_t* b, size_t bn);
+
+/* r = a - b, requires a >= b and an >= bn; r has an limbs and may alias a. Returns borrow. */
+rt_limb_t rt_limbs_sub(rt_limb_t* r, const rt_limb_t* a, size_t an, const rt_limb_t* b, size_t bn);
+
+/* r = a * m for a single limb m; r has n limbs and may alias a. Returns carry limb. */
+rt_limb_t rt_limbs_mul_1(rt_limb_t* r, const rt_limb_t* a, size_t n, rt_limb_t m);
+
+/* r += a * m for a single limb m; r has n limbs. Returns carry limb. */
+rt_limb_t rt_limbs_addmul_1(rt_limb_t* r, const rt_limb_t* a, size_t n, rt_limb_t m);
+
+/* r = a << s for 0 < s < RT_INT_LIMB_BITS; r has n limbs and may alias a. Returns bits shifted out. */
+rt_limb_t rt_limbs_lshift(rt_limb_t* r, const rt_limb_t* a, size_t n, unsigned s);
+
+/* r = a >> s for 0 < s < RT_INT_LIMB_BITS; r has n limbs and may alias a. */
+void rt_limbs_rshift(rt_limb_t* r, const rt_limb_t* a, size_t n, unsigned s);
+
+/* q = a / d for a single limb d; q has n limbs and may alias a. Returns remainder. */
+rt_limb_t rt_limbs_divrem_1(rt_limb_t* q, const rt_limb_t* a, size_t n, rt_limb_t d);
+
+/*
+ * r = a * b with size-based algorithm selection (schoolbook, Karatsuba,
+ * Toom-3). r must have an + bn limbs and must not overlap a or b.
+ */
+rt_error_code_t rt_limbs_mul(rt_limb_t* r, const rt_limb_t* a, size_t an,
+                             const rt_limb_t* b, size_t bn);
+
+/* r = a * a; r must have 2 * n limbs and must not overlap a. */
+rt_error_code_t rt_limbs_sqr(rt_limb_t* r, const rt_limb_t* a, size_t n);
+
+/*
+ * Magnitude division: q = |a| / |b|, r = |a| % |b|, both non-negative.
+ * Either output may be NULL; outputs must not alias a or b.
+ */
+rt_error_code_t rt_int_divrem_abs(rt_int* q, rt_int* r, const rt_int* a, const rt_int* b);
+
+/* Upper bound on the number of decimal digits of |a| (at least 1) */
+size_t rt_int_dec_digits_bound(const rt_int* a);
+
+/*
+ * Write |a| in decimal to buf without sign or terminator. buf must hold
+ * rt_int_dec_digits_bound(a) characters; *out_len receives the length.
+ */
+rt_error_code_t rt_int_to_dec_abs(char* buf, const rt_int* a, size_t* out_len);
+
+/*
+ * Parse n decimal digits (all '0'-'9', no sign) into x as a non-negative
+ * value, reusing x's buffer.
+ */
+rt_error_code_t rt_int_from_dec_abs(rt_int* x, const char* digits, size_t n);
+
+/* Grow x's digit buffer to at least new_cap limbs (contents preserved) */
+rt_error_code_t rt_int_ensure_cap(rt_int* x, size_t new_cap);
+
+/* Normalize BigInt (remove leading zeros, fix sign) */
+static inline void rt_int_normalize(rt_int* x) {
+    while (x->len > 0 && x->digits[x->len - 1] == 0) {
+        x->len--;
+    }
+    if (x->len == 0) {
+        x->sign = 0;
+    }
+}
+
+/* Number of significant limbs in a (strips leading zero limbs) */
+static inline size_t rt_limbs_normalized_len(const rt_limb_t* a, size_t n) {
+    while (n > 0 && a[n - 1] == 0) n--;
+    return n;
+}
+
+/* Read-only BigInt view over a limb range (never cleared or resized) */
+static inline rt_int rt_limbs_view(const rt_limb_t* p, size_t n) {
+    rt_int v;
+    v.len = rt_limbs_normalized_len(p, n);
+    v.cap = v.len;
+    v.sign = v.len ? 1 : 0;
+    v.digits = (rt_limb_t*)p;
+    return v;
+}
+
+#ifdef __cplusplus
+}
+#endif
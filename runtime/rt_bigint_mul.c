@@ -0,0 +1,545 @@
+/*
+ * BigInt multiplication engine for pcc.
+ *
+ * Implements the limb-level kernels declared in rt_bigint_internal.h and a
+ * size-dispatched multiplier: schoolbook for short operands, Karatsuba for
+ * medium operands and Toom-3 for long operands, with dedicated squaring
+ * variants of each. Thresholds are configured in rt_config.h.
+ *
+ * The sub-products of Karatsuba and Toom-3 are independent: above
+ * RT_INT_PAR_THRESHOLD they run as tasks on the thread pool, each writing
+ * its own buffer, and the recombination waits for all of them.
+ */
+
+#include "rt_bigint_internal.h"
+#include "rt_alloc.h"
+#include "rt_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Karatsuba splits into (h + 1)-limb sums, which only shrink from 4 limbs up */
+#if RT_INT_KARATSUBA_THRESHOLD < 4 || RT_INT_SQR_KARATSUBA_THRESHOLD < 4
+#error "Karatsuba thresholds must be at least 4 limbs"
+#endif
+
+/* ==================== Basic Kernels ==================== */
+
+int rt_limbs_cmp(const rt_limb_t* a, size_t an, const rt_limb_t* b, size_t bn) {
+    an = rt_limbs_normalized_len(a, an);
+    bn = rt_limbs_normalized_len(b, bn);
+    if (an != bn) {
+        return (an < bn) ? -1 : 1;
+    }
+    for (size_t i = an; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return (a[i] < b[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+rt_limb_t rt_limbs_add(rt_limb_t* r, const rt_limb_t* a, size_t an, const rt_limb_t* b, size_t bn) {
+    rt_limb_t carry = 0;
+    size_t i = 0;
+
+    for (; i < bn; i++) {
+        rt_limb_t sum = a[i] + carry;
+        carry = (sum < carry);
+        sum += b[i];
+        carry += (sum < b[i]);
+        r[i] = sum;
+    }
+
+    /* In-place: only the carry chain needs to be walked */
+    if (r == a) {
+        for (; carry && i < an; i++) {
+            r[i] = a[i] + 1;
+            carry = (r[i] == 0);
+        }
+        return carry;
+    }
+
+    for (; i < an; i++) {
+        rt_limb_t sum = a[i] + carry;
+        carry = (sum < carry);
+        r[i] = sum;
+    }
+    return carry;
+}
+
+rt_limb_t rt_limbs_sub(rt_limb_t* r, const rt_limb_t* a, size_t an, const rt_limb_t* b, size_t bn) {
+    rt_limb_t borrow = 0;
+    size_t i = 0;
+
+    for (; i < bn; i++) {
+        rt_limb_t ai = a[i];
+        rt_limb_t diff = ai - b[i];
+        rt_limb_t out = diff - borrow;
+        borrow = (ai < b[i]) | (diff < borrow);
+        r[i] = out;
+    }
+
+    if (r == a) {
+        for (; borrow && i < an; i++) {
+            borrow = (a[i] == 0);
+            r[i] = a[i] - 1;
+        }
+        return borrow;
+    }
+
+    for (; i < an; i++) {
+        rt_limb_t ai = a[i];
+        r[i] = ai - borrow;
+        borrow = (ai < borrow);
+    }
+    return borrow;
+}
+
+rt_limb_t rt_limbs_mul_1(rt_limb_t* r, const rt_limb_t* a, size_t n, rt_limb_t m) {
+    rt_limb_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        rt_dlimb_t t = (rt_dlimb_t)a[i] * m + carry;
+        r[i] = (rt_limb_t)t;
+        carry = (rt_limb_t)(t >> RT_INT_LIMB_BITS);
+    }
+    return carry;
+}
+
+rt_limb_t rt_limbs_addmul_1(rt_limb_t* r, const rt_limb_t* a, size_t n, rt_limb_t m) {
+    rt_limb_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        rt_dlimb_t t = (rt_dlimb_t)a[i] * m + r[i] + carry;
+        r[i] = (rt_limb_t)t;
+        carry = (rt_limb_t)(t >> RT_INT_LIMB_BITS);
+    }
+    return carry;
+}
+
+rt_limb_t rt_limbs_lshift(rt_limb_t* r, const rt_limb_t* a, size_t n, unsigned s) {
+    rt_limb_t out = 0;
+    for (size_t i = n; i-- > 0;) {
+        rt_limb_t ai = a[i];
+        if (i == n - 1) out = ai >> (RT_INT_LIMB_BITS - s);
+        r[i] = (ai << s) | (i ? a[i - 1] >> (RT_INT_LIMB_BITS - s) : 0);
+    }
+    return out;
+}
+
+void rt_limbs_rshift(rt_limb_t* r, const rt_limb_t* a, size_t n, unsigned s) {
+    for (size_t i = 0; i < n; i++) {
+        r[i] = (a[i] >> s) | (i + 1 < n ? a[i + 1] << (RT_INT_LIMB_BITS - s) : 0);
+    }
+}
+
+rt_limb_t rt_limbs_divrem_1(rt_limb_t* q, const rt_limb_t* a, size_t n, rt_limb_t d) {
+    rt_limb_t rem = 0;
+    for (size_t i = n; i-- > 0;) {
+        rt_dlimb_t cur = ((rt_dlimb_t)rem << RT_INT_LIMB_BITS) | a[i];
+        q[i] = (rt_limb_t)(cur / d);
+        rem = (rt_limb_t)(cur % d);
+    }
+    return rem;
+}
+
+/* ==================== Schoolbook ==================== */
+
+static void rt_limbs_mul_basecase(rt_limb_t* r, const rt_limb_t* a, size_t an,
+                                  const rt_limb_t* b, size_t bn) {
+    memset(r, 0, (an + bn) * sizeof(rt_limb_t));
+    for (size_t i = 0; i < an; i++) {
+        if (a[i] == 0) continue;
+        r[i + bn] = rt_limbs_addmul_1(r + i, b, bn, a[i]);
+    }
+}
+
+static void rt_limbs_sqr_basecase(rt_limb_t* r, const rt_limb_t* a, size_t n) {
+    memset(r, 0, 2 * n * sizeof(rt_limb_t));
+
+    /* Off-diagonal products a[i] * a[j] for i < j, computed once */
+    for (size_t i = 0; i + 1 < n; i++) {
+        if (a[i] == 0) continue;
+        r[i + n] = rt_limbs_addmul_1(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+    }
+
+    /* Double them and add the diagonal squares */
+    rt_limbs_lshift(r, r, 2 * n, 1);
+
+    rt_limb_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        rt_dlimb_t t = (rt_dlimb_t)a[i] * a[i] + r[2 * i] + carry;
+        r[2 * i] = (rt_limb_t)t;
+        t = (t >> RT_INT_LIMB_BITS) + r[2 * i + 1];
+        r[2 * i + 1] = (rt_limb_t)t;
+        carry = (rt_limb_t)(t >> RT_INT_LIMB_BITS);
+    }
+}
+
+/* ==================== Parallel Sub-Products ==================== */
+
+/* A limb product (or square, when b is NULL) run as a pool task */
+typedef struct {
+    rt_limb_t* r;
+    const rt_limb_t* a;
+    size_t an;
+    const rt_limb_t* b;
+    size_t bn;
+} rt_limbs_mul_job;
+
+static rt_error_code_t rt_limbs_mul_job_run(void* arg) {
+    rt_limbs_mul_job* job = (rt_limbs_mul_job*)arg;
+    if (!job->b) return rt_limbs_sqr(job->r, job->a, job->an);
+    return rt_limbs_mul(job->r, job->a, job->an, job->b, job->bn);
+}
+
+/*
+ * Compute z = x * y here and the two jobs on the pool, in the order a
+ * serial caller would: hi and lo are spawned first so idle threads can
+ * take them, and joined newest first so the ones left run here.
+ */
+static rt_error_code_t rt_limbs_mul3_parallel(rt_limbs_mul_job* z, rt_limbs_mul_job* lo,
+                                              rt_limbs_mul_job* hi) {
+    rt_task lo_task, hi_task;
+    rt_task_spawn(&hi_task, rt_limbs_mul_job_run, hi);
+    rt_task_spawn(&lo_task, rt_limbs_mul_job_run, lo);
+    rt_error_code_t err = rt_limbs_mul_job_run(z);
+    rt_error_code_t lo_err = rt_task_join(&lo_task);
+    rt_error_code_t hi_err = rt_task_join(&hi_task);
+    if (err == RT_OK) err = lo_err;
+    if (err == RT_OK) err = hi_err;
+    return err;
+}
+
+/* ==================== Karatsuba ==================== */
+
+/*
+ * Split at h = ceil(an / 2): a = a1 * B^h + a0, b = b1 * B^h + b0 and
+ * a * b = a1*b1 * B^2h + ((a0+a1)(b0+b1) - a0*b0 - a1*b1) * B^h + a0*b0.
+ * Requires an >= bn > h.
+ */
+static rt_error_code_t rt_limbs_mul_karatsuba(rt_limb_t* r, const rt_limb_t* a, size_t an,
+                                              const rt_limb_t* b, size_t bn) {
+    size_t h = (an + 1) / 2;
+    size_t a1n = an - h;
+    size_t b1n = bn - h;
+    size_t sn = h + 1;
+    size_t rn = an + bn;
+
+    size_t scratch_size = 4 * sn * sizeof(rt_limb_t);
+    rt_limb_t* scratch = (rt_limb_t*)rt_mem_alloc(scratch_size);
+    RT_CHECK_ALLOC(scratch, "Karatsuba scratch");
+    rt_limb_t* sa = scratch;
+    rt_limb_t* sb = scratch + sn;
+    rt_limb_t* z1 = scratch + 2 * sn;
+
+    sa[h] = rt_limbs_add(sa, a, h, a + h, a1n);
+    sb[h] = rt_limbs_add(sb, b, h, b + h, b1n);
+
+    rt_error_code_t err;
+    if (rt_pool_should_split(bn, RT_INT_PAR_THRESHOLD)) {
+        /* z1, the low half of r and the high half of r are disjoint */
+        rt_limbs_mul_job z = { z1, sa, sn, sb, sn };
+        rt_limbs_mul_job lo = { r, a, h, b, h };
+        rt_limbs_mul_job hi = { r + 2 * h, a + h, a1n, b + h, b1n };
+        err = rt_limbs_mul3_parallel(&z, &lo, &hi);
+        if (err != RT_OK) goto cleanup;
+    } else {
+        err = rt_limbs_mul(z1, sa, sn, sb, sn);
+        if (err != RT_OK) goto cleanup;
+        err = rt_limbs_mul(r, a, h, b, h);
+        if (err != RT_OK) goto cleanup;
+        err = rt_limbs_mul(r + 2 * h, a + h, a1n, b + h, b1n);
+        if (err != RT_OK) goto cleanup;
+    }
+
+    rt_limbs_sub(z1, z1, 2 * sn, r, 2 * h);
+    rt_limbs_sub(z1, z1, 2 * sn, r + 2 * h, a1n + b1n);
+    rt_limbs_add(r + h, r + h, rn - h, z1, rt_limbs_normalized_len(z1, 2 * sn));
+
+cleanup:
+    rt_mem_free(scratch, scratch_size);
+    return err;
+}
+
+static rt_error_code_t rt_limbs_sqr_karatsuba(rt_limb_t* r, const rt_limb_t* a, size_t n) {
+    size_t h = (n + 1) / 2;
+    size_t a1n = n - h;
+    size_t sn = h + 1;
+
+    size_t scratch_size = 3 * sn * sizeof(rt_limb_t);
+    rt_limb_t* scratch = (rt_limb_t*)rt_mem_alloc(scratch_size);
+    RT_CHECK_ALLOC(scratch, "Karatsuba scratch");
+    rt_limb_t* sa = scratch;
+    rt_limb_t* z1 = scratch + sn;
+
+    sa[h] = rt_limbs_add(sa, a, h, a + h, a1n);
+
+    rt_error_code_t err;
+    if (rt_pool_should_split(n, RT_INT_PAR_THRESHOLD)) {
+        rt_limbs_mul_job z = { z1, sa, sn, NULL, 0 };
+        rt_limbs_mul_job lo = { r, a, h, NULL, 0 };
+        rt_limbs_mul_job hi = { r + 2 * h, a + h, a1n, NULL, 0 };
+        err = rt_limbs_mul3_parallel(&z, &lo, &hi);
+        if (err != RT_OK) goto cleanup;
+    } else {
+        err = rt_limbs_sqr(z1, sa, sn);
+        if (err != RT_OK) goto cleanup;
+        err = rt_limbs_sqr(r, a, h);
+        if (err != RT_OK) goto cleanup;
+        err = rt_limbs_sqr(r + 2 * h, a + h, a1n);
+        if (err != RT_OK) goto cleanup;
+    }
+
+    rt_limbs_sub(z1, z1, 2 * sn, r, 2 * h);
+    rt_limbs_sub(z1, z1, 2 * sn, r + 2 * h, 2 * a1n);
+    rt_limbs_add(r + h, r + h, 2 * n - h, z1, rt_limbs_normalized_len(z1, 2 * sn));
+
+cleanup:
+    rt_mem_free(scratch, scratch_size);
+    return err;
+}
+
+/* ==================== Toom-3 ==================== */
+
+/* Exact division of a BigInt by a small constant */
+static void rt_int_divexact_1(rt_int* x, rt_limb_t d) {
+    rt_limbs_divrem_1(x->digits, x->digits, x->len, d);
+    rt_int_normalize(x);
+}
+
+/* Add a non-negative coefficient into r at limb offset off */
+static void rt_limbs_add_at(rt_limb_t* r, size_t rn, size_t off, const rt_int* c) {
+    if (c->len == 0) return;
+    rt_limbs_add(r + off, r + off, rn - off, c->digits, c->len);
+}
+
+/* A pointwise product of Toom-3 run as a pool task */
+typedef struct {
+    rt_int* out;
+    const rt_int* a;
+    const rt_int* b;
+} rt_int_mul_job;
+
+static rt_error_code_t rt_int_mul_job_run(void* arg) {
+    rt_int_mul_job* job = (rt_int_mul_job*)arg;
+    return rt_int_mul(job->out, job->a, job->b);
+}
+
+/* x(-2) = 2 * (x(-1) + x2) - x0 */
+static rt_error_code_t rt_toom3_eval_m2(rt_int* out, const rt_int* pm1,
+                                        const rt_int* x2, const rt_int* x0) {
+    rt_error_code_t err = rt_int_add(out, pm1, x2);
+    if (err != RT_OK) return err;
+    err = rt_int_add(out, out, out);
+    if (err != RT_OK) return err;
+    return rt_int_sub(out, out, x0);
+}
+
+/*
+ * Toom-3 (Toom-Cook 3-way) multiplication, evaluating at 0, 1, -1, -2 and
+ * infinity using Bodrato's interpolation sequence. Pointwise products go
+ * back through rt_int_mul, so they recurse into the dispatcher. Requires
+ * an >= bn > 2 * ceil(an / 3).
+ */
+static rt_error_code_t rt_limbs_mul_toom3(rt_limb_t* r, const rt_limb_t* a, size_t an,
+                                          const rt_limb_t* b, size_t bn, int square) {
+    size_t k = (an + 2) / 3;
+    size_t rn = an + bn;
+
+    rt_int a0 = rt_limbs_view(a, k);
+    rt_int a1 = rt_limbs_view(a + k, k);
+    rt_int a2 = rt_limbs_view(a + 2 * k, an - 2 * k);
+    rt_int b0 = rt_limbs_view(b, k);
+    rt_int b1 = rt_limbs_view(b + k, k);
+    rt_int b2 = rt_limbs_view(b + 2 * k, bn - 2 * k);
+
+    rt_int t, pa1, pam1, pam2, pb1, pbm1, pbm2;
+    rt_int r0, r1, rm1, rm2, rinf;
+    rt_int_init(&t);
+    rt_int_init(&pa1);
+    rt_int_init(&pam1);
+    rt_int_init(&pam2);
+    rt_int_init(&pb1);
+    rt_int_init(&pbm1);
+    rt_int_init(&pbm2);
+    rt_int_init(&r0);
+    rt_int_init(&r1);
+    rt_int_init(&rm1);
+    rt_int_init(&rm2);
+    rt_int_init(&rinf);
+
+    const rt_int* qb1 = &pa1;
+    const rt_int* qbm1 = &pam1;
+    const rt_int* qbm2 = &pam2;
+
+    /* Evaluate a at 1, -1, -2 */
+    rt_error_code_t err = rt_int_add(&t, &a0, &a2);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_add(&pa1, &t, &a1);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_sub(&pam1, &t, &a1);
+    if (err != RT_OK) goto cleanup;
+    err = rt_toom3_eval_m2(&pam2, &pam1, &a2, &a0);
+    if (err != RT_OK) goto cleanup;
+
+    /* Evaluate b at 1, -1, -2 */
+    if (!square) {
+        err = rt_int_add(&t, &b0, &b2);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_add(&pb1, &t, &b1);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_sub(&pbm1, &t, &b1);
+        if (err != RT_OK) goto cleanup;
+        err = rt_toom3_eval_m2(&pbm2, &pbm1, &b2, &b0);
+        if (err != RT_OK) goto cleanup;
+        qb1 = &pb1;
+        qbm1 = &pbm1;
+        qbm2 = &pbm2;
+    }
+
+    /* Pointwise products */
+    if (rt_pool_should_split(bn, RT_INT_PAR_THRESHOLD)) {
+        rt_int_mul_job jobs[4] = {
+            { &r1, &pa1, qb1 },
+            { &rm1, &pam1, qbm1 },
+            { &rm2, &pam2, qbm2 },
+            { &rinf, &a2, square ? &a2 : &b2 },
+        };
+        rt_task tasks[4];
+        for (size_t i = 0; i < 4; i++) {
+            rt_task_spawn(&tasks[i], rt_int_mul_job_run, &jobs[i]);
+        }
+        err = rt_int_mul(&r0, &a0, square ? &a0 : &b0);
+        for (size_t i = 4; i-- > 0;) {
+            rt_error_code_t task_err = rt_task_join(&tasks[i]);
+            if (err == RT_OK) err = task_err;
+        }
+        if (err != RT_OK) goto cleanup;
+    } else {
+        err = rt_int_mul(&r0, &a0, square ? &a0 : &b0);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_mul(&r1, &pa1, qb1);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_mul(&rm1, &pam1, qbm1);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_mul(&rm2, &pam2, qbm2);
+        if (err != RT_OK) goto cleanup;
+        err = rt_int_mul(&rinf, &a2, square ? &a2 : &b2);
+        if (err != RT_OK) goto cleanup;
+    }
+
+    /* Interpolate: rm2 -> c3, r1 -> c1, rm1 -> c2 */
+    err = rt_int_sub(&rm2, &rm2, &r1);
+    if (err != RT_OK) goto cleanup;
+    rt_int_divexact_1(&rm2, 3);
+    err = rt_int_sub(&r1, &r1, &rm1);
+    if (err != RT_OK) goto cleanup;
+    rt_int_divexact_1(&r1, 2);
+    err = rt_int_sub(&rm1, &rm1, &r0);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_sub(&rm2, &rm1, &rm2);
+    if (err != RT_OK) goto cleanup;
+    rt_int_divexact_1(&rm2, 2);
+    err = rt_int_add(&t, &rinf, &rinf);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_add(&rm2, &rm2, &t);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_add(&rm1, &rm1, &r1);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_sub(&rm1, &rm1, &rinf);
+    if (err != RT_OK) goto cleanup;
+    err = rt_int_sub(&r1, &r1, &rm2);
+    if (err != RT_OK) goto cleanup;
+
+    /* Recompose: all coefficients are non-negative here */
+    memset(r, 0, rn * sizeof(rt_limb_t));
+    rt_limbs_add_at(r, rn, 0, &r0);
+    rt_limbs_add_at(r, rn, k, &r1);
+    rt_limbs_add_at(r, rn, 2 * k, &rm1);
+    rt_limbs_add_at(r, rn, 3 * k, &rm2);
+    rt_limbs_add_at(r, rn, 4 * k, &rinf);
+
+cleanup:
+    rt_int_clear(&t);
+    rt_int_clear(&pa1);
+    rt_int_clear(&pam1);
+    rt_int_clear(&pam2);
+    rt_int_clear(&pb1);
+    rt_int_clear(&pbm1);
+    rt_int_clear(&pbm2);
+    rt_int_clear(&r0);
+    rt_int_clear(&r1);
+    rt_int_clear(&rm1);
+    rt_int_clear(&rm2);
+    rt_int_clear(&rinf);
+    return err;
+}
+
+/* ==================== Dispatch ==================== */
+
+/* Multiply a long operand by a much shorter one in bn-sized chunks */
+static rt_error_code_t rt_limbs_mul_unbalanced(rt_limb_t* r, const rt_limb_t* a, size_t an,
+                                               const rt_limb_t* b, size_t bn) {
+    size_t rn = an + bn;
+    size_t tmp_size = 2 * bn * sizeof(rt_limb_t);
+    rt_limb_t* tmp = (rt_limb_t*)rt_mem_alloc(tmp_size);
+    RT_CHECK_ALLOC(tmp, "multiply scratch");
+
+    memset(r, 0, rn * sizeof(rt_limb_t));
+
+    rt_error_code_t err = RT_OK;
+    for (size_t off = 0; off < an; off += bn) {
+        size_t cn = (an - off < bn) ? an - off : bn;
+        err = rt_limbs_mul(tmp, a + off, cn, b, bn);
+        if (err != RT_OK) break;
+        rt_limbs_add(r + off, r + off, rn - off, tmp, cn + bn);
+    }
+
+    rt_mem_free(tmp, tmp_size);
+    return err;
+}
+
+rt_error_code_t rt_limbs_mul(rt_limb_t* r, const rt_limb_t* a, size_t an,
+                             const rt_limb_t* b, size_t bn) {
+    if (an < bn) {
+        const rt_limb_t* tp = a; a = b; b = tp;
+        size_t tn = an; an = bn; bn = tn;
+    }
+
+    if (bn == 0) {
+        memset(r, 0, an * sizeof(rt_limb_t));
+        return RT_OK;
+    }
+
+    if (bn < RT_INT_KARATSUBA_THRESHOLD) {
+        rt_limbs_mul_basecase(r, a, an, b, bn);
+        return RT_OK;
+    }
+
+    /* Karatsuba and Toom-3 want roughly balanced operands */
+    if (bn <= (an + 1) / 2) {
+        return rt_limbs_mul_unbalanced(r, a, an, b, bn);
+    }
+
+    if (bn < RT_INT_TOOM3_THRESHOLD || bn <= 2 * ((an + 2) / 3)) {
+        return rt_limbs_mul_karatsuba(r, a, an, b, bn);
+    }
+
+    return rt_limbs_mul_toom3(r, a, an, b, bn, 0);
+}
+
+rt_error_code_t rt_limbs_sqr(rt_limb_t* r, const rt_limb_t* a, size_t n) {
+    if (n == 0) {
+        return RT_OK;
+    }
+
+    if (n < RT_INT_SQR_KARATSUBA_THRESHOLD) {
+        rt_limbs_sqr_basecase(r, a, n);
+        return RT_OK;
+    }
+
+    if (n < RT_INT_SQR_TOOM3_THRESHOLD) {
+        return rt_limbs_sqr_karatsuba(r, a, n);
+    }
+
+    return rt_limbs_mul_toom3(r, a, n, a, n, 1);
+}
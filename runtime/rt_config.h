@@ -46,17 +46,197 @@ extern "C" {
     #define RT_INLINE inline
 #endif
 
+/* Branch hints for error paths */
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    #define RT_LIKELY(x) __builtin_expect(!!(x), 1)
+    #define RT_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+    #define RT_LIKELY(x) (x)
+    #define RT_UNLIKELY(x) (x)
+#endif
+
+/*
+ * Thread-local storage for per-thread runtime state: the last error, the
+ * allocator's free lists and the temporary scope stack. Compilers without
+ * it get a single shared copy, and the runtime is then single-threaded.
+ */
+#if defined(RT_COMPILER_MSVC)
+    #define RT_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define RT_THREAD_LOCAL _Thread_local
+#elif defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    #define RT_THREAD_LOCAL __thread
+#else
+    #define RT_THREAD_LOCAL
+    #define RT_NO_THREADS
+#endif
+
+/*
+ * Atomic counters for reference counts that may be shared across threads:
+ * RT_ATOMIC_INC/RT_ATOMIC_DEC update a size_t and yield the new value,
+ * RT_ATOMIC_LOAD reads one with acquire ordering (a plain load on x86),
+ * RT_ATOMIC_STORE writes one with release ordering, and
+ * RT_SPIN_LOCK/RT_SPIN_UNLOCK guard short sections with an int flag.
+ */
+#if defined(RT_COMPILER_MSVC)
+    #include <intrin.h>
+    #if defined(_WIN64)
+        #define RT_ATOMIC_INC(p) ((size_t)_InterlockedIncrement64((volatile __int64*)(p)))
+        #define RT_ATOMIC_DEC(p) ((size_t)_InterlockedDecrement64((volatile __int64*)(p)))
+    #else
+        #define RT_ATOMIC_INC(p) ((size_t)_InterlockedIncrement((volatile long*)(p)))
+        #define RT_ATOMIC_DEC(p) ((size_t)_InterlockedDecrement((volatile long*)(p)))
+    #endif
+    /* MSVC volatile accesses have acquire/release semantics */
+    #define RT_ATOMIC_LOAD(p) (*(const volatile size_t*)(p))
+    #define RT_ATOMIC_STORE(p, v) (*(volatile size_t*)(p) = (v))
+    #define RT_SPIN_LOCK(l) while (_InterlockedExchange((volatile long*)(l), 1)) {}
+    #define RT_SPIN_UNLOCK(l) _InterlockedExchange((volatile long*)(l), 0)
+#elif defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    #define RT_ATOMIC_INC(p) __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+    #define RT_ATOMIC_DEC(p) __atomic_sub_fetch((p), 1, __ATOMIC_ACQ_REL)
+    #define RT_ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define RT_ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define RT_SPIN_LOCK(l) while (__atomic_exchange_n((l), 1, __ATOMIC_ACQUIRE)) {}
+    #define RT_SPIN_UNLOCK(l) __atomic_store_n((l), 0, __ATOMIC_RELEASE)
+#else
+    #define RT_ATOMIC_INC(p) (++*(p))
+    #define RT_ATOMIC_DEC(p) (--*(p))
+    #define RT_ATOMIC_LOAD(p) (*(p))
+    #define RT_ATOMIC_STORE(p, v) (*(p) = (v))
+    #define RT_SPIN_LOCK(l) ((void)(l))
+    #define RT_SPIN_UNLOCK(l) ((void)(l))
+#endif
+
 /* Error handling configuration */
 #define RT_ERROR_BUFFER_SIZE 256
 
-/* BigInt configuration */
-#define RT_INT_BASE 1000000000u  /* 1e9 */
-#define RT_INT_BASE_DIGITS 9
+/*
+ * BigInt configuration. Limbs are binary so carries are native: 64-bit
+ * limbs where the compiler provides a 128-bit product type, 32-bit limbs
+ * otherwise. Build with -DRT_INT_LIMB_BITS=32 to force 32-bit limbs.
+ */
+#ifndef RT_INT_LIMB_BITS
+#if defined(__SIZEOF_INT128__)
+#define RT_INT_LIMB_BITS 64
+#else
+#define RT_INT_LIMB_BITS 32
+#endif
+#endif
+
+/* Largest power of ten that fits in a limb, the chunk size for decimal I/O */
+#if RT_INT_LIMB_BITS == 64
+#define RT_INT_DEC_BASE 10000000000000000000ull  /* 1e19 */
+#define RT_INT_DEC_DIGITS 19
+#else
+#define RT_INT_DEC_BASE 1000000000u  /* 1e9 */
+#define RT_INT_DEC_DIGITS 9
+#endif
+
 #define RT_INT_INITIAL_CAPACITY 4
 
+/*
+ * Multiplication algorithm thresholds, in limbs of the shorter operand.
+ * Below the Karatsuba threshold schoolbook multiplication is used; Toom-3
+ * takes over at the Toom-3 threshold. Squaring has its own pair because
+ * the schoolbook square is roughly twice as fast as a general multiply.
+ * Override with -D at build time to tune for a particular machine.
+ */
+#ifndef RT_INT_KARATSUBA_THRESHOLD
+#define RT_INT_KARATSUBA_THRESHOLD 32
+#endif
+#ifndef RT_INT_TOOM3_THRESHOLD
+#define RT_INT_TOOM3_THRESHOLD 160
+#endif
+#ifndef RT_INT_SQR_KARATSUBA_THRESHOLD
+#define RT_INT_SQR_KARATSUBA_THRESHOLD 48
+#endif
+#ifndef RT_INT_SQR_TOOM3_THRESHOLD
+#define RT_INT_SQR_TOOM3_THRESHOLD 200
+#endif
+
+/*
+ * Karatsuba and Toom-3 run their sub-products as parallel tasks on the
+ * thread pool (rt_pool.h) from RT_INT_PAR_THRESHOLD limbs of the shorter
+ * operand. Product trees (factorials, binomials) hand a half to the pool
+ * once its product reaches RT_INT_PAR_TREE_THRESHOLD limbs. Smaller work
+ * always takes the serial path.
+ */
+#ifndef RT_INT_PAR_THRESHOLD
+#define RT_INT_PAR_THRESHOLD 1024
+#endif
+#ifndef RT_INT_PAR_TREE_THRESHOLD
+#define RT_INT_PAR_TREE_THRESHOLD 256
+#endif
+
+/*
+ * Division switches from Knuth's Algorithm D to Burnikel-Ziegler recursive
+ * division once both the divisor and the quotient reach this many limbs.
+ */
+#ifndef RT_INT_DIV_BZ_THRESHOLD
+#define RT_INT_DIV_BZ_THRESHOLD 32
+#endif
+
+/*
+ * Decimal output and parsing use schoolbook conversion up to this many
+ * limbs and divide-and-conquer splitting by powers of ten above it.
+ */
+#ifndef RT_INT_DEC_DC_THRESHOLD
+#define RT_INT_DEC_DC_THRESHOLD 30
+#endif
+
 /* String configuration */
 #define RT_STR_INITIAL_CAPACITY 16
 
+/*
+ * Substring search filters candidates by the pattern's first and last byte
+ * up to this pattern length, and uses the Two-Way algorithm above it.
+ */
+#ifndef RT_STR_TWOWAY_THRESHOLD
+#define RT_STR_TWOWAY_THRESHOLD 32
+#endif
+
+/*
+ * Vector instruction sets the string kernels may use, as enabled by the
+ * compiler's target flags. Build with -DRT_NO_SIMD for the scalar code.
+ */
+#if !defined(RT_NO_SIMD)
+#if defined(__AVX2__)
+    #define RT_SIMD_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define RT_SIMD_SSE2 1
+#endif
+#if defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+    #define RT_SIMD_NEON 1
+#endif
+#endif
+
+/*
+ * Pooled allocator configuration. Blocks up to RT_MEM_MAX_BLOCK bytes are
+ * rounded up to power-of-two classes starting at RT_MEM_MIN_BLOCK, and each
+ * thread caches at most RT_MEM_CACHE_BLOCKS freed blocks per class. Larger
+ * blocks go straight to malloc. Build with -DRT_MEM_NO_POOL to bypass the
+ * pool entirely, e.g. under a leak checker.
+ */
+#ifndef RT_MEM_MIN_BLOCK
+#define RT_MEM_MIN_BLOCK 32
+#endif
+#ifndef RT_MEM_MAX_BLOCK
+#define RT_MEM_MAX_BLOCK 32768
+#endif
+#ifndef RT_MEM_CACHE_BLOCKS
+#define RT_MEM_CACHE_BLOCKS 64
+#endif
+
+/*
+ * Standard output is collected in a buffer of this many bytes before it
+ * reaches stdio; see rt_io.h.
+ */
+#ifndef RT_OUT_BUFFER_SIZE
+#define RT_OUT_BUFFER_SIZE 65536
+#endif
+
 #ifdef __cplusplus
 }
 #endif
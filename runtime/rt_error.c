@@ -4,37 +4,33 @@
 
 #include "rt_error.h"
 #include <stdio.h>
-#include <string.h>
 
-/* Global error state */
-rt_error_t rt_last_error = {
+/* Per-thread error state */
+RT_THREAD_LOCAL rt_error_t rt_last_error = {
     .code = RT_OK,
-    .message = {0},
+    .message = NULL,
     .file = NULL,
     .line = 0
 };
 
 void rt_error_set(rt_error_code_t code, const char* message, const char* file, int line) {
     rt_last_error.code = code;
+    rt_last_error.message = message;
     rt_last_error.file = file;
     rt_last_error.line = line;
-
-    if (message != NULL) {
-        strncpy(rt_last_error.message, message, RT_ERROR_BUFFER_SIZE - 1);
-        rt_last_error.message[RT_ERROR_BUFFER_SIZE - 1] = '\0';
-    } else {
-        strncpy(rt_last_error.message, rt_error_string(code), RT_ERROR_BUFFER_SIZE - 1);
-        rt_last_error.message[RT_ERROR_BUFFER_SIZE - 1] = '\0';
-    }
 }
 
 void rt_error_clear(void) {
     rt_last_error.code = RT_OK;
-    rt_last_error.message[0] = '\0';
+    rt_last_error.message = NULL;
     rt_last_error.file = NULL;
     rt_last_error.line = 0;
 }
 
+const rt_error_t* rt_error_last(void) {
+    return &rt_last_error;
+}
+
 const char* rt_error_string(rt_error_code_t code) {
     switch (code) {
         case RT_OK:
@@ -55,10 +51,27 @@ const char* rt_error_string(rt_error_code_t code) {
     }
 }
 
+/* Detail text of the current error, defaulting to the code's description */
+static const char* rt_error_message(void) {
+    if (rt_last_error.message != NULL) {
+        return rt_last_error.message;
+    }
+    return rt_error_string(rt_last_error.code);
+}
+
+int rt_error_format(char* buf, size_t size) {
+    const char* message = rt_error_message();
+    if (rt_last_error.file != NULL) {
+        return snprintf(buf, size, "%s (code %d) at %s:%d", message,
+                        rt_last_error.code, rt_last_error.file, rt_last_error.line);
+    }
+    return snprintf(buf, size, "%s (code %d)", message, rt_last_error.code);
+}
+
 void rt_error_print(void) {
     if (rt_last_error.code != RT_OK) {
         fprintf(stderr, "[pcc runtime error] %s (code %d)\n",
-                rt_last_error.message, rt_last_error.code);
+                rt_error_message(), rt_last_error.code);
         if (rt_last_error.file != NULL) {
             fprintf(stderr, "  at %s:%d\n", rt_last_error.file, rt_last_error.line);
         }
@@ -3,6 +3,10 @@
  *
  * Provides structured error handling with error codes, messages,
  * and graceful error recovery instead of abrupt termination.
+ *
+ * The error state is per-thread: an error raised on one thread is never
+ * seen, or cleared, by another. Raising an error only records where it
+ * came from; the message is built when the error is printed.
  */
 
 #pragma once
@@ -14,6 +18,7 @@ extern "C" {
 #endif
 
 #include <stddef.h>
+#include <assert.h>
 
 /* Error codes */
 typedef enum {
@@ -29,13 +34,13 @@ typedef enum {
 /* Error context structure */
 typedef struct {
     rt_error_code_t code;
-    char message[RT_ERROR_BUFFER_SIZE];
+    const char* message;          /* Static detail text, or NULL */
     const char* file;
     int line;
 } rt_error_t;
 
-/* Global error state (thread-local in multi-threaded environments) */
-extern rt_error_t rt_last_error;
+/* Last error raised on the calling thread */
+extern RT_THREAD_LOCAL rt_error_t rt_last_error;
 
 /* Error handling macros */
 #define RT_SET_ERROR(code, msg) rt_error_set(code, msg, __FILE__, __LINE__)
@@ -45,10 +50,11 @@ extern rt_error_t rt_last_error;
 /* Function prototypes */
 
 /**
- * Set an error with context information.
+ * Set an error with context information. Only the pointers are stored.
  *
  * @param code Error code
- * @param message Error message (can be NULL for default message)
+ * @param message Error detail in static storage, such as a string
+ *                literal (can be NULL for the default message)
  * @param file Source file where error occurred
  * @param line Line number where error occurred
  */
@@ -59,6 +65,15 @@ void rt_error_set(rt_error_code_t code, const char* message, const char* file, i
  */
 void rt_error_clear(void);
 
+/**
+ * Get the calling thread's last error. Code that cannot reach thread-local
+ * variables directly, such as a host loading the runtime as a DLL, uses
+ * this instead of rt_last_error.
+ *
+ * @return Error state of the calling thread
+ */
+const rt_error_t* rt_error_last(void);
+
 /**
  * Get a human-readable error message for an error code.
  *
@@ -67,6 +82,15 @@ void rt_error_clear(void);
  */
 const char* rt_error_string(rt_error_code_t code);
 
+/**
+ * Format the current error message into buf, truncating it to fit.
+ *
+ * @param buf Output buffer
+ * @param size Size of buf in bytes, e.g. RT_ERROR_BUFFER_SIZE
+ * @return Length of the full message, as snprintf() returns
+ */
+int rt_error_format(char* buf, size_t size);
+
 /**
  * Print the current error to stderr.
  */
@@ -79,25 +103,47 @@ void rt_error_print(void);
  */
 #define RT_CHECK(expr) do { \
     rt_error_code_t _rt_err = (expr); \
-    if (_rt_err != RT_OK) { \
+    if (RT_UNLIKELY(_rt_err != RT_OK)) { \
         rt_error_print(); \
         return _rt_err; \
     } \
 } while(0)
 
 /**
- * Check if pointer is non-NULL, set error and return if NULL.
+ * Check if an argument pointer is non-NULL, set error and return if NULL.
+ *
+ * Release builds (-DRT_RELEASE, as `pcc build --release` compiles) reduce
+ * this to a debug assertion: generated code never passes NULL, and the
+ * asserts vanish entirely under -DNDEBUG.
  *
  * @param ptr Pointer to check
  * @param name Name of the pointer (for error message)
  */
+#ifdef RT_RELEASE
+#define RT_CHECK_NULL(ptr, name) assert((ptr) != NULL && name)
+#else
 #define RT_CHECK_NULL(ptr, name) do { \
-    if ((ptr) == NULL) { \
+    if (RT_UNLIKELY((ptr) == NULL)) { \
         RT_SET_ERROR(RT_ERROR_INVALID, name " is NULL"); \
         rt_error_print(); \
         return RT_ERROR_INVALID; \
     } \
 } while(0)
+#endif
+
+/**
+ * Check the result of an allocation, set error and return if NULL.
+ * Active in every build profile.
+ *
+ * @param ptr Pointer returned by the allocator
+ * @param what What was being allocated (for error message)
+ */
+#define RT_CHECK_ALLOC(ptr, what) do { \
+    if (RT_UNLIKELY((ptr) == NULL)) { \
+        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate " what); \
+        return RT_ERROR_NOMEM; \
+    } \
+} while(0)
 
 #ifdef __cplusplus
 }
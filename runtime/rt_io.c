@@ -0,0 +1,157 @@
+/*
+ * Buffered standard output implementation for pcc runtime.
+ *
+ * One static buffer collects everything written to stdout through the
+ * runtime. The first write decides the flush mode and registers the exit
+ * flush; every write after that is a lock, a copy and an unlock until the
+ * buffer fills. Draining hands the whole buffer to fwrite() and fflush(),
+ * so stdio's own buffer only ever sees full chunks.
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "rt_io.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef RT_PLATFORM_WINDOWS
+    #include <io.h>
+    #define rt_out_isatty() _isatty(_fileno(stdout))
+#else
+    #include <unistd.h>
+    #define rt_out_isatty() isatty(fileno(stdout))
+#endif
+
+/* Short numbers and lines are formatted in place, so they must fit */
+#if RT_OUT_BUFFER_SIZE < 4096
+#error "RT_OUT_BUFFER_SIZE must be at least 4096 bytes"
+#endif
+
+const char rt_dec_pairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static char rt_out_buf[RT_OUT_BUFFER_SIZE];
+static size_t rt_out_len;
+static rt_out_mode rt_out_current;
+static rt_error_code_t rt_out_failed;  /* Error of a drain made for a reservation */
+static int rt_out_started;
+static int rt_out_lock;
+
+/* ==================== Draining ==================== */
+
+/* Hand the buffer to stdio and flush it; the caller holds the lock */
+static rt_error_code_t rt_out_drain(void) {
+    rt_error_code_t err = RT_OK;
+    if (rt_out_len > 0 && fwrite(rt_out_buf, 1, rt_out_len, stdout) != rt_out_len) {
+        err = RT_ERROR_IO;
+    }
+    rt_out_len = 0;
+    if (fflush(stdout) != 0) {
+        err = RT_ERROR_IO;
+    }
+    return err;
+}
+
+static void rt_out_flush_at_exit(void) {
+    rt_out_flush();
+}
+
+/* Pick the mode and register the exit flush, once; the caller holds the lock */
+static void rt_out_start(void) {
+    const char* mode = getenv("PCC_STDOUT");
+    if (mode && strcmp(mode, "line") == 0) {
+        rt_out_current = RT_OUT_LINE;
+    } else if (mode && strcmp(mode, "full") == 0) {
+        rt_out_current = RT_OUT_FULL;
+    } else {
+        rt_out_current = rt_out_isatty() ? RT_OUT_LINE : RT_OUT_FULL;
+    }
+    atexit(rt_out_flush_at_exit);
+    rt_out_started = 1;
+}
+
+/* Lock the buffer, starting it on first use */
+static void rt_out_acquire(void) {
+    RT_SPIN_LOCK(&rt_out_lock);
+    if (RT_UNLIKELY(!rt_out_started)) rt_out_start();
+}
+
+/* ==================== Output Buffer ==================== */
+
+void rt_out_set_mode(rt_out_mode mode) {
+    rt_out_acquire();
+    rt_out_drain();
+    rt_out_current = mode;
+    RT_SPIN_UNLOCK(&rt_out_lock);
+}
+
+rt_error_code_t rt_out_write(const char* p, size_t n) {
+    rt_error_code_t err = RT_OK;
+    rt_out_acquire();
+
+    if (n > RT_OUT_BUFFER_SIZE - rt_out_len) {
+        err = rt_out_drain();
+        if (n > RT_OUT_BUFFER_SIZE) {
+            /* Too long to buffer: write it through */
+            if (fwrite(p, 1, n, stdout) != n || fflush(stdout) != 0) err = RT_ERROR_IO;
+            goto cleanup;
+        }
+    }
+    memcpy(rt_out_buf + rt_out_len, p, n);
+    rt_out_len += n;
+    if (rt_out_current == RT_OUT_LINE && memchr(p, '\n', n) != NULL) {
+        rt_error_code_t drained = rt_out_drain();
+        if (err == RT_OK) err = drained;
+    }
+
+cleanup:
+    RT_SPIN_UNLOCK(&rt_out_lock);
+    if (err != RT_OK) RT_SET_ERROR(err, "Failed to write to standard output");
+    return err;
+}
+
+char* rt_out_reserve(size_t n) {
+    if (n > RT_OUT_BUFFER_SIZE) return NULL;
+
+    rt_out_acquire();
+    if (n > RT_OUT_BUFFER_SIZE - rt_out_len) {
+        rt_out_failed = rt_out_drain();
+    }
+    return rt_out_buf + rt_out_len;
+}
+
+rt_error_code_t rt_out_commit(char* end) {
+    char* start = rt_out_buf + rt_out_len;
+    rt_error_code_t err = rt_out_failed;
+    rt_out_failed = RT_OK;
+
+    rt_out_len = (size_t)(end - rt_out_buf);
+    if (rt_out_current == RT_OUT_LINE && memchr(start, '\n', (size_t)(end - start)) != NULL) {
+        rt_error_code_t drained = rt_out_drain();
+        if (err == RT_OK) err = drained;
+    }
+    RT_SPIN_UNLOCK(&rt_out_lock);
+
+    if (err != RT_OK) RT_SET_ERROR(err, "Failed to write to standard output");
+    return err;
+}
+
+rt_error_code_t rt_out_flush(void) {
+    rt_out_acquire();
+    rt_error_code_t err = rt_out_drain();
+    RT_SPIN_UNLOCK(&rt_out_lock);
+
+    if (err != RT_OK) RT_SET_ERROR(err, "Failed to flush standard output");
+    return err;
+}
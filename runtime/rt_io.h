@@ -0,0 +1,142 @@
+/*
+ * Buffered standard output for pcc runtime.
+ *
+ * rt_print_* and writes to stdout through rt_int_fprint()/rt_str_fprint()
+ * collect in one RT_OUT_BUFFER_SIZE buffer, with numbers formatted
+ * directly into it, and reach stdio a buffer at a time. The buffer is
+ * flushed when it fills, by rt_out_flush(), and at exit.
+ *
+ * Output is line-buffered when stdout is a terminal and fully buffered
+ * otherwise; PCC_STDOUT=line or PCC_STDOUT=full overrides the choice at
+ * run time, and rt_out_set_mode() from code.
+ *
+ * The buffer is shared by all threads under a spin lock, so lines printed
+ * by different threads never interleave within a line and keep the order
+ * they were printed in.
+ */
+
+#pragma once
+
+#include "rt_config.h"
+#include "rt_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ==================== Output Buffer ==================== */
+
+typedef enum {
+    RT_OUT_FULL,            /* Flush when full, on rt_out_flush() and at exit */
+    RT_OUT_LINE             /* Also flush after every write with a newline */
+} rt_out_mode;
+
+/**
+ * Select when the output buffer is flushed, flushing what it holds.
+ *
+ * @param mode RT_OUT_FULL or RT_OUT_LINE
+ */
+void rt_out_set_mode(rt_out_mode mode);
+
+/**
+ * Append bytes to the output buffer; writes longer than the buffer go
+ * straight to stdout after what it holds.
+ *
+ * @param p Bytes to write
+ * @param n Number of bytes
+ * @return RT_OK on success, RT_ERROR_IO if flushing failed
+ */
+rt_error_code_t rt_out_write(const char* p, size_t n);
+
+/**
+ * Reserve n bytes at the end of the output buffer to format into, holding
+ * the buffer until rt_out_commit(). Returns NULL, holding nothing, when n
+ * exceeds the buffer; use rt_out_write() then.
+ *
+ * @param n Bytes to reserve
+ * @return Start of the reserved bytes, or NULL
+ */
+char* rt_out_reserve(size_t n);
+
+/**
+ * Keep the bytes written into a reservation and release the buffer.
+ *
+ * @param end One past the last byte written, at most the reservation's end
+ * @return RT_OK on success, RT_ERROR_IO if flushing failed
+ */
+rt_error_code_t rt_out_commit(char* end);
+
+/**
+ * Write everything buffered to stdout and flush stdout.
+ *
+ * @return RT_OK on success, RT_ERROR_IO if writing failed
+ */
+rt_error_code_t rt_out_flush(void);
+
+/* ==================== Number Formatting ==================== */
+
+/* "00" through "99", for formatting two digits per division */
+extern const char rt_dec_pairs[200];
+
+/**
+ * Write the width low decimal digits of v, with leading zeros, at out.
+ *
+ * @param out Destination of width bytes
+ * @param v Value
+ * @param width Number of digits
+ */
+static inline void rt_fmt_digits(char* out, uint64_t v, size_t width) {
+    char* p = out + width;
+    while (p - out >= 2) {
+        p -= 2;
+        memcpy(p, rt_dec_pairs + 2 * (v % 100), 2);
+        v /= 100;
+    }
+    if (p > out) *--p = (char)('0' + v % 10);
+}
+
+/**
+ * Write the decimal digits of v so that they end at end, without a
+ * terminator.
+ *
+ * @param end One past the last digit; 20 bytes before it must be writable
+ * @param v Value
+ * @return Start of the digits
+ */
+static inline char* rt_fmt_u64(char* end, uint64_t v) {
+    char* p = end;
+    while (v >= 100) {
+        p -= 2;
+        memcpy(p, rt_dec_pairs + 2 * (v % 100), 2);
+        v /= 100;
+    }
+    if (v >= 10) {
+        p -= 2;
+        memcpy(p, rt_dec_pairs + 2 * v, 2);
+    } else {
+        *--p = (char)('0' + v);
+    }
+    return p;
+}
+
+/**
+ * Write the decimal form of v, with a minus sign if negative, so that it
+ * ends at end, without a terminator.
+ *
+ * @param end One past the last digit; 20 bytes before it must be writable
+ * @param v Value
+ * @return Start of the text
+ */
+static inline char* rt_fmt_si(char* end, int64_t v) {
+    char* p = rt_fmt_u64(end, (v < 0) ? 0 - (uint64_t)v : (uint64_t)v);
+    if (v < 0) *--p = '-';
+    return p;
+}
+
+#ifdef __cplusplus
+}
+#endif
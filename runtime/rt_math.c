@@ -3,6 +3,9 @@
  */
 
 #include "rt_math.h"
+#include "rt_bigint_internal.h"
+#include "rt_alloc.h"
+#include "rt_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
@@ -75,25 +78,57 @@ int64_t rt_math_sqrt_si(int64_t x) {
         return x;
     }
     
-    /* Binary search for integer square root */
-    int64_t low = 1, high = x;
-    int64_t result = 0;
+    /* Newton from a power of two above the root decreases monotonically */
+    uint64_t n = (uint64_t)x;
+    unsigned bits = 0;
+    for (unsigned sh = 32; sh > 0; sh >>= 1) {
+        if (n >> (bits + sh)) bits += sh;
+    }
+    uint64_t r = (uint64_t)1 << (bits / 2 + 1);
+    for (;;) {
+        uint64_t y = (r + n / r) >> 1;
+        if (y >= r) break;
+        r = y;
+    }
     
-    while (low <= high) {
-        int64_t mid = low + (high - low) / 2;
-        int64_t div = x / mid;
-        
-        if (div == mid) {
-            return mid;  /* Exact square root */
-        } else if (div > mid) {
-            low = mid + 1;
-            result = mid;  /* Floor candidate */
-        } else {
-            high = mid - 1;
-        }
+    return (int64_t)r;
+}
+
+static uint64_t rt_math_mulmod_u64(uint64_t a, uint64_t b, uint64_t m) {
+#if RT_INT_LIMB_BITS == 64
+    return (uint64_t)(((rt_dlimb_t)a * b) % m);
+#else
+    /* No 128-bit type: double-and-add, keeping every sum below 2m */
+    uint64_t r = 0;
+    a %= m;
+    while (b) {
+        if (b & 1) r = (r >= m - a) ? r - (m - a) : r + a;
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return r;
+#endif
+}
+
+int64_t rt_math_powmod_si(int64_t base, int64_t exp, int64_t mod) {
+    if (mod == 0 || exp < 0) {
+        return 0;  /* Invalid: zero modulus or negative exponent */
     }
     
-    return result;
+    uint64_t m = mod > 0 ? (uint64_t)mod : 0 - (uint64_t)mod;
+    uint64_t b = (base >= 0) ? (uint64_t)base % m : (m - (0 - (uint64_t)base) % m) % m;
+    uint64_t r = 1 % m;
+    
+    for (uint64_t e = (uint64_t)exp; e > 0; e >>= 1) {
+        if (e & 1) r = rt_math_mulmod_u64(r, b, m);
+        b = rt_math_mulmod_u64(b, b, m);
+    }
+    
+    /* Python semantics: the result takes the sign of the modulus */
+    if (mod < 0 && r != 0) {
+        return (int64_t)(r - m);
+    }
+    return (int64_t)r;
 }
 
 int64_t rt_math_gcd_si(int64_t a, int64_t b) {
@@ -174,6 +209,7 @@ rt_error_code_t rt_math_max(rt_int* out, const rt_int* a, const rt_int* b) {
 rt_error_code_t rt_math_pow(rt_int* out, const rt_int* base, int64_t exp) {
     RT_CHECK_NULL(out, "out");
     RT_CHECK_NULL(base, "base");
+    RT_PROF_SCOPE(RT_PROF_MATH_POW);
     
     if (exp < 0) {
         RT_SET_ERROR(RT_ERROR_INVALID, "Negative exponent not supported");
@@ -190,11 +226,10 @@ rt_error_code_t rt_math_pow(rt_int* out, const rt_int* base, int64_t exp) {
         return RT_OK;
     }
     
-    /* Fast exponentiation by squaring */
-    rt_int result, b, temp;
+    /* Fast exponentiation by squaring, updating result and b in place */
+    rt_int result, b;
     rt_int_init(&result);
     rt_int_init(&b);
-    rt_int_init(&temp);
     
     rt_int_set_si(&result, 1);
     rt_error_code_t err = rt_int_copy(&b, base);
@@ -206,24 +241,21 @@ rt_error_code_t rt_math_pow(rt_int* out, const rt_int* base, int64_t exp) {
     
     while (e > 0) {
         if (e & 1) {
-            err = rt_int_mul(&temp, &result, &b);
+            err = rt_int_mul(&result, &result, &b);
             if (err != RT_OK) goto cleanup;
-            rt_int_copy(&result, &temp);
         }
         e >>= 1;
         if (e > 0) {
-            err = rt_int_mul(&temp, &b, &b);
+            err = rt_int_sqr(&b, &b);
             if (err != RT_OK) goto cleanup;
-            rt_int_copy(&b, &temp);
         }
     }
     
-    err = rt_int_copy(out, &result);
+    rt_int_swap(out, &result);
     
 cleanup:
     rt_int_clear(&result);
     rt_int_clear(&b);
-    rt_int_clear(&temp);
     
     return err;
 }
@@ -231,121 +263,470 @@ cleanup:
 rt_error_code_t rt_math_sqrt(rt_int* out, const rt_int* x) {
     RT_CHECK_NULL(out, "out");
     RT_CHECK_NULL(x, "x");
+    RT_PROF_SCOPE(RT_PROF_MATH_SQRT);
     
     if (x->sign < 0) {
         RT_SET_ERROR(RT_ERROR_INVALID, "Cannot compute square root of negative number");
         return RT_ERROR_INVALID;
     }
     
-    if (rt_int_is_zero(x)) {
-        rt_int_set_si(out, 0);
+    size_t bits = rt_int_bit_length(x);
+    if (bits < 64) {
+        int64_t v;
+        rt_int_to_si_checked(x, &v);
+        return rt_int_set_si(out, rt_math_sqrt_si(v));
+    }
+    
+    /*
+     * Newton iteration with doubling precision: a approximates
+     * sqrt(x >> (2c - 2d)) to d + 1 bits, and each step doubles d using
+     * one division of that size, so the total cost is a constant number
+     * of full-size divisions.
+     */
+    size_t c = (bits - 1) / 2;
+    size_t d = 0;
+    int top = 0;
+    while ((c >> (top + 1)) > 0) top++;
+    
+    rt_int a, t;
+    rt_int_init(&a);
+    rt_int_init(&t);
+    
+    rt_error_code_t err = rt_int_set_si(&a, 1);
+    for (int s = top; err == RT_OK && s >= 0; s--) {
+        size_t e = d;
+        d = c >> s;
+        /* a = (a << (d - e - 1)) + (x >> (2c - e - d + 1)) // a */
+        err = rt_int_shr(&t, x, 2 * c - e - d + 1);
+        if (err == RT_OK) err = rt_int_floordiv(&t, &t, &a);
+        if (err == RT_OK) err = rt_int_shl(&a, &a, d - e - 1);
+        if (err == RT_OK) err = rt_int_add(&a, &a, &t);
+    }
+    
+    /* The estimate is exact or one too large */
+    if (err == RT_OK) err = rt_int_sqr(&t, &a);
+    if (err == RT_OK && rt_int_cmp(&t, x) > 0) err = rt_int_sub_si(&a, &a, 1);
+    if (err == RT_OK) rt_int_swap(out, &a);
+    
+    rt_int_clear(&a);
+    rt_int_clear(&t);
+    return err;
+}
+
+/*
+ * Modular exponentiation works on fixed-size residues of n limbs (the
+ * size of the modulus). Odd moduli use Montgomery multiplication, others
+ * Barrett reduction; both reduce each product with multiplications only,
+ * so the full power is never formed. Exponent bits are consumed by a
+ * left-to-right sliding window over a table of odd powers.
+ */
+
+/* Reduction context for residues modulo m */
+typedef struct {
+    const rt_limb_t* m;  /* modulus, n limbs, top limb non-zero */
+    size_t n;
+    int mont;            /* Montgomery (odd m) rather than Barrett */
+    rt_limb_t minv;      /* -m^-1 mod 2^RT_INT_LIMB_BITS (Montgomery) */
+    rt_limb_t* mu;       /* floor(B^(2n) / m), n + 2 limbs (Barrett) */
+    rt_limb_t* t;        /* product scratch, 2n + 2 limbs */
+    rt_limb_t* u;        /* Barrett quotient scratch, 2n + 3 limbs */
+    rt_limb_t* w;        /* Barrett remainder scratch, 2n + 2 limbs */
+} rt_modctx;
+
+/* r = t[n .. 2n] reduced below m, where t[n .. 2n] < 2m */
+static void rt_mod_final_sub(const rt_modctx* c, rt_limb_t* r, const rt_limb_t* hi, rt_limb_t top) {
+    if (top || rt_limbs_cmp(hi, c->n, c->m, c->n) >= 0) {
+        rt_limbs_sub(r, hi, c->n, c->m, c->n);
+    } else if (r != hi) {
+        memcpy(r, hi, c->n * sizeof(rt_limb_t));
+    }
+}
+
+/* Montgomery reduction: r = t * B^-n mod m for t = c->t (2n + 1 limbs) */
+static void rt_mod_redc(const rt_modctx* c, rt_limb_t* r) {
+    size_t n = c->n;
+    rt_limb_t* t = c->t;
+    for (size_t i = 0; i < n; i++) {
+        rt_limb_t q = t[i] * c->minv;
+        rt_limb_t carry = rt_limbs_addmul_1(t + i, c->m, n, q);
+        rt_limbs_add(t + i + n, t + i + n, n + 1 - i, &carry, 1);
+    }
+    rt_mod_final_sub(c, r, t + n, t[2 * n]);
+}
+
+/* Barrett reduction: r = t mod m for t = c->t < m^2 (2n limbs) */
+static rt_error_code_t rt_mod_barrett(const rt_modctx* c, rt_limb_t* r) {
+    size_t n = c->n;
+    rt_limb_t* t = c->t;
+
+    /* q = ((t >> (n - 1) limbs) * mu) >> (n + 1) limbs underestimates t / m by at most 2 */
+    rt_error_code_t err = rt_limbs_mul(c->u, t + (n - 1), n + 1, c->mu, n + 2);
+    if (err != RT_OK) return err;
+    err = rt_limbs_mul(c->w, c->u + (n + 1), n + 2, c->m, n);
+    if (err != RT_OK) return err;
+
+    /* t - q * m < 3m fits in n + 1 limbs: compute it modulo B^(n + 1) */
+    rt_limbs_sub(t, t, n + 1, c->w, n + 1);
+    while (t[n] || rt_limbs_cmp(t, n, c->m, n) >= 0) {
+        t[n] -= rt_limbs_sub(t, t, n, c->m, n);
+    }
+    memcpy(r, t, n * sizeof(rt_limb_t));
+    return RT_OK;
+}
+
+/* r = a * b mod m (in the context's representation); r may alias a or b */
+static rt_error_code_t rt_mod_mul(const rt_modctx* c, rt_limb_t* r, const rt_limb_t* a, const rt_limb_t* b) {
+    size_t n = c->n;
+    rt_error_code_t err = (a == b) ? rt_limbs_sqr(c->t, a, n) : rt_limbs_mul(c->t, a, n, b, n);
+    if (err != RT_OK) return err;
+
+    c->t[2 * n] = 0;
+    c->t[2 * n + 1] = 0;
+    if (c->mont) {
+        rt_mod_redc(c, r);
         return RT_OK;
     }
-    
-    /* Binary search for integer square root */
-    rt_int low, high, mid, temp, div_result;
-    rt_int_init(&low);
-    rt_int_init(&high);
-    rt_int_init(&mid);
-    rt_int_init(&temp);
-    rt_int_init(&div_result);
-    
-    rt_int_set_si(&low, 1);
-    rt_error_code_t err = rt_int_copy(&high, x);
-    if (err != RT_OK) goto cleanup_sqrt;
-    
-    rt_int result;
-    rt_int_init(&result);
-    rt_int_set_si(&result, 0);
-    
-    while (rt_int_cmp(&low, &high) <= 0) {
-        /* mid = low + (high - low) / 2 */
-        err = rt_int_sub(&temp, &high, &low);
-        if (err != RT_OK) goto cleanup_sqrt;
-        
-        rt_int floordiv_result;
-        rt_int_init(&floordiv_result);
-        rt_int_set_si(&floordiv_result, 2);
-        err = rt_int_floordiv(&mid, &temp, &floordiv_result);
-        rt_int_clear(&floordiv_result);
-        if (err != RT_OK) goto cleanup_sqrt;
-        
-        err = rt_int_add(&temp, &low, &mid);
-        if (err != RT_OK) goto cleanup_sqrt;
-        rt_int_copy(&mid, &temp);
-        
-        /* div = x / mid */
-        err = rt_int_floordiv(&div_result, x, &mid);
-        if (err != RT_OK) goto cleanup_sqrt;
-        
-        int cmp_div = rt_int_cmp(&div_result, &mid);
-        
-        if (cmp_div == 0) {
-            /* Exact square root */
-            rt_int_copy(out, &mid);
-            goto cleanup_sqrt;
-        } else if (cmp_div > 0) {
-            /* mid is too small */
-            err = rt_int_add(&temp, &mid, &low);
-            if (err != RT_OK) goto cleanup_sqrt;
-            rt_int_copy(&low, &temp);
-            rt_int_copy(&result, &mid);  /* Floor candidate */
+    return rt_mod_barrett(c, r);
+}
+
+/* Copy |x| < m into an n-limb residue */
+static void rt_mod_load(rt_limb_t* r, const rt_int* x, size_t n) {
+    memcpy(r, x->digits, x->len * sizeof(rt_limb_t));
+    memset(r + x->len, 0, (n - x->len) * sizeof(rt_limb_t));
+}
+
+/* Sliding window width for an exponent of the given bit length */
+static unsigned rt_mod_window(size_t bits) {
+    if (bits <= 7) return 1;
+    if (bits <= 36) return 3;
+    if (bits <= 140) return 4;
+    if (bits <= 450) return 5;
+    return 6;
+}
+
+/* Bit i of |x| */
+static int rt_int_bit(const rt_int* x, size_t i) {
+    return (int)((x->digits[i / RT_INT_LIMB_BITS] >> (i % RT_INT_LIMB_BITS)) & 1);
+}
+
+/* out = b^e mod m, with 0 < b < m, e > 0 and m > 1; out must not alias */
+static rt_error_code_t rt_math_powmod_abs(rt_int* out, const rt_int* b, const rt_int* e, const rt_int* m) {
+    size_t n = m->len;
+    size_t bits = rt_int_bit_length(e);
+    unsigned win = rt_mod_window(bits);
+    size_t tsize = (size_t)1 << (win - 1);
+
+    /* Odd powers b^1, b^3, ..., the accumulator, then the scratch areas */
+    size_t total = (tsize + 1) * n + (2 * n + 2) + (2 * n + 3) + (2 * n + 2) + (n + 2);
+    size_t bytes = total * sizeof(rt_limb_t);
+    rt_limb_t* block = (rt_limb_t*)rt_mem_alloc(bytes);
+    if (block == NULL) {
+        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate modular exponentiation buffers");
+        return RT_ERROR_NOMEM;
+    }
+
+    rt_limb_t* table = block;
+    rt_limb_t* acc = table + tsize * n;
+    rt_modctx c;
+    c.m = m->digits;
+    c.n = n;
+    c.mont = (int)(m->digits[0] & 1);
+    c.minv = 0;
+    c.t = acc + n;
+    c.u = c.t + (2 * n + 2);
+    c.w = c.u + (2 * n + 3);
+    c.mu = c.w + (2 * n + 2);
+
+    rt_int x, q;
+    rt_int_init(&x);
+    rt_int_init(&q);
+    rt_error_code_t err = RT_OK;
+
+    if (c.mont) {
+        /* Newton iteration for m^-1 mod B; m * m == 1 mod 8 seeds 3 bits */
+        rt_limb_t inv = m->digits[0];
+        for (int i = 0; i < 6; i++) {
+            inv *= 2 - m->digits[0] * inv;
+        }
+        c.minv = (rt_limb_t)0 - inv;
+
+        /* Montgomery form of b: b * B^n mod m */
+        err = rt_int_shl(&x, b, n * RT_INT_LIMB_BITS);
+        if (err == RT_OK) err = rt_int_divrem_abs(NULL, &q, &x, m);
+    } else {
+        err = rt_int_set_si(&x, 1);
+        if (err == RT_OK) err = rt_int_shl(&x, &x, 2 * n * RT_INT_LIMB_BITS);
+        if (err == RT_OK) err = rt_int_divrem_abs(&q, NULL, &x, m);
+        if (err == RT_OK) {
+            rt_mod_load(c.mu, &q, n + 2);
+            err = rt_int_copy(&q, b);
+        }
+    }
+    if (err != RT_OK) goto cleanup_powmod;
+    rt_mod_load(table, &q, n);
+
+    /* table[i] = b^(2i + 1), built with b^2 in acc */
+    if (tsize > 1) {
+        err = rt_mod_mul(&c, acc, table, table);
+        for (size_t i = 1; err == RT_OK && i < tsize; i++) {
+            err = rt_mod_mul(&c, table + i * n, table + (i - 1) * n, acc);
+        }
+        if (err != RT_OK) goto cleanup_powmod;
+    }
+
+    /* Left to right: square per bit, multiply by each window's odd power */
+    int started = 0;
+    size_t i = bits;
+    while (err == RT_OK && i > 0) {
+        if (!rt_int_bit(e, i - 1)) {
+            err = rt_mod_mul(&c, acc, acc, acc);
+            i--;
+            continue;
+        }
+
+        /* Window [j, i): the longest with an odd value, at most win bits */
+        size_t j = (i > win) ? i - win : 0;
+        while (!rt_int_bit(e, j)) j++;
+        size_t value = 0;
+        for (size_t k = i; k > j; k--) {
+            value = (value << 1) | (size_t)rt_int_bit(e, k - 1);
+        }
+
+        if (started) {
+            for (size_t k = j; err == RT_OK && k < i; k++) {
+                err = rt_mod_mul(&c, acc, acc, acc);
+            }
+            if (err == RT_OK) err = rt_mod_mul(&c, acc, acc, table + (value / 2) * n);
         } else {
-            /* mid is too large */
-            err = rt_int_sub(&temp, &mid, &high);
-            if (err != RT_OK) goto cleanup_sqrt;
-            rt_int_copy(&high, &temp);
+            memcpy(acc, table + (value / 2) * n, n * sizeof(rt_limb_t));
+            started = 1;
         }
+        i = j;
+    }
+    if (err != RT_OK) goto cleanup_powmod;
+
+    /* Leave Montgomery form: REDC(acc) = acc * B^-n */
+    if (c.mont) {
+        memcpy(c.t, acc, n * sizeof(rt_limb_t));
+        memset(c.t + n, 0, (n + 2) * sizeof(rt_limb_t));
+        rt_mod_redc(&c, acc);
+    }
+
+    err = rt_int_ensure_cap(out, n);
+    if (err == RT_OK) {
+        memcpy(out->digits, acc, n * sizeof(rt_limb_t));
+        out->len = n;
+        out->sign = 1;
+        rt_int_normalize(out);
+    }
+
+cleanup_powmod:
+    rt_int_clear(&x);
+    rt_int_clear(&q);
+    rt_mem_free(block, bytes);
+    return err;
+}
+
+rt_error_code_t rt_math_powmod(rt_int* out, const rt_int* base, const rt_int* exp, const rt_int* mod) {
+    RT_CHECK_NULL(out, "out");
+    RT_CHECK_NULL(base, "base");
+    RT_CHECK_NULL(exp, "exp");
+    RT_CHECK_NULL(mod, "mod");
+    RT_PROF_SCOPE(RT_PROF_MATH_POWMOD);
+    
+    if (mod->sign == 0 || mod->len == 0) {
+        RT_SET_ERROR(RT_ERROR_INVALID, "pow() modulus must not be zero");
+        return RT_ERROR_INVALID;
+    }
+    if (exp->sign < 0) {
+        RT_SET_ERROR(RT_ERROR_INVALID, "pow() with a modulus needs a non-negative exponent");
+        return RT_ERROR_INVALID;
     }
     
-    err = rt_int_copy(out, &result);
-    rt_int_clear(&result);
+    /* Work with |mod| and reduce base into [0, |mod|) */
+    rt_int m = rt_limbs_view(mod->digits, mod->len);
+    rt_int b, r;
+    rt_int_init(&b);
+    rt_int_init(&r);
+    
+    rt_error_code_t err = rt_int_divrem_abs(NULL, &b, base, &m);
+    if (err == RT_OK && base->sign < 0 && b.len) err = rt_int_sub(&b, &m, &b);
+    if (err != RT_OK) goto cleanup_pm;
+    
+    if (m.len == 1 && m.digits[0] == 1) {
+        err = rt_int_set_si(&r, 0);
+    } else if (exp->len == 0) {
+        err = rt_int_set_si(&r, 1);
+    } else if (b.len == 0) {
+        err = rt_int_set_si(&r, 0);
+    } else {
+        err = rt_math_powmod_abs(&r, &b, exp, &m);
+    }
     
-cleanup_sqrt:
-    rt_int_clear(&low);
-    rt_int_clear(&high);
-    rt_int_clear(&mid);
-    rt_int_clear(&temp);
-    rt_int_clear(&div_result);
+    /* Python semantics: the result takes the sign of the modulus */
+    if (err == RT_OK && mod->sign < 0 && r.len) err = rt_int_sub(&r, &r, &m);
+    if (err == RT_OK) rt_int_swap(out, &r);
     
+cleanup_pm:
+    rt_int_clear(&b);
+    rt_int_clear(&r);
+    return err;
+}
+
+/*
+ * Products of integer sequences are formed by binary splitting: the sequence
+ * is halved recursively and the halves multiplied, so the large final
+ * multiplications are balanced and reach the Karatsuba/Toom-3 ranges instead
+ * of growing one word at a time. Leaves pack consecutive terms into one
+ * machine word before touching the BigInt. Factors of two are counted and
+ * applied as a single shift at the end.
+ */
+
+/* Terms per leaf of the product tree */
+#define RT_MATH_PROD_LEAF 32
+
+static rt_error_code_t rt_math_prod_seq(rt_int* out, uint64_t first, uint64_t step, uint64_t count);
+
+/* A subtree of the product, run as a pool task */
+typedef struct {
+    rt_int* out;
+    uint64_t first;
+    uint64_t step;
+    uint64_t count;
+} rt_math_prod_job;
+
+static rt_error_code_t rt_math_prod_job_run(void* arg) {
+    rt_math_prod_job* job = (rt_math_prod_job*)arg;
+    return rt_math_prod_seq(job->out, job->first, job->step, job->count);
+}
+
+/* Upper bound on the limbs of a product of count terms up to last */
+static size_t rt_math_prod_limbs(uint64_t last, uint64_t count) {
+    unsigned bits = 0;
+    while (last) {
+        bits++;
+        last >>= 1;
+    }
+    return (size_t)(count * bits / RT_INT_LIMB_BITS + 1);
+}
+
+/*
+ * out = prod(first + i * step for i in [0, count)), every term at least 1
+ * and at most 2^63 (the caller guarantees no overflow).
+ */
+static rt_error_code_t rt_math_prod_seq(rt_int* out, uint64_t first, uint64_t step, uint64_t count) {
+    rt_error_code_t err;
+
+    if (count <= RT_MATH_PROD_LEAF) {
+        err = rt_int_set_si(out, 1);
+        uint64_t acc = 1;
+        for (uint64_t i = 0; err == RT_OK && i < count; i++) {
+            uint64_t v = first + i * step;
+            if (v > (uint64_t)INT64_MAX) {
+                /* Only 2^63 itself: apply it as 2^62 * 2 */
+                err = rt_int_mul_si(out, out, (int64_t)(v >> 1));
+                v = 2;
+            }
+            if (err == RT_OK && acc > (uint64_t)INT64_MAX / v) {
+                err = rt_int_mul_si(out, out, (int64_t)acc);
+                acc = 1;
+            }
+            acc *= v;
+        }
+        if (err == RT_OK) err = rt_int_mul_si(out, out, (int64_t)acc);
+        return err;
+    }
+
+    uint64_t half = count / 2;
+    rt_int t;
+    rt_int_init(&t);
+
+    uint64_t last = first + (count - 1) * step;
+    if (rt_pool_should_split(rt_math_prod_limbs(last, count - half), RT_INT_PAR_TREE_THRESHOLD)) {
+        /* The upper half may run on another thread meanwhile */
+        rt_math_prod_job upper = { &t, first + half * step, step, count - half };
+        rt_task task;
+        rt_task_spawn(&task, rt_math_prod_job_run, &upper);
+        err = rt_math_prod_seq(out, first, step, half);
+        rt_error_code_t upper_err = rt_task_join(&task);
+        if (err == RT_OK) err = upper_err;
+    } else {
+        err = rt_math_prod_seq(out, first, step, half);
+        if (err == RT_OK) err = rt_math_prod_seq(&t, first + half * step, step, count - half);
+    }
+    if (err == RT_OK) err = rt_int_mul(out, out, &t);
+
+    rt_int_clear(&t);
+    return err;
+}
+
+/* out *= product of the odd numbers in [lo, hi] (1 <= lo) */
+static rt_error_code_t rt_math_mul_odd_range(rt_int* out, uint64_t lo, uint64_t hi) {
+    if (lo % 2 == 0) lo++;
+    if (lo > hi) return RT_OK;
+
+    rt_int t;
+    rt_int_init(&t);
+    rt_error_code_t err = rt_math_prod_seq(&t, lo, 2, (hi - lo) / 2 + 1);
+    if (err == RT_OK) err = rt_int_mul(out, out, &t);
+    rt_int_clear(&t);
+    return err;
+}
+
+/*
+ * Product of [lo, hi] (1 <= lo <= hi) as its odd part in out and the
+ * exponent of two in *twos. The evens 2m contribute a two each and leave
+ * the range of m, [ceil(lo / 2), floor(hi / 2)], to be processed the same
+ * way. For lo == 1 this is n! = oddpart * 2^(n - popcount(n)), with the odd
+ * ranges accumulated so every odd factor is multiplied in only once.
+ */
+static rt_error_code_t rt_math_prod_consecutive(rt_int* out, uint64_t lo, uint64_t hi, uint64_t* twos) {
+    rt_error_code_t err = rt_int_set_si(out, 1);
+    *twos = 0;
+
+    if (lo == 1) {
+        /* Odd numbers in (hi >> (i + 1), hi >> i] occur i + 1 times */
+        rt_int p;
+        rt_int_init(&p);
+        err = rt_int_set_si(&p, 1);
+        int top = 0;
+        while ((hi >> (top + 1)) > 0) top++;
+        for (int i = top; err == RT_OK && i >= 0; i--) {
+            err = rt_math_mul_odd_range(&p, (hi >> (i + 1)) + 1, hi >> i);
+            if (err == RT_OK) err = rt_int_mul(out, out, &p);
+            *twos += hi >> (i + 1);
+        }
+        rt_int_clear(&p);
+        return err;
+    }
+
+    while (err == RT_OK && lo <= hi) {
+        err = rt_math_mul_odd_range(out, lo, hi);
+        lo = lo / 2 + lo % 2;
+        hi = hi / 2;
+        if (lo <= hi) *twos += hi - lo + 1;
+    }
     return err;
 }
 
 rt_error_code_t rt_math_factorial(rt_int* out, int64_t n) {
     RT_CHECK_NULL(out, "out");
+    RT_PROF_SCOPE(RT_PROF_MATH_FACTORIAL);
     
     if (n < 0) {
         RT_SET_ERROR(RT_ERROR_INVALID, "Factorial of negative number is undefined");
         return RT_ERROR_INVALID;
     }
     
-    rt_error_code_t err = rt_int_set_si(out, 1);
-    if (err != RT_OK) return err;
-    
     if (n <= 1) {
-        return RT_OK;
-    }
-    
-    rt_int temp, i_val;
-    rt_int_init(&temp);
-    rt_int_init(&i_val);
-    
-    for (int64_t i = 2; i <= n; i++) {
-        err = rt_int_set_si(&i_val, i);
-        if (err != RT_OK) goto cleanup_fact;
-        
-        err = rt_int_mul(&temp, out, &i_val);
-        if (err != RT_OK) goto cleanup_fact;
-        
-        err = rt_int_copy(out, &temp);
-        if (err != RT_OK) goto cleanup_fact;
+        return rt_int_set_si(out, 1);
     }
     
-cleanup_fact:
-    rt_int_clear(&temp);
-    rt_int_clear(&i_val);
+    uint64_t twos;
+    rt_error_code_t err = rt_math_prod_consecutive(out, 1, (uint64_t)n, &twos);
+    if (err != RT_OK) return err;
     
-    return err;
+    return rt_int_shl(out, out, (size_t)twos);
 }
 
 rt_error_code_t rt_math_binomial(rt_int* out, int64_t n, int64_t k) {
@@ -366,49 +747,97 @@ rt_error_code_t rt_math_binomial(rt_int* out, int64_t n, int64_t k) {
         k = n - k;
     }
     
-    rt_error_code_t err = rt_int_set_si(out, 1);
-    if (err != RT_OK) return err;
-    
     if (k == 0) {
-        return RT_OK;
+        return rt_int_set_si(out, 1);
     }
     
-    rt_int temp, num, den;
-    rt_int_init(&temp);
-    rt_int_init(&num);
+    /* C(n, k) = (n-k+1 .. n) / k!: one exact division of the odd parts */
+    rt_int den;
     rt_int_init(&den);
     
-    /* Compute C(n, k) = product((n-k+1..n) / (1..k)) */
-    for (int64_t i = 1; i <= k; i++) {
-        /* Multiply by (n - k + i) */
-        err = rt_int_set_si(&num, n - k + i);
-        if (err != RT_OK) goto cleanup_binom;
-        
-        err = rt_int_mul(&temp, out, &num);
-        if (err != RT_OK) goto cleanup_binom;
-        
-        err = rt_int_copy(out, &temp);
-        if (err != RT_OK) goto cleanup_binom;
-        
-        /* Divide by i */
-        err = rt_int_set_si(&den, i);
-        if (err != RT_OK) goto cleanup_binom;
-        
-        err = rt_int_floordiv(&temp, out, &den);
-        if (err != RT_OK) goto cleanup_binom;
-        
-        err = rt_int_copy(out, &temp);
-        if (err != RT_OK) goto cleanup_binom;
-    }
+    uint64_t num_twos, den_twos;
+    rt_error_code_t err = rt_math_prod_consecutive(out, (uint64_t)(n - k + 1), (uint64_t)n, &num_twos);
+    if (err != RT_OK) goto cleanup_binom;
+    
+    err = rt_math_prod_consecutive(&den, 1, (uint64_t)k, &den_twos);
+    if (err != RT_OK) goto cleanup_binom;
+    
+    err = rt_int_floordiv(out, out, &den);
+    if (err != RT_OK) goto cleanup_binom;
+    
+    err = rt_int_shl(out, out, (size_t)(num_twos - den_twos));
     
 cleanup_binom:
-    rt_int_clear(&temp);
-    rt_int_clear(&num);
     rt_int_clear(&den);
     
     return err;
 }
 
+rt_error_code_t rt_math_prod_range(rt_int* out, int64_t start, int64_t stop, int64_t step) {
+    RT_CHECK_NULL(out, "out");
+    
+    if (step == 0) {
+        RT_SET_ERROR(RT_ERROR_INVALID, "range step must not be zero");
+        return RT_ERROR_INVALID;
+    }
+    
+    /* Number of terms, as len(range(start, stop, step)) */
+    uint64_t count = 0;
+    if (step > 0 && start < stop) {
+        count = ((uint64_t)stop - (uint64_t)start - 1) / (uint64_t)step + 1;
+    } else if (step < 0 && start > stop) {
+        count = ((uint64_t)start - (uint64_t)stop - 1) / (0 - (uint64_t)step) + 1;
+    }
+    if (count == 0) {
+        return rt_int_set_si(out, 1);
+    }
+    
+    /* Walk upwards: the terms are lo, lo + d, ..., hi */
+    uint64_t d = step > 0 ? (uint64_t)step : 0 - (uint64_t)step;
+    int64_t lo = step > 0 ? start : (int64_t)((uint64_t)start - (count - 1) * d);
+    int64_t hi = (int64_t)((uint64_t)lo + (count - 1) * d);
+    
+    /* Any zero term: the terms below zero are hit in steps of d from lo */
+    if (lo <= 0 && hi >= 0 && (0 - (uint64_t)lo) % d == 0) {
+        return rt_int_set_si(out, 0);
+    }
+    
+    /* Magnitude of the negative terms, then of the positive ones */
+    uint64_t neg = 0;
+    if (lo < 0) {
+        neg = (0 - (uint64_t)lo - 1) / d + 1;
+        if (neg > count) neg = count;
+    }
+    uint64_t pos = count - neg;
+    
+    rt_int t;
+    rt_int_init(&t);
+    rt_error_code_t err = rt_int_set_si(out, 1);
+    
+    if (err == RT_OK && neg > 0) {
+        /* |lo + (neg - 1) * d|, ..., |lo| */
+        uint64_t first = 0 - (uint64_t)(lo + (int64_t)((neg - 1) * d));
+        err = rt_math_prod_seq(out, first, d, neg);
+    }
+    if (err == RT_OK && pos > 0) {
+        uint64_t first = (uint64_t)lo + neg * d;
+        uint64_t twos = 0;
+        if (d == 1) {
+            err = rt_math_prod_consecutive(&t, first, first + (pos - 1), &twos);
+        } else {
+            err = rt_math_prod_seq(&t, first, d, pos);
+        }
+        if (err == RT_OK) err = rt_int_shl(&t, &t, (size_t)twos);
+        if (err == RT_OK) err = rt_int_mul(out, out, &t);
+    }
+    if (err == RT_OK && neg % 2 == 1) {
+        out->sign = -out->sign;
+    }
+    
+    rt_int_clear(&t);
+    return err;
+}
+
 /* ==================== Utility Functions ==================== */
 
 int rt_math_is_prime_si(int64_t n) {
@@ -465,16 +894,16 @@ size_t rt_math_num_digits(const rt_int* x) {
     if (!x || rt_int_is_zero(x)) {
         return 1;  /* "0" has 1 digit */
     }
-    
-    /* Count digits in base 1e9 representation */
-    size_t digits = (x->len - 1) * RT_INT_BASE_DIGITS;
-    
-    /* Count digits in most significant limb */
-    uint32_t last = x->digits[x->len - 1];
-    while (last > 0) {
-        digits++;
-        last /= 10;
-    }
-    
-    return digits;
+
+    /* Limbs are binary, so count the digits of the decimal form */
+    size_t len = rt_int_dec_digits_bound(x);
+    char* buf = (char*)rt_mem_alloc(len);
+    if (buf == NULL) {
+        return len;
+    }
+    size_t size = len;
+    rt_int_to_dec_abs(buf, x, &len);
+    rt_mem_free(buf, size);
+
+    return len;
 }
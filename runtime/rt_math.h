@@ -46,6 +46,32 @@ int64_t rt_math_min_si(int64_t a, int64_t b);
  */
 int64_t rt_math_max_si(int64_t a, int64_t b);
 
+/**
+ * Floor division with Python semantics: the quotient rounds toward
+ * negative infinity.
+ *
+ * @param a Dividend
+ * @param b Divisor (non-zero; b == -1 requires a != INT64_MIN)
+ * @return floor(a / b)
+ */
+static inline int64_t rt_math_floordiv_si(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (q * b != a && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+/**
+ * Modulo with Python semantics: the result has the sign of the divisor.
+ *
+ * @param a Dividend
+ * @param b Divisor (non-zero)
+ * @return a - b * floor(a / b)
+ */
+static inline int64_t rt_math_mod_si(int64_t a, int64_t b) {
+    if (b == -1) return 0;  /* INT64_MIN % -1 traps in C */
+    int64_t r = a % b;
+    return (r != 0 && (r < 0) != (b < 0)) ? r + b : r;
+}
+
 /**
  * Compute integer power: base^exp.
  *
@@ -63,6 +89,17 @@ int64_t rt_math_pow_si(int64_t base, int64_t exp);
  */
 int64_t rt_math_sqrt_si(int64_t x);
 
+/**
+ * Compute modular power: base^exp mod mod, as Python's pow(base, exp, mod).
+ * The result has the sign of mod.
+ *
+ * @param base Base value
+ * @param exp Exponent (must be non-negative)
+ * @param mod Modulus (must not be zero)
+ * @return base^exp mod mod, or 0 if exp is negative or mod is zero
+ */
+int64_t rt_math_powmod_si(int64_t base, int64_t exp, int64_t mod);
+
 /**
  * Compute greatest common divisor (GCD) using Euclidean algorithm.
  *
@@ -122,9 +159,27 @@ rt_error_code_t rt_math_max(rt_int* out, const rt_int* a, const rt_int* b) RT_NO
  */
 rt_error_code_t rt_math_pow(rt_int* out, const rt_int* base, int64_t exp) RT_NONNULL;
 
+/**
+ * Compute modular power: base^exp mod mod, as Python's pow(base, exp, mod).
+ *
+ * Uses Montgomery multiplication for odd moduli and Barrett reduction
+ * otherwise, so intermediate values never exceed twice the modulus size.
+ * The result has the sign of mod.
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param base Base BigInt
+ * @param exp Exponent BigInt (must be non-negative)
+ * @param mod Modulus BigInt (must not be zero)
+ * @return RT_OK on success, RT_ERROR_INVALID if exp is negative or mod is zero
+ */
+rt_error_code_t rt_math_powmod(rt_int* out, const rt_int* base, const rt_int* exp, const rt_int* mod) RT_NONNULL;
+
 /**
  * Compute integer square root (floor) of a BigInt.
  *
+ * Newton iteration with doubling precision, costing a small multiple of
+ * one full-size division.
+ *
  * @param out Result BigInt (must be initialized)
  * @param x Input BigInt (must be non-negative)
  * @return RT_OK on success, RT_ERROR_INVALID if x is negative
@@ -150,6 +205,18 @@ rt_error_code_t rt_math_factorial(rt_int* out, int64_t n) RT_NONNULL;
  */
 rt_error_code_t rt_math_binomial(rt_int* out, int64_t n, int64_t k) RT_NONNULL;
 
+/**
+ * Compute the product of range(start, stop, step): start * (start + step) * ...
+ * An empty range gives 1.
+ *
+ * @param out Result BigInt (must be initialized)
+ * @param start First term
+ * @param stop End of the range (exclusive)
+ * @param step Difference between terms (must not be zero)
+ * @return RT_OK on success, RT_ERROR_INVALID if step is zero
+ */
+rt_error_code_t rt_math_prod_range(rt_int* out, int64_t start, int64_t stop, int64_t step) RT_NONNULL;
+
 /* ==================== Utility Functions ==================== */
 
 /**
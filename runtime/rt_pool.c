@@ -0,0 +1,422 @@
+/*
+ * Work-stealing thread pool implementation for pcc runtime.
+ *
+ * Each thread of the pool owns a deque of task pointers behind a spinlock:
+ * the owner pushes and pops at the bottom, thieves take from the top.
+ * Tasks are only spawned for large operations, so the lock is never where
+ * the time goes. Idle workers sleep on a condition variable until a spawn
+ * makes a task available.
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "rt_pool.h"
+#include <stdlib.h>
+
+#if defined(RT_NO_THREADS)
+    /* No thread-local storage: every task runs inline */
+#elif defined(RT_PLATFORM_WINDOWS)
+    #include <windows.h>
+    typedef HANDLE rt_thread_t;
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+    typedef pthread_t rt_thread_t;
+#endif
+
+/* ==================== Deques ==================== */
+
+typedef struct {
+    int lock;
+    size_t top;     /* next task to steal */
+    size_t bottom;  /* one past the owner's newest task */
+    rt_task* tasks[RT_POOL_DEQUE_SIZE];
+} rt_deque;
+
+static int rt_deque_push(rt_deque* d, rt_task* task) {
+    int pushed = 0;
+    RT_SPIN_LOCK(&d->lock);
+    if (d->bottom - d->top < RT_POOL_DEQUE_SIZE) {
+        d->tasks[d->bottom % RT_POOL_DEQUE_SIZE] = task;
+        d->bottom++;
+        pushed = 1;
+    }
+    RT_SPIN_UNLOCK(&d->lock);
+    return pushed;
+}
+
+static rt_task* rt_deque_pop(rt_deque* d) {
+    rt_task* task = NULL;
+    RT_SPIN_LOCK(&d->lock);
+    if (d->bottom != d->top) {
+        d->bottom--;
+        task = d->tasks[d->bottom % RT_POOL_DEQUE_SIZE];
+    }
+    RT_SPIN_UNLOCK(&d->lock);
+    return task;
+}
+
+static rt_task* rt_deque_steal(rt_deque* d) {
+    rt_task* task = NULL;
+    RT_SPIN_LOCK(&d->lock);
+    if (d->bottom != d->top) {
+        task = d->tasks[d->top % RT_POOL_DEQUE_SIZE];
+        d->top++;
+    }
+    RT_SPIN_UNLOCK(&d->lock);
+    return task;
+}
+
+/* ==================== Pool State ==================== */
+
+static struct {
+    int lock;               /* guards starting and stopping */
+    size_t started;         /* set, with release ordering, once threads is final */
+    size_t requested;       /* rt_pool_set_threads(), 0 for the default */
+    size_t threads;         /* size of the running pool */
+    size_t workers;         /* worker threads started, at most threads - 1 */
+    size_t generation;      /* bumped on every start, to retire stale thread indices */
+    size_t pending;         /* tasks sitting in deques */
+    int stop;               /* asks the workers to exit */
+    rt_deque* deques;       /* one per thread; index 0 belongs to the thread that started the pool */
+#if !defined(RT_NO_THREADS)
+    rt_thread_t* handles;   /* workers 1 .. threads - 1 */
+#endif
+} rt_pool_state = { .requested = RT_POOL_DEFAULT_THREADS };
+
+/* Deque index of the calling thread, valid while rt_worker_generation matches */
+static RT_THREAD_LOCAL size_t rt_worker_index;
+static RT_THREAD_LOCAL size_t rt_worker_generation;
+
+/* ==================== Platform Threads ==================== */
+
+#if defined(RT_PLATFORM_WINDOWS) && !defined(RT_NO_THREADS)
+
+static CRITICAL_SECTION rt_idle_lock;
+static CONDITION_VARIABLE rt_idle_cond;
+
+static void rt_worker_loop(size_t index);
+
+static DWORD WINAPI rt_worker_entry(LPVOID arg) {
+    rt_worker_loop((size_t)arg);
+    return 0;
+}
+
+static int rt_thread_start(rt_thread_t* t, size_t index) {
+    *t = CreateThread(NULL, 0, rt_worker_entry, (LPVOID)index, 0, NULL);
+    return *t != NULL;
+}
+
+static void rt_thread_join(rt_thread_t t) {
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+
+static void rt_idle_init(void) {
+    InitializeCriticalSection(&rt_idle_lock);
+    InitializeConditionVariable(&rt_idle_cond);
+}
+
+static void rt_idle_enter(void) { EnterCriticalSection(&rt_idle_lock); }
+static void rt_idle_leave(void) { LeaveCriticalSection(&rt_idle_lock); }
+static void rt_idle_wait(void) { SleepConditionVariableCS(&rt_idle_cond, &rt_idle_lock, INFINITE); }
+static void rt_idle_wake_one(void) { WakeConditionVariable(&rt_idle_cond); }
+static void rt_idle_wake_all(void) { WakeAllConditionVariable(&rt_idle_cond); }
+static void rt_yield(void) { SwitchToThread(); }
+
+static size_t rt_cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwNumberOfProcessors;
+}
+
+#elif !defined(RT_NO_THREADS)
+
+static pthread_mutex_t rt_idle_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t rt_idle_cond = PTHREAD_COND_INITIALIZER;
+
+static void rt_worker_loop(size_t index);
+
+static void* rt_worker_entry(void* arg) {
+    rt_worker_loop((size_t)arg);
+    return NULL;
+}
+
+static int rt_thread_start(rt_thread_t* t, size_t index) {
+    return pthread_create(t, NULL, rt_worker_entry, (void*)index) == 0;
+}
+
+static void rt_thread_join(rt_thread_t t) {
+    pthread_join(t, NULL);
+}
+
+static void rt_idle_init(void) {}
+static void rt_idle_enter(void) { pthread_mutex_lock(&rt_idle_lock); }
+static void rt_idle_leave(void) { pthread_mutex_unlock(&rt_idle_lock); }
+static void rt_idle_wait(void) { pthread_cond_wait(&rt_idle_cond, &rt_idle_lock); }
+static void rt_idle_wake_one(void) { pthread_cond_signal(&rt_idle_cond); }
+static void rt_idle_wake_all(void) { pthread_cond_broadcast(&rt_idle_cond); }
+static void rt_yield(void) { sched_yield(); }
+
+static size_t rt_cpu_count(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+}
+
+#endif
+
+/* ==================== Tasks ==================== */
+
+static void rt_task_run(rt_task* task) {
+    rt_error_code_t result = task->fn(task->arg);
+    if (result != RT_OK) {
+        /* The joining thread reports it; this thread starts clean */
+        task->error = rt_last_error;
+        RT_CLEAR_ERROR();
+    }
+    task->result = result;
+    RT_ATOMIC_STORE(&task->done, 1);
+}
+
+/* Deque of the calling thread, or NULL outside the running pool */
+static rt_deque* rt_pool_self(void) {
+    if (!RT_ATOMIC_LOAD(&rt_pool_state.started) || rt_pool_state.threads < 2 ||
+        rt_worker_generation != rt_pool_state.generation) {
+        return NULL;
+    }
+    return &rt_pool_state.deques[rt_worker_index];
+}
+
+/* Own newest task first, then the oldest task of another thread */
+static rt_task* rt_pool_take(size_t index) {
+    size_t n = rt_pool_state.threads;
+    rt_task* task = rt_deque_pop(&rt_pool_state.deques[index]);
+    for (size_t i = 1; !task && i < n; i++) {
+        task = rt_deque_steal(&rt_pool_state.deques[(index + i) % n]);
+    }
+    if (task) RT_ATOMIC_DEC(&rt_pool_state.pending);
+    return task;
+}
+
+#if !defined(RT_NO_THREADS)
+static void rt_worker_loop(size_t index) {
+    rt_worker_index = index;
+    rt_worker_generation = rt_pool_state.generation;
+
+    for (;;) {
+        rt_task* task = rt_pool_take(index);
+        if (task) {
+            rt_task_run(task);
+            continue;
+        }
+
+        rt_idle_enter();
+        while (RT_ATOMIC_LOAD(&rt_pool_state.pending) == 0 && !rt_pool_state.stop) {
+            rt_idle_wait();
+        }
+        int stop = rt_pool_state.stop;
+        rt_idle_leave();
+        if (stop) return;
+    }
+}
+#endif
+
+/* ==================== Pool Control ==================== */
+
+static size_t rt_pool_configured(void) {
+    size_t n = rt_pool_state.requested;
+    const char* env = getenv("PCC_THREADS");
+    if (env && *env) {
+        char* end;
+        unsigned long v = strtoul(env, &end, 10);
+        if (*end == '\0' && v > 0) n = (size_t)v;
+    }
+#if defined(RT_NO_THREADS)
+    (void)n;
+    return 1;
+#else
+    if (n == 0) n = rt_cpu_count();
+    return n > RT_POOL_MAX_THREADS ? RT_POOL_MAX_THREADS : n;
+#endif
+}
+
+/* Start the pool if needed; the starting thread takes deque 0 */
+static size_t rt_pool_start(void) {
+    if (RT_LIKELY(RT_ATOMIC_LOAD(&rt_pool_state.started))) return rt_pool_state.threads;
+
+    RT_SPIN_LOCK(&rt_pool_state.lock);
+    if (!rt_pool_state.started) {
+        size_t n = rt_pool_configured();
+#if !defined(RT_NO_THREADS)
+        if (n > 1) {
+            rt_pool_state.deques = (rt_deque*)calloc(n, sizeof(rt_deque));
+            rt_pool_state.handles = (rt_thread_t*)calloc(n, sizeof(rt_thread_t));
+            if (!rt_pool_state.deques || !rt_pool_state.handles) {
+                free(rt_pool_state.deques);
+                free(rt_pool_state.handles);
+                rt_pool_state.deques = NULL;
+                rt_pool_state.handles = NULL;
+                n = 1;
+            }
+        }
+        if (n > 1) {
+            rt_idle_init();
+            rt_pool_state.generation++;
+            rt_pool_state.stop = 0;
+            rt_worker_index = 0;
+            rt_worker_generation = rt_pool_state.generation;
+
+            /* Final before any worker starts; a deque whose worker failed to start stays empty */
+            rt_pool_state.threads = n;
+            rt_pool_state.workers = 0;
+            while (rt_pool_state.workers + 1 < n &&
+                   rt_thread_start(&rt_pool_state.handles[rt_pool_state.workers + 1], rt_pool_state.workers + 1)) {
+                rt_pool_state.workers++;
+            }
+        }
+#endif
+        if (n <= 1) rt_pool_state.threads = 1;
+        RT_ATOMIC_STORE(&rt_pool_state.started, 1);
+    }
+    RT_SPIN_UNLOCK(&rt_pool_state.lock);
+    return rt_pool_state.threads;
+}
+
+void rt_pool_set_threads(size_t n) {
+    rt_pool_state.requested = n;
+}
+
+size_t rt_pool_threads(void) {
+    return RT_ATOMIC_LOAD(&rt_pool_state.started) ? rt_pool_state.threads : rt_pool_configured();
+}
+
+int rt_pool_should_split(size_t size, size_t threshold) {
+    if (size < threshold) return 0;
+    return rt_pool_start() > 1 && rt_pool_self() != NULL;
+}
+
+void rt_task_spawn(rt_task* task, rt_task_fn fn, void* arg) {
+    task->fn = fn;
+    task->arg = arg;
+    task->result = RT_OK;
+    task->done = 0;
+
+    rt_deque* self = rt_pool_self();
+    if (!self) {
+        rt_task_run(task);
+        return;
+    }
+
+    /* Counted before it is visible, so a thief never takes it below zero */
+    RT_ATOMIC_INC(&rt_pool_state.pending);
+    if (!rt_deque_push(self, task)) {
+        RT_ATOMIC_DEC(&rt_pool_state.pending);
+        rt_task_run(task);
+        return;
+    }
+
+#if !defined(RT_NO_THREADS)
+    rt_idle_enter();
+    rt_idle_wake_one();
+    rt_idle_leave();
+#endif
+}
+
+rt_error_code_t rt_task_join(rt_task* task) {
+    while (!RT_ATOMIC_LOAD(&task->done)) {
+        /* Not stolen: it is at the bottom of our deque. Otherwise help out. */
+        rt_task* other = rt_pool_self() ? rt_pool_take(rt_worker_index) : NULL;
+        if (other) {
+            rt_task_run(other);
+        } else {
+#if !defined(RT_NO_THREADS)
+            rt_yield();
+#endif
+        }
+    }
+    if (task->result != RT_OK) {
+        rt_last_error = task->error;
+    }
+    return task->result;
+}
+
+/* ==================== Parallel Loops ==================== */
+
+size_t rt_pool_range_chunks(int64_t start, int64_t stop, int64_t step, int64_t grain, int64_t* bounds) {
+    /* Unsigned differences cannot overflow, whatever the signs */
+    uint64_t trips;
+    if (step > 0) {
+        trips = start < stop ? ((uint64_t)stop - (uint64_t)start - 1) / (uint64_t)step + 1 : 0;
+    } else {
+        trips = start > stop ? ((uint64_t)start - (uint64_t)stop - 1) / (0 - (uint64_t)step) + 1 : 0;
+    }
+    if (trips == 0) return 0;
+
+    uint64_t chunks = (uint64_t)rt_pool_threads() * RT_POOL_FOR_CHUNKS_PER_THREAD;
+    if (chunks > RT_POOL_FOR_MAX_CHUNKS) chunks = RT_POOL_FOR_MAX_CHUNKS;
+    if (grain > 1 && chunks > trips / (uint64_t)grain) chunks = trips / (uint64_t)grain;
+    if (chunks > trips) chunks = trips;
+    if (chunks == 0) chunks = 1;
+
+    /* The first trips % chunks chunks take one iteration more */
+    uint64_t size = trips / chunks, extra = trips % chunks, index = 0;
+    for (uint64_t k = 0; k <= chunks; k++) {
+        bounds[k] = (int64_t)((uint64_t)start + index * (uint64_t)step);
+        index += size + (k < extra);
+    }
+    return (size_t)chunks;
+}
+
+rt_error_code_t rt_pool_run(rt_task_fn fn, void* args, size_t arg_size, size_t count) {
+    rt_task tasks[RT_POOL_FOR_MAX_CHUNKS];
+    char* base = (char*)args;
+    if (count == 0) return RT_OK;
+    if (count > RT_POOL_FOR_MAX_CHUNKS) count = RT_POOL_FOR_MAX_CHUNKS;
+
+    /* Thieves take the oldest task first, so start handing out from the front */
+    rt_pool_start();
+    for (size_t i = 1; i < count; i++) {
+        rt_task_spawn(&tasks[i], fn, base + i * arg_size);
+    }
+    rt_error_code_t first = fn(base);
+    rt_error_t first_error = rt_last_error;
+
+    /* Joined last to first, so the first failure's error is left standing */
+    rt_error_code_t result = RT_OK;
+    for (size_t i = count; i-- > 1;) {
+        rt_error_code_t r = rt_task_join(&tasks[i]);
+        if (r != RT_OK) result = r;
+    }
+    if (first != RT_OK) {
+        rt_last_error = first_error;
+        result = first;
+    }
+    return result;
+}
+
+void rt_pool_shutdown(void) {
+    RT_SPIN_LOCK(&rt_pool_state.lock);
+    if (rt_pool_state.started) {
+#if !defined(RT_NO_THREADS)
+        if (rt_pool_state.threads > 1) {
+            rt_idle_enter();
+            rt_pool_state.stop = 1;
+            rt_idle_wake_all();
+            rt_idle_leave();
+            for (size_t i = 1; i <= rt_pool_state.workers; i++) {
+                rt_thread_join(rt_pool_state.handles[i]);
+            }
+            free(rt_pool_state.deques);
+            free(rt_pool_state.handles);
+            rt_pool_state.deques = NULL;
+            rt_pool_state.handles = NULL;
+        }
+#endif
+        rt_pool_state.threads = 1;
+        RT_ATOMIC_STORE(&rt_pool_state.started, 0);
+    }
+    RT_SPIN_UNLOCK(&rt_pool_state.lock);
+}
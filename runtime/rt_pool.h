@@ -0,0 +1,160 @@
+/*
+ * Work-stealing thread pool for pcc runtime.
+ *
+ * Fork-join parallelism for the BigInt kernels. A task spawned by a
+ * thread goes onto that thread's deque; idle workers steal the oldest
+ * task of another deque, which for divide-and-conquer code is the largest
+ * one. Joining a task that nobody took runs it on the joining thread, so
+ * a pool whose workers are all busy degrades to the serial recursion.
+ * While a stolen task is still running, the joining thread runs other
+ * tasks instead of blocking.
+ *
+ * Threads are started on the first parallel operation. Their number is
+ * taken from the PCC_THREADS environment variable, else the default set
+ * with rt_pool_set_threads() (which `pcc build --threads N` compiles in),
+ * else the number of online processors. One thread means every task runs
+ * inline, in spawn order.
+ *
+ * Tasks report errors through their result code; an error raised on a
+ * worker is copied into the joining thread's error state.
+ */
+
+#pragma once
+
+#include "rt_config.h"
+#include "rt_error.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Upper bound on the pool size, whatever PCC_THREADS asks for */
+#ifndef RT_POOL_MAX_THREADS
+#define RT_POOL_MAX_THREADS 256
+#endif
+
+/* Tasks each deque holds; a spawn onto a full deque runs inline */
+#ifndef RT_POOL_DEQUE_SIZE
+#define RT_POOL_DEQUE_SIZE 256
+#endif
+
+/* Pool size when neither PCC_THREADS nor rt_pool_set_threads() sets one (0: processors) */
+#ifndef RT_POOL_DEFAULT_THREADS
+#define RT_POOL_DEFAULT_THREADS 0
+#endif
+
+/* Most chunks a parallel loop is split into */
+#ifndef RT_POOL_FOR_MAX_CHUNKS
+#define RT_POOL_FOR_MAX_CHUNKS 64
+#endif
+
+/* Chunks per thread, so that threads done early take over the rest */
+#ifndef RT_POOL_FOR_CHUNKS_PER_THREAD
+#define RT_POOL_FOR_CHUNKS_PER_THREAD 4
+#endif
+
+/* Fewest iterations per chunk of a loop whose body is straight-line code */
+#ifndef RT_POOL_FOR_GRAIN
+#define RT_POOL_FOR_GRAIN 4096
+#endif
+
+typedef rt_error_code_t (*rt_task_fn)(void* arg);
+
+/* A unit of work; lives on the spawning thread's stack until joined */
+typedef struct {
+    rt_task_fn fn;
+    void* arg;
+    rt_error_code_t result;
+    rt_error_t error;       /* error state of the thread that ran it, on failure */
+    size_t done;            /* set, with release ordering, once result is valid */
+} rt_task;
+
+/**
+ * Set the number of threads used when PCC_THREADS is not set.
+ * Has no effect once the pool has started.
+ *
+ * @param n Number of threads including the caller, 0 for one per processor
+ */
+void rt_pool_set_threads(size_t n);
+
+/**
+ * Get the number of threads parallel operations use, including the caller.
+ *
+ * @return Pool size, 1 when running serially
+ */
+size_t rt_pool_threads(void);
+
+/**
+ * Check whether work of a given size should be split across the pool:
+ * the size reaches the threshold and the pool has more than one thread.
+ * Starts the pool if it is not running yet.
+ *
+ * @param size Size of the work, in the caller's unit
+ * @param threshold Smallest size worth splitting
+ * @return Non-zero if the work should be spawned as tasks
+ */
+int rt_pool_should_split(size_t size, size_t threshold);
+
+/**
+ * Spawn fn(arg) as a task. It may run on any thread, at any point until
+ * rt_task_join() returns; on a serial pool it runs before this returns.
+ *
+ * @param task Task to fill in, which must stay valid until joined
+ * @param fn Function to run
+ * @param arg Argument passed to fn, may be NULL
+ */
+void rt_task_spawn(rt_task* task, rt_task_fn fn, void* arg);
+
+/**
+ * Wait for a spawned task, running it here if no other thread has.
+ * Every spawned task must be joined exactly once.
+ *
+ * @param task Task passed to rt_task_spawn()
+ * @return The task's result
+ */
+rt_error_code_t rt_task_join(rt_task* task) RT_NONNULL;
+
+/**
+ * Split the counter values of range(start, stop, step) into contiguous
+ * chunks for a parallel loop: chunk k runs the counter from bounds[k] in
+ * steps of step up to, not including, bounds[k + 1]. There are at most
+ * RT_POOL_FOR_CHUNKS_PER_THREAD per pool thread, RT_POOL_FOR_MAX_CHUNKS
+ * in all, and every chunk but an empty range's has at least grain
+ * iterations or is the only one.
+ *
+ * The caller guarantees that step is non-zero and that counting one step
+ * past the last value does not overflow.
+ *
+ * @param start First counter value
+ * @param stop Bound the counter stops at
+ * @param step Counter increment
+ * @param grain Fewest iterations worth a chunk of their own
+ * @param bounds Receives the chunk bounds; RT_POOL_FOR_MAX_CHUNKS + 1 entries
+ * @return Number of chunks, 0 for an empty range
+ */
+size_t rt_pool_range_chunks(int64_t start, int64_t stop, int64_t step, int64_t grain, int64_t* bounds) RT_NONNULL;
+
+/**
+ * Run fn over an array of arguments as parallel tasks and wait for all of
+ * them. The first runs on the calling thread.
+ *
+ * @param fn Function to run
+ * @param args First of count arguments, arg_size bytes apart
+ * @param arg_size Size of one argument
+ * @param count Number of arguments, at most RT_POOL_FOR_MAX_CHUNKS
+ * @return RT_OK, or the result of the first failing task; its error is
+ *         the caller's last error
+ */
+rt_error_code_t rt_pool_run(rt_task_fn fn, void* args, size_t arg_size, size_t count) RT_NONNULL;
+
+/**
+ * Stop and join the worker threads. The next parallel operation starts
+ * them again; call it with no task outstanding.
+ */
+void rt_pool_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
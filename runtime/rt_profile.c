@@ -0,0 +1,319 @@
+/*
+ * Profiling implementation for pcc runtime.
+ *
+ * Counters are process-wide and updated atomically, since the parallel
+ * kernels call into the runtime from pool threads; the nesting depth of
+ * each entry point is per-thread. The report is registered with atexit()
+ * by the first event, so programs need no setup call.
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "rt_profile.h"
+
+#ifdef RT_PROFILE
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+/* Relaxed atomic updates of 64-bit counters */
+#if defined(RT_COMPILER_MSVC)
+    #define RT_PROF_ADD(p, v) _InterlockedExchangeAdd64((volatile __int64*)(p), (__int64)(v))
+    #define RT_PROF_SUB(p, v) _InterlockedExchangeAdd64((volatile __int64*)(p), -(__int64)(v))
+#elif defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    #define RT_PROF_ADD(p, v) __atomic_add_fetch((p), (v), __ATOMIC_RELAXED)
+    #define RT_PROF_SUB(p, v) __atomic_sub_fetch((p), (v), __ATOMIC_RELAXED)
+#else
+    #define RT_PROF_ADD(p, v) (*(p) += (v))
+    #define RT_PROF_SUB(p, v) (*(p) -= (v))
+#endif
+
+typedef struct {
+    uint64_t calls;
+    uint64_t ns;
+    uint64_t hist[RT_PROF_HIST_BUCKETS];
+} rt_prof_counter;
+
+static const char* const rt_prof_names[RT_PROF_COUNT] = {
+    "rt_int_add",
+    "rt_int_sub",
+    "rt_int_mul",
+    "rt_int_sqr",
+    "rt_int_divmod",
+    "rt_int_from_dec",
+    "rt_int_to_dec",
+    "rt_math_pow",
+    "rt_math_powmod",
+    "rt_math_sqrt",
+    "rt_math_factorial",
+    "rt_str_concat",
+    "rt_str_find",
+    "rt_str_replace",
+    "rt_str_join",
+};
+
+static const char* const rt_prof_grow_names[RT_PROF_GROW_KINDS] = {
+    "rt_int_ensure_cap",
+    "rt_str_reserve",
+};
+
+static rt_prof_counter rt_prof_counters[RT_PROF_COUNT];
+static uint64_t rt_prof_mem_counts[RT_PROF_MEM_EVENTS];
+static uint64_t rt_prof_grow_counts[RT_PROF_GROW_KINDS];
+static uint64_t rt_prof_grow_bytes[RT_PROF_GROW_KINDS];
+static uint64_t rt_prof_live;          /* Bytes handed out and not given back */
+static uint64_t rt_prof_peak;          /* Highest rt_prof_live */
+static uint64_t rt_prof_total;         /* Bytes ever handed out */
+
+static RT_THREAD_LOCAL unsigned rt_prof_depth[RT_PROF_COUNT];
+
+static size_t rt_prof_started;
+static int rt_prof_lock;
+static uint64_t rt_prof_start_ns;
+
+/* ==================== Clock ==================== */
+
+static uint64_t rt_prof_now(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (uint64_t)((double)count.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* ==================== Recording ==================== */
+
+static void rt_prof_report_at_exit(void) {
+    const char* mode = getenv("PCC_PROFILE");
+    if (mode && strcmp(mode, "0") == 0) return;
+    int json = (mode && strcmp(mode, "json") == 0);
+
+    const char* path = getenv("PCC_PROFILE_FILE");
+    FILE* fp = (path && *path) ? fopen(path, "w") : NULL;
+    rt_prof_report(fp ? fp : stderr, json);
+    if (fp) fclose(fp);
+}
+
+/* Start the run's clock and register the report, once */
+static void rt_prof_start(void) {
+    if (RT_LIKELY(RT_ATOMIC_LOAD(&rt_prof_started))) return;
+
+    RT_SPIN_LOCK(&rt_prof_lock);
+    if (!rt_prof_started) {
+        rt_prof_start_ns = rt_prof_now();
+        atexit(rt_prof_report_at_exit);
+        RT_ATOMIC_STORE(&rt_prof_started, 1);
+    }
+    RT_SPIN_UNLOCK(&rt_prof_lock);
+}
+
+static unsigned rt_prof_bucket(size_t limbs) {
+    unsigned b = 0;
+    while (limbs > 1 && b < RT_PROF_HIST_BUCKETS - 1) {
+        limbs >>= 1;
+        b++;
+    }
+    return b;
+}
+
+rt_prof_frame rt_prof_enter(rt_prof_id id, size_t limbs) {
+    rt_prof_start();
+    rt_prof_counter* c = &rt_prof_counters[id];
+    RT_PROF_ADD(&c->calls, 1);
+    if (limbs != RT_PROF_NO_SIZE) {
+        RT_PROF_ADD(&c->hist[rt_prof_bucket(limbs)], 1);
+    }
+
+    rt_prof_frame frame = {id, 0};
+#ifdef RT_PROF_TIMED
+    if (rt_prof_depth[id]++ == 0) {
+        frame.start = rt_prof_now();
+    }
+#endif
+    return frame;
+}
+
+void rt_prof_leave(rt_prof_frame* frame) {
+    rt_prof_depth[frame->id]--;
+    if (frame->start) {
+        RT_PROF_ADD(&rt_prof_counters[frame->id].ns, rt_prof_now() - frame->start);
+    }
+}
+
+void rt_prof_mem(rt_prof_mem_event event, size_t added, size_t removed) {
+    rt_prof_start();
+    RT_PROF_ADD(&rt_prof_mem_counts[event], 1);
+    if (removed) {
+        RT_PROF_SUB(&rt_prof_live, removed);
+    }
+    if (added) {
+        RT_PROF_ADD(&rt_prof_total, added);
+        uint64_t live = RT_PROF_ADD(&rt_prof_live, added);
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+        uint64_t peak = __atomic_load_n(&rt_prof_peak, __ATOMIC_RELAXED);
+        while (live > peak &&
+               !__atomic_compare_exchange_n(&rt_prof_peak, &peak, live, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        }
+#else
+        /* A racing update may lose a peak here; counts stay exact */
+        if (live > rt_prof_peak) rt_prof_peak = live;
+#endif
+    }
+}
+
+void rt_prof_grow(rt_prof_grow_kind kind, size_t bytes) {
+    rt_prof_start();
+    RT_PROF_ADD(&rt_prof_grow_counts[kind], 1);
+    RT_PROF_ADD(&rt_prof_grow_bytes[kind], bytes);
+}
+
+void rt_prof_reset(void) {
+    memset(rt_prof_counters, 0, sizeof(rt_prof_counters));
+    memset(rt_prof_mem_counts, 0, sizeof(rt_prof_mem_counts));
+    memset(rt_prof_grow_counts, 0, sizeof(rt_prof_grow_counts));
+    memset(rt_prof_grow_bytes, 0, sizeof(rt_prof_grow_bytes));
+    rt_prof_live = 0;
+    rt_prof_peak = 0;
+    rt_prof_total = 0;
+    rt_prof_start_ns = rt_prof_now();
+}
+
+/* ==================== Report ==================== */
+
+/* Entry points by descending time, then calls */
+static int rt_prof_order(const void* pa, const void* pb) {
+    const rt_prof_counter* a = &rt_prof_counters[*(const int*)pa];
+    const rt_prof_counter* b = &rt_prof_counters[*(const int*)pb];
+    if (a->ns != b->ns) return a->ns < b->ns ? 1 : -1;
+    if (a->calls != b->calls) return a->calls < b->calls ? 1 : -1;
+    return *(const int*)pa - *(const int*)pb;
+}
+
+static void rt_prof_report_text(FILE* fp, const int* order, uint64_t wall_ns) {
+    fprintf(fp, "\n== pcc runtime profile: %.3f ms since the first runtime call ==\n", (double)wall_ns / 1e6);
+    fprintf(fp, "%-20s %14s %14s %8s %12s\n", "entry point", "calls", "time ms", "% run", "ns/call");
+    for (int i = 0; i < RT_PROF_COUNT; i++) {
+        const rt_prof_counter* c = &rt_prof_counters[order[i]];
+        if (c->calls == 0) continue;
+        fprintf(fp, "%-20s %14llu %14.3f %7.1f%% %12.1f\n", rt_prof_names[order[i]],
+                (unsigned long long)c->calls, (double)c->ns / 1e6,
+                wall_ns ? (double)c->ns * 100.0 / (double)wall_ns : 0.0,
+                (double)c->ns / (double)c->calls);
+    }
+#ifndef RT_PROF_TIMED
+    fprintf(fp, "(calls only: this compiler does not support timing)\n");
+#endif
+
+    for (int i = 0; i < RT_PROF_COUNT; i++) {
+        const rt_prof_counter* c = &rt_prof_counters[i];
+        int last = -1;
+        for (int b = 0; b < RT_PROF_HIST_BUCKETS; b++) {
+            if (c->hist[b]) last = b;
+        }
+        if (last < 0) continue;
+        fprintf(fp, "\n%s operand limbs:\n", rt_prof_names[i]);
+        for (int b = 0; b <= last; b++) {
+            unsigned long long lo = b ? 1ull << b : 0, hi = (2ull << b) - 1;
+            fprintf(fp, "  %10llu-%-10llu %14llu\n", lo, hi, (unsigned long long)c->hist[b]);
+        }
+    }
+
+    fprintf(fp, "\nmemory:\n");
+    fprintf(fp, "  rt_mem_alloc %llu, rt_mem_realloc %llu, rt_mem_free %llu\n",
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_MEM_ALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_MEM_REALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_MEM_FREE]);
+    fprintf(fp, "  malloc %llu, realloc %llu, free %llu\n",
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_SYS_MALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_SYS_REALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_SYS_FREE]);
+    fprintf(fp, "  %llu bytes allocated, %llu bytes peak, %llu bytes in use\n",
+            (unsigned long long)rt_prof_total, (unsigned long long)rt_prof_peak,
+            (unsigned long long)rt_prof_live);
+    for (int k = 0; k < RT_PROF_GROW_KINDS; k++) {
+        fprintf(fp, "  %s grew %llu times, to %llu bytes of capacity in all\n", rt_prof_grow_names[k],
+                (unsigned long long)rt_prof_grow_counts[k], (unsigned long long)rt_prof_grow_bytes[k]);
+    }
+}
+
+static void rt_prof_report_json(FILE* fp, const int* order, uint64_t wall_ns) {
+    fprintf(fp, "{\"wall_ns\": %llu, \"timed\": %s, \"entry_points\": [",
+            (unsigned long long)wall_ns,
+#ifdef RT_PROF_TIMED
+            "true"
+#else
+            "false"
+#endif
+    );
+    int first = 1;
+    for (int i = 0; i < RT_PROF_COUNT; i++) {
+        const rt_prof_counter* c = &rt_prof_counters[order[i]];
+        if (c->calls == 0) continue;
+        fprintf(fp, "%s\n  {\"name\": \"%s\", \"calls\": %llu, \"time_ns\": %llu, \"limbs_histogram\": [",
+                first ? "" : ",", rt_prof_names[order[i]],
+                (unsigned long long)c->calls, (unsigned long long)c->ns);
+        first = 0;
+        int any = 0;
+        for (int b = 0; b < RT_PROF_HIST_BUCKETS; b++) {
+            if (!c->hist[b]) continue;
+            fprintf(fp, "%s{\"min\": %llu, \"max\": %llu, \"calls\": %llu}", any ? ", " : "",
+                    b ? 1ull << b : 0ull, (2ull << b) - 1, (unsigned long long)c->hist[b]);
+            any = 1;
+        }
+        fprintf(fp, "]}");
+    }
+
+    fprintf(fp, "\n], \"memory\": {\"rt_mem_alloc\": %llu, \"rt_mem_realloc\": %llu, \"rt_mem_free\": %llu, "
+                "\"malloc\": %llu, \"realloc\": %llu, \"free\": %llu, "
+                "\"bytes_allocated\": %llu, \"peak_bytes\": %llu, \"live_bytes\": %llu",
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_MEM_ALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_MEM_REALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_MEM_FREE],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_SYS_MALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_SYS_REALLOC],
+            (unsigned long long)rt_prof_mem_counts[RT_PROF_SYS_FREE],
+            (unsigned long long)rt_prof_total, (unsigned long long)rt_prof_peak,
+            (unsigned long long)rt_prof_live);
+    for (int k = 0; k < RT_PROF_GROW_KINDS; k++) {
+        fprintf(fp, ", \"%s\": {\"calls\": %llu, \"bytes\": %llu}", rt_prof_grow_names[k],
+                (unsigned long long)rt_prof_grow_counts[k], (unsigned long long)rt_prof_grow_bytes[k]);
+    }
+    fprintf(fp, "}}\n");
+}
+
+void rt_prof_report(FILE* fp, int json) {
+    int order[RT_PROF_COUNT];
+    for (int i = 0; i < RT_PROF_COUNT; i++) {
+        order[i] = i;
+    }
+    qsort(order, RT_PROF_COUNT, sizeof(int), rt_prof_order);
+
+    uint64_t wall_ns = rt_prof_started ? rt_prof_now() - rt_prof_start_ns : 0;
+    if (json) {
+        rt_prof_report_json(fp, order, wall_ns);
+    } else {
+        rt_prof_report_text(fp, order, wall_ns);
+    }
+    fflush(fp);
+}
+
+#else
+
+/* ISO C forbids an empty translation unit */
+typedef int rt_profile_disabled;
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * Profiling module for pcc runtime.
+ *
+ * Builds with -DRT_PROFILE (pcc build --profile) count the calls and time
+ * of the runtime's hot entry points, histogram the operand sizes of BigInt
+ * multiplication and division, and track the pooled allocator's traffic
+ * and high-water mark. A report is written when the program exits.
+ * Without RT_PROFILE every probe expands to nothing.
+ *
+ * At run time PCC_PROFILE selects the report: "text" (or "1", the
+ * default), "json", or "0" for none. It goes to standard error, or to the
+ * file PCC_PROFILE_FILE names.
+ *
+ * Counts include the calls the runtime makes itself, e.g. the additions
+ * inside a division, and time includes nested calls; a recursive call of
+ * an entry point is timed once, by its outermost call. Calls on pool
+ * threads add their time too, so entry points may total more than the run.
+ * Timing needs the cleanup attribute of GCC and Clang; other compilers
+ * only count calls.
+ */
+
+#pragma once
+
+#include "rt_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Profiled entry points, the rows of the report */
+typedef enum {
+    RT_PROF_INT_ADD,
+    RT_PROF_INT_SUB,
+    RT_PROF_INT_MUL,        /* Histogram of the shorter operand's limbs */
+    RT_PROF_INT_SQR,        /* Histogram of the operand's limbs */
+    RT_PROF_INT_DIVMOD,     /* Histogram of the divisor's limbs */
+    RT_PROF_INT_FROM_DEC,
+    RT_PROF_INT_TO_DEC,
+    RT_PROF_MATH_POW,
+    RT_PROF_MATH_POWMOD,
+    RT_PROF_MATH_SQRT,
+    RT_PROF_MATH_FACTORIAL,
+    RT_PROF_STR_CONCAT,
+    RT_PROF_STR_FIND,
+    RT_PROF_STR_REPLACE,
+    RT_PROF_STR_JOIN,
+    RT_PROF_COUNT
+} rt_prof_id;
+
+/* Allocator events: pooled-allocator calls and the system calls behind them */
+typedef enum {
+    RT_PROF_MEM_ALLOC,
+    RT_PROF_MEM_REALLOC,
+    RT_PROF_MEM_FREE,
+    RT_PROF_SYS_MALLOC,
+    RT_PROF_SYS_REALLOC,
+    RT_PROF_SYS_FREE,
+    RT_PROF_MEM_EVENTS
+} rt_prof_mem_event;
+
+/* Capacity growth of runtime objects */
+typedef enum {
+    RT_PROF_GROW_INT,       /* rt_int_ensure_cap */
+    RT_PROF_GROW_STR,       /* rt_str_reserve */
+    RT_PROF_GROW_KINDS
+} rt_prof_grow_kind;
+
+/* Operand-size histogram buckets: 0-1 limbs, then [2^k, 2^(k+1)) */
+#define RT_PROF_HIST_BUCKETS 32
+
+/* Size argument of entry points without a histogram */
+#define RT_PROF_NO_SIZE ((size_t)-1)
+
+#ifdef RT_PROFILE
+
+/* An entry point's call in progress */
+typedef struct {
+    rt_prof_id id;
+    uint64_t start;         /* Clock at entry, or 0 for a nested call */
+} rt_prof_frame;
+
+/**
+ * Count a call of an entry point and start timing it.
+ *
+ * @param id Entry point
+ * @param limbs Operand size for the histogram, or RT_PROF_NO_SIZE
+ * @return Frame to pass to rt_prof_leave()
+ */
+rt_prof_frame rt_prof_enter(rt_prof_id id, size_t limbs);
+
+/**
+ * Add the time since rt_prof_enter() to the entry point's total.
+ *
+ * @param frame Frame from rt_prof_enter()
+ */
+void rt_prof_leave(rt_prof_frame* frame);
+
+/**
+ * Record an allocator event and the change it makes to the bytes in use.
+ *
+ * @param event Allocator event
+ * @param added Bytes handed out
+ * @param removed Bytes given back
+ */
+void rt_prof_mem(rt_prof_mem_event event, size_t added, size_t removed);
+
+/**
+ * Record a capacity growth of a runtime object.
+ *
+ * @param kind Kind of object
+ * @param bytes New capacity in bytes
+ */
+void rt_prof_grow(rt_prof_grow_kind kind, size_t bytes);
+
+/**
+ * Write the report of everything recorded so far.
+ *
+ * @param fp Stream to write to
+ * @param json Non-zero for JSON, zero for text
+ */
+void rt_prof_report(FILE* fp, int json);
+
+/**
+ * Forget everything recorded so far.
+ */
+void rt_prof_reset(void);
+
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    #define RT_PROF_TIMED 1
+    #define RT_PROF_CLEANUP __attribute__((cleanup(rt_prof_leave), unused))
+#else
+    #define RT_PROF_CLEANUP
+#endif
+
+/* Profile the rest of the enclosing function as a call of entry point id */
+#define RT_PROF_SCOPE(id) RT_PROF_SCOPE_LIMBS(id, RT_PROF_NO_SIZE)
+#define RT_PROF_SCOPE_LIMBS(id, limbs) \
+    rt_prof_frame rt_prof_frame_ RT_PROF_CLEANUP = rt_prof_enter((id), (limbs))
+#define RT_PROF_MEM(event, added, removed) rt_prof_mem((event), (added), (removed))
+#define RT_PROF_GROW(kind, bytes) rt_prof_grow((kind), (bytes))
+
+#else
+
+#define RT_PROF_SCOPE(id) ((void)0)
+#define RT_PROF_SCOPE_LIMBS(id, limbs) ((void)0)
+#define RT_PROF_MEM(event, added, removed) ((void)0)
+#define RT_PROF_GROW(kind, bytes) ((void)0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,39 +3,117 @@
  */
 
 #include "rt_string.h"
+#include "rt_alloc.h"
+#include "rt_profile.h"
+#include "rt_io.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 /* ==================== Helper Functions ==================== */
 
-/**
- * Ensure string has at least min_cap capacity.
- */
-static rt_error_code_t rt_str_reserve(rt_str* s, size_t min_cap) {
+rt_str_block rt_str_interned_block = {1, 0};
+
+static char* rt_str_block_bytes(rt_str_block* b) {
+    return (char*)(b + 1);
+}
+
+/* Allocate a block with room for at least cap bytes, with one reference */
+static rt_str_block* rt_str_block_alloc(size_t cap, size_t* usable) {
+    if (cap > SIZE_MAX - sizeof(rt_str_block)) {
+        RT_SET_ERROR(RT_ERROR_OVERFLOW, "String length overflow");
+        return NULL;
+    }
+    size_t size = rt_mem_usable_size(sizeof(rt_str_block) + cap);
+    rt_str_block* b = (rt_str_block*)rt_mem_alloc(size);
+    if (!b) {
+        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate string memory");
+        return NULL;
+    }
+    b->refs = 1;
+    b->size = size;
+    *usable = size - sizeof(rt_str_block);
+    return b;
+}
+
+static void rt_str_block_release(rt_str_block* b) {
+    if (!b || b == RT_STR_INTERNED) return;
+    /* A sole reference cannot race with another thread */
+    if (RT_ATOMIC_LOAD(&b->refs) == 1 || RT_ATOMIC_DEC(&b->refs) == 0) {
+        rt_mem_free(b, b->size);
+    }
+}
+
+rt_error_code_t rt_str_reserve(rt_str* s, size_t min_cap) {
     RT_CHECK_NULL(s, "s");
 
-    if (min_cap <= s->cap) {
+    int writable = rt_str_is_writable(s);
+    if (RT_LIKELY(writable && min_cap <= s->cap)) {
         return RT_OK;
     }
+    if (min_cap <= s->len) {
+        min_cap = s->len + 1;
+    }
 
-    /* Double capacity strategy */
-    size_t new_cap = s->cap ? s->cap : RT_STR_INITIAL_CAPACITY;
+    /* Double capacity strategy; the block sizes round it up further */
+    size_t new_cap = writable ? s->cap : RT_STR_INITIAL_CAPACITY;
     while (new_cap < min_cap) {
+        if (new_cap > SIZE_MAX / 2) {
+            new_cap = min_cap;
+            break;
+        }
         new_cap *= 2;
     }
+    RT_PROF_GROW(RT_PROF_GROW_STR, new_cap);
 
-    char* new_data = (char*)realloc(s->data, new_cap);
-    if (!new_data) {
-        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate string memory");
-        return RT_ERROR_NOMEM;
+    if (writable) {
+        if (new_cap > SIZE_MAX - sizeof(rt_str_block)) {
+            RT_SET_ERROR(RT_ERROR_OVERFLOW, "String length overflow");
+            return RT_ERROR_OVERFLOW;
+        }
+        size_t size = rt_mem_usable_size(sizeof(rt_str_block) + new_cap);
+        rt_str_block* b = (rt_str_block*)rt_mem_realloc(s->block, s->block->size, size);
+        if (!b) {
+            RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate string memory");
+            return RT_ERROR_NOMEM;
+        }
+        b->size = size;
+        s->block = b;
+        s->data = rt_str_block_bytes(b);
+        s->cap = size - sizeof(rt_str_block);
+        return RT_OK;
+    }
+
+    /* Shared, static or empty: move the contents into a block of our own */
+    size_t usable;
+    rt_str_block* b = rt_str_block_alloc(new_cap, &usable);
+    if (!b) {
+        return rt_last_error.code;
     }
+    char* data = rt_str_block_bytes(b);
+    if (s->len > 0) {
+        memcpy(data, s->data, s->len);
+    }
+    data[s->len] = '\0';
 
-    s->data = new_data;
-    s->cap = new_cap;
+    rt_str_block_release(s->block);
+    s->block = b;
+    s->data = data;
+    s->cap = usable;
     return RT_OK;
 }
 
+const char* rt_str_cstr(rt_str* s) {
+    if (!s->data) {
+        return "";
+    }
+    if (s->data[s->len] != '\0' && rt_str_reserve(s, s->len + 1) != RT_OK) {
+        return "";
+    }
+    return s->data;
+}
+
 /* ==================== Lifecycle ==================== */
 
 rt_error_code_t rt_str_init(rt_str* s) {
@@ -44,9 +122,24 @@ rt_error_code_t rt_str_init(rt_str* s) {
     s->len = 0;
     s->cap = 0;
     s->data = NULL;
+    s->block = NULL;
     return RT_OK;
 }
 
+rt_str rt_str_with_capacity(size_t cap) {
+    rt_str s = rt_str_null();
+    size_t usable;
+    rt_str_block* b = rt_str_block_alloc(cap ? cap : 1, &usable);
+    if (!b) {
+        return s;
+    }
+    s.block = b;
+    s.data = rt_str_block_bytes(b);
+    s.data[0] = '\0';
+    s.cap = usable;
+    return s;
+}
+
 rt_str rt_str_from_cstr(const char* cstr) {
     rt_str s;
     rt_str_init(&s);
@@ -60,25 +153,46 @@ rt_str rt_str_from_cstr(const char* cstr) {
         return s;
     }
 
-    s.data = (char*)malloc(n + 1);
+    s = rt_str_with_capacity(n + 1);
     if (!s.data) {
-        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate string memory");
         return s;
     }
 
     memcpy(s.data, cstr, n + 1);
     s.len = n;
-    s.cap = n + 1;
     return s;
 }
 
+rt_str rt_str_share(rt_str s) {
+    if (s.block && s.block != RT_STR_INTERNED) {
+        /* As in release, a sole reference cannot race */
+        if (RT_ATOMIC_LOAD(&s.block->refs) == 1) {
+            s.block->refs = 2;
+        } else {
+            RT_ATOMIC_INC(&s.block->refs);
+        }
+    }
+    /* Neither copy may write in place while the other is alive */
+    s.cap = 0;
+    return s;
+}
+
+rt_str rt_str_view(rt_str s, size_t start, size_t len) {
+    if (len == 0) {
+        return rt_str_null();
+    }
+    rt_str v = rt_str_share(s);
+    v.data += start;
+    v.len = len;
+    return v;
+}
+
 void rt_str_clear(rt_str* s) {
     if (!s) return;
 
-    if (s->data) {
-        free(s->data);
-        s->data = NULL;
-    }
+    rt_str_block_release(s->block);
+    s->data = NULL;
+    s->block = NULL;
     s->len = 0;
     s->cap = 0;
 }
@@ -86,6 +200,7 @@ void rt_str_clear(rt_str* s) {
 /* ==================== Operations ==================== */
 
 rt_str rt_str_concat(rt_str a, rt_str b) {
+    RT_PROF_SCOPE(RT_PROF_STR_CONCAT);
     rt_str result;
     rt_str_init(&result);
 
@@ -94,9 +209,8 @@ rt_str rt_str_concat(rt_str a, rt_str b) {
         return result;
     }
 
-    result.data = (char*)malloc(total_len + 1);
+    result = rt_str_with_capacity(total_len + 1);
     if (!result.data) {
-        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate string memory");
         return result;
     }
 
@@ -108,7 +222,6 @@ rt_str rt_str_concat(rt_str a, rt_str b) {
     }
     result.data[total_len] = '\0';
     result.len = total_len;
-    result.cap = total_len + 1;
 
     return result;
 }
@@ -120,32 +233,176 @@ rt_error_code_t rt_str_append_cstr(rt_str* s, const char* cstr) {
         return RT_OK;
     }
 
-    size_t cstr_len = strlen(cstr);
-    size_t new_len = s->len + cstr_len;
+    return rt_strbuf_append_bytes(s, cstr, strlen(cstr));
+}
+
+/* ==================== Builder ==================== */
+
+rt_error_code_t rt_strbuf_reserve(rt_strbuf* b, size_t extra) {
+    RT_CHECK_NULL(b, "b");
+
+    if (RT_UNLIKELY(extra > SIZE_MAX - b->len - 1)) {
+        RT_SET_ERROR(RT_ERROR_OVERFLOW, "String length overflow");
+        return RT_ERROR_OVERFLOW;
+    }
+    return rt_str_reserve(b, b->len + extra + 1);
+}
+
+rt_error_code_t rt_strbuf_append_bytes(rt_strbuf* b, const char* p, size_t n) {
+    RT_CHECK_NULL(b, "b");
+
+    if (n == 0) {
+        return RT_OK;
+    }
+
+    /* p may point into b itself (s = s + s): find it again after growing */
+    uintptr_t base = (uintptr_t)b->data, at = (uintptr_t)p;
+    int inside = b->data && at >= base && at < base + b->len;
+    size_t offset = inside ? (size_t)(at - base) : 0;
 
-    rt_error_code_t err = rt_str_reserve(s, new_len + 1);
-    if (err != RT_OK) {
+    rt_error_code_t err = rt_strbuf_reserve(b, n);
+    if (RT_UNLIKELY(err != RT_OK)) {
         return err;
     }
+    if (inside) {
+        p = b->data + offset;
+    }
+
+    memcpy(b->data + b->len, p, n);
+    b->len += n;
+    b->data[b->len] = '\0';
+    return RT_OK;
+}
+
+rt_error_code_t rt_strbuf_append(rt_strbuf* b, rt_str s) {
+    return rt_strbuf_append_bytes(b, s.data, s.len);
+}
+
+/* ==================== Interning ==================== */
+
+/* Open-addressing set of interned strings, guarded by a spin lock */
+static rt_str* rt_intern_slots;
+static size_t rt_intern_cap;
+static size_t rt_intern_count;
+static int rt_intern_lock;
+
+/* FNV-1a */
+static size_t rt_intern_hash(const char* p, size_t n) {
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < n; i++) {
+        h = (h ^ (unsigned char)p[i]) * 1099511628211ull;
+    }
+    return (size_t)(h ^ (h >> 32));
+}
+
+static rt_str* rt_intern_find(const char* p, size_t n) {
+    size_t mask = rt_intern_cap - 1;
+    for (size_t i = rt_intern_hash(p, n) & mask;; i = (i + 1) & mask) {
+        rt_str* slot = &rt_intern_slots[i];
+        if (!slot->data || (slot->len == n && memcmp(slot->data, p, n) == 0)) {
+            return slot;
+        }
+    }
+}
+
+/* Keep the table at most half full; called with the lock held */
+static rt_error_code_t rt_intern_grow(void) {
+    if (2 * (rt_intern_count + 1) <= rt_intern_cap) {
+        return RT_OK;
+    }
 
-    memcpy(s->data + s->len, cstr, cstr_len + 1);
-    s->len = new_len;
+    size_t old_cap = rt_intern_cap;
+    rt_str* old = rt_intern_slots;
+    size_t cap = old_cap ? old_cap * 2 : 64;
+    rt_str* slots = (rt_str*)calloc(cap, sizeof(rt_str));
+    if (!slots) {
+        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to grow string intern table");
+        return RT_ERROR_NOMEM;
+    }
 
+    rt_intern_slots = slots;
+    rt_intern_cap = cap;
+    for (size_t i = 0; i < old_cap; i++) {
+        if (old[i].data) {
+            *rt_intern_find(old[i].data, old[i].len) = old[i];
+        }
+    }
+    free(old);
     return RT_OK;
 }
 
+/* Look up p, adding it (copied unless is_static) if absent */
+static rt_str rt_intern_bytes(const char* p, size_t n, int is_static) {
+    static const char empty[1] = "";
+    if (n == 0) {
+        p = empty;
+        is_static = 1;
+    }
+
+    rt_str result = rt_str_null();
+    RT_SPIN_LOCK(&rt_intern_lock);
+    if (rt_intern_grow() != RT_OK) {
+        goto cleanup;
+    }
+
+    rt_str* slot = rt_intern_find(p, n);
+    if (!slot->data) {
+        char* data = (char*)p;
+        if (!is_static) {
+            /* Lives as long as the table: plain malloc, outside the pool */
+            data = (char*)malloc(n + 1);
+            if (!data) {
+                RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate interned string");
+                goto cleanup;
+            }
+            memcpy(data, p, n);
+            data[n] = '\0';
+        }
+        slot->len = n;
+        slot->cap = 0;
+        slot->data = data;
+        slot->block = RT_STR_INTERNED;
+        rt_intern_count++;
+    }
+    result = *slot;
+
+cleanup:
+    RT_SPIN_UNLOCK(&rt_intern_lock);
+    return result;
+}
+
+rt_str rt_str_intern(rt_str s) {
+    if (rt_str_is_interned(&s)) {
+        return s;
+    }
+    return rt_intern_bytes(s.data, s.len, 0);
+}
+
+rt_str rt_str_intern_static(const char* p, size_t n) {
+    return rt_intern_bytes(p, n, 1);
+}
+
 /* ==================== I/O ==================== */
 
 void rt_print_str(rt_str s) {
-    if (s.data && s.len > 0) {
-        fwrite(s.data, 1, s.len, stdout);
+    size_t len = s.data ? s.len : 0;
+    char* out = rt_out_reserve(len + 1);
+    if (out == NULL) {
+        rt_out_write(s.data, len);
+        rt_out_write("\n", 1);
+        return;
     }
-    fputc('\n', stdout);
+    if (len > 0) memcpy(out, s.data, len);
+    out[len] = '\n';
+    rt_out_commit(out + len + 1);
 }
 
 rt_error_code_t rt_str_fprint(FILE* fp, rt_str s) {
     RT_CHECK_NULL(fp, "fp");
 
+    if (fp == stdout) {
+        return (s.data && s.len > 0) ? rt_out_write(s.data, s.len) : RT_OK;
+    }
     if (s.data && s.len > 0) {
         size_t written = fwrite(s.data, 1, s.len, fp);
         if (written != s.len) {
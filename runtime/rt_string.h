@@ -2,6 +2,18 @@
  * String runtime module for pcc.
  *
  * Provides string operations with proper memory management and error handling.
+ *
+ * Strings are immutable values whose bytes live in one of three places:
+ *   - a reference-counted heap block: every copy and slice made with
+ *     rt_str_share() or rt_str_view() holds a reference, and the block is
+ *     freed when the last one is cleared;
+ *   - static storage (literals from rt_str_from_static()), never freed;
+ *   - the intern table (rt_str_intern()), which lives for the process.
+ * A string may be modified in place only when it alone references a block
+ * it starts at, which rt_str_reserve() guarantees by copying first.
+ *
+ * data[len] is always readable. It is '\0' except for a slice that ends
+ * before its parent does; use rt_str_cstr() where a C string is needed.
  */
 
 #pragma once
@@ -17,13 +29,24 @@ extern "C" {
 #include <stdint.h>
 #include <stdio.h>
 
+/* Header of a heap block of string bytes; the bytes follow it */
+typedef struct rt_str_block {
+    size_t refs;     /* Number of strings referencing the block */
+    size_t size;     /* Allocated size including this header */
+} rt_str_block;
+
 /* String structure */
 typedef struct {
     size_t len;      /* Length of string in bytes */
-    size_t cap;      /* Capacity of allocated buffer */
-    char* data;      /* Null-terminated character data */
+    size_t cap;      /* Writable bytes at data, or 0 if not modifiable in place */
+    char* data;      /* Character data */
+    rt_str_block* block; /* Block holding data, NULL or RT_STR_INTERNED if none */
 } rt_str;
 
+/* Sentinel block of interned strings, which are never freed */
+extern rt_str_block rt_str_interned_block;
+#define RT_STR_INTERNED (&rt_str_interned_block)
+
 /* ==================== Lifecycle ==================== */
 
 /**
@@ -48,12 +71,53 @@ rt_str rt_str_from_cstr(const char* cstr);
  * @return Empty string
  */
 static inline rt_str rt_str_null(void) {
-    rt_str s = {0, 0, NULL};
+    rt_str s = {0, 0, NULL, NULL};
     return s;
 }
 
 /**
- * Clear a string and free its memory.
+ * Create an empty string that owns a buffer of at least cap bytes,
+ * including the terminator.
+ *
+ * @param cap Capacity in bytes
+ * @return Empty string, with NULL data on allocation failure
+ */
+rt_str rt_str_with_capacity(size_t cap);
+
+/**
+ * Wrap bytes in static storage without copying. The bytes must stay valid
+ * and unchanged for the life of the program and be followed by '\0'.
+ *
+ * @param p Bytes
+ * @param n Number of bytes, excluding the terminator
+ * @return String referencing p
+ */
+static inline rt_str rt_str_from_static(const char* p, size_t n) {
+    rt_str s = {n, 0, (char*)p, NULL};
+    return s;
+}
+
+/**
+ * Take another reference to a string's bytes without copying them.
+ *
+ * @param s String to share
+ * @return String with the same contents, to be cleared independently
+ */
+rt_str rt_str_share(rt_str s);
+
+/**
+ * Take a slice of a string without copying it. The slice keeps the
+ * parent's bytes alive, so the parent may be cleared first.
+ *
+ * @param s Parent string
+ * @param start Byte offset of the slice, at most s.len
+ * @param len Length of the slice, at most s.len - start
+ * @return String referencing the parent's bytes
+ */
+rt_str rt_str_view(rt_str s, size_t start, size_t len);
+
+/**
+ * Clear a string, releasing its reference to its bytes.
  *
  * @param s String to clear
  */
@@ -79,6 +143,37 @@ rt_str rt_str_concat(rt_str a, rt_str b);
  */
 rt_error_code_t rt_str_append_cstr(rt_str* s, const char* cstr) RT_NONNULL;
 
+/**
+ * Ensure a string can hold at least min_cap bytes, including the
+ * terminator. Capacity grows geometrically, so repeated appends are
+ * amortized O(1) per byte.
+ *
+ * @param s String to grow
+ * @param min_cap Required capacity in bytes
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_str_reserve(rt_str* s, size_t min_cap) RT_NONNULL;
+
+/**
+ * Check if a string may be modified in place: it alone references a heap
+ * block that its data starts at.
+ *
+ * @param s String
+ * @return 1 if writable, 0 otherwise
+ */
+static inline int rt_str_is_writable(const rt_str* s) {
+    return s->cap != 0 && RT_ATOMIC_LOAD(&s->block->refs) == 1;
+}
+
+/**
+ * Get a string's bytes as a C string, copying a slice that is not
+ * terminated into a buffer of its own.
+ *
+ * @param s String
+ * @return NUL-terminated bytes, or "" if the copy fails
+ */
+const char* rt_str_cstr(rt_str* s) RT_NONNULL;
+
 /**
  * Get the length of a string.
  *
@@ -99,6 +194,81 @@ static inline int rt_str_is_empty(const rt_str* s) {
     return !s || s->len == 0 || !s->data || s->data[0] == '\0';
 }
 
+/* ==================== Builder ==================== */
+
+/*
+ * A string under construction. Any rt_str can be built on in place: the
+ * rt_strbuf_* functions append into its spare capacity, growing it through
+ * rt_str_reserve(), and it stays a valid terminated string throughout.
+ * Reserve the final length up front when it is known to allocate once.
+ */
+typedef rt_str rt_strbuf;
+
+/**
+ * Make room for extra more bytes without further allocation.
+ *
+ * @param b Builder
+ * @param extra Number of bytes about to be appended
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_strbuf_reserve(rt_strbuf* b, size_t extra) RT_NONNULL;
+
+/**
+ * Append bytes to a builder. p may point into the builder itself.
+ *
+ * @param b Builder
+ * @param p Bytes to append
+ * @param n Number of bytes
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_strbuf_append_bytes(rt_strbuf* b, const char* p, size_t n);
+
+/**
+ * Append a string to a builder. s may be the builder itself.
+ *
+ * @param b Builder
+ * @param s String to append
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_strbuf_append(rt_strbuf* b, rt_str s);
+
+/* ==================== Interning ==================== */
+
+/*
+ * Interned strings are unique per contents across the process, so two of
+ * them are equal exactly when their data pointers are. The table is shared
+ * by all threads and its strings are never freed.
+ */
+
+/**
+ * Get the interned string with the contents of s, copying s into the
+ * table if it is not there yet.
+ *
+ * @param s String to intern
+ * @return Interned string; clearing it is a no-op
+ */
+rt_str rt_str_intern(rt_str s);
+
+/**
+ * Get the interned string with the given contents, registering the static
+ * bytes themselves if they are not there yet. Used for literals.
+ *
+ * @param p Bytes in static storage, followed by '\0'
+ * @param n Number of bytes
+ * @return Interned string; clearing it is a no-op
+ */
+rt_str rt_str_intern_static(const char* p, size_t n);
+
+/**
+ * Check if a string is interned.
+ *
+ * @param s String
+ * @return 1 if interned, 0 otherwise
+ */
+static inline int rt_str_is_interned(const rt_str* s) {
+    return s->block == RT_STR_INTERNED;
+}
+
 /* ==================== I/O ==================== */
 
 /**
@@ -4,11 +4,38 @@
 
 #include "rt_string_ex.h"
 #include "rt_math.h"
+#include "rt_alloc.h"
+#include "rt_profile.h"
+#include "rt_io.h"
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <stdio.h>
 #include <limits.h>
+#include <stdint.h>
+
+/*
+ * The character kernels also carry AVX2 versions built with a target
+ * attribute and picked at run time, unless the whole build targets AVX2.
+ */
+#if defined(RT_SIMD_SSE2) && !defined(RT_SIMD_AVX2) && \
+    (defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)) && (defined(__x86_64__) || defined(__i386__))
+#define RT_STR_AVX2_DISPATCH 1
+#define RT_STR_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define RT_STR_AVX2_TARGET
+#endif
+
+#if defined(RT_SIMD_AVX2) || defined(RT_STR_AVX2_DISPATCH)
+#include <immintrin.h>
+#elif defined(RT_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(RT_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(RT_COMPILER_MSVC)
+#include <intrin.h>
+#endif
 
 /* ==================== Helper Functions ==================== */
 
@@ -16,49 +43,27 @@ static int is_whitespace(char c) {
     return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
 }
 
-static char to_upper_char(char c) {
-    if (c >= 'a' && c <= 'z') {
-        return c - 'a' + 'A';
-    }
-    return c;
+/* ASCII case flip for bytes in [lo, hi]: one unsigned range test and an xor */
+static unsigned char flip_case_in(unsigned char c, unsigned char lo, unsigned char hi) {
+    return (unsigned char)(c - lo) <= (unsigned char)(hi - lo) ? (unsigned char)(c ^ 0x20) : c;
 }
 
-static char to_lower_char(char c) {
-    if (c >= 'A' && c <= 'Z') {
-        return c - 'A' + 'a';
-    }
-    return c;
+static unsigned char fold_char(unsigned char c) {
+    return flip_case_in(c, 'A', 'Z');
 }
 
 /* ==================== Substring Operations ==================== */
 
 rt_str rt_str_substring(rt_str s, size_t start, size_t length) {
-    rt_str result;
-    rt_str_init(&result);
-    
     if (start >= s.len) {
-        return result;  /* Empty string if start is beyond length */
+        return rt_str_null();  /* Empty string if start is beyond length */
     }
     
     size_t available = s.len - start;
     size_t actual_len = (length == 0 || length > available) ? available : length;
     
-    if (actual_len == 0) {
-        return result;
-    }
-    
-    result.data = (char*)malloc(actual_len + 1);
-    if (!result.data) {
-        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate substring memory");
-        return result;
-    }
-    
-    memcpy(result.data, s.data + start, actual_len);
-    result.data[actual_len] = '\0';
-    result.len = actual_len;
-    result.cap = actual_len + 1;
-    
-    return result;
+    /* A view into s's bytes: no allocation or copy */
+    return rt_str_view(s, start, actual_len);
 }
 
 rt_str rt_str_slice_from(rt_str s, size_t start) {
@@ -69,27 +74,307 @@ rt_str rt_str_slice_to(rt_str s, size_t end) {
     if (end > s.len) {
         end = s.len;
     }
+    if (end == 0) {
+        /* A length of 0 would mean "to the end" to rt_str_substring() */
+        rt_str empty;
+        rt_str_init(&empty);
+        return empty;
+    }
     return rt_str_substring(s, 0, end);
 }
 
 /* ==================== Searching ==================== */
 
-size_t rt_str_find(rt_str s, rt_str pattern, size_t start) {
-    if (start >= s.len || pattern.len == 0) {
+/*
+ * Candidate filter: one block of RT_VEC_BYTES consecutive start offsets is
+ * tested at once by comparing the bytes under the pattern's first and last
+ * position. The mask has RT_VEC_STRIDE bits per offset, of which only the
+ * lowest is set.
+ */
+#if defined(RT_SIMD_AVX2)
+#define RT_VEC_BYTES 32
+#define RT_VEC_STRIDE 1
+typedef __m256i rt_vec;
+
+static rt_vec rt_vec_splat(unsigned char c) {
+    return _mm256_set1_epi8((char)c);
+}
+
+static uint64_t rt_vec_match2(const unsigned char* a, const unsigned char* b, rt_vec x, rt_vec y) {
+    __m256i ea = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)a), x);
+    __m256i eb = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)b), y);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(ea, eb));
+}
+#elif defined(RT_SIMD_SSE2)
+#define RT_VEC_BYTES 16
+#define RT_VEC_STRIDE 1
+typedef __m128i rt_vec;
+
+static rt_vec rt_vec_splat(unsigned char c) {
+    return _mm_set1_epi8((char)c);
+}
+
+static uint64_t rt_vec_match2(const unsigned char* a, const unsigned char* b, rt_vec x, rt_vec y) {
+    __m128i ea = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)a), x);
+    __m128i eb = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)b), y);
+    return (uint32_t)_mm_movemask_epi8(_mm_and_si128(ea, eb));
+}
+#elif defined(RT_SIMD_NEON)
+#define RT_VEC_BYTES 16
+#define RT_VEC_STRIDE 4
+typedef uint8x16_t rt_vec;
+
+static rt_vec rt_vec_splat(unsigned char c) {
+    return vdupq_n_u8(c);
+}
+
+static uint64_t rt_vec_match2(const unsigned char* a, const unsigned char* b, rt_vec x, rt_vec y) {
+    uint8x16_t e = vandq_u8(vceqq_u8(vld1q_u8(a), x), vceqq_u8(vld1q_u8(b), y));
+    /* Narrow each byte to a nibble, then keep one bit per offset */
+    uint8x8_t n = vshrn_n_u16(vreinterpretq_u16_u8(e), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(n), 0) & 0x1111111111111111ull;
+}
+#endif
+
+#ifdef RT_VEC_BYTES
+/* Index of the lowest / highest set bit of a non-zero mask */
+static unsigned rt_bit_lowest(uint64_t x) {
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    return (unsigned)__builtin_ctzll(x);
+#elif defined(RT_COMPILER_MSVC) && defined(_M_X64)
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (unsigned)i;
+#else
+    unsigned i = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+
+static unsigned rt_bit_highest(uint64_t x) {
+#if defined(RT_COMPILER_GCC) || defined(RT_COMPILER_CLANG)
+    return 63u - (unsigned)__builtin_clzll(x);
+#elif defined(RT_COMPILER_MSVC) && defined(_M_X64)
+    unsigned long i;
+    _BitScanReverse64(&i, x);
+    return (unsigned)i;
+#else
+    unsigned i = 63;
+    while (!(x >> i)) i--;
+    return i;
+#endif
+}
+#endif
+
+/* Does the pattern match at h, given its first and last byte already do? */
+static int rt_str_match_inner(const unsigned char* h, const unsigned char* p, size_t m) {
+    return m <= 2 || memcmp(h + 1, p + 1, m - 2) == 0;
+}
+
+/*
+ * Two-Way string matching (Crochemore-Perrin) for long patterns: linear
+ * time, constant extra space, and a Horspool-style skip on the byte under
+ * the window's last position.
+ */
+static size_t rt_str_search_twoway(const unsigned char* h, size_t n, const unsigned char* p, size_t m) {
+    size_t byteset[32 / sizeof(size_t)] = {0};
+    size_t shift[256];
+    const size_t word = 8 * sizeof(size_t);
+
+    for (size_t i = 0; i < m; i++) {
+        byteset[p[i] / word] |= (size_t)1 << (p[i] % word);
+        shift[p[i]] = i + 1;
+    }
+
+    /* Maximal suffix for both byte orders; the later one is the critical factorization */
+    size_t ip = (size_t)-1, jp = 0, k = 1, per = 1;
+    while (jp + k < m) {
+        if (p[ip + k] == p[jp + k]) {
+            if (k == per) {
+                jp += per;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if (p[ip + k] > p[jp + k]) {
+            jp += k;
+            k = 1;
+            per = jp - ip;
+        } else {
+            ip = jp++;
+            k = per = 1;
+        }
+    }
+    size_t ms = ip, per0 = per;
+
+    ip = (size_t)-1;
+    jp = 0;
+    k = per = 1;
+    while (jp + k < m) {
+        if (p[ip + k] == p[jp + k]) {
+            if (k == per) {
+                jp += per;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if (p[ip + k] < p[jp + k]) {
+            jp += k;
+            k = 1;
+            per = jp - ip;
+        } else {
+            ip = jp++;
+            k = per = 1;
+        }
+    }
+    if (ip + 1 > ms + 1) {
+        ms = ip;
+    } else {
+        per = per0;
+    }
+
+    /* A periodic pattern remembers how much of the left half already matched */
+    size_t mem0;
+    if (memcmp(p, p + per, ms + 1) != 0) {
+        mem0 = 0;
+        per = (ms > m - ms - 1 ? ms : m - ms - 1) + 1;
+    } else {
+        mem0 = m - per;
+    }
+
+    size_t pos = 0, mem = 0;
+    while (n - pos >= m) {
+        const unsigned char* w = h + pos;
+        unsigned char c = w[m - 1];
+        if (!(byteset[c / word] & ((size_t)1 << (c % word)))) {
+            pos += m;
+            mem = 0;
+            continue;
+        }
+        k = m - shift[c];
+        if (k) {
+            pos += k < mem ? mem : k;
+            mem = 0;
+            continue;
+        }
+
+        /* Compare the right half, then the left half */
+        for (k = (ms + 1 > mem ? ms + 1 : mem); k < m && p[k] == w[k]; k++);
+        if (k < m) {
+            pos += k - ms;
+            mem = 0;
+            continue;
+        }
+        for (k = ms + 1; k > mem && p[k - 1] == w[k - 1]; k--);
+        if (k <= mem) {
+            return pos;
+        }
+        pos += per;
+        mem = mem0;
+    }
+    return (size_t)-1;
+}
+
+/* First offset of p (1 <= m <= n) in h, or (size_t)-1 */
+static size_t rt_str_search(const unsigned char* h, size_t n, const unsigned char* p, size_t m) {
+    if (m == 1) {
+        const unsigned char* q = (const unsigned char*)memchr(h, p[0], n);
+        return q ? (size_t)(q - h) : (size_t)-1;
+    }
+    if (m > RT_STR_TWOWAY_THRESHOLD) {
+        return rt_str_search_twoway(h, n, p, m);
+    }
+
+    size_t last = n - m;  /* Highest start offset */
+    size_t i = 0;
+#ifdef RT_VEC_BYTES
+    rt_vec vfirst = rt_vec_splat(p[0]);
+    rt_vec vlast = rt_vec_splat(p[m - 1]);
+    for (; i <= last && last - i >= RT_VEC_BYTES - 1; i += RT_VEC_BYTES) {
+        uint64_t mask = rt_vec_match2(h + i, h + i + m - 1, vfirst, vlast);
+        while (mask) {
+            size_t j = i + rt_bit_lowest(mask) / RT_VEC_STRIDE;
+            if (rt_str_match_inner(h + j, p, m)) return j;
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    /* Remaining offsets: let memchr find first-byte candidates */
+    while (i <= last) {
+        const unsigned char* q = (const unsigned char*)memchr(h + i, p[0], last - i + 1);
+        if (!q) break;
+        size_t j = (size_t)(q - h);
+        if (h[j + m - 1] == p[m - 1] && rt_str_match_inner(h + j, p, m)) return j;
+        i = j + 1;
+    }
+    return (size_t)-1;
+}
+
+/* Last offset of p (1 <= m <= n) in h, or (size_t)-1 */
+static size_t rt_str_search_last(const unsigned char* h, size_t n, const unsigned char* p, size_t m) {
+    size_t end = n - m + 1;  /* Offsets below end are still to be tested */
+
+    if (m > RT_STR_TWOWAY_THRESHOLD) {
+        /* Horspool run backwards: skip on the byte under the window's first position */
+        size_t shift[256];
+        for (size_t c = 0; c < 256; c++) shift[c] = m;
+        for (size_t j = m - 1; j > 0; j--) shift[p[j]] = j;
+
+        size_t i = end - 1;
+        for (;;) {
+            if (h[i] == p[0] && memcmp(h + i + 1, p + 1, m - 1) == 0) return i;
+            size_t sh = shift[h[i]];
+            if (i < sh) break;
+            i -= sh;
+        }
         return (size_t)-1;
     }
-    
-    if (pattern.len > s.len - start) {
+
+#ifdef RT_VEC_BYTES
+    rt_vec vfirst = rt_vec_splat(p[0]);
+    rt_vec vlast = rt_vec_splat(p[m - 1]);
+    for (; end >= RT_VEC_BYTES; end -= RT_VEC_BYTES) {
+        size_t base = end - RT_VEC_BYTES;
+        uint64_t mask = rt_vec_match2(h + base, h + base + m - 1, vfirst, vlast);
+        while (mask) {
+            unsigned bit = rt_bit_highest(mask);
+            size_t j = base + bit / RT_VEC_STRIDE;
+            if (rt_str_match_inner(h + j, p, m)) return j;
+            mask &= ~((uint64_t)1 << bit);
+        }
+    }
+#endif
+
+    while (end > 0) {
+        size_t j = --end;
+        if (h[j] == p[0] && h[j + m - 1] == p[m - 1] && rt_str_match_inner(h + j, p, m)) return j;
+    }
+    return (size_t)-1;
+}
+
+/* Shared body of rt_str_find() and rt_str_find_cstr() */
+static size_t rt_str_find_bytes(rt_str s, const char* pattern, size_t pattern_len, size_t start) {
+    if (start >= s.len || pattern_len == 0) {
         return (size_t)-1;
     }
     
-    for (size_t i = start; i <= s.len - pattern.len; i++) {
-        if (memcmp(s.data + i, pattern.data, pattern.len) == 0) {
-            return i;
-        }
+    if (pattern_len > s.len - start) {
+        return (size_t)-1;
     }
     
-    return (size_t)-1;
+    size_t pos = rt_str_search((const unsigned char*)s.data + start, s.len - start,
+                               (const unsigned char*)pattern, pattern_len);
+    return pos == (size_t)-1 ? pos : start + pos;
+}
+
+size_t rt_str_find(rt_str s, rt_str pattern, size_t start) {
+    RT_PROF_SCOPE(RT_PROF_STR_FIND);
+    return rt_str_find_bytes(s, pattern.data, pattern.len, start);
 }
 
 size_t rt_str_find_cstr(rt_str s, const char* pattern, size_t start) {
@@ -97,11 +382,8 @@ size_t rt_str_find_cstr(rt_str s, const char* pattern, size_t start) {
         return (size_t)-1;
     }
     
-    rt_str pattern_str = rt_str_from_cstr(pattern);
-    size_t result = rt_str_find(s, pattern_str, start);
-    rt_str_clear(&pattern_str);
-    
-    return result;
+    /* Searched in place: no copy of the pattern */
+    return rt_str_find_bytes(s, pattern, strlen(pattern), start);
 }
 
 size_t rt_str_rfind(rt_str s, rt_str pattern) {
@@ -109,13 +391,8 @@ size_t rt_str_rfind(rt_str s, rt_str pattern) {
         return (size_t)-1;
     }
     
-    for (size_t i = s.len - pattern.len; i != (size_t)-1; i--) {
-        if (memcmp(s.data + i, pattern.data, pattern.len) == 0) {
-            return i;
-        }
-    }
-    
-    return (size_t)-1;
+    return rt_str_search_last((const unsigned char*)s.data, s.len,
+                              (const unsigned char*)pattern.data, pattern.len);
 }
 
 int rt_str_contains(rt_str s, rt_str pattern) {
@@ -138,6 +415,292 @@ int rt_str_ends_with(rt_str s, rt_str suffix) {
     return memcmp(s.data + s.len - suffix.len, suffix.data, suffix.len) == 0;
 }
 
+/* ==================== Character Kernels ==================== */
+
+/*
+ * Byte-wise kernels behind case mapping, case-insensitive comparison and
+ * whitespace handling. Each instruction set provides the same table and
+ * the best one the CPU supports is chosen on first use. dst may equal src.
+ */
+typedef struct {
+    const char* name;
+    /* Flip the case of each byte in [lo, hi] */
+    void (*case_map)(char* dst, const char* src, size_t n, unsigned char lo, unsigned char hi);
+    /* Index of the first byte that differs after ASCII folding, or n */
+    size_t (*fold_mismatch)(const char* a, const char* b, size_t n);
+    /* Length of the leading / trailing whitespace run */
+    size_t (*space_prefix)(const char* s, size_t n);
+    size_t (*space_suffix)(const char* s, size_t n);
+    /* Copy the non-whitespace bytes, returning how many were copied */
+    size_t (*space_remove)(char* dst, const char* src, size_t n);
+} rt_str_kernels;
+
+static void rt_case_map_scalar(char* dst, const char* src, size_t n, unsigned char lo, unsigned char hi) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = (char)flip_case_in((unsigned char)src[i], lo, hi);
+    }
+}
+
+static size_t rt_fold_mismatch_scalar(const char* a, const char* b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (fold_char((unsigned char)a[i]) != fold_char((unsigned char)b[i])) return i;
+    }
+    return n;
+}
+
+static size_t rt_space_prefix_scalar(const char* s, size_t n) {
+    size_t i = 0;
+    while (i < n && is_whitespace(s[i])) i++;
+    return i;
+}
+
+static size_t rt_space_suffix_scalar(const char* s, size_t n) {
+    size_t i = n;
+    while (i > 0 && is_whitespace(s[i - 1])) i--;
+    return n - i;
+}
+
+static size_t rt_space_remove_scalar(char* dst, const char* src, size_t n) {
+    size_t j = 0;
+    for (size_t i = 0; i < n; i++) {
+        char c = src[i];
+        if (!is_whitespace(c)) dst[j++] = c;
+    }
+    return j;
+}
+
+static const rt_str_kernels rt_str_kernels_scalar = {
+    "scalar",
+    rt_case_map_scalar,
+    rt_fold_mismatch_scalar,
+    rt_space_prefix_scalar,
+    rt_space_suffix_scalar,
+    rt_space_remove_scalar,
+};
+
+#if defined(RT_SIMD_SSE2) && !defined(RT_SIMD_AVX2)
+/* Bytes of x in [lo, lo + span], as a 0x00/0xFF mask */
+static __m128i rt_in_range_sse2(__m128i x, unsigned char lo, unsigned char span) {
+    __m128i y = _mm_sub_epi8(x, _mm_set1_epi8((char)lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(y, _mm_set1_epi8((char)span)), y);
+}
+
+/* Bytes of x that are ' ' or in '\t'..'\r' */
+static __m128i rt_is_space_sse2(__m128i x) {
+    return _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')), rt_in_range_sse2(x, '\t', '\r' - '\t'));
+}
+
+static void rt_case_map_sse2(char* dst, const char* src, size_t n, unsigned char lo, unsigned char hi) {
+    const __m128i bit = _mm_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i flip = _mm_and_si128(rt_in_range_sse2(x, lo, (unsigned char)(hi - lo)), bit);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(x, flip));
+    }
+    rt_case_map_scalar(dst + i, src + i, n - i, lo, hi);
+}
+
+static size_t rt_fold_mismatch_sse2(const char* a, const char* b, size_t n) {
+    const __m128i bit = _mm_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        x = _mm_xor_si128(x, _mm_and_si128(rt_in_range_sse2(x, 'A', 'Z' - 'A'), bit));
+        y = _mm_xor_si128(y, _mm_and_si128(rt_in_range_sse2(y, 'A', 'Z' - 'A'), bit));
+        uint32_t diff = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) & 0xFFFFu;
+        if (diff) return i + rt_bit_lowest(diff);
+    }
+    return i + rt_fold_mismatch_scalar(a + i, b + i, n - i);
+}
+
+static size_t rt_space_prefix_sse2(const char* s, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + i));
+        uint32_t text = ~(uint32_t)_mm_movemask_epi8(rt_is_space_sse2(x)) & 0xFFFFu;
+        if (text) return i + rt_bit_lowest(text);
+    }
+    return i + rt_space_prefix_scalar(s + i, n - i);
+}
+
+static size_t rt_space_suffix_sse2(const char* s, size_t n) {
+    size_t end = n;
+    for (; end >= 16; end -= 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + end - 16));
+        uint32_t text = ~(uint32_t)_mm_movemask_epi8(rt_is_space_sse2(x)) & 0xFFFFu;
+        if (text) return n - (end - 16 + rt_bit_highest(text) + 1);
+    }
+    return n - end + rt_space_suffix_scalar(s, end);
+}
+
+static size_t rt_space_remove_sse2(char* dst, const char* src, size_t n) {
+    size_t i = 0, j = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+        uint32_t space = (uint32_t)_mm_movemask_epi8(rt_is_space_sse2(x));
+        if (space == 0) {
+            /* j <= i, so in place this only overwrites bytes already loaded */
+            _mm_storeu_si128((__m128i*)(dst + j), x);
+            j += 16;
+        } else if (space != 0xFFFFu) {
+            unsigned char block[16];
+            _mm_storeu_si128((__m128i*)block, x);
+            for (unsigned k = 0; k < 16; k++) {
+                dst[j] = (char)block[k];
+                j += !(space >> k & 1);
+            }
+        }
+    }
+    return j + rt_space_remove_scalar(dst + j, src + i, n - i);
+}
+
+static const rt_str_kernels rt_str_kernels_sse2 = {
+    "sse2",
+    rt_case_map_sse2,
+    rt_fold_mismatch_sse2,
+    rt_space_prefix_sse2,
+    rt_space_suffix_sse2,
+    rt_space_remove_sse2,
+};
+#endif
+
+#if defined(RT_SIMD_AVX2) || defined(RT_STR_AVX2_DISPATCH)
+RT_STR_AVX2_TARGET
+static __m256i rt_in_range_avx2(__m256i x, unsigned char lo, unsigned char span) {
+    __m256i y = _mm256_sub_epi8(x, _mm256_set1_epi8((char)lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(y, _mm256_set1_epi8((char)span)), y);
+}
+
+RT_STR_AVX2_TARGET
+static __m256i rt_is_space_avx2(__m256i x) {
+    return _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')), rt_in_range_avx2(x, '\t', '\r' - '\t'));
+}
+
+/*
+ * Each kernel clears the upper vector state before its scalar tail: in a
+ * dispatched build the tail is legacy SSE code, and entering it with dirty
+ * upper halves costs a state transition per call - far more than the work
+ * itself for short strings.
+ */
+
+RT_STR_AVX2_TARGET
+static void rt_case_map_avx2(char* dst, const char* src, size_t n, unsigned char lo, unsigned char hi) {
+    const __m256i bit = _mm256_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i flip = _mm256_and_si256(rt_in_range_avx2(x, lo, (unsigned char)(hi - lo)), bit);
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(x, flip));
+    }
+    _mm256_zeroupper();
+    rt_case_map_scalar(dst + i, src + i, n - i, lo, hi);
+}
+
+RT_STR_AVX2_TARGET
+static size_t rt_fold_mismatch_avx2(const char* a, const char* b, size_t n) {
+    const __m256i bit = _mm256_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        x = _mm256_xor_si256(x, _mm256_and_si256(rt_in_range_avx2(x, 'A', 'Z' - 'A'), bit));
+        y = _mm256_xor_si256(y, _mm256_and_si256(rt_in_range_avx2(y, 'A', 'Z' - 'A'), bit));
+        uint32_t diff = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y));
+        if (diff) return i + rt_bit_lowest(diff);
+    }
+    _mm256_zeroupper();
+    return i + rt_fold_mismatch_scalar(a + i, b + i, n - i);
+}
+
+RT_STR_AVX2_TARGET
+static size_t rt_space_prefix_avx2(const char* s, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + i));
+        uint32_t text = ~(uint32_t)_mm256_movemask_epi8(rt_is_space_avx2(x));
+        if (text) return i + rt_bit_lowest(text);
+    }
+    _mm256_zeroupper();
+    return i + rt_space_prefix_scalar(s + i, n - i);
+}
+
+RT_STR_AVX2_TARGET
+static size_t rt_space_suffix_avx2(const char* s, size_t n) {
+    size_t end = n;
+    for (; end >= 32; end -= 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + end - 32));
+        uint32_t text = ~(uint32_t)_mm256_movemask_epi8(rt_is_space_avx2(x));
+        if (text) return n - (end - 32 + rt_bit_highest(text) + 1);
+    }
+    _mm256_zeroupper();
+    return n - end + rt_space_suffix_scalar(s, end);
+}
+
+RT_STR_AVX2_TARGET
+static size_t rt_space_remove_avx2(char* dst, const char* src, size_t n) {
+    size_t i = 0, j = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        uint32_t space = (uint32_t)_mm256_movemask_epi8(rt_is_space_avx2(x));
+        if (space == 0) {
+            /* j <= i, so in place this only overwrites bytes already loaded */
+            _mm256_storeu_si256((__m256i*)(dst + j), x);
+            j += 32;
+        } else if (space != 0xFFFFFFFFu) {
+            unsigned char block[32];
+            _mm256_storeu_si256((__m256i*)block, x);
+            for (unsigned k = 0; k < 32; k++) {
+                dst[j] = (char)block[k];
+                j += !(space >> k & 1);
+            }
+        }
+    }
+    _mm256_zeroupper();
+    return j + rt_space_remove_scalar(dst + j, src + i, n - i);
+}
+
+static const rt_str_kernels rt_str_kernels_avx2 = {
+    "avx2",
+    rt_case_map_avx2,
+    rt_fold_mismatch_avx2,
+    rt_space_prefix_avx2,
+    rt_space_suffix_avx2,
+    rt_space_remove_avx2,
+};
+#endif
+
+/* PCC_SIMD=scalar (or =sse2 where AVX2 is dispatched) caps the choice */
+static const rt_str_kernels* rt_str_kernels_select(void) {
+    const char* force = getenv("PCC_SIMD");
+    if (force && strcmp(force, "scalar") == 0) return &rt_str_kernels_scalar;
+#if defined(RT_SIMD_AVX2)
+    return &rt_str_kernels_avx2;
+#else
+#if defined(RT_STR_AVX2_DISPATCH)
+    if (!(force && strcmp(force, "sse2") == 0) && __builtin_cpu_supports("avx2")) return &rt_str_kernels_avx2;
+#endif
+#if defined(RT_SIMD_SSE2)
+    return &rt_str_kernels_sse2;
+#else
+    return &rt_str_kernels_scalar;
+#endif
+#endif
+}
+
+/* Resolved once per thread, so the lookup needs no synchronization */
+static RT_THREAD_LOCAL const rt_str_kernels* rt_str_kernels_active;
+
+static const rt_str_kernels* rt_str_kern(void) {
+    if (!rt_str_kernels_active) rt_str_kernels_active = rt_str_kernels_select();
+    return rt_str_kernels_active;
+}
+
+const char* rt_str_simd_level(void) {
+    return rt_str_kern()->name;
+}
+
 /* ==================== Comparison ==================== */
 
 int rt_str_compare(rt_str a, rt_str b) {
@@ -158,19 +721,25 @@ int rt_str_equals(rt_str a, rt_str b) {
     if (a.len != b.len) {
         return 0;
     }
+    if (a.data == b.data) {
+        return 1;
+    }
     
+    /* Interned strings are unique per contents */
+    if (rt_str_is_interned(&a) && rt_str_is_interned(&b)) {
+        return 0;
+    }
     return memcmp(a.data, b.data, a.len) == 0;
 }
 
 int rt_str_compare_ignore_case(rt_str a, rt_str b) {
     size_t min_len = a.len < b.len ? a.len : b.len;
     
-    for (size_t i = 0; i < min_len; i++) {
-        char ca = to_lower_char(a.data[i]);
-        char cb = to_lower_char(b.data[i]);
-        
-        if (ca < cb) return -1;
-        if (ca > cb) return 1;
+    size_t i = min_len ? rt_str_kern()->fold_mismatch(a.data, b.data, min_len) : 0;
+    if (i < min_len) {
+        unsigned char ca = fold_char((unsigned char)a.data[i]);
+        unsigned char cb = fold_char((unsigned char)b.data[i]);
+        return ca < cb ? -1 : 1;
     }
     
     /* Equal up to min_len, compare lengths */
@@ -181,7 +750,8 @@ int rt_str_compare_ignore_case(rt_str a, rt_str b) {
 
 /* ==================== Case Conversion ==================== */
 
-rt_str rt_str_to_upper(rt_str s) {
+/* Copy of s with the case of bytes in [lo, hi] flipped */
+static rt_str rt_str_case_copy(rt_str s, unsigned char lo, unsigned char hi, const char* what) {
     rt_str result;
     rt_str_init(&result);
     
@@ -189,96 +759,82 @@ rt_str rt_str_to_upper(rt_str s) {
         return result;
     }
     
-    result.data = (char*)malloc(s.len + 1);
+    result = rt_str_with_capacity(s.len + 1);
     if (!result.data) {
-        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate uppercase string memory");
+        RT_SET_ERROR(RT_ERROR_NOMEM, what);
         return result;
     }
     
-    for (size_t i = 0; i < s.len; i++) {
-        result.data[i] = to_upper_char(s.data[i]);
-    }
+    rt_str_kern()->case_map(result.data, s.data, s.len, lo, hi);
     result.data[s.len] = '\0';
     result.len = s.len;
-    result.cap = s.len + 1;
     
     return result;
 }
 
+rt_str rt_str_to_upper(rt_str s) {
+    return rt_str_case_copy(s, 'a', 'z', "Failed to allocate uppercase string memory");
+}
+
 rt_str rt_str_to_lower(rt_str s) {
-    rt_str result;
-    rt_str_init(&result);
-    
-    if (s.len == 0) {
-        return result;
-    }
-    
-    result.data = (char*)malloc(s.len + 1);
-    if (!result.data) {
-        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate lowercase string memory");
-        return result;
-    }
-    
-    for (size_t i = 0; i < s.len; i++) {
-        result.data[i] = to_lower_char(s.data[i]);
-    }
-    result.data[s.len] = '\0';
-    result.len = s.len;
-    result.cap = s.len + 1;
-    
-    return result;
+    return rt_str_case_copy(s, 'A', 'Z', "Failed to allocate lowercase string memory");
 }
 
 rt_str rt_str_capitalize(rt_str s) {
-    rt_str result;
-    rt_str_init(&result);
-    
-    if (s.len == 0) {
-        return result;
+    rt_str result = rt_str_case_copy(s, 'A', 'Z', "Failed to allocate capitalized string memory");
+    if (result.len > 0) {
+        result.data[0] = (char)flip_case_in((unsigned char)s.data[0], 'a', 'z');
     }
-    
-    result.data = (char*)malloc(s.len + 1);
-    if (!result.data) {
-        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate capitalized string memory");
-        return result;
+    return result;
+}
+
+/* Map case in s's own buffer, first copying bytes it shares */
+static rt_error_code_t rt_str_case_inplace(rt_str* s, unsigned char lo, unsigned char hi) {
+    RT_CHECK_NULL(s, "s");
+    if (s->len == 0) {
+        return RT_OK;
     }
     
-    result.data[0] = to_upper_char(s.data[0]);
-    for (size_t i = 1; i < s.len; i++) {
-        result.data[i] = to_lower_char(s.data[i]);
+    rt_error_code_t err = rt_str_reserve(s, s->len + 1);
+    if (err != RT_OK) {
+        return err;
     }
-    result.data[s.len] = '\0';
-    result.len = s.len;
-    result.cap = s.len + 1;
-    
-    return result;
+    rt_str_kern()->case_map(s->data, s->data, s->len, lo, hi);
+    return RT_OK;
+}
+
+rt_error_code_t rt_str_to_upper_inplace(rt_str* s) {
+    return rt_str_case_inplace(s, 'a', 'z');
+}
+
+rt_error_code_t rt_str_to_lower_inplace(rt_str* s) {
+    return rt_str_case_inplace(s, 'A', 'Z');
 }
 
 /* ==================== Whitespace Handling ==================== */
 
 rt_str rt_str_ltrim(rt_str s) {
-    size_t start = 0;
-    while (start < s.len && is_whitespace(s.data[start])) {
-        start++;
-    }
-    
+    size_t start = s.len ? rt_str_kern()->space_prefix(s.data, s.len) : 0;
     return rt_str_slice_from(s, start);
 }
 
 rt_str rt_str_rtrim(rt_str s) {
-    size_t end = s.len;
-    while (end > 0 && is_whitespace(s.data[end - 1])) {
-        end--;
-    }
-    
+    size_t end = s.len ? s.len - rt_str_kern()->space_suffix(s.data, s.len) : 0;
     return rt_str_slice_to(s, end);
 }
 
 rt_str rt_str_trim(rt_str s) {
-    rt_str temp = rt_str_ltrim(s);
-    rt_str result = rt_str_rtrim(temp);
-    rt_str_clear(&temp);
-    return result;
+    if (s.len == 0) {
+        return rt_str_slice_from(s, 0);
+    }
+    
+    /* One pass from each end, one allocation */
+    size_t start = rt_str_kern()->space_prefix(s.data, s.len);
+    if (start == s.len) {
+        return rt_str_slice_from(s, s.len);
+    }
+    size_t end = s.len - rt_str_kern()->space_suffix(s.data, s.len);
+    return rt_str_substring(s, start, end - start);
 }
 
 rt_str rt_str_remove_whitespace(rt_str s) {
@@ -289,37 +845,65 @@ rt_str rt_str_remove_whitespace(rt_str s) {
         return result;
     }
     
-    /* Count non-whitespace characters */
-    size_t count = 0;
-    for (size_t i = 0; i < s.len; i++) {
-        if (!is_whitespace(s.data[i])) {
-            count++;
-        }
-    }
-    
-    if (count == 0) {
-        return result;
-    }
-    
-    result.data = (char*)malloc(count + 1);
+    result = rt_str_with_capacity(s.len + 1);
     if (!result.data) {
         RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate trimmed string memory");
         return result;
     }
     
-    size_t j = 0;
-    for (size_t i = 0; i < s.len; i++) {
-        if (!is_whitespace(s.data[i])) {
-            result.data[j++] = s.data[i];
-        }
+    result.len = rt_str_kern()->space_remove(result.data, s.data, s.len);
+    result.data[result.len] = '\0';
+    if (result.len == 0) {
+        rt_str_clear(&result);
     }
-    result.data[j] = '\0';
-    result.len = count;
-    result.cap = count + 1;
     
     return result;
 }
 
+rt_error_code_t rt_str_trim_inplace(rt_str* s) {
+    RT_CHECK_NULL(s, "s");
+    if (s->len == 0) {
+        return RT_OK;
+    }
+    
+    size_t start = rt_str_kern()->space_prefix(s->data, s->len);
+    size_t len = s->len - start;
+    if (len > 0) {
+        len -= rt_str_kern()->space_suffix(s->data + start, len);
+    }
+    if (len == 0) {
+        rt_str_clear(s);
+        return RT_OK;
+    }
+    
+    if (!rt_str_is_writable(s)) {
+        /* Shared or static bytes: narrow to a view instead of copying */
+        rt_str view = rt_str_view(*s, start, len);
+        rt_str_clear(s);
+        *s = view;
+        return RT_OK;
+    }
+    if (start > 0) memmove(s->data, s->data + start, len);
+    s->data[len] = '\0';
+    s->len = len;
+    return RT_OK;
+}
+
+rt_error_code_t rt_str_remove_whitespace_inplace(rt_str* s) {
+    RT_CHECK_NULL(s, "s");
+    if (s->len == 0) {
+        return RT_OK;
+    }
+    
+    rt_error_code_t err = rt_str_reserve(s, s->len + 1);
+    if (err != RT_OK) {
+        return err;
+    }
+    s->len = rt_str_kern()->space_remove(s->data, s->data, s->len);
+    s->data[s->len] = '\0';
+    return RT_OK;
+}
+
 /* ==================== Type Conversion ==================== */
 
 rt_str rt_str_from_int(const rt_int* x) {
@@ -331,37 +915,53 @@ rt_str rt_str_from_int(const rt_int* x) {
         return result;
     }
     
-    /* Use the BigInt print function to get string representation */
-    /* For now, use a simple approach with a fixed buffer */
-    char buffer[1024];
-    
-    if (rt_int_is_zero(x)) {
-        return rt_str_from_cstr("0");
+    /* Format straight into the string's storage: one allocation */
+    size_t cap = rt_int_to_buffer_size(x);
+    result = rt_str_with_capacity(cap);
+    if (!result.data) {
+        RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate string memory");
+        return result;
+    }
+    result.len = rt_int_to_buffer(result.data, cap, x);
+    if (result.len == 0) {
+        rt_str_clear(&result);
     }
     
-    /* Calculate required buffer size */
-    size_t num_digits = rt_math_num_digits(x);
-    size_t need_sign = (x->sign < 0) ? 1 : 0;
+    return result;
+}
+
+rt_error_code_t rt_strbuf_append_int(rt_strbuf* b, const rt_int* x) {
+    RT_CHECK_NULL(b, "b");
+    RT_CHECK_NULL(x, "x");
     
-    if (num_digits + need_sign >= sizeof(buffer)) {
-        RT_SET_ERROR(RT_ERROR_OVERFLOW, "Number too large for string conversion");
-        return rt_str_null();
+    /* Format straight into the builder's spare capacity */
+    size_t bound = rt_int_to_buffer_size(x);
+    rt_error_code_t err = rt_strbuf_reserve(b, bound - 1);
+    if (err != RT_OK) {
+        return err;
     }
     
-    /* Build string from BigInt digits */
-    /* This is a simplified version - full implementation would use rt_int_fprint */
-    char* p = buffer + sizeof(buffer) - 1;
-    *p = '\0';
-    
-    /* For now, return a placeholder - full implementation needs BigInt to string conversion */
-    /* This would require access to BigInt internals or a print-to-string function */
-    return rt_str_from_cstr("0");  /* Placeholder */
+    size_t n = rt_int_to_buffer(b->data + b->len, bound, x);
+    if (n == 0) {
+        b->data[b->len] = '\0';
+        return RT_ERROR_NOMEM;
+    }
+    b->len += n;
+    return RT_OK;
+}
+
+rt_error_code_t rt_strbuf_append_si(rt_strbuf* b, int64_t x) {
+    char buffer[32];
+    char* end = buffer + sizeof(buffer);
+    char* p = rt_fmt_si(end, x);
+    return rt_strbuf_append_bytes(b, p, (size_t)(end - p));
 }
 
 rt_str rt_str_from_si(int64_t x) {
     char buffer[32];
-    snprintf(buffer, sizeof(buffer), "%lld", (long long)x);
-    return rt_str_from_cstr(buffer);
+    char* end = buffer + sizeof(buffer) - 1;
+    *end = '\0';
+    return rt_str_from_cstr(rt_fmt_si(end, x));
 }
 
 rt_error_code_t rt_str_to_int(rt_str s, rt_int* out) {
@@ -376,7 +976,7 @@ rt_error_code_t rt_str_to_int(rt_str s, rt_int* out) {
     }
     
     /* Use BigInt from decimal string function */
-    rt_error_code_t err = rt_int_from_dec(out, trimmed.data);
+    rt_error_code_t err = rt_int_from_dec(out, rt_str_cstr(&trimmed));
     
     rt_str_clear(&trimmed);
     return err;
@@ -397,7 +997,7 @@ rt_error_code_t rt_str_to_si(rt_str s, int64_t* out) {
     rt_int temp;
     rt_int_init(&temp);
     
-    rt_error_code_t err = rt_int_from_dec(&temp, trimmed.data);
+    rt_error_code_t err = rt_int_from_dec(&temp, rt_str_cstr(&trimmed));
     if (err != RT_OK) {
         rt_str_clear(&trimmed);
         rt_int_clear(&temp);
@@ -458,7 +1058,7 @@ rt_str rt_str_repeat(rt_str s, int64_t count) {
     
     size_t total_len = s.len * (size_t)count;
     
-    result.data = (char*)malloc(total_len + 1);
+    result = rt_str_with_capacity(total_len + 1);
     if (!result.data) {
         RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate repeated string memory");
         return result;
@@ -469,12 +1069,12 @@ rt_str rt_str_repeat(rt_str s, int64_t count) {
     }
     result.data[total_len] = '\0';
     result.len = total_len;
-    result.cap = total_len + 1;
     
     return result;
 }
 
 rt_str rt_str_join(rt_str* strings, size_t count, rt_str separator) {
+    RT_PROF_SCOPE(RT_PROF_STR_JOIN);
     rt_str result;
     rt_str_init(&result);
     
@@ -493,7 +1093,7 @@ rt_str rt_str_join(rt_str* strings, size_t count, rt_str separator) {
     }
     total_len += separator.len * (count - 1);
     
-    result.data = (char*)malloc(total_len + 1);
+    result = rt_str_with_capacity(total_len + 1);
     if (!result.data) {
         RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate joined string memory");
         return result;
@@ -512,12 +1112,12 @@ rt_str rt_str_join(rt_str* strings, size_t count, rt_str separator) {
     }
     *p = '\0';
     result.len = total_len;
-    result.cap = total_len + 1;
     
     return result;
 }
 
 rt_str rt_str_replace(rt_str s, rt_str old, rt_str replacement) {
+    RT_PROF_SCOPE(RT_PROF_STR_REPLACE);
     rt_str result;
     rt_str_init(&result);
     
@@ -542,7 +1142,7 @@ rt_str rt_str_replace(rt_str s, rt_str old, rt_str replacement) {
     /* Calculate new length */
     size_t total_len = s.len + count * (replacement.len - old.len);
     
-    result.data = (char*)malloc(total_len + 1);
+    result = rt_str_with_capacity(total_len + 1);
     if (!result.data) {
         RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate replaced string memory");
         return result;
@@ -578,7 +1178,6 @@ rt_str rt_str_replace(rt_str s, rt_str old, rt_str replacement) {
     
     *p = '\0';
     result.len = total_len;
-    result.cap = total_len + 1;
     
     return result;
 }
@@ -599,7 +1198,7 @@ rt_str rt_str_replace_first(rt_str s, rt_str old, rt_str replacement) {
     
     size_t total_len = s.len - old.len + replacement.len;
     
-    result.data = (char*)malloc(total_len + 1);
+    result = rt_str_with_capacity(total_len + 1);
     if (!result.data) {
         RT_SET_ERROR(RT_ERROR_NOMEM, "Failed to allocate replaced string memory");
         return result;
@@ -628,7 +1227,6 @@ rt_str rt_str_replace_first(rt_str s, rt_str old, rt_str replacement) {
     
     *p = '\0';
     result.len = total_len;
-    result.cap = total_len + 1;
     
     return result;
 }
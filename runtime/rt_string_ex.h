@@ -25,13 +25,19 @@ extern "C" {
 
 /* ==================== Substring Operations ==================== */
 
+/*
+ * Substrings and trimmed strings are views that share the source's bytes
+ * (see rt_str_view()): they do not allocate, and stay valid after the
+ * source is cleared. Clear them like any other string.
+ */
+
 /**
  * Extract a substring from a string.
  *
  * @param s Source string
  * @param start Start index (0-based, inclusive)
  * @param length Number of characters to extract (or 0 for remainder)
- * @return New string containing the substring, empty string on error
+ * @return View of the substring, empty string if start is out of range
  */
 rt_str rt_str_substring(rt_str s, size_t start, size_t length);
 
@@ -40,7 +46,7 @@ rt_str rt_str_substring(rt_str s, size_t start, size_t length);
  *
  * @param s Source string
  * @param start Start index (0-based)
- * @return New string from start to end
+ * @return View from start to end
  */
 rt_str rt_str_slice_from(rt_str s, size_t start);
 
@@ -49,7 +55,7 @@ rt_str rt_str_slice_from(rt_str s, size_t start);
  *
  * @param s Source string
  * @param end End index (exclusive)
- * @return New string from beginning to end
+ * @return View from beginning to end
  */
 rt_str rt_str_slice_to(rt_str s, size_t end);
 
@@ -123,7 +129,8 @@ int rt_str_ends_with(rt_str s, rt_str suffix);
 int rt_str_compare(rt_str a, rt_str b);
 
 /**
- * Check if two strings are equal.
+ * Check if two strings are equal. Two interned strings are compared by
+ * pointer only.
  *
  * @param a First string
  * @param b Second string
@@ -140,6 +147,16 @@ int rt_str_equals(rt_str a, rt_str b);
  */
 int rt_str_compare_ignore_case(rt_str a, rt_str b);
 
+/**
+ * Name of the kernel set used for case mapping, case-insensitive
+ * comparison and whitespace handling: "avx2", "sse2" or "scalar".
+ * Chosen from the CPU on first use; PCC_SIMD=scalar (or =sse2) in the
+ * environment caps the choice.
+ *
+ * @return Static string naming the kernel set
+ */
+const char* rt_str_simd_level(void);
+
 /* ==================== Case Conversion ==================== */
 
 /**
@@ -166,13 +183,29 @@ rt_str rt_str_to_lower(rt_str s);
  */
 rt_str rt_str_capitalize(rt_str s);
 
+/**
+ * Convert string to uppercase in place, e.g. when it is a dead temporary.
+ *
+ * @param s String to convert
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_str_to_upper_inplace(rt_str* s) RT_NONNULL;
+
+/**
+ * Convert string to lowercase in place.
+ *
+ * @param s String to convert
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_str_to_lower_inplace(rt_str* s) RT_NONNULL;
+
 /* ==================== Whitespace Handling ==================== */
 
 /**
  * Remove leading whitespace from string.
  *
  * @param s Source string
- * @return New string with leading whitespace removed
+ * @return View with leading whitespace removed
  */
 rt_str rt_str_ltrim(rt_str s);
 
@@ -180,7 +213,7 @@ rt_str rt_str_ltrim(rt_str s);
  * Remove trailing whitespace from string.
  *
  * @param s Source string
- * @return New string with trailing whitespace removed
+ * @return View with trailing whitespace removed
  */
 rt_str rt_str_rtrim(rt_str s);
 
@@ -188,7 +221,7 @@ rt_str rt_str_rtrim(rt_str s);
  * Remove leading and trailing whitespace from string.
  *
  * @param s Source string
- * @return New trimmed string
+ * @return Trimmed view
  */
 rt_str rt_str_trim(rt_str s);
 
@@ -200,6 +233,23 @@ rt_str rt_str_trim(rt_str s);
  */
 rt_str rt_str_remove_whitespace(rt_str s);
 
+/**
+ * Remove leading and trailing whitespace in place, keeping the buffer.
+ * A string that is not writable is narrowed to a view instead.
+ *
+ * @param s String to trim
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_str_trim_inplace(rt_str* s) RT_NONNULL;
+
+/**
+ * Remove all whitespace in place, keeping the buffer.
+ *
+ * @param s String to compact
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_str_remove_whitespace_inplace(rt_str* s) RT_NONNULL;
+
 /* ==================== Type Conversion ==================== */
 
 /**
@@ -210,6 +260,24 @@ rt_str rt_str_remove_whitespace(rt_str s);
  */
 rt_str rt_str_from_int(const rt_int* x) RT_NONNULL;
 
+/**
+ * Append a BigInt in decimal to a string builder, formatting in place.
+ *
+ * @param b Builder to append to
+ * @param x BigInt to format
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_strbuf_append_int(rt_strbuf* b, const rt_int* x) RT_NONNULL;
+
+/**
+ * Append a signed 64-bit integer in decimal to a string builder.
+ *
+ * @param b Builder to append to
+ * @param x Integer to format
+ * @return RT_OK on success, error code on failure
+ */
+rt_error_code_t rt_strbuf_append_si(rt_strbuf* b, int64_t x) RT_NONNULL;
+
 /**
  * Convert signed 64-bit integer to string.
  *
@@ -25,6 +25,18 @@ extern "C" {
 /* Math utilities */
 #include "rt_math.h"
 
+/* Pooled allocation and temporary scopes */
+#include "rt_alloc.h"
+
+/* Thread pool for the parallel BigInt kernels */
+#include "rt_pool.h"
+
+/* Profiling probes (active with -DRT_PROFILE) */
+#include "rt_profile.h"
+
+/* Buffered standard output and number formatting */
+#include "rt_io.h"
+
 #ifdef __cplusplus
 }
 #endif
@@ -174,35 +174,6 @@ class TestRunner:
         """
         return text.replace("\r\n", "\n").rstrip()
 
-    def _needs_hpf(self, test_file: Path) -> bool:
-        """Check if a test file needs HPF (BigInt/Class) support."""
-        # Check filename patterns
-        name = test_file.stem.lower()
-        if "bigint" in name or "divmod_big" in name or "class" in name:
-            return True
-        # Check for large integers in source
-        try:
-            content = test_file.read_text(encoding="utf-8")
-            # Check for class definitions
-            if "class " in content:
-                return True
-            import re
-            # Find all integer literals
-            for match in re.finditer(r'\b(\d+)\b', content):
-                num_str = match.group(1)
-                # If number is larger than 64-bit max, needs HPF
-                if len(num_str) > 18:  # 2^63-1 has 19 digits
-                    return True
-                try:
-                    val = int(num_str)
-                    if val > 9223372036854775807 or val < -9223372036854775808:
-                        return True
-                except ValueError:
-                    pass
-        except IOError:
-            pass
-        return False
-
     def build_test(self, test_file: Path, exe_path: Path) -> bool:
         """
         Compile a test fixture to an executable.
@@ -220,10 +191,6 @@ class TestRunner:
             "-o", str(exe_path),
             "--toolchain", self.toolchain.value
         ]
-        
-        # Add --use-hpf flag for tests that need BigInt support
-        if self._needs_hpf(test_file):
-            cmd.append("--use-hpf")
 
         logger.debug(f"Running: {' '.join(cmd)}")
 
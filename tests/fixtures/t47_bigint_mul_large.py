@@ -0,0 +1,12 @@
+a = 7
+i = 0
+while i < 12:
+    a = a * a
+    i = i + 1
+b = a + 123456789
+c = a * b
+print(c % 999999937)
+print(a * a - c + a * 123456789)
+d = c * c
+print(d % 999999937)
+print(d - a * a * b * b)
@@ -0,0 +1,29 @@
+def gcd(m, n):
+    u = m
+    v = n
+    while v != 0:
+        t = u % v
+        u = v
+        v = t
+    return u
+
+a = 123456789012345678901234567890123456789012345678901234567890
+b = 98765432109876543210987
+print(a // b)
+print(a % b)
+print((0 - a) // b)
+print((0 - a) % b)
+print(a // (0 - b))
+print(a % (0 - b))
+print((0 - a) // (0 - b))
+print((0 - a) % (0 - b))
+x = 7
+i = 0
+while i < 10:
+    x = x * x
+    i = i + 1
+y = x * 1000000000000000000007 + 12345678901234567
+print(y // x)
+print(y % x)
+print(gcd(x * 600851475143, x * 1000000007 * 3))
+print(gcd(1000000000000000000000000000000000000000, 64))
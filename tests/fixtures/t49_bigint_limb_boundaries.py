@@ -0,0 +1,21 @@
+a = 18446744073709551615
+b = a + 1
+print(a)
+print(b)
+print(b * b - 1)
+print(b * b // (a + 2))
+print(0 - b * b % 4294967297)
+c = 9999999999999999999
+print(c + 1)
+print(c * c)
+d = 10000000000000000000000000000000000000000000000000000000000
+print(d - 1)
+print(d * d + 7)
+print(d // 10000000000000000001)
+x = 3
+i = 0
+while i < 9:
+    x = x * x
+    i = i + 1
+print(x)
+print(x % 10000000000000000000)
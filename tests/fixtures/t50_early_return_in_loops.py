@@ -0,0 +1,37 @@
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def collatz(n):
+    steps = 0
+    while n != 1:
+        if n % 2 == 0:
+            n = n // 2
+        else:
+            n = 3 * n + 1
+        steps = steps + 1
+        if steps > 1000:
+            return 0 - 1
+    return steps
+
+def first_square_over(k):
+    for i in range(1, 1000000):
+        big = i * i * 100000000000000000000000000000
+        if big > k:
+            return i
+    return 0
+
+print(fib(20))
+print(collatz(27))
+print(first_square_over(123456789012345678901234567890123456789))
+t = 0
+for j in range(10):
+    if j == 7:
+        break
+    if j % 2 == 1:
+        continue
+    s = "step"
+    print(s)
+    t = t + j
+print(t)
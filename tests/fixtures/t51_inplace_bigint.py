@@ -0,0 +1,35 @@
+# In-place BigInt updates: x = x op k and x = x + y * k
+def horner(n):
+    acc = 0
+    i = 0
+    while i < n:
+        acc = acc * 10 + 7
+        i = i + 1
+    return acc
+
+
+def weighted(n):
+    total = 0
+    for i in range(1, n + 1):
+        total = total + i * 3
+        total = total - i * 1000000007
+    return total
+
+
+x = 1000000000000000000000
+x = x + 1
+print(x)
+x = 3 * x
+print(x)
+x = x - 5
+print(x)
+y = 123456789012345678901234567890
+x = x + y * 999
+print(x)
+x = y * 7 + x
+print(x)
+x = x - y * 2
+print(x)
+print(x % 1000000007)
+print(horner(25))
+print(weighted(100))
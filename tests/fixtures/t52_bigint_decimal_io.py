@@ -0,0 +1,9 @@
+# Decimal I/O of long literals (past the divide-and-conquer threshold)
+a = 52601815908301661318609139099603082462819482199351819093786579754323194875749118625276018955597971147104974650752917034236671276842684656321223307924402685995289078666617603137215901092815901396245957117777412154728038528084148525388853933633875004743957551313735379907511637265167612220297299752882001826330434839548620579868282880729022279180588871803340187801759898347887838483726167513613412524273167232686563551505877065894811311440242646288975140261401419314170586492083124023448347824504000883873716786843353265020146201684934072247045585304352056174833801412690604431982965724920868288909310025167800837407188181741433377617409319254499207074137484777183417047187463319128452984153776020776426565150556130445166915640410423468535606883106792470822765444463478612213878375762833125815354930666836450749528831436676402067970168773132281718002390424861114893643900847453783830640037614365370565630481373433734419792376092603092600267511253287046557210141561836546107358735570636060710431955459045440910317764672720429355759183623610788526114913167723267938144494544373233249351643883170107375043103993158279401995305520340930565294130787161682812646446049566053663062611695722008261995822542821167342075096192396937293068265123308051697846493665787200977379727611256517880021581086201913274231594259472487394983550326245624180578891486546592551732904844950032496685027390000954185836949235972203
+b = 9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999
+print(a)
+print(b)
+print(b + 1)
+print(a - b * 1000)
+print(a % 1000000007)
+print(0 - a)
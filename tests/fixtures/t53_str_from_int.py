@@ -0,0 +1,16 @@
+# str() of BigInts and string building from numbers
+big = 123456789012345678901234567890
+print(str(big))
+print(str(0 - big))
+print(str(0))
+s = "big*big=" + str(big * big)
+print(s)
+row = ""
+for i in range(1, 8):
+    row = row + str(i * big) + ","
+print(row)
+power = 1
+for i in range(0, 60):
+    power = power * 1000
+digits = str(power)
+print(len(digits))
@@ -0,0 +1,13 @@
+# Modular exponentiation on BigInts: pow(base, exp, mod)
+p = 170141183460469231731687303715884105727
+print(pow(3, p - 1, p))
+print(pow(2, p, p))
+m = 1000000000000000000000
+print(pow(7, m * m * m, m))
+print(pow(123456789123456789123, 1000003, m + 7))
+print(pow(0 - 5, 77, 0 - m - 7))
+print(pow(12345, 0, p))
+x = 1
+for i in range(1, 6):
+    x = pow(x * 10 + i, i * 1000, p)
+print(x)
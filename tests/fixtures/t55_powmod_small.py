@@ -0,0 +1,17 @@
+# Modular exponentiation on machine integers
+def is_probable_prime(n):
+    if n < 2:
+        return 0
+    for a in range(2, 8):
+        if a % n != 0:
+            if pow(a, n - 1, n) != 1:
+                return 0
+    return 1
+
+count = 0
+for n in range(2, 2000):
+    count = count + is_probable_prime(n)
+print(count)
+print(pow(123456789, 987654321, 1000000007))
+print(pow(0 - 2, 3, 5))
+print(pow(2, 3, 0 - 5))
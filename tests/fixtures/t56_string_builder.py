@@ -0,0 +1,23 @@
+# Concatenation chains and accumulating loops build strings in place
+s = ""
+for i in range(12):
+    s = s + str(i) + ","
+print(s)
+
+label = "len=" + str(len(s)) + " last=" + str(11) + "!"
+print(label)
+
+s = s + "|" + s
+print(s)
+
+t = s
+s = s + "tail"
+print(t)
+print(s)
+
+w = ""
+n = 0
+while n < 300:
+    w = w + "ab"
+    n = n + 1
+print(len(w))
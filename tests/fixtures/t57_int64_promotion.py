@@ -0,0 +1,17 @@
+x = 3037000499
+print(x * x)
+x = x + 1
+print(x * x)
+big = 9223372036854775807
+print(big + 1)
+print(-big - 2)
+p = 1
+for i in range(1, 26):
+    p = p * i
+print(p)
+s = 0
+for i in range(10, 0, -3):
+    s = s + i // 4 - i % 4
+print(s)
+print(-7 // 2)
+print(-7 % 3)
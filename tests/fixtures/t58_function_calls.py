@@ -0,0 +1,51 @@
+# Inlining, tail calls and int64_t entry points with BigInt fallback
+
+def gcd(a, b):
+    if b == 0:
+        return a
+    return gcd(b, a % b)
+
+def fact(n, acc):
+    if n <= 1:
+        return acc
+    return fact(n - 1, acc * n)
+
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def sq(x):
+    return x * x
+
+def sum_odd(n):
+    total = 0
+    for i in range(n):
+        if i % 2 == 0:
+            continue
+        total = total + i
+    return total
+
+def collatz(n):
+    steps = 0
+    while n != 1:
+        steps = steps + 1
+        if n % 2 == 0:
+            n = n // 2
+            continue
+        n = 3 * n + 1
+    return steps
+
+print(gcd(1071, 462))
+print(gcd(0 - 48, 18))
+print(fact(20, 1))
+print(fact(25, 1))
+print(fib(25))
+print(sq(3037000499))
+print(sq(3037000500))
+print(sum_odd(1000))
+print(collatz(27))
+total = 0
+for k in range(1, 200):
+    total = total + gcd(k, 360) + sq(k)
+print(total)
@@ -0,0 +1,475 @@
+/*
+ * Micro-benchmarks of the runtime's BigInt, math and string operations.
+ *
+ * Every case times one runtime call in process, on operands from one limb
+ * to a million digits, so that the numbers carry no process startup or
+ * code generation noise. A case is calibrated to the number of calls that
+ * lasts at least the target time, warmed up, then timed over repetitions
+ * of that many calls. The JSON report has one entry per case in the shape
+ * of BenchmarkResult.to_dict() in test_runtime_performance.py, with the
+ * time of each repetition and the time (and TSC cycles, where there is a
+ * TSC) per call; ReportGenerator.compare_with_baseline() checks it against
+ * a stored report.
+ *
+ * Build from the repository root:
+ *     gcc -O2 -std=c11 -Iruntime tests/unit/bench_runtime.c runtime/rt_*.c -pthread -lm -o bench_runtime
+ *
+ * Usage:
+ *     bench_runtime [--quick] [--max-digits N] [--repetitions N] [--target-ms MS]
+ *                   [--filter TEXT] [--json FILE]
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../../runtime/runtime.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define BENCH_NULL_DEVICE "NUL"
+#else
+#include <time.h>
+#define BENCH_NULL_DEVICE "/dev/null"
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define BENCH_HAVE_TSC 1
+#endif
+
+/* Repetitions kept in a report, at most */
+#define BENCH_MAX_REPETITIONS 64
+
+/* ==================== Timing ==================== */
+
+static double bench_now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+static uint64_t bench_cycles(void) {
+#ifdef BENCH_HAVE_TSC
+    return (uint64_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* ==================== Cases ==================== */
+
+/* Operands of a case, built once by its setup function */
+typedef struct {
+    rt_int a, b, q, r;
+    rt_str s, pattern, replacement;
+    rt_str parts[64];
+    size_t nparts;
+    char* dec;
+    int64_t n;
+    FILE* sink;
+} bench_ctx;
+
+typedef struct {
+    const char* name;
+    const char* unit;                 /* What the sizes count: "digits", "chars" or "n" */
+    const size_t* sizes;              /* Zero-terminated */
+    void (*setup)(bench_ctx* ctx, size_t size);
+    void (*run)(bench_ctx* ctx);
+} bench_case;
+
+/* Deterministic pseudo-random digits, so runs compare with each other */
+static uint64_t bench_seed = 88172645463325252ULL;
+
+static unsigned bench_random(void) {
+    bench_seed ^= bench_seed << 13;
+    bench_seed ^= bench_seed >> 7;
+    bench_seed ^= bench_seed << 17;
+    return (unsigned)(bench_seed >> 32);
+}
+
+static char* bench_digits(size_t digits) {
+    char* text = malloc(digits + 1);
+    if (text == NULL) {
+        fprintf(stderr, "bench_runtime: out of memory\n");
+        exit(1);
+    }
+    text[0] = (char)('1' + bench_random() % 9);
+    for (size_t i = 1; i < digits; i++) {
+        text[i] = (char)('0' + bench_random() % 10);
+    }
+    text[digits] = '\0';
+    return text;
+}
+
+static void bench_set_random(rt_int* x, size_t digits) {
+    char* text = bench_digits(digits);
+    rt_int_from_dec(x, text);
+    free(text);
+}
+
+static rt_str bench_random_str(size_t chars) {
+    rt_str s = rt_str_with_capacity(chars + 1);
+    for (size_t i = 0; i < chars; i++) {
+        s.data[i] = (char)('a' + bench_random() % 26);
+    }
+    s.data[chars] = '\0';
+    s.len = chars;
+    return s;
+}
+
+static void setup_two_ints(bench_ctx* ctx, size_t digits) {
+    bench_set_random(&ctx->a, digits);
+    bench_set_random(&ctx->b, digits);
+}
+
+static void setup_division(bench_ctx* ctx, size_t digits) {
+    /* A 2n-digit dividend by an n-digit divisor */
+    bench_set_random(&ctx->a, 2 * digits);
+    bench_set_random(&ctx->b, digits);
+}
+
+static void setup_decimal(bench_ctx* ctx, size_t digits) {
+    ctx->dec = bench_digits(digits);
+}
+
+static void setup_one_int(bench_ctx* ctx, size_t digits) {
+    bench_set_random(&ctx->a, digits);
+}
+
+static void setup_power(bench_ctx* ctx, size_t digits) {
+    /* 3^n with the given number of digits */
+    rt_int_set_si(&ctx->a, 3);
+    ctx->n = (int64_t)((double)digits / log10(3.0));
+}
+
+static void setup_count(bench_ctx* ctx, size_t n) {
+    ctx->n = (int64_t)n;
+}
+
+static void setup_find(bench_ctx* ctx, size_t chars) {
+    /* The pattern only occurs at the very end */
+    ctx->s = bench_random_str(chars);
+    memset(ctx->s.data + chars - 8, '#', 8);
+    ctx->pattern = rt_str_from_cstr("########");
+}
+
+static void setup_replace(bench_ctx* ctx, size_t chars) {
+    ctx->s = bench_random_str(chars);
+    ctx->pattern = rt_str_from_cstr("e");
+    ctx->replacement = rt_str_from_cstr("EE");
+}
+
+static void setup_concat(bench_ctx* ctx, size_t chars) {
+    ctx->s = bench_random_str(chars);
+    ctx->pattern = bench_random_str(chars);
+}
+
+static void setup_join(bench_ctx* ctx, size_t chars) {
+    /* Pieces of chars / 64 characters (at least one), 64 of them */
+    ctx->nparts = sizeof(ctx->parts) / sizeof(ctx->parts[0]);
+    for (size_t i = 0; i < ctx->nparts; i++) {
+        ctx->parts[i] = bench_random_str(chars / ctx->nparts ? chars / ctx->nparts : 1);
+    }
+    ctx->pattern = rt_str_from_cstr(", ");
+}
+
+static void run_int_add(bench_ctx* ctx) { rt_int_add(&ctx->r, &ctx->a, &ctx->b); }
+static void run_int_mul(bench_ctx* ctx) { rt_int_mul(&ctx->r, &ctx->a, &ctx->b); }
+static void run_int_divmod(bench_ctx* ctx) { rt_int_divmod(&ctx->q, &ctx->r, &ctx->a, &ctx->b); }
+static void run_int_from_dec(bench_ctx* ctx) { rt_int_from_dec(&ctx->r, ctx->dec); }
+static void run_int_fprint(bench_ctx* ctx) { rt_int_fprint(ctx->sink, &ctx->a); }
+static void run_math_pow(bench_ctx* ctx) { rt_math_pow(&ctx->r, &ctx->a, ctx->n); }
+static void run_math_factorial(bench_ctx* ctx) { rt_math_factorial(&ctx->r, ctx->n); }
+static void run_math_sqrt(bench_ctx* ctx) { rt_math_sqrt(&ctx->r, &ctx->a); }
+
+static void run_str_find(bench_ctx* ctx) {
+    if (rt_str_find(ctx->s, ctx->pattern, 0) != ctx->s.len - 8) {
+        fprintf(stderr, "bench_runtime: str_find found the wrong position\n");
+        exit(1);
+    }
+}
+
+static void run_str_replace(bench_ctx* ctx) {
+    rt_str out = rt_str_replace(ctx->s, ctx->pattern, ctx->replacement);
+    rt_str_clear(&out);
+}
+
+static void run_str_concat(bench_ctx* ctx) {
+    rt_str out = rt_str_concat(ctx->s, ctx->pattern);
+    rt_str_clear(&out);
+}
+
+static void run_str_join(bench_ctx* ctx) {
+    rt_str out = rt_str_join(ctx->parts, ctx->nparts, ctx->pattern);
+    rt_str_clear(&out);
+}
+
+/* 19 digits fill one 64-bit limb */
+static const size_t int_sizes[] = {19, 100, 1000, 10000, 100000, 1000000, 0};
+static const size_t factorial_sizes[] = {20, 100, 1000, 10000, 100000, 0};
+static const size_t str_sizes[] = {16, 1000, 100000, 1000000, 0};
+
+static const bench_case cases[] = {
+    {"int_add", "digits", int_sizes, setup_two_ints, run_int_add},
+    {"int_mul", "digits", int_sizes, setup_two_ints, run_int_mul},
+    {"int_divmod", "digits", int_sizes, setup_division, run_int_divmod},
+    {"int_from_dec", "digits", int_sizes, setup_decimal, run_int_from_dec},
+    {"int_fprint", "digits", int_sizes, setup_one_int, run_int_fprint},
+    {"math_pow", "digits", int_sizes, setup_power, run_math_pow},
+    {"math_factorial", "n", factorial_sizes, setup_count, run_math_factorial},
+    {"math_sqrt", "digits", int_sizes, setup_one_int, run_math_sqrt},
+    {"str_find", "chars", str_sizes, setup_find, run_str_find},
+    {"str_replace", "chars", str_sizes, setup_replace, run_str_replace},
+    {"str_concat", "chars", str_sizes, setup_concat, run_str_concat},
+    {"str_join", "chars", str_sizes, setup_join, run_str_join},
+};
+
+static void bench_ctx_init(bench_ctx* ctx, FILE* sink) {
+    memset(ctx, 0, sizeof(*ctx));
+    rt_int_init(&ctx->a);
+    rt_int_init(&ctx->b);
+    rt_int_init(&ctx->q);
+    rt_int_init(&ctx->r);
+    ctx->sink = sink;
+}
+
+static void bench_ctx_clear(bench_ctx* ctx) {
+    rt_int_clear(&ctx->a);
+    rt_int_clear(&ctx->b);
+    rt_int_clear(&ctx->q);
+    rt_int_clear(&ctx->r);
+    rt_str_clear(&ctx->s);
+    rt_str_clear(&ctx->pattern);
+    rt_str_clear(&ctx->replacement);
+    for (size_t i = 0; i < ctx->nparts; i++) {
+        rt_str_clear(&ctx->parts[i]);
+    }
+    free(ctx->dec);
+}
+
+/* ==================== Measurement ==================== */
+
+typedef struct {
+    char name[64];
+    size_t repetitions;
+    size_t ops;                           /* Calls per repetition */
+    double ms[BENCH_MAX_REPETITIONS];     /* Time of each repetition */
+    double cycles[BENCH_MAX_REPETITIONS]; /* TSC cycles of each repetition */
+} bench_result;
+
+typedef struct {
+    size_t max_size;
+    size_t repetitions;
+    size_t warmup;
+    double target_ms;
+    const char* filter;
+    const char* json_path;
+} bench_options;
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double median(const double* values, size_t n) {
+    double sorted[BENCH_MAX_REPETITIONS];
+    memcpy(sorted, values, n * sizeof(double));
+    qsort(sorted, n, sizeof(double), compare_doubles);
+    return (n % 2) ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+}
+
+static void run_ops(const bench_case* c, bench_ctx* ctx, size_t ops) {
+    for (size_t i = 0; i < ops; i++) {
+        c->run(ctx);
+    }
+}
+
+static void measure(const bench_case* c, size_t size, const bench_options* opt, FILE* sink,
+                    bench_result* result) {
+    bench_ctx ctx;
+    bench_ctx_init(&ctx, sink);
+    c->setup(&ctx, size);
+
+    /* Double the calls per repetition until one lasts the target time */
+    size_t ops = 1;
+    for (;;) {
+        double start = bench_now_ns();
+        run_ops(c, &ctx, ops);
+        double ms = (bench_now_ns() - start) / 1e6;
+        if (ms >= opt->target_ms || ops >= ((size_t)1 << 30)) {
+            break;
+        }
+        ops = (ms > 0 && opt->target_ms / ms < 2) ? (size_t)(ops * opt->target_ms / ms) + 1 : ops * 2;
+    }
+
+    for (size_t i = 0; i < opt->warmup; i++) {
+        run_ops(c, &ctx, ops);
+    }
+    for (size_t i = 0; i < opt->repetitions; i++) {
+        uint64_t cycles = bench_cycles();
+        double start = bench_now_ns();
+        run_ops(c, &ctx, ops);
+        result->ms[i] = (bench_now_ns() - start) / 1e6;
+        result->cycles[i] = (double)(bench_cycles() - cycles);
+    }
+    result->repetitions = opt->repetitions;
+    result->ops = ops;
+    snprintf(result->name, sizeof(result->name), "%s/%s=%zu", c->name, c->unit, size);
+    bench_ctx_clear(&ctx);
+}
+
+/* ==================== Report ==================== */
+
+static void print_json(FILE* fp, const bench_result* results, size_t count, const bench_options* opt) {
+    fprintf(fp, "{\n  \"limb_bits\": %d,\n  \"repetitions\": %zu,\n  \"warmup\": %zu,\n"
+                "  \"target_ms\": %g,\n  \"benchmarks\": [",
+            RT_INT_LIMB_BITS, opt->repetitions, opt->warmup, opt->target_ms);
+    for (size_t i = 0; i < count; i++) {
+        const bench_result* r = &results[i];
+        size_t n = r->repetitions;
+        double sum = 0, lo = r->ms[0], hi = r->ms[0], var = 0;
+        for (size_t k = 0; k < n; k++) {
+            sum += r->ms[k];
+            lo = r->ms[k] < lo ? r->ms[k] : lo;
+            hi = r->ms[k] > hi ? r->ms[k] : hi;
+        }
+        double mean = sum / (double)n;
+        for (size_t k = 0; k < n; k++) {
+            var += (r->ms[k] - mean) * (r->ms[k] - mean);
+        }
+        double med = median(r->ms, n);
+
+        fprintf(fp, "%s\n    {\n      \"test_name\": \"%s\",\n      \"execution_type\": \"native\",\n"
+                    "      \"iterations\": %zu,\n      \"ops_per_iteration\": %zu,\n"
+                    "      \"execution_time_ms\": {\"mean\": %.6g, \"median\": %.6g, \"min\": %.6g, "
+                    "\"max\": %.6g, \"std\": %.6g},\n      \"ns_per_op\": %.6g,\n",
+                i ? "," : "", r->name, n, r->ops, mean, med, lo, hi,
+                n > 1 ? sqrt(var / (double)(n - 1)) : 0.0, med * 1e6 / (double)r->ops);
+#ifdef BENCH_HAVE_TSC
+        fprintf(fp, "      \"cycles_per_op\": %.6g\n    }", median(r->cycles, n) / (double)r->ops);
+#else
+        fprintf(fp, "      \"cycles_per_op\": null\n    }");
+#endif
+    }
+    fprintf(fp, "\n  ]\n}\n");
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bench_runtime [--quick] [--max-digits N] [--repetitions N] [--target-ms MS]\n"
+            "                     [--filter TEXT] [--json FILE]\n"
+            "  --quick         sizes up to 10^4, 3 repetitions of 2 ms (for regression gating)\n"
+            "  --max-digits N  largest operand size to run (default 1000000)\n"
+            "  --repetitions N timed repetitions per case (default 7, at most %d)\n"
+            "  --target-ms MS  minimum time of one repetition (default 20)\n"
+            "  --filter TEXT   only run cases whose name contains TEXT\n"
+            "  --json FILE     write the JSON report to FILE ('-' for standard output)\n",
+            BENCH_MAX_REPETITIONS);
+}
+
+int main(int argc, char** argv) {
+    bench_options opt = {1000000, 7, 1, 20.0, NULL, NULL};
+
+    for (int i = 1; i < argc; i++) {
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "--quick") == 0) {
+            opt.max_size = 10000;
+            opt.repetitions = 3;
+            opt.target_ms = 2.0;
+        } else if (strcmp(argv[i], "--max-digits") == 0 && value) {
+            opt.max_size = (size_t)strtoull(value, NULL, 10);
+            i++;
+        } else if (strcmp(argv[i], "--repetitions") == 0 && value) {
+            opt.repetitions = (size_t)strtoull(value, NULL, 10);
+            i++;
+        } else if (strcmp(argv[i], "--target-ms") == 0 && value) {
+            opt.target_ms = strtod(value, NULL);
+            i++;
+        } else if (strcmp(argv[i], "--filter") == 0 && value) {
+            opt.filter = value;
+            i++;
+        } else if (strcmp(argv[i], "--json") == 0 && value) {
+            opt.json_path = value;
+            i++;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (opt.repetitions < 1 || opt.repetitions > BENCH_MAX_REPETITIONS) {
+        usage();
+        return 2;
+    }
+
+    FILE* sink = fopen(BENCH_NULL_DEVICE, "w");
+    if (sink == NULL) {
+        sink = tmpfile();
+    }
+    size_t capacity = 0;
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        for (const size_t* size = cases[c].sizes; *size; size++) {
+            capacity++;
+        }
+    }
+    bench_result* results = calloc(capacity, sizeof(bench_result));
+    if (sink == NULL || results == NULL) {
+        fprintf(stderr, "bench_runtime: cannot set up\n");
+        return 1;
+    }
+
+    /* With the report on standard output, the table goes to standard error */
+    int json_stdout = opt.json_path != NULL && strcmp(opt.json_path, "-") == 0;
+    FILE* table = json_stdout ? stderr : stdout;
+    fprintf(table, "%-32s %12s %14s %14s\n", "case", "calls/rep", "ns/call", "cycles/call");
+
+    size_t count = 0;
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        for (const size_t* size = cases[c].sizes; *size && *size <= opt.max_size; size++) {
+            char name[64];
+            snprintf(name, sizeof(name), "%s/%s=%zu", cases[c].name, cases[c].unit, *size);
+            if (opt.filter && !strstr(name, opt.filter)) {
+                continue;
+            }
+            bench_result* r = &results[count++];
+            measure(&cases[c], *size, &opt, sink, r);
+            double ns = median(r->ms, r->repetitions) * 1e6 / (double)r->ops;
+            fprintf(table, "%-32s %12zu %14.1f %14.1f\n", r->name, r->ops, ns,
+                    median(r->cycles, r->repetitions) / (double)r->ops);
+            fflush(table);
+        }
+    }
+
+    if (opt.json_path != NULL) {
+        FILE* fp = json_stdout ? stdout : fopen(opt.json_path, "w");
+        if (fp == NULL) {
+            fprintf(stderr, "bench_runtime: cannot write %s\n", opt.json_path);
+            return 1;
+        }
+        print_json(fp, results, count, &opt);
+        if (!json_stdout) {
+            fclose(fp);
+        }
+    }
+
+    free(results);
+    fclose(sink);
+    rt_pool_shutdown();
+    return 0;
+}
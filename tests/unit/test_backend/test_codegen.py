@@ -1,14 +1,16 @@
 """
 Unit tests for the code generation module.
 
-This module tests the CodeGenerator class defined in pcc.backend.codegen.
+This module tests the CodeGenerator class defined in pcc.backend.codegen,
+and the native integer back end in pcc.backend.codegen_fast.
 """
 
 import pytest
 from pcc.backend import CodeGenerator, CSource
+from pcc.backend.codegen_fast import generate as generate_fast
 from pcc.ir import (
-    IntConst, StrConst, Var, BinOp, CmpOp, Call,
-    Assign, Print, If, While, ForRange, Return,
+    IntConst, StrConst, Var, BinOp, CmpOp, Call, BuiltinCall,
+    Assign, Print, If, While, ForRange, Return, Break, Continue,
     FunctionDef, ClassDef, ModuleIR
 )
 
@@ -327,8 +329,10 @@ class TestCodeGeneratorEdgeCases:
             main=[Print(outer)]
         )
         result = codegen.generate(module)
-        # Should generate multiple temporaries
-        assert result.c_source.count("rt_int_init") >= 2
+        # Each step reuses the temporary its operand dies in
+        assert "rt_int_add_si(&pcc_tmp_1, &pcc_tmp_1, 2LL);" in result.c_source
+        assert "rt_int_mul_si(&pcc_tmp_1, &pcc_tmp_1, 3LL);" in result.c_source
+        assert result.c_source.count("rt_int_init") == 1
 
     def test_string_concatenation(self, codegen):
         """Test generating code for string concatenation."""
@@ -343,3 +347,570 @@ class TestCodeGeneratorEdgeCases:
         )
         result = codegen.generate(module)
         assert "rt_str" in result.c_source
+
+
+class TestCodeGeneratorScopes:
+    """Tests for temporary scopes and local variable hoisting."""
+
+    def test_loop_resets_temporaries(self, codegen):
+        """Test that loop temporaries are pooled and the loop scope is reset on every back-edge."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("i", IntConst(0)),
+                While(
+                    test=CmpOp("<", Var("i"), IntConst(10)),
+                    body=[Assign("i", BinOp("+", Var("i"), IntConst(1)))]
+                )
+            ]
+        )
+        result = codegen.generate(module)
+        src = result.c_source
+        assert "rt_scope_int(&" not in src
+        loop_start = src.index("while_start_1:")
+        assert "rt_int_init(&pcc_tmp_" not in src[loop_start:]
+        scope_decl = src.rindex("rt_scope_t pcc_scope_", 0, loop_start)
+        scope = src[scope_decl:].split()[1]
+        assert f"rt_scope_reset({scope});" in src[loop_start:]
+
+    def test_locals_declared_once(self, codegen):
+        """Test that a local first assigned inside a loop is declared at entry."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                ForRange(
+                    var="i",
+                    start=IntConst(0),
+                    stop=IntConst(5),
+                    step=IntConst(1),
+                    body=[Assign("y", BinOp("*", Var("i"), Var("i")))],
+                    lineno=1
+                )
+            ]
+        )
+        result = codegen.generate(module)
+        src = result.c_source
+        assert src.count("rt_int y;") == 1
+        assert src.index("rt_int y;") < src.index("for_start_")
+        assert "rt_int_clear(&y);" in src
+
+    def test_return_jumps_to_exit(self, codegen):
+        """Test that return leaves the function early through a single exit."""
+        module = ModuleIR(
+            functions=[FunctionDef(
+                name="sign",
+                params=["n"],
+                body=[
+                    If(
+                        test=CmpOp("<", Var("n"), IntConst(0)),
+                        body=[Return(IntConst(-1))],
+                        orelse=[]
+                    ),
+                    Return(IntConst(1))
+                ],
+                lineno=1
+            )],
+            classes=[],
+            main=[Print(Call("sign", [IntConst(5)]))]
+        )
+        result = codegen.generate(module)
+        src = result.c_source
+        assert src.count("goto pcc_exit;") == 2
+        assert "pcc_exit:" in src
+        assert "rt_int_clear(&n);" in src
+
+    def test_param_reassignment_reuses_parameter(self, codegen):
+        """Test that assigning to a parameter does not redeclare it."""
+        module = ModuleIR(
+            functions=[FunctionDef(
+                name="dec",
+                params=["n"],
+                body=[
+                    Assign("n", BinOp("-", Var("n"), IntConst(1))),
+                    Return(Var("n"))
+                ],
+                lineno=1
+            )],
+            classes=[],
+            main=[Print(Call("dec", [IntConst(5)]))]
+        )
+        result = codegen.generate(module)
+        assert result.c_source.count("rt_int n;") == 1
+
+
+class TestCodeGeneratorTempPool:
+    """Tests for pooled BigInt temporaries."""
+
+    def test_deep_expression_reuses_temps(self, codegen):
+        """Test that dead operands are recycled within one expression."""
+        # (a*b + c*d) - (a*d + b*c): four products, at most three live at once
+        prod = lambda x, y: BinOp("*", Var(x), Var(y))
+        expr = BinOp("-", BinOp("+", prod("a", "b"), prod("c", "d")),
+                     BinOp("+", prod("a", "d"), prod("b", "c")))
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[Assign(v, IntConst(3)) for v in "abcd"] + [
+                ForRange("i", IntConst(0), IntConst(10), IntConst(1), [Print(expr)], 1)
+            ]
+        )
+        src = codegen.generate(module).c_source
+        loop_start = src.index("for_start_")
+        assert src.count("rt_int_mul(&pcc_tmp_") == 4
+        assert src.count("rt_int_init(&pcc_tmp_") <= 6
+        assert "rt_int_init(&pcc_tmp_" not in src[loop_start:]
+
+    def test_statements_share_temps(self, codegen):
+        """Test that a temporary is reused once its statement has ended."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("x", IntConst(2)),
+                Print(BinOp("*", Var("x"), Var("x"))),
+                Print(BinOp("*", Var("x"), Var("x")))
+            ]
+        )
+        src = codegen.generate(module).c_source
+        assert src.count("rt_int_mul(&pcc_tmp_1, &x, &x);") == 2
+        assert src.count("rt_int pcc_tmp_") == 1
+        assert "rt_int_clear(&pcc_tmp_1);" in src
+
+    def test_loops_in_sequence_compile_names(self, codegen):
+        """Test that reused temporaries never repeat a scalar declaration."""
+        loop = ForRange("i", IntConst(0), Var("n"), IntConst(1), [Print(Var("i"))], 1)
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[Assign("n", IntConst(3)), loop, loop]
+        )
+        src = codegen.generate(module).c_source
+        decls = [line.split("=")[0].strip() for line in src.splitlines()
+                 if line.strip().startswith("int pcc_tmp_")]
+        assert len(decls) == 2
+        assert len(set(decls)) == 2
+
+
+class TestCodeGeneratorInPlace:
+    """Tests for in-place BigInt updates."""
+
+    def test_increment_updates_in_place(self, codegen):
+        """Test that x = x + 1 adds the constant directly into x."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("x", IntConst(5)),
+                Assign("x", BinOp("+", Var("x"), IntConst(1))),
+                Print(Var("x"))
+            ]
+        )
+        result = codegen.generate(module)
+        assert "rt_int_set_si(&x, 5LL);" in result.c_source
+        assert "rt_int_add_si(&x, &x, 1LL);" in result.c_source
+        assert "rt_int_copy(&x" not in result.c_source
+
+    def test_scale_by_constant(self, codegen):
+        """Test that x = 3 * x uses the single-word multiply."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("x", IntConst(7)),
+                Assign("x", BinOp("*", IntConst(3), Var("x"))),
+                Print(Var("x"))
+            ]
+        )
+        result = codegen.generate(module)
+        assert "rt_int_mul_si(&x, &x, 3LL);" in result.c_source
+
+    def test_multiply_accumulate(self, codegen):
+        """Test that x = x - y * k becomes a single addmul."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("x", IntConst(100)),
+                Assign("y", IntConst(4)),
+                Assign("x", BinOp("-", Var("x"), BinOp("*", Var("y"), IntConst(6)))),
+                Print(Var("x"))
+            ]
+        )
+        result = codegen.generate(module)
+        assert "rt_int_addmul_si(&x, &y, -6LL);" in result.c_source
+
+
+class TestCodeGeneratorBuiltins:
+    """Tests for number-theoretic builtins."""
+
+    def test_pow_with_modulus(self, codegen):
+        """Test that pow(b, e, m) calls the modular kernel."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("b", IntConst(3)),
+                Assign("e", IntConst(1000)),
+                Print(BuiltinCall("pow", [Var("b"), Var("e"), IntConst(1009)]))
+            ]
+        )
+        result = codegen.generate(module)
+        assert "rt_math_powmod(&pcc_tmp_" in result.c_source
+        assert "&b, &e, " in result.c_source
+        assert "rt_math_pow(" not in result.c_source
+
+    def test_two_pows_in_one_scope(self, codegen):
+        """Test that each pow(b, e) gets its own exponent variable."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("x", IntConst(2)),
+                Print(BuiltinCall("pow", [Var("x"), IntConst(10)])),
+                Print(BuiltinCall("pow", [Var("x"), IntConst(20)]))
+            ]
+        )
+        result = codegen.generate(module)
+        assert result.c_source.count("rt_math_pow(&") == 2
+        assert "int64_t exp;" not in result.c_source
+
+    def test_isqrt(self, codegen):
+        """Test that isqrt() calls the Newton square root."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("n", IntConst(1000000)),
+                Print(BuiltinCall("isqrt", [Var("n")]))
+            ]
+        )
+        result = codegen.generate(module)
+        assert "rt_math_sqrt(&pcc_tmp_" in result.c_source
+
+
+class TestCodeGeneratorStrings:
+    """Tests for string concatenation lowering."""
+
+    def test_concat_chain_builds_once(self, codegen):
+        """Test that a + b + c reserves once and appends each operand."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("s", StrConst("ab")),
+                Print(BinOp("+", BinOp("+", BinOp("+", StrConst("n="), BuiltinCall("str", [IntConst(7)])),
+                                        StrConst(", s=")), Var("s")))
+            ]
+        )
+        result = codegen.generate(module)
+        assert result.c_source.count("rt_strbuf_reserve(") == 1
+        assert '"n=", 2);' in result.c_source
+        assert "rt_strbuf_append_int(&pcc_tmp_" in result.c_source
+        assert ", s);" in result.c_source
+        assert "rt_str_concat" not in result.c_source
+        assert "rt_str_from_int" not in result.c_source
+
+    def test_accumulate_appends_in_place(self, codegen):
+        """Test that s = s + x appends to s instead of copying it."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("s", StrConst("")),
+                ForRange("i", IntConst(0), IntConst(10), IntConst(1), [
+                    Assign("s", BinOp("+", BinOp("+", Var("s"), BuiltinCall("str", [Var("i")])), StrConst(",")))
+                ], 1),
+                Print(Var("s"))
+            ]
+        )
+        result = codegen.generate(module)
+        assert "rt_strbuf_reserve(&s, " in result.c_source
+        assert "rt_strbuf_append_int(&s, &i);" in result.c_source
+        assert 'rt_strbuf_append_bytes(&s, ",", 1);' in result.c_source
+
+    def test_self_concat_is_not_in_place(self, codegen):
+        """Test that s = s + s builds a new string rather than appending."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("s", StrConst("ab")),
+                Assign("s", BinOp("+", Var("s"), Var("s"))),
+                Print(Var("s"))
+            ]
+        )
+        result = codegen.generate(module)
+        assert "rt_strbuf_append(&s, " not in result.c_source
+        assert "s = pcc_tmp_" in result.c_source
+
+    def test_literals_are_interned(self, codegen):
+        """Test that string literals are interned once instead of allocated."""
+        module = ModuleIR(
+            functions=[
+                FunctionDef("f", [], [Print(StrConst("hi")), Return(IntConst(0))], 1)
+            ],
+            classes=[],
+            main=[
+                Print(StrConst("hi")),
+                Assign("s", StrConst("hi")),
+                Print(Var("s"))
+            ]
+        )
+        result = codegen.generate(module)
+        assert result.c_source.count('rt_str_intern_static("hi", 2);') == 1
+        assert "pcc_init_literals();" in result.c_source
+        assert "s = pcc_lit_0;" in result.c_source
+        assert "rt_str_from_cstr" not in result.c_source
+
+
+class TestCodeGeneratorRangeInference:
+    """Tests for int64_t locals chosen by range inference."""
+
+    @pytest.fixture
+    def inferring(self):
+        return CodeGenerator(infer_ranges=True)
+
+    def test_loop_counter_is_native(self, inferring):
+        """Test that a bounded range() loop runs on int64_t."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                ForRange("i", IntConst(0), IntConst(10), IntConst(1), [
+                    Print(BinOp("*", Var("i"), Var("i")))
+                ], 1)
+            ]
+        )
+        result = inferring.generate(module)
+        assert "int64_t i = 0;" in result.c_source
+        assert "rt_print_si((i * i));" in result.c_source
+        assert "rt_int i;" not in result.c_source
+
+    def test_accumulator_promotes(self, inferring):
+        """Test that an unbounded accumulator stays a BigInt fed natively."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("total", IntConst(0)),
+                ForRange("i", IntConst(0), IntConst(10), IntConst(1), [
+                    Assign("total", BinOp("+", Var("total"), BinOp("*", Var("i"), Var("i"))))
+                ], 1),
+                Print(Var("total"))
+            ]
+        )
+        result = inferring.generate(module)
+        assert "rt_int total;" in result.c_source
+        assert "rt_int_add_si(&total, &total, (i * i));" in result.c_source
+
+    def test_possible_overflow_is_checked(self, inferring):
+        """Test that a native product that may overflow is promoted on overflow."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("x", IntConst(1 << 40)),
+                Assign("y", BinOp("*", Var("x"), Var("x"))),
+                Print(Var("y"))
+            ]
+        )
+        result = inferring.generate(module)
+        assert "int64_t x = 0;" in result.c_source
+        assert "rt_int_set_si_mul(&y, x, x);" in result.c_source
+
+    def test_params_stay_bigint(self, inferring):
+        """Test that parameters are BigInts compared with a native operand."""
+        module = ModuleIR(
+            functions=[
+                FunctionDef("f", ["n"], [
+                    If(CmpOp("<", IntConst(3), Var("n")), [Return(IntConst(1))], []),
+                    Return(IntConst(0))
+                ], 1)
+            ],
+            classes=[],
+            main=[]
+        )
+        result = inferring.generate(module)
+        assert "rt_int_cmp_si(&n, 3LL);" in result.c_source
+        assert "rt_int_set_si(out, 1LL);" in result.c_source
+
+
+class TestCodeGeneratorOptimizedIR:
+    """Tests for the IR forms produced by the optimization passes."""
+
+    def test_big_constant_is_predecoded(self, codegen):
+        """Test that an integer beyond int64 is built once from 32-bit words."""
+        module = ModuleIR(functions=[], classes=[], main=[Print(IntConst((1 << 64) + 5))])
+        src = codegen.generate(module).c_source
+        assert "static const uint32_t pcc_big_0_words[] = {0x00000005u, 0x00000000u, 0x00000001u};" in src
+        assert "rt_int_from_words(&pcc_big_0, pcc_big_0_words, 3, 1);" in src
+        assert "rt_print_int(&pcc_big_0);" in src
+        assert "rt_int_from_dec" not in src
+
+    def test_shifts_and_masks_on_bigints(self, codegen):
+        """Test that shift and mask operators use the bit-count kernels."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                Assign("x", IntConst(100)),
+                Print(BinOp("<<", Var("x"), IntConst(3))),
+                Print(BinOp(">>", Var("x"), IntConst(2))),
+                Print(BinOp("&", Var("x"), IntConst(15)))
+            ]
+        )
+        src = codegen.generate(module).c_source
+        assert "rt_int_shl(&pcc_tmp_1, &x, 3);" in src
+        assert "rt_int_shr(&pcc_tmp_1, &x, 2);" in src
+        assert "rt_int_mod_pow2(&pcc_tmp_1, &x, 4);" in src
+
+    def test_shifts_and_masks_native(self):
+        """Test that shift and mask operators on native values are plain C."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[
+                ForRange("i", IntConst(-50), IntConst(50), IntConst(1), [
+                    Print(BinOp("<<", Var("i"), IntConst(3))),
+                    Print(BinOp(">>", Var("i"), IntConst(2))),
+                    Print(BinOp("&", Var("i"), IntConst(15)))
+                ], 1)
+            ]
+        )
+        src = CodeGenerator(infer_ranges=True).generate(module).c_source
+        assert "rt_print_si((i * 8LL));" in src
+        assert "rt_print_si((i >> 2LL));" in src
+        assert "rt_print_si((i & 15LL));" in src
+
+
+class TestCodeGeneratorNativeEntryPoints:
+    """Tests for the checked int64_t entry points of integer functions."""
+
+    SQ_PLUS = FunctionDef("f", ["a", "b"], [Return(BinOp("+", BinOp("*", Var("a"), Var("a")), Var("b")))], 1)
+
+    def test_entry_point_checks_overflow(self):
+        """Test that every step may give up, and the BigInt version tries it first."""
+        module = ModuleIR(functions=[self.SQ_PLUS], classes=[], main=[])
+        src = CodeGenerator(infer_ranges=True).generate(module).c_source
+        assert "static int pcc_fn_f_si(int64_t* out, int64_t a, int64_t b) {" in src
+        assert "if (rt_si_mul_overflow(a, a, &pcc_tmp_1)) return 0;" in src
+        assert "if (rt_si_add_overflow(pcc_tmp_1, b, &pcc_tmp_2)) return 0;" in src
+        assert "pcc_fn_f_si(&pcc_si_out, pcc_si_a, pcc_si_b)) {" in src
+        assert "rt_int_set_si(out, pcc_si_out);" in src
+
+    def test_native_call_site(self):
+        """Test that native arguments are passed unboxed, with a BigInt fallback."""
+        main = [ForRange("i", IntConst(0), IntConst(10), IntConst(1), [
+            Print(Call("f", [Var("i"), IntConst(2)]))
+        ], 1)]
+        module = ModuleIR(functions=[self.SQ_PLUS], classes=[], main=main)
+        src = CodeGenerator(infer_ranges=True).generate(module).c_source
+        assert "if (pcc_fn_f_si(&pcc_tmp_1, i, 2LL)) {" in src
+
+    def test_impure_function_has_no_entry_point(self):
+        """Test that functions with output, or calling one, stay BigInt only."""
+        module = ModuleIR(
+            functions=[
+                FunctionDef("p", ["n"], [Print(Var("n")), Return(Var("n"))], 1),
+                FunctionDef("q", ["n"], [Return(Call("p", [Var("n")]))], 2),
+            ],
+            classes=[],
+            main=[]
+        )
+        src = CodeGenerator(infer_ranges=True).generate(module).c_source
+        assert "_si(int64_t* out" not in src
+
+    def test_without_range_inference(self, codegen):
+        """Test that entry points come with range inference only."""
+        module = ModuleIR(functions=[self.SQ_PLUS], classes=[], main=[])
+        assert "pcc_fn_f_si" not in codegen.generate(module).c_source
+
+    def test_integer_condition(self, codegen):
+        """Test that an integer used as a test is compared with zero."""
+        module = ModuleIR(
+            functions=[],
+            classes=[],
+            main=[Assign("x", IntConst(5)), If(Var("x"), [Print(IntConst(1))], [])]
+        )
+        assert "if (!rt_int_is_zero(&x)) {" in codegen.generate(module).c_source
+
+
+class TestCodeGeneratorParallel:
+    """Tests for range() loops run on the thread pool."""
+
+    SUM = [
+        Assign("s", IntConst(0)),
+        ForRange("i", IntConst(0), IntConst(100000), IntConst(1), [
+            Assign("s", BinOp("+", Var("s"), BinOp("*", Var("i"), Var("i"))))
+        ], 1),
+        Print(Var("s"))
+    ]
+
+    def test_reduction_runs_on_pool(self):
+        """Test that a sum is split into chunks with BigInt partial results."""
+        module = ModuleIR(functions=[], classes=[], main=self.SUM)
+        src = CodeGenerator(infer_ranges=True, parallel=True).generate(module).c_source
+        assert "static rt_error_code_t pcc_par_0(void* pcc_arg) {" in src
+        assert "rt_pool_range_chunks(0LL, 100000LL, 1LL, RT_POOL_FOR_GRAIN, pcc_par_0_bounds);" in src
+        assert "rt_pool_run(pcc_par_0, pcc_par_0_ctx, sizeof(pcc_par_0_t), pcc_par_0_n);" in src
+        assert "rt_int_add(&s, &s, &pcc_par_0_ctx[pcc_par_0_k].s);" in src
+
+    def test_serial_without_option(self):
+        """Test that loops stay serial unless parallel loops are enabled."""
+        module = ModuleIR(functions=[], classes=[], main=self.SUM)
+        assert "rt_pool_run" not in CodeGenerator(infer_ranges=True).generate(module).c_source
+
+    def test_output_keeps_loop_serial(self):
+        """Test that a loop printing its values is not split."""
+        module = ModuleIR(functions=[], classes=[], main=[
+            ForRange("i", IntConst(0), IntConst(10), IntConst(1), [Print(Var("i"))], 1)
+        ])
+        src = CodeGenerator(infer_ranges=True, parallel=True).generate(module).c_source
+        assert "rt_pool_run" not in src
+        assert "rt_print_si(i);" in src
+
+
+class TestNativeIntLoops:
+    """Tests for the loops of the native integer back end."""
+
+    def test_range_is_countable_for(self):
+        """Test that range() becomes a C for loop over a counter with constant bounds."""
+        module = ModuleIR(functions=[], classes=[], main=[
+            Assign("s", IntConst(0)),
+            ForRange("i", IntConst(0), IntConst(10), IntConst(1), [
+                If(CmpOp("==", Var("i"), IntConst(3)), [Continue(1)], []),
+                Assign("s", BinOp("+", Var("s"), Var("i")))
+            ], 1),
+            Print(Var("s"))
+        ])
+        src = generate_fast(module).c_source
+        assert "const long long pcc_ctr_1_stop = 10LL;" in src
+        assert "for (long long pcc_ctr_1 = 0LL; pcc_ctr_1 < pcc_ctr_1_stop; pcc_ctr_1 += pcc_ctr_1_step) {" in src
+        assert "    i = pcc_ctr_1;" in src
+        assert "    continue;" in src
+        assert "goto" not in src
+
+    def test_locals_of_loop_bodies_are_hoisted(self):
+        """Test that a local first assigned in a loop is visible after it, and loops may share a variable."""
+        loop = ForRange("i", IntConst(5), IntConst(0), IntConst(-1), [Assign("x", Var("i"))], 1)
+        module = ModuleIR(functions=[], classes=[], main=[loop, loop, Print(Var("x"))])
+        src = generate_fast(module).c_source
+        assert src.count("long long x = 0;") == 1
+        assert src.count("long long i = 0;") == 1
+        assert "pcc_ctr_1 > pcc_ctr_1_stop;" in src
+
+    def test_while_with_statement_test(self):
+        """Test that a while loop whose test needs temporaries evaluates it every pass."""
+        module = ModuleIR(functions=[], classes=[], main=[
+            Assign("n", IntConst(10)),
+            While(CmpOp(">", BinOp("%", Var("n"), IntConst(7)), IntConst(0)), [
+                Assign("n", BinOp("+", Var("n"), IntConst(1))),
+                If(CmpOp(">", Var("n"), IntConst(100)), [Break(1)], [])
+            ]),
+            Print(Var("n"))
+        ])
+        src = generate_fast(module).c_source
+        assert "    for (;;) {" in src
+        assert "    break;" in src
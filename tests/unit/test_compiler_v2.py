@@ -2,11 +2,20 @@
 Unit tests for the Compiler with ParserV2 integration.
 """
 
+import json
+import os
+import shutil
+import subprocess
+
 import pytest
 from pathlib import Path
 from pcc.core import Compiler
 from pcc.frontend import ParserV2, LexerError
 from pcc.frontend.parser_v1 import ParseError as ParseErrorV1
+from pcc.ir import IntConst, Print
+from pcc.ir.optimize import OptimizationOptions
+from pcc.utils.cache import BuildCache
+from pcc.utils.toolchain import Toolchain
 
 
 class TestCompilerV2:
@@ -137,5 +146,284 @@ x = greet()
         assert "greet" in c_source.c_source
 
 
+class TestCompilerBuildProfile:
+    """Tests for the debug and release build profiles."""
+    
+    def test_debug_profile_has_no_defines(self):
+        """Test that the default profile keeps the runtime checks."""
+        assert Compiler(parser_version=2)._defines() == ()
+    
+    def test_release_profile_defines(self):
+        """Test that the release profile compiles the NULL checks out."""
+        compiler = Compiler(parser_version=2, release=True)
+        assert compiler._defines() == ("RT_RELEASE", "NDEBUG")
+    
+    def test_threads_define(self):
+        """Test that --threads compiles in the default pool size."""
+        compiler = Compiler(parser_version=2, release=True, threads=4)
+        assert compiler._defines() == ("RT_RELEASE", "NDEBUG", "RT_POOL_DEFAULT_THREADS=4")
+        with pytest.raises(ValueError):
+            Compiler(parser_version=2, threads=0)
+    
+    def test_opt_mode_flags(self):
+        """Test that --opt modes add LTO and target flags to every translation unit."""
+        compiler = Compiler(parser_version=2, opt=("native", "lto"))
+        assert compiler._cflags("gcc", Path("rt"))[-2:] == ["-flto=auto", "-march=native"]
+        assert "/GL" in Compiler(parser_version=2, opt=("pgo",))._cflags("msvc", Path("rt"))
+        assert "-flto=auto" not in Compiler(parser_version=2)._cflags("gcc", Path("rt"))
+        with pytest.raises(ValueError):
+            Compiler(parser_version=2, opt=("o3",))
+    
+    def test_profile_define(self):
+        """Test that --profile compiles in the runtime's profiling probes."""
+        assert Compiler(parser_version=2, profile=True)._defines() == ("RT_PROFILE",)
+        assert "-DRT_PROFILE" in Compiler(parser_version=2, profile=True)._cflags("gcc", Path("rt"))
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    def test_profiled_build_reports(self, tmp_path):
+        """Test that a --profile build reports at exit as PCC_PROFILE selects."""
+        src = tmp_path / "profiled.py"
+        src.write_text("x = 1180591620717411303424\ny = x * x\nprint(y)\nprint(y // 7)\n")
+        exe = tmp_path / "profiled"
+        
+        result = Compiler(parser_version=1, use_hpf=True, cache=False, profile=True).build(src, exe, toolchain="gcc")
+        assert result.success, result.error_message
+        expected = [str(2 ** 140), str(2 ** 140 // 7)]
+        
+        out = subprocess.run([str(exe)], capture_output=True, text=True, env={})
+        assert out.stdout.split() == expected
+        assert "pcc runtime profile" in out.stderr
+        assert "rt_int_mul operand limbs" in out.stderr
+        
+        report = tmp_path / "profile.json"
+        out = subprocess.run([str(exe)], capture_output=True, text=True,
+                             env={"PCC_PROFILE": "json", "PCC_PROFILE_FILE": str(report)})
+        assert out.stdout.split() == expected and out.stderr == ""
+        data = json.loads(report.read_text())
+        calls = {entry["name"]: entry for entry in data["entry_points"]}
+        assert calls["rt_int_mul"]["limbs_histogram"] == [{"min": 2, "max": 3, "calls": 1}]
+        assert calls["rt_int_divmod"]["calls"] >= 1
+        assert data["memory"]["rt_mem_alloc"] >= 1
+        assert data["memory"]["peak_bytes"] > 0
+        
+        out = subprocess.run([str(exe)], capture_output=True, text=True, env={"PCC_PROFILE": "0"})
+        assert out.stdout.split() == expected and out.stderr == ""
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    def test_pgo_lto_build_runs(self, tmp_path):
+        """Test that a profile-guided, link-time optimized build prints what Python prints."""
+        src = tmp_path / "pgo_profile.py"
+        src.write_text("x = 1\nfor i in range(1, 300):\n    x = x * i + 1\nprint(x % 1000000007)\n")
+        exe = tmp_path / "pgo_profile"
+        
+        compiler = Compiler(parser_version=1, cache=False, opt=("pgo", "lto"))
+        unsupported = {"pgo", "lto"} - compiler._toolchain_detector.supported_opt_modes(Toolchain.GCC)
+        if unsupported:
+            pytest.skip(f"gcc lacks {', '.join(sorted(unsupported))}")
+        result = compiler.build(src, exe, toolchain="gcc")
+        assert result.success, result.error_message
+        
+        x = 1
+        for i in range(1, 300):
+            x = x * i + 1
+        out = subprocess.run([str(result.executable_path)], capture_output=True, text=True)
+        assert out.stdout.split() == [str(x % 1000000007)]
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    def test_release_build_runs(self, tmp_path):
+        """Test that a release build of a HPF program runs correctly."""
+        src = tmp_path / "release_profile.py"
+        src.write_text("x = 1180591620717411303424\nprint(x * 3 - 1)\nprint('a' + str(x))\n")
+        exe = tmp_path / "release_profile"
+        
+        result = Compiler(parser_version=1, use_hpf=True, release=True).build(src, exe, toolchain="gcc")
+        assert result.success, result.error_message
+        
+        out = subprocess.run([str(result.executable_path)], capture_output=True, text=True)
+        assert out.stdout.split() == [str(2 ** 70 * 3 - 1), "a" + str(2 ** 70)]
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    @pytest.mark.parametrize("native_ints", [False, True])
+    def test_parallel_build_runs(self, tmp_path, native_ints):
+        """Test that loops run on the thread pool print what Python prints."""
+        src = tmp_path / "parallel_loops.py"
+        src.write_text(
+            "def sq(n):\n"
+            "    return n * n\n"
+            "w = 3\n"
+            "s = 0\n"
+            "best = 0\n"
+            "for i in range(1, 20000, 3):\n"
+            "    if i % 7 == 0:\n"
+            "        continue\n"
+            "    t = sq(i) % 1000 + w\n"
+            "    s = s + t\n"
+            "    best = max(best, t)\n"
+            "print(s)\n"
+            "print(best)\n"
+        )
+        exe = tmp_path / "parallel_loops"
+        
+        result = Compiler(parser_version=1, native_ints=native_ints, parallel=True).build(src, exe, toolchain="gcc")
+        assert result.success, result.error_message
+        assert "rt_pool_run" in result.c_source_path.read_text()
+        
+        terms = [i * i % 1000 + 3 for i in range(1, 20000, 3) if i % 7 != 0]
+        out = subprocess.run([str(result.executable_path)], capture_output=True, text=True,
+                             env={"PCC_THREADS": "4"})
+        assert out.stdout.split() == [str(sum(terms)), str(max(terms))]
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    def test_buffered_stdout(self, tmp_path):
+        """Test that buffered output matches Python in every flush mode and on a terminal."""
+        src = tmp_path / "many_lines.py"
+        src.write_text(
+            "x = 1180591620717411303424\n"
+            "for i in range(30000):\n"
+            "    print(i * 1000003 - 7)\n"
+            "print(\"done\")\n"
+            "print(x * x)\n"
+        )
+        exe = tmp_path / "many_lines"
+        
+        result = Compiler(parser_version=1, use_hpf=True, cache=False).build(src, exe, toolchain="gcc")
+        assert result.success, result.error_message
+        expected = "".join(f"{i * 1000003 - 7}\n" for i in range(30000)) + f"done\n{2 ** 140}\n"
+        
+        for env in ({}, {"PCC_STDOUT": "full"}, {"PCC_STDOUT": "line"}):
+            out = subprocess.run([str(exe)], capture_output=True, text=True, env=env)
+            assert out.stdout == expected and out.stderr == "", env
+        
+        if hasattr(os, "openpty"):
+            leader, follower = os.openpty()
+            try:
+                proc = subprocess.Popen([str(exe)], stdout=follower, env={})
+                os.close(follower)
+                chunks = []
+                while True:
+                    try:
+                        chunk = os.read(leader, 65536)
+                    except OSError:
+                        break  # EIO once the program has exited
+                    if not chunk:
+                        break
+                    chunks.append(chunk)
+                proc.wait()
+            finally:
+                os.close(leader)
+            assert b"".join(chunks).replace(b"\r\n", b"\n").decode() == expected
+
+
+
+class TestCompilerCache:
+    """Tests for reuse of generated C, the runtime library and executables."""
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None or shutil.which("ar") is None,
+                        reason="gcc or ar not available")
+    def test_unchanged_build_is_cache_hit(self, tmp_path):
+        """Test that an unchanged rebuild copies the executable, and a changed one links the cached runtime."""
+        cache = BuildCache(tmp_path / "cache")
+        compiler = Compiler(parser_version=1, cache=cache)
+        src = tmp_path / "cached.py"
+        src.write_text("print(1180591620717411303424)\n")
+        
+        first = compiler.build(src, tmp_path / "first", toolchain="gcc")
+        assert first.success, first.error_message
+        assert not first.cache_hit
+        second = compiler.build(src, tmp_path / "second", toolchain="gcc")
+        assert second.cache_hit
+        out = subprocess.run([str(second.executable_path)], capture_output=True, text=True)
+        assert out.stdout.split() == [str(2 ** 70)]
+        
+        libraries = list((tmp_path / "cache" / "lib").rglob("*.a"))
+        src.write_text("print(1180591620717411303424 * 2)\n")
+        third = compiler.build(src, tmp_path / "third", toolchain="gcc")
+        assert not third.cache_hit
+        assert list((tmp_path / "cache" / "lib").rglob("*.a")) == libraries
+        out = subprocess.run([str(third.executable_path)], capture_output=True, text=True)
+        assert out.stdout.split() == [str(2 ** 71)]
+    
+    def test_options_change_generated_c_key(self):
+        """Test that C generated with other options is not reused."""
+        assert (Compiler(parser_version=1)._codegen_key("print(1)")
+                != Compiler(parser_version=1, native_ints=True)._codegen_key("print(1)"))
+        assert (Compiler(parser_version=1)._codegen_key("print(1)")
+                == Compiler(parser_version=1)._codegen_key("print(1)"))
+
+
+class TestCompilerBuildMany:
+    """Tests for building several programs at once."""
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None or shutil.which("ar") is None,
+                        reason="gcc or ar not available")
+    def test_programs_build_in_parallel(self, tmp_path):
+        """Test that workers build every program, sharing one cached runtime library."""
+        (tmp_path / "a").mkdir()
+        (tmp_path / "b").mkdir()
+        sources = [tmp_path / "a" / "main.py", tmp_path / "b" / "main.py", tmp_path / "third.py"]
+        for n, src in enumerate(sources, 1):
+            src.write_text(f"print({n} * 1180591620717411303424)\n")
+        builds = [(src, tmp_path / "bin" / f"prog{n}") for n, src in enumerate(sources, 1)]
+    
+        compiler = Compiler(parser_version=1, cache=BuildCache(tmp_path / "cache"))
+        results = compiler.build_many(builds, toolchain="gcc", jobs=2)
+        assert [r.success for r in results] == [True, True, True], [r.error_message for r in results]
+        assert len({r.c_source_path for r in results}) == 3
+        for n, result in enumerate(results, 1):
+            out = subprocess.run([str(result.executable_path)], capture_output=True, text=True)
+            assert out.stdout.split() == [str(n * 2 ** 70)]
+        assert len(list((tmp_path / "cache" / "lib").rglob("*.a"))) == 1
+    
+    def test_failures_are_reported_per_program(self, tmp_path):
+        """Test that a program that cannot be built does not stop the others."""
+        good = tmp_path / "good.py"
+        good.write_text("print(42)\n")
+        builds = [(tmp_path / "missing.py", tmp_path / "missing"), (good, tmp_path / "good")]
+    
+        results = Compiler(parser_version=1, cache=False).build_many(builds, emit_c_only=True, jobs=2)
+        assert not results[0].success
+        assert "not found" in results[0].error_message
+        assert results[1].success
+        assert "main" in results[1].c_source_path.read_text()
+        assert Compiler(cache=False).build_many([]) == []
+
+
+class TestCompilerOptimizations:
+    """Tests for the IR optimization stage."""
+    
+    def test_passes_run_by_default(self):
+        """Test that optimize() folds constants with the default options."""
+        compiler = Compiler(parser_version=2)
+        ir = compiler.optimize(compiler.parse("print(3 * 4 + 1)"))
+        assert ir.main == [Print(IntConst(13))]
+    
+    def test_passes_can_be_disabled(self):
+        """Test that a disabled pass leaves the IR as parsed."""
+        compiler = Compiler(parser_version=2, optimizations=OptimizationOptions(fold_constants=False))
+        ir = compiler.parse("print(3 + 1)")
+        assert compiler.optimize(ir) == ir
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    def test_optimized_build_runs(self, tmp_path):
+        """Test that an optimized program prints what Python prints."""
+        src = tmp_path / "optimized.py"
+        src.write_text(
+            "n = 7\n"
+            "t = 0\n"
+            "for i in range(-10, 10):\n"
+            "    t = t + i // 4 + i % 8 + n * n * 2\n"
+            "print(t)\n"
+            "print(0 - 73786976294838206464 // 1024)\n"
+        )
+        exe = tmp_path / "optimized"
+        
+        result = Compiler(parser_version=1).build(src, exe, toolchain="gcc")
+        assert result.success, result.error_message
+        
+        out = subprocess.run([str(result.executable_path)], capture_output=True, text=True)
+        expected_t = sum(i // 4 + i % 8 + 7 * 7 * 2 for i in range(-10, 10))
+        assert out.stdout.split() == [str(expected_t), str(0 - (1 << 66) // 1024)]
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v"])
@@ -2,6 +2,8 @@
 Unit tests for the tokenize-based lexer.
 """
 
+import re
+
 import pytest
 from pcc.frontend import Lexer, Token, TokenType, LexerError
 
@@ -152,6 +154,68 @@ class TestLexerErrorHandling:
         assert "Line 5" in str(error)
 
 
+class TestLexerScanner:
+    """Tests that the scanner places tokens where Python's tokenizer does."""
+    
+    @pytest.fixture
+    def lexer(self):
+        return Lexer()
+    
+    @staticmethod
+    def _summary(tokens):
+        return [(t.type.name, t.value, t.lineno, t.col_offset) for t in tokens]
+    
+    def test_block_structure(self, lexer):
+        """Test NEWLINE, INDENT and DEDENT positions, with an implicit NEWLINE at the end."""
+        tokens = lexer.tokenize("if x:\n    y = 1\n\n    # c\nz")
+        assert self._summary(tokens) == [
+            ("NAME", "if", 1, 0), ("NAME", "x", 1, 3), ("COLON", ":", 1, 4), ("NEWLINE", "\n", 1, 5),
+            ("INDENT", "    ", 2, 0), ("NAME", "y", 2, 4), ("EQUAL", "=", 2, 6), ("NUMBER", "1", 2, 8),
+            ("NEWLINE", "\n", 2, 9), ("NL", "\n", 3, 0), ("COMMENT", "# c", 4, 4), ("NL", "\n", 4, 7),
+            ("DEDENT", "", 5, 0), ("NAME", "z", 5, 0), ("NEWLINE", "", 5, 1), ("ENDMARKER", "", 6, 0),
+        ]
+    
+    def test_lines_joined_by_brackets_and_backslashes(self, lexer):
+        """Test that newlines inside brackets are NL and a backslash-newline is no token."""
+        tokens = lexer.tokenize("f(1,\n  2) + \\\n  3\n")
+        assert self._summary(tokens) == [
+            ("NAME", "f", 1, 0), ("LPAR", "(", 1, 1), ("NUMBER", "1", 1, 2), ("COMMA", ",", 1, 3),
+            ("NL", "\n", 1, 4), ("NUMBER", "2", 2, 2), ("RPAR", ")", 2, 3), ("PLUS", "+", 2, 5),
+            ("NUMBER", "3", 3, 2), ("NEWLINE", "\n", 3, 3), ("ENDMARKER", "", 4, 0),
+        ]
+    
+    def test_strings(self, lexer):
+        """Test prefixed, escaped and multi-line strings."""
+        tokens = lexer.tokenize("a = rb'x\\'y' + \"\"\"1\n2\"\"\" + 'p\\\nq'\n")
+        strings = [t for t in tokens if t.type == TokenType.STRING]
+        assert [(t.value, t.lineno, t.col_offset) for t in strings] == [
+            ("rb'x\\'y'", 1, 4), ('"""1\n2"""', 1, 15), ("'p\\\nq'", 2, 7),
+        ]
+        assert strings[1].line == "a = rb'x\\'y' + \"\"\"1\n2\"\"\" + 'p\\\n"
+        assert strings[2].line == "2\"\"\" + 'p\\\nq'\n"
+    
+    def test_numbers(self, lexer):
+        """Test that every Python number literal is one token."""
+        tokens = lexer.tokenize("1_000 0x1F 0o17 0b101 1.5e-3 .5 3j 7")
+        assert [t.value for t in tokens if t.type == TokenType.NUMBER] == [
+            "1_000", "0x1F", "0o17", "0b101", "1.5e-3", ".5", "3j", "7",
+        ]
+    
+    @pytest.mark.parametrize("source, message", [
+        ("x ** 2\n", "Unsupported operator: '**'"),
+        ("x += 1\n", "Unsupported operator: '+='"),
+        ("x = $\n", "Invalid character: '$'"),
+        ("x = 'abc\\\ndef\n", "Unterminated string literal"),
+        ("x = '''abc\n", "EOF in multi-line string"),
+        ("f(1,\n", "EOF in multi-line statement"),
+        ("if x:\n    y\n  z\n", "unindent does not match"),
+    ])
+    def test_errors(self, lexer, source, message):
+        """Test the errors for input Python or pcc cannot tokenize."""
+        with pytest.raises(LexerError, match=re.escape(message)):
+            lexer.tokenize(source)
+
+
 class TestLexerIntegration:
     """Integration tests for the lexer."""
     
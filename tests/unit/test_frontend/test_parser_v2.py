@@ -5,7 +5,7 @@ Unit tests for the Version 2 parser with tokenize-based lexer.
 import pytest
 from pcc.frontend import ParserV2, ParseError, LexerError
 from pcc.ir import (
-    IntConst, StrConst, Var, BinOp, CmpOp, Call,
+    IntConst, StrConst, Var, BinOp, CmpOp, Call, BuiltinCall,
     Assign, Print, If, While, ForRange, Return, Break, Continue,
     FunctionDef, ClassDef, ModuleIR
 )
@@ -238,6 +238,29 @@ x = add(1, 2)
         assert stmt.expr.func == "add"
         assert len(stmt.expr.args) == 2
 
+    def test_builtin_call(self, parser):
+        """Test parsing three-argument pow() and isqrt()."""
+        ir = parser.parse("""
+x = pow(3, 100, 7)
+y = isqrt(x)
+""")
+        assert isinstance(ir.main[0].expr, BuiltinCall)
+        assert ir.main[0].expr.name == "pow"
+        assert len(ir.main[0].expr.args) == 3
+        assert isinstance(ir.main[1].expr, BuiltinCall)
+        assert ir.main[1].expr.name == "isqrt"
+
+    def test_function_shadows_builtin(self, parser):
+        """Test that a user function named like a builtin is called instead."""
+        ir = parser.parse("""
+def isqrt(n):
+    return n
+
+x = isqrt(9)
+""")
+        assert isinstance(ir.main[0].expr, Call)
+        assert ir.main[0].expr.func == "isqrt"
+
 
 class TestParserV2Classes:
     """Tests for class parsing."""
@@ -0,0 +1,240 @@
+"""
+Unit tests for the IR optimization passes.
+
+This module tests the passes defined in pcc.ir.optimize.
+"""
+
+import pytest
+from pcc.ir import (
+    IntConst, StrConst, Var, BinOp, CmpOp, Call, BuiltinCall,
+    Assign, Print, If, While, ForRange, Return, Continue, FunctionDef, ModuleIR
+)
+from pcc.ir.optimize import OptimizationOptions, optimize
+
+
+def _options(**enabled):
+    """Options with only the given passes enabled."""
+    return OptimizationOptions(
+        fold_constants=enabled.get("fold", False),
+        strength_reduce=enabled.get("reduce", False),
+        cse=enabled.get("cse", False),
+        licm=enabled.get("licm", False),
+        inline=enabled.get("inline", False),
+        tail_calls=enabled.get("tail_calls", False),
+    )
+
+
+def _run(body, **enabled):
+    """Optimize a main body with only the given passes enabled."""
+    return optimize(ModuleIR(functions=[], classes=[], main=body), _options(**enabled)).main
+
+
+def _run_module(functions, body, **enabled):
+    """Optimize functions and a main body with only the given passes enabled."""
+    return optimize(ModuleIR(functions=functions, classes=[], main=body), _options(**enabled))
+
+
+class TestConstantFolding:
+    """Tests for constant folding."""
+
+    def test_big_constants(self):
+        """Test that arithmetic on constants beyond int64 is folded exactly."""
+        expr = BinOp("*", IntConst(1 << 70), BinOp("-", IntConst(0), IntConst(3)))
+        assert _run([Print(expr)], fold=True) == [Print(IntConst(-3 << 70))]
+
+    def test_floor_semantics(self):
+        """Test that // and % fold with Python semantics."""
+        body = [Print(BinOp("//", IntConst(-7), IntConst(2))), Print(BinOp("%", IntConst(-7), IntConst(2)))]
+        assert _run(body, fold=True) == [Print(IntConst(-4)), Print(IntConst(1))]
+
+    def test_division_by_zero_is_kept(self):
+        """Test that a division that raises is left for run time."""
+        expr = BinOp("//", IntConst(1), IntConst(0))
+        assert _run([Print(expr)], fold=True) == [Print(expr)]
+
+    def test_strings_and_builtins(self):
+        """Test folding of concatenation and of builtins on constants."""
+        body = [
+            Print(BinOp("+", StrConst("ab"), BuiltinCall("str", [IntConst(12)]))),
+            Print(BuiltinCall("len", [StrConst("hé")])),
+            Print(BuiltinCall("max", [IntConst(3), BuiltinCall("abs", [IntConst(-9)])])),
+            Print(BuiltinCall("pow", [IntConst(3), IntConst(100), IntConst(7)])),
+        ]
+        assert _run(body, fold=True) == [
+            Print(StrConst("ab12")),
+            Print(IntConst(3)),  # UTF-8 bytes, as the runtime counts
+            Print(IntConst(9)),
+            Print(IntConst(pow(3, 100, 7))),
+        ]
+
+    def test_identities(self):
+        """Test that identity operations are removed."""
+        body = [
+            Assign("a", BinOp("+", Var("x"), IntConst(0))),
+            Assign("b", BinOp("*", IntConst(1), Var("x"))),
+            Assign("c", BinOp("*", Var("x"), IntConst(0))),
+            Assign("d", BinOp("*", Call("f", []), IntConst(0))),
+        ]
+        result = _run(body, fold=True)
+        assert result[:3] == [Assign("a", Var("x")), Assign("b", Var("x")), Assign("c", IntConst(0))]
+        assert result[3] == body[3]  # the call is still made
+
+    def test_constant_branches(self):
+        """Test that branches and loops with a constant condition are pruned."""
+        body = [
+            If(CmpOp("<", IntConst(1), IntConst(2)), [Print(IntConst(1))], [Print(IntConst(2))]),
+            While(IntConst(0), [Print(IntConst(3))]),
+        ]
+        assert _run(body, fold=True) == [Print(IntConst(1))]
+
+
+class TestStrengthReduction:
+    """Tests for strength reduction."""
+
+    def test_powers_of_two(self):
+        """Test that * // % by 2^k become shifts and masks."""
+        body = [
+            Print(BinOp("*", IntConst(8), Var("x"))),
+            Print(BinOp("//", Var("x"), IntConst(4))),
+            Print(BinOp("%", Var("x"), IntConst(16))),
+        ]
+        assert _run(body, reduce=True) == [
+            Print(BinOp("<<", Var("x"), IntConst(3))),
+            Print(BinOp(">>", Var("x"), IntConst(2))),
+            Print(BinOp("&", Var("x"), IntConst(15))),
+        ]
+
+    def test_other_constants_unchanged(self):
+        """Test that other divisors and negative powers are kept."""
+        body = [Print(BinOp("//", Var("x"), IntConst(6))), Print(BinOp("%", Var("x"), IntConst(-4)))]
+        assert _run(body, reduce=True) == body
+
+
+class TestLoopInvariantCodeMotion:
+    """Tests for loop-invariant code motion."""
+
+    def test_hoists_invariant_expression(self):
+        """Test that an expression over unchanged variables moves before the loop."""
+        loop = ForRange("i", IntConst(0), Var("n"), IntConst(1), [
+            Assign("t", BinOp("+", Var("t"), BinOp("*", Var("n"), Var("n")))),
+        ], 1)
+        result = _run([loop], licm=True)
+        assert result[0] == Assign("pcc_licm_1", BinOp("*", Var("n"), Var("n")))
+        assert result[1].body == [Assign("t", BinOp("+", Var("t"), Var("pcc_licm_1")))]
+
+    def test_keeps_variant_and_raising_expressions(self):
+        """Test that expressions reading assigned variables, or that may raise, stay."""
+        body = [
+            Assign("k", BinOp("*", Var("i"), Var("n"))),
+            Assign("q", BinOp("//", Var("n"), Var("d"))),
+            Assign("c", BinOp("+", Call("f", [Var("n")]), IntConst(1))),
+        ]
+        loop = ForRange("i", IntConst(0), IntConst(10), IntConst(1), body, 1)
+        assert _run([loop], licm=True) == [loop]
+
+    def test_nested_loops(self):
+        """Test that an expression invariant in both loops leaves both."""
+        inner = While(CmpOp("<", Var("j"), BinOp("-", Var("n"), IntConst(1))), [
+            Assign("j", BinOp("+", Var("j"), IntConst(1))),
+        ])
+        outer = ForRange("i", IntConst(0), IntConst(3), IntConst(1), [Assign("j", IntConst(0)), inner], 1)
+        result = _run([outer], licm=True)
+        assert result[0] == Assign("pcc_licm_1", BinOp("-", Var("n"), IntConst(1)))
+        assert result[1].body[1].test == CmpOp("<", Var("j"), Var("pcc_licm_1"))
+
+
+class TestCommonSubexpressions:
+    """Tests for common-subexpression elimination."""
+
+    def test_shares_repeated_product(self):
+        """Test that a repeated product is computed once."""
+        body = [
+            Assign("a", BinOp("+", BinOp("*", Var("x"), Var("y")), IntConst(1))),
+            Assign("b", BinOp("-", BinOp("*", Var("x"), Var("y")), IntConst(1))),
+        ]
+        assert _run(body, cse=True) == [
+            Assign("pcc_cse_1", BinOp("*", Var("x"), Var("y"))),
+            Assign("a", BinOp("+", Var("pcc_cse_1"), IntConst(1))),
+            Assign("b", BinOp("-", Var("pcc_cse_1"), IntConst(1))),
+        ]
+
+    def test_assignment_kills_value(self):
+        """Test that a value is not reused after one of its variables changes."""
+        body = [
+            Assign("a", BinOp("*", Var("x"), Var("y"))),
+            Assign("x", IntConst(2)),
+            Assign("b", BinOp("*", Var("x"), Var("y"))),
+        ]
+        assert _run(body, cse=True) == body
+
+    def test_cheap_expressions_not_shared(self):
+        """Test that a single addition is recomputed rather than stored."""
+        body = [Print(BinOp("+", Var("x"), Var("y"))), Print(BinOp("+", Var("x"), Var("y")))]
+        assert _run(body, cse=True) == body
+
+
+class TestInlining:
+    """Tests for inlining of small functions."""
+
+    SQ = FunctionDef("sq", ["x"], [Return(BinOp("*", Var("x"), Var("x")))], 1)
+
+    def test_inlines_and_drops_function(self):
+        """Test that a single-return function is substituted and then dropped."""
+        plus = FunctionDef("plus_sq", ["a", "b"], [Return(BinOp("+", Call("sq", [Var("a")]), Var("b")))], 2)
+        result = _run_module([self.SQ, plus], [Print(Call("plus_sq", [Var("y"), IntConst(1)]))], inline=True)
+        assert result.functions == []
+        assert result.main == [Print(BinOp("+", BinOp("*", Var("y"), Var("y")), IntConst(1)))]
+
+    def test_recursive_function_is_kept(self):
+        """Test that a function reaching a call of itself is not inlined."""
+        f = FunctionDef("f", ["n"], [Return(Call("g", [Var("n")]))], 1)
+        g = FunctionDef("g", ["n"], [Return(Call("f", [Var("n")]))], 2)
+        main = [Print(Call("f", [IntConst(1)]))]
+        result = _run_module([f, g], main, inline=True)
+        assert result.functions == [f, g]
+        assert result.main == main
+
+    def test_argument_is_not_duplicated(self):
+        """Test that a computed argument used twice keeps the call."""
+        main = [
+            Print(Call("sq", [BinOp("+", Var("y"), IntConst(1))])),
+            Print(Call("sq", [Call("g", [])])),
+        ]
+        result = _run_module([self.SQ], main, inline=True)
+        assert result.functions == [self.SQ]
+        assert result.main == main
+
+
+class TestTailCalls:
+    """Tests for self-recursive tail-call elimination."""
+
+    def test_tail_call_becomes_loop(self):
+        """Test that gcd's tail call rebinds the parameters as if simultaneously."""
+        exit_test = If(CmpOp("==", Var("b"), IntConst(0)), [Return(Var("a"))], [])
+        gcd = FunctionDef("gcd", ["a", "b"], [
+            exit_test,
+            Return(Call("gcd", [Var("b"), BinOp("%", Var("a"), Var("b"))])),
+        ], 1)
+        result = _run_module([gcd], [], tail_calls=True)
+        assert result.functions[0].body == [While(IntConst(1), [
+            exit_test,
+            Assign("pcc_tail_1", Var("b")),
+            Assign("b", BinOp("%", Var("a"), Var("b"))),
+            Assign("a", Var("pcc_tail_1")),
+            Continue(1),
+        ])]
+
+    def test_other_calls_are_kept(self):
+        """Test that non-tail self-calls and tail calls inside loops stay calls."""
+        fn = FunctionDef("f", ["n"], [
+            While(CmpOp(">", Var("n"), IntConst(0)), [Return(Call("f", [IntConst(0)]))]),
+            Return(BinOp("+", Call("f", [Var("n")]), IntConst(1))),
+        ], 1)
+        assert _run_module([fn], [], tail_calls=True).functions == [fn]
+
+
+def test_all_passes_disabled():
+    """Test that disabling every pass leaves the module unchanged."""
+    body = [Print(BinOp("*", BinOp("+", IntConst(1), IntConst(2)), Var("x")))]
+    module = ModuleIR(functions=[], classes=[], main=body)
+    assert optimize(module, OptimizationOptions.disabled()) == module
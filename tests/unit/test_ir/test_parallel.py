@@ -0,0 +1,166 @@
+"""
+Unit tests for the loop parallelism analysis.
+
+This module tests pure_functions() and find_parallel_loops() from pcc.ir.parallel.
+"""
+
+import pytest
+from pcc.ir import (
+    IntConst, Var, BinOp, CmpOp, Call, BuiltinCall,
+    Assign, Print, If, While, ForRange, Return, Break, Continue, FunctionDef
+)
+from pcc.ir.parallel import ParallelLoop, find_parallel_loops, pure_functions
+
+
+def _loop(body, var="i"):
+    """A range(100) loop over a body."""
+    return ForRange(var, IntConst(0), IntConst(100), IntConst(1), body, 1)
+
+
+def _add(name, expr):
+    """name = name + expr"""
+    return Assign(name, BinOp("+", Var(name), expr))
+
+
+class TestReductions:
+    """Tests for the accumulators a parallel loop combines."""
+
+    def test_sum(self):
+        """Test that a running sum is a + reduction."""
+        loop = _loop([_add("total", BinOp("*", Var("i"), Var("i")))])
+        assert find_parallel_loops([loop], set()) == {
+            id(loop): ParallelLoop(inputs=[], reductions={"total": "+"}, heavy=False)
+        }
+
+    def test_min_max_and_subtraction(self):
+        """Test that min, max and a chain with the accumulator added once are reductions."""
+        loop = _loop([
+            Assign("lo", BuiltinCall("min", [Var("i"), Var("lo")])),
+            Assign("hi", BuiltinCall("max", [Var("hi"), Var("i")])),
+            Assign("neg", BinOp("-", BinOp("+", Var("neg"), Var("k")), Var("i"))),
+        ])
+        found = find_parallel_loops([loop], set())
+        assert found[id(loop)].reductions == {"lo": "min", "hi": "max", "neg": "+"}
+        assert found[id(loop)].inputs == ["k"]
+
+    def test_subtracted_accumulator_is_rejected(self):
+        """Test that r = x - r carries a value between iterations."""
+        loop = _loop([Assign("r", BinOp("-", Var("i"), Var("r")))])
+        assert find_parallel_loops([loop], set()) == {}
+
+    def test_mixed_operators_are_rejected(self):
+        """Test that an accumulator summed and maximized is no reduction."""
+        loop = _loop([_add("r", Var("i")), Assign("r", BuiltinCall("max", [Var("r"), IntConst(5)]))])
+        assert find_parallel_loops([loop], set()) == {}
+
+    def test_accumulator_read_elsewhere_is_rejected(self):
+        """Test that reading a partial result inside the body is a dependency."""
+        loop = _loop([_add("r", Var("i")), If(CmpOp(">", Var("r"), IntConst(10)), [Assign("x", IntConst(1))], [])])
+        assert find_parallel_loops([loop], set()) == {}
+
+
+class TestDependencies:
+    """Tests for the loops that must stay serial."""
+
+    def test_carried_value_is_rejected(self):
+        """Test that a variable read before it is written carries a value."""
+        loop = _loop([_add("chain", Var("prev")), Assign("prev", Var("i"))])
+        assert find_parallel_loops([loop], set()) == {}
+
+    def test_private_written_first(self):
+        """Test that a temporary written before every read is private."""
+        loop = _loop([Assign("t", BinOp("*", Var("i"), Var("k"))), _add("s", Var("t"))])
+        assert find_parallel_loops([loop], set())[id(loop)].inputs == ["k"]
+
+    def test_private_written_on_one_branch_is_rejected(self):
+        """Test that a write in one branch of an if does not make a variable private."""
+        loop = _loop([
+            If(CmpOp("<", Var("i"), IntConst(5)), [Assign("t", Var("i"))], []),
+            _add("s", Var("t")),
+        ])
+        assert find_parallel_loops([loop], set()) == {}
+
+    def test_live_out_private_is_rejected(self):
+        """Test that the last iteration's value of a private must not be used later."""
+        loop = _loop([Assign("x", BinOp("*", Var("i"), IntConst(2)))])
+        assert find_parallel_loops([loop, Print(Var("x"))], set()) == {}
+        assert id(loop) in find_parallel_loops([loop, Assign("x", IntConst(0)), Print(Var("x"))], set())
+
+    def test_loop_variable_used_later_is_rejected(self):
+        """Test that the counter's final value is live out like any private."""
+        loop = _loop([_add("s", Var("i"))])
+        assert find_parallel_loops([loop, Print(Var("i"))], set()) == {}
+
+
+class TestEffects:
+    """Tests for bodies with effects beyond their variables."""
+
+    def test_print_is_rejected(self):
+        """Test that output keeps the loop serial."""
+        loop = _loop([Print(Var("i"))])
+        assert find_parallel_loops([loop], set()) == {}
+
+    def test_break_is_rejected(self):
+        """Test that leaving the loop early keeps it serial, but continue does not."""
+        broken = _loop([If(CmpOp("==", Var("i"), IntConst(5)), [Break(1)], []), _add("s", Var("i"))])
+        assert find_parallel_loops([broken], set()) == {}
+        skipped = _loop([If(CmpOp("==", Var("i"), IntConst(5)), [Continue(1)], []), _add("s", Var("i"))])
+        assert id(skipped) in find_parallel_loops([skipped], set())
+
+    def test_break_of_inner_loop(self):
+        """Test that a break inside an inner loop only ends that loop."""
+        inner = While(IntConst(1), [Break(1)])
+        loop = _loop([inner, _add("s", Var("i"))])
+        found = find_parallel_loops([loop], set())
+        assert found[id(loop)].heavy
+
+    def test_calls(self):
+        """Test that only functions without effects may be called."""
+        functions = [
+            FunctionDef("sq", ["n"], [Return(BinOp("*", Var("n"), Var("n")))], 1),
+            FunctionDef("show", ["n"], [Print(Var("n")), Return(Var("n"))], 2),
+            FunctionDef("wrap", ["n"], [Return(Call("show", [Var("n")]))], 3),
+        ]
+        pure = pure_functions(functions)
+        assert pure == {"sq"}
+        ok = _loop([_add("s", Call("sq", [Var("i")]))])
+        assert find_parallel_loops([ok], pure)[id(ok)].heavy
+        bad = _loop([_add("s", Call("wrap", [Var("i")]))])
+        assert find_parallel_loops([bad], pure) == {}
+
+
+class TestNesting:
+    """Tests for loop nests."""
+
+    def test_outermost_only(self):
+        """Test that the inner loops of a parallel loop are not reported."""
+        inner = _loop([_add("g", BinOp("*", Var("a"), Var("b")))], var="b")
+        outer = _loop([inner], var="a")
+        assert list(find_parallel_loops([outer], set())) == [id(outer)]
+
+    def test_inner_loop_of_serial_loop(self):
+        """Test that an inner loop is found when the loop around it is serial."""
+        inner = _loop([Assign("t", BinOp("*", Var("j"), Var("j"))), _add("s", Var("t"))], var="j")
+        outer = _loop([inner, Print(Var("s"))])
+        found = find_parallel_loops([outer], set())
+        assert list(found) == [id(inner)]
+        assert found[id(inner)].reductions == {"s": "+"}
+
+    def test_private_read_by_next_outer_iteration_is_rejected(self):
+        """Test that the enclosing loop counts as code after the inner one."""
+        inner = _loop([Assign("t", Var("j"))], var="j")
+        outer = While(CmpOp("<", Var("t"), IntConst(5)), [inner, Print(Var("s"))])
+        assert find_parallel_loops([Assign("t", IntConst(0)), outer], set()) == {}
+
+    def test_inputs_in_order_of_use(self):
+        """Test that inputs are listed in the order the body first reads them."""
+        loop = _loop([
+            Assign("t", BinOp("+", Var("i"), Var("b"))),
+            _add("s", BinOp("*", Var("t"), Var("a"))),
+            _add("s", Var("b")),
+        ])
+        assert find_parallel_loops([loop], set())[id(loop)].inputs == ["b", "a"]
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
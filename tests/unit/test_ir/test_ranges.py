@@ -0,0 +1,120 @@
+"""
+Unit tests for integer range inference.
+
+This module tests the range analysis defined in pcc.ir.ranges.
+"""
+
+import pytest
+from pcc.ir import (
+    IntConst, StrConst, Var, BinOp, CmpOp, Call, BuiltinCall,
+    Assign, If, While, ForRange
+)
+from pcc.ir.ranges import INT64_MAX, INT64_MIN, for_range_counter, infer_ranges
+
+
+class TestForRangeCounter:
+    """Tests for range() loop counter bounds."""
+
+    def test_ascending(self):
+        """Test that the counter takes one step past the last value."""
+        assert for_range_counter((0, 0), (10, 10), (3, 3)) == ((0, 12), 1)
+
+    def test_descending(self):
+        """Test a negative step."""
+        assert for_range_counter((10, 10), (0, 0), (-3, -3)) == ((-2, 10), -1)
+
+    def test_step_may_be_zero(self):
+        """Test that a step range containing zero is rejected."""
+        assert for_range_counter((0, 0), (10, 10), (-1, 1)) == (None, 0)
+
+    def test_counter_overflow(self):
+        """Test that a final step past INT64_MAX is rejected."""
+        assert for_range_counter((0, 0), (INT64_MAX, INT64_MAX), (2, 2)) == (None, 0)
+
+
+class TestInferRanges:
+    """Tests for variable range inference."""
+
+    def test_constant_assignment(self):
+        """Test that a variable holding constants is native."""
+        info = infer_ranges([Assign("x", IntConst(5)), Assign("x", IntConst(-3))])
+        assert info.ranges == {"x": (-3, 5)}
+
+    def test_loop_variable(self):
+        """Test the range of a range() loop variable and values derived from it."""
+        body = [
+            ForRange("i", IntConst(0), IntConst(100), IntConst(1), [
+                Assign("sq", BinOp("*", Var("i"), Var("i"))),
+            ], 1),
+        ]
+        info = infer_ranges(body)
+        assert info.ranges == {"i": (0, 99), "sq": (0, 9801)}
+
+    def test_accumulator_is_widened(self):
+        """Test that a variable growing every iteration stays a BigInt."""
+        body = [
+            Assign("total", IntConst(0)),
+            ForRange("i", IntConst(0), IntConst(10), IntConst(1), [
+                Assign("total", BinOp("+", Var("total"), Var("i"))),
+            ], 1),
+        ]
+        info = infer_ranges(body)
+        assert info.is_native("i")
+        assert not info.is_native("total")
+
+    def test_while_counter_is_widened(self):
+        """Test that a while loop counter stays a BigInt."""
+        body = [
+            Assign("n", IntConst(0)),
+            While(CmpOp("<", Var("n"), IntConst(10)), [
+                Assign("n", BinOp("+", Var("n"), IntConst(1))),
+            ]),
+        ]
+        assert not infer_ranges(body).is_native("n")
+
+    def test_overflowing_product(self):
+        """Test that a product that may leave int64_t is not native."""
+        body = [Assign("x", BinOp("*", IntConst(1 << 40), IntConst(1 << 40)))]
+        assert not infer_ranges(body).is_native("x")
+
+    def test_params_and_calls_are_unbounded(self):
+        """Test that parameters and call results are BigInts."""
+        body = [
+            Assign("a", BinOp("+", Var("n"), IntConst(1))),
+            Assign("b", Call("f", [])),
+        ]
+        info = infer_ranges(body, ["n"])
+        assert info.ranges == {}
+
+    def test_floordiv_by_range_with_zero(self):
+        """Test that a divisor that may be zero is not bounded."""
+        body = [
+            ForRange("i", IntConst(0), IntConst(10), IntConst(1), [
+                Assign("q", BinOp("//", IntConst(100), Var("i"))),
+                Assign("r", BinOp("%", Var("i"), IntConst(7))),
+            ], 1),
+        ]
+        info = infer_ranges(body)
+        assert not info.is_native("q")
+        assert info.ranges["r"] == (0, 6)
+
+    def test_strings_are_not_native(self):
+        """Test that string variables are excluded and len() is bounded."""
+        body = [
+            Assign("s", StrConst("abc")),
+            Assign("t", BinOp("+", Var("s"), BuiltinCall("str", [IntConst(1)]))),
+            Assign("k", BuiltinCall("len", [Var("t")])),
+        ]
+        info = infer_ranges(body)
+        assert info.ranges == {"k": (0, INT64_MAX)}
+
+    def test_branches_are_joined(self):
+        """Test that assignments in both branches of an if are joined."""
+        body = [
+            If(CmpOp("<", IntConst(1), IntConst(2)),
+               [Assign("x", IntConst(INT64_MIN))],
+               [Assign("x", IntConst(7))]),
+        ]
+        info = infer_ranges(body)
+        assert info.ranges == {"x": (INT64_MIN, 7)}
+        assert info.expr_range(BinOp("-", Var("x"), IntConst(1))) is None
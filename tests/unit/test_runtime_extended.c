@@ -14,6 +14,11 @@
 
 #include "../../runtime/runtime.h"
 
+#if !defined(_WIN32) && !defined(RT_NO_THREADS)
+#include <pthread.h>
+#define HAVE_PTHREADS 1
+#endif
+
 /* Test result tracking */
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -89,6 +94,20 @@ TEST(math_sqrt_si) {
     ASSERT_EQ(rt_math_sqrt_si(100), 10);
     /* Negative input returns -1 */
     ASSERT_EQ(rt_math_sqrt_si(-1), -1);
+    /* Near the top of the range, where a double estimate is off by one */
+    ASSERT_EQ(rt_math_sqrt_si(INT64_MAX), 3037000499LL);
+    ASSERT_EQ(rt_math_sqrt_si(3037000499LL * 3037000499LL - 1), 3037000498LL);
+}
+
+TEST(math_powmod_si) {
+    ASSERT_EQ(rt_math_powmod_si(123456789, 987654321, 1000000007), 652541198);
+    ASSERT_EQ(rt_math_powmod_si(2, 0, 7), 1);
+    ASSERT_EQ(rt_math_powmod_si(5, 3, 1), 0);
+    /* Result takes the sign of the modulus */
+    ASSERT_EQ(rt_math_powmod_si(-2, 3, 5), 2);
+    ASSERT_EQ(rt_math_powmod_si(2, 3, -5), -2);
+    /* Operands near 2^63 */
+    ASSERT_EQ(rt_math_powmod_si(INT64_MAX - 1, 2, INT64_MAX), 1);
 }
 
 TEST(math_gcd_si) {
@@ -136,6 +155,21 @@ TEST(math_next_prime_si) {
     ASSERT_EQ(rt_math_next_prime_si(18), 19);
 }
 
+TEST(math_floordiv_mod_si) {
+    /* Python rounds toward negative infinity; r takes the divisor's sign */
+    ASSERT_EQ(rt_math_floordiv_si(7, 2), 3);
+    ASSERT_EQ(rt_math_floordiv_si(-7, 2), -4);
+    ASSERT_EQ(rt_math_floordiv_si(7, -2), -4);
+    ASSERT_EQ(rt_math_floordiv_si(-7, -2), 3);
+    ASSERT_EQ(rt_math_floordiv_si(-8, 2), -4);
+    ASSERT_EQ(rt_math_mod_si(7, 3), 1);
+    ASSERT_EQ(rt_math_mod_si(-7, 3), 2);
+    ASSERT_EQ(rt_math_mod_si(7, -3), -2);
+    ASSERT_EQ(rt_math_mod_si(-7, -3), -1);
+    ASSERT_EQ(rt_math_mod_si(-9, 3), 0);
+    ASSERT_EQ(rt_math_mod_si(INT64_MIN, -1), 0);
+}
+
 /* ==================== BigInt Math Tests ==================== */
 
 TEST(math_abs_bigint) {
@@ -218,6 +252,375 @@ TEST(math_binomial) {
     rt_int_clear(&result);
 }
 
+TEST(math_prod_range) {
+    rt_int result, expected;
+    rt_int_init(&result);
+    rt_int_init(&expected);
+    
+    /* Empty range is 1, a range through zero is 0 */
+    rt_error_code_t err = rt_math_prod_range(&result, 5, 5, 1);
+    ASSERT_EQ(err, RT_OK);
+    rt_int_set_si(&expected, 1);
+    ASSERT_EQ(rt_int_cmp(&result, &expected), 0);
+    
+    rt_math_prod_range(&result, -3, 4, 1);
+    ASSERT(rt_int_is_zero(&result));
+    
+    /* prod(range(-9, 0, 2)) = -9 * -7 * -5 * -3 * -1 */
+    rt_math_prod_range(&result, -9, 0, 2);
+    rt_int_set_si(&expected, -945);
+    ASSERT_EQ(rt_int_cmp(&result, &expected), 0);
+    
+    /* prod(range(1, 301)) = 300! */
+    rt_math_prod_range(&result, 1, 301, 1);
+    rt_math_factorial(&expected, 300);
+    ASSERT_EQ(rt_int_cmp(&result, &expected), 0);
+    
+    /* prod(range(300, 100, -1)) * 100! = 300! */
+    rt_math_prod_range(&result, 300, 100, -1);
+    rt_int_floordiv(&expected, &expected, &result);
+    rt_math_factorial(&result, 100);
+    ASSERT_EQ(rt_int_cmp(&result, &expected), 0);
+    
+    err = rt_math_prod_range(&result, 1, 10, 0);
+    ASSERT_EQ(err, RT_ERROR_INVALID);
+    
+    rt_int_clear(&result);
+    rt_int_clear(&expected);
+}
+
+TEST(math_sqrt_bigint) {
+    rt_int x, root, expected;
+    rt_int_init(&x);
+    rt_int_init(&root);
+    rt_int_init(&expected);
+    
+    /* isqrt(7^200) */
+    rt_int_set_si(&x, 7);
+    rt_math_pow(&x, &x, 200);
+    rt_error_code_t err = rt_math_sqrt(&root, &x);
+    ASSERT_EQ(err, RT_OK);
+    rt_int_from_dec(&expected, "3234476509624757991344647769100216810857203198904625400933895331391691459636928060001");
+    ASSERT_EQ(rt_int_cmp(&root, &expected), 0);
+    
+    /* isqrt(r^2) == r and isqrt(r^2 - 1) == r - 1, in place */
+    rt_int_mul(&x, &expected, &expected);
+    rt_math_sqrt(&x, &x);
+    ASSERT_EQ(rt_int_cmp(&x, &expected), 0);
+    rt_int_mul(&x, &expected, &expected);
+    rt_int_sub_si(&x, &x, 1);
+    rt_math_sqrt(&root, &x);
+    rt_int_sub_si(&expected, &expected, 1);
+    ASSERT_EQ(rt_int_cmp(&root, &expected), 0);
+    
+    rt_int_set_si(&x, -4);
+    err = rt_math_sqrt(&root, &x);
+    ASSERT_EQ(err, RT_ERROR_INVALID);
+    
+    rt_int_clear(&x);
+    rt_int_clear(&root);
+    rt_int_clear(&expected);
+}
+
+TEST(math_powmod) {
+    rt_int base, exp, mod, result, expected;
+    rt_int_init(&base);
+    rt_int_init(&exp);
+    rt_int_init(&mod);
+    rt_int_init(&result);
+    rt_int_init(&expected);
+    
+    /* Fermat: 3^(p-1) mod p == 1 for the Mersenne prime 2^127 - 1 (odd modulus) */
+    rt_int_set_si(&mod, 1);
+    rt_int_shl(&mod, &mod, 127);
+    rt_int_sub_si(&mod, &mod, 1);
+    rt_int_sub_si(&exp, &mod, 1);
+    rt_int_set_si(&base, 3);
+    rt_error_code_t err = rt_math_powmod(&result, &base, &exp, &mod);
+    ASSERT_EQ(err, RT_OK);
+    rt_int_set_si(&expected, 1);
+    ASSERT_EQ(rt_int_cmp(&result, &expected), 0);
+    
+    /* 3^(10^30) mod 10^20 (even modulus) */
+    rt_int_from_dec(&exp, "1000000000000000000000000000000");
+    rt_int_from_dec(&mod, "100000000000000000000");
+    rt_math_powmod(&result, &base, &exp, &mod);
+    ASSERT_EQ(rt_int_cmp(&result, &expected), 0);
+    
+    /* Negative base and modulus: result takes the sign of the modulus */
+    rt_int_set_si(&base, -5);
+    rt_int_set_si(&exp, 77);
+    rt_int_from_dec(&mod, "-10000000000000000000000007");
+    rt_math_powmod(&base, &base, &exp, &mod);
+    rt_int_from_dec(&expected, "-4827253157151760732159824");
+    ASSERT_EQ(rt_int_cmp(&base, &expected), 0);
+    
+    rt_int_set_si(&mod, 0);
+    err = rt_math_powmod(&result, &base, &exp, &mod);
+    ASSERT_EQ(err, RT_ERROR_INVALID);
+    rt_int_set_si(&mod, 7);
+    rt_int_set_si(&exp, -1);
+    err = rt_math_powmod(&result, &base, &exp, &mod);
+    ASSERT_EQ(err, RT_ERROR_INVALID);
+    
+    rt_int_clear(&base);
+    rt_int_clear(&exp);
+    rt_int_clear(&mod);
+    rt_int_clear(&result);
+    rt_int_clear(&expected);
+}
+
+TEST(int_native_promotion) {
+    rt_int r, expected;
+    rt_int_init(&r);
+    rt_int_init(&expected);
+    
+    /* No overflow: the result is computed natively */
+    rt_int_set_si_add(&r, 40, 2);
+    ASSERT_EQ(rt_int_cmp_si(&r, 42), 0);
+    rt_int_set_si_mul(&r, -6, 7);
+    ASSERT_EQ(rt_int_cmp_si(&r, -42), 0);
+    
+    /* Overflow promotes to the exact BigInt result */
+    rt_int_set_si_add(&r, INT64_MAX, 1);
+    rt_int_from_dec(&expected, "9223372036854775808");
+    ASSERT_EQ(rt_int_cmp(&r, &expected), 0);
+    ASSERT_GT(rt_int_cmp_si(&r, INT64_MAX), 0);
+    rt_int_set_si_sub(&r, INT64_MIN, 1);
+    rt_int_from_dec(&expected, "-9223372036854775809");
+    ASSERT_EQ(rt_int_cmp(&r, &expected), 0);
+    ASSERT_LT(rt_int_cmp_si(&r, INT64_MIN), 0);
+    rt_int_set_si_mul(&r, 3037000500LL, 3037000500LL);
+    rt_int_from_dec(&expected, "9223372037000250000");
+    ASSERT_EQ(rt_int_cmp(&r, &expected), 0);
+    rt_int_set_si_mul(&r, INT64_MIN, -1);
+    rt_int_from_dec(&expected, "9223372036854775808");
+    ASSERT_EQ(rt_int_cmp(&r, &expected), 0);
+    
+    /* Comparison against a native value */
+    rt_int_from_dec(&r, "-100000000000000000000");
+    ASSERT_LT(rt_int_cmp_si(&r, INT64_MIN), 0);
+    rt_int_set_si(&r, INT64_MIN);
+    ASSERT_EQ(rt_int_cmp_si(&r, INT64_MIN), 0);
+    ASSERT_LT(rt_int_cmp_si(&r, 0), 0);
+    rt_int_set_si(&r, 0);
+    ASSERT_EQ(rt_int_cmp_si(&r, 0), 0);
+    ASSERT_GT(rt_int_cmp_si(&r, -1), 0);
+    
+    rt_int_clear(&r);
+    rt_int_clear(&expected);
+}
+
+TEST(int_mod_pow2_and_words) {
+    rt_int a, r, expected;
+    rt_int_init(&a);
+    rt_int_init(&r);
+    rt_int_init(&expected);
+    
+    /* Remainders take the sign of the modulus, as in Python */
+    rt_int_set_si(&a, 1000);
+    rt_int_mod_pow2(&r, &a, 8);
+    ASSERT_EQ(rt_int_cmp_si(&r, 232), 0);
+    rt_int_set_si(&a, -1000);
+    rt_int_mod_pow2(&r, &a, 8);
+    ASSERT_EQ(rt_int_cmp_si(&r, 24), 0);
+    rt_int_set_si(&a, -256);
+    rt_int_mod_pow2(&r, &a, 8);
+    ASSERT_EQ(rt_int_cmp_si(&r, 0), 0);
+    
+    /* Across limbs, aliasing the operand */
+    rt_int_from_dec(&a, "-340282366920938463463374607431768211457");  /* -(2^128 + 1) */
+    rt_int_mod_pow2(&a, &a, 100);
+    rt_int_from_dec(&expected, "1267650600228229401496703205375");  /* 2^100 - 1 */
+    ASSERT_EQ(rt_int_cmp(&a, &expected), 0);
+    rt_int_from_dec(&a, "340282366920938463463374607431768211457");
+    rt_int_mod_pow2(&r, &a, 200);
+    ASSERT_EQ(rt_int_cmp(&r, &a), 0);
+    
+    /* Words are 32-bit and least significant first, for any limb size */
+    const uint32_t words[] = {0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000001u};
+    rt_int_from_words(&r, words, 5, 1);
+    ASSERT_EQ(rt_int_cmp(&r, &a), 0);
+    rt_int_from_words(&r, words, 5, -1);
+    rt_int_from_dec(&expected, "-340282366920938463463374607431768211457");
+    ASSERT_EQ(rt_int_cmp(&r, &expected), 0);
+    const uint32_t zeros[] = {0u, 0u};
+    rt_int_from_words(&r, zeros, 2, -1);
+    ASSERT_EQ(rt_int_is_zero(&r), 1);
+    
+    rt_int_clear(&a);
+    rt_int_clear(&r);
+    rt_int_clear(&expected);
+}
+
+TEST(int_inline_fast_paths) {
+    rt_int a, b, r, expected;
+    rt_int_init(&a);
+    rt_int_init(&b);
+    rt_int_init(&r);
+    rt_int_init(&expected);
+    
+    /* Setting from the extremes of int64_t */
+    rt_int_set_si(&a, INT64_MIN);
+    rt_int_from_dec(&expected, "-9223372036854775808");
+    ASSERT_EQ(rt_int_cmp(&a, &expected), 0);
+    ASSERT_EQ(rt_int_cmp_si(&a, INT64_MIN), 0);
+    rt_int_set_si(&b, INT64_MAX);
+    ASSERT_LT(rt_int_cmp(&a, &b), 0);
+    ASSERT_GT(rt_int_cmp(&b, &a), 0);
+    
+    /* Two-limb values against one-limb values, either sign */
+    rt_int_from_dec(&a, "18446744073709551616");  /* 2^64 */
+    rt_int_from_dec(&b, "-18446744073709551616");
+    ASSERT_GT(rt_int_cmp_si(&a, INT64_MAX), 0);
+    ASSERT_LT(rt_int_cmp_si(&b, INT64_MIN), 0);
+    rt_int_set_si(&r, -5);
+    ASSERT_GT(rt_int_cmp(&r, &b), 0);
+    ASSERT_LT(rt_int_cmp(&r, &a), 0);
+    rt_int_from_dec(&r, "18446744073709551617");
+    ASSERT_GT(rt_int_cmp(&r, &a), 0);
+    rt_int_from_dec(&r, "-18446744073709551617");
+    ASSERT_LT(rt_int_cmp(&r, &b), 0);
+    
+    /* Zero compares equal whatever its sign field says */
+    rt_int_set_si(&a, 0);
+    ASSERT_EQ(rt_int_is_zero(&a), 1);
+    rt_int_set_si(&b, -1);
+    rt_int_add(&b, &b, &b);
+    rt_int_set_si(&r, 2);
+    rt_int_add(&r, &r, &b);
+    ASSERT_EQ(rt_int_is_zero(&r), 1);
+    ASSERT_EQ(rt_int_cmp(&r, &a), 0);
+    
+    /* Single-limb sums that carry into a second limb and cancel */
+    rt_int_from_dec(&a, "18446744073709551615");  /* 2^64 - 1 */
+    rt_int_set_si(&b, 1);
+    rt_int_add(&r, &a, &b);
+    rt_int_from_dec(&expected, "18446744073709551616");
+    ASSERT_EQ(rt_int_cmp(&r, &expected), 0);
+    rt_int_from_dec(&a, "-18446744073709551615");
+    rt_int_sub(&r, &a, &b);
+    rt_int_from_dec(&expected, "-18446744073709551616");
+    ASSERT_EQ(rt_int_cmp(&r, &expected), 0);
+    rt_int_set_si(&a, -7);
+    rt_int_set_si(&b, -7);
+    rt_int_sub(&r, &a, &b);
+    ASSERT_EQ(rt_int_is_zero(&r), 1);
+    rt_int_set_si(&b, 9);
+    rt_int_add(&r, &a, &b);
+    ASSERT_EQ(rt_int_cmp_si(&r, 2), 0);
+    rt_int_sub(&r, &a, &b);
+    ASSERT_EQ(rt_int_cmp_si(&r, -16), 0);
+    
+    rt_int_clear(&a);
+    rt_int_clear(&b);
+    rt_int_clear(&r);
+    rt_int_clear(&expected);
+}
+
+static rt_error_code_t pool_square_task(void* arg) {
+    rt_int* x = (rt_int*)arg;
+    return rt_int_mul(x, x, x);
+}
+
+static rt_error_code_t pool_failing_task(void* arg) {
+    (void)arg;
+    RT_SET_ERROR(RT_ERROR_INVALID, "failed in a task");
+    return RT_ERROR_INVALID;
+}
+
+TEST(pool_tasks_and_parallel_mul) {
+    rt_int serial, parallel, values[4];
+    rt_task tasks[4];
+    rt_int_init(&serial);
+    rt_int_init(&parallel);
+    
+    /* Products large enough to split must match the serial result */
+    rt_pool_shutdown();
+    rt_pool_set_threads(1);
+    ASSERT_EQ(rt_pool_threads(), 1);
+    ASSERT_EQ(rt_math_factorial(&serial, 30000), RT_OK);
+    rt_pool_shutdown();
+    rt_pool_set_threads(4);
+    ASSERT_EQ(rt_math_factorial(&parallel, 30000), RT_OK);
+    ASSERT_EQ(rt_int_cmp(&serial, &parallel), 0);
+    ASSERT_EQ(rt_int_mul(&parallel, &serial, &serial), RT_OK);
+    ASSERT_EQ(rt_int_mul(&serial, &serial, &serial), RT_OK);
+    ASSERT_EQ(rt_int_cmp(&serial, &parallel), 0);
+    
+    /* Every task runs exactly once, whichever thread takes it */
+    for (int i = 0; i < 4; i++) {
+        rt_int_init(&values[i]);
+        rt_int_set_si(&values[i], 1000 + i);
+        rt_task_spawn(&tasks[i], pool_square_task, &values[i]);
+    }
+    for (int i = 3; i >= 0; i--) {
+        ASSERT_EQ(rt_task_join(&tasks[i]), RT_OK);
+        ASSERT_EQ(rt_int_cmp_si(&values[i], (1000 + i) * (1000 + i)), 0);
+        rt_int_clear(&values[i]);
+    }
+    
+    /* A task's error reaches the joining thread */
+    RT_CLEAR_ERROR();
+    rt_task_spawn(&tasks[0], pool_failing_task, NULL);
+    ASSERT_EQ(rt_task_join(&tasks[0]), RT_ERROR_INVALID);
+    ASSERT_EQ(rt_error_last()->code, RT_ERROR_INVALID);
+    RT_CLEAR_ERROR();
+    
+    rt_pool_shutdown();
+    rt_pool_set_threads(RT_POOL_DEFAULT_THREADS);
+    rt_int_clear(&serial);
+    rt_int_clear(&parallel);
+}
+
+TEST(pool_range_chunks_and_run) {
+    int64_t bounds[RT_POOL_FOR_MAX_CHUNKS + 1];
+    rt_int values[RT_POOL_FOR_MAX_CHUNKS];
+    size_t n;
+    
+    rt_pool_shutdown();
+    rt_pool_set_threads(4);
+    
+    /* Chunks cover the counter values in order, with the grain respected */
+    n = rt_pool_range_chunks(0, 100000, 1, 4096, bounds);
+    ASSERT_EQ(n, 4 * RT_POOL_FOR_CHUNKS_PER_THREAD);
+    ASSERT_EQ(bounds[0], 0);
+    ASSERT_EQ(bounds[n], 100000);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_GE(bounds[i + 1] - bounds[i], 4096);
+    }
+    ASSERT_EQ(rt_pool_range_chunks(0, 5000, 1, 4096, bounds), 1);
+    ASSERT_EQ(rt_pool_range_chunks(10, 10, 1, 1, bounds), 0);
+    
+    /* Negative steps land every bound on a counter value */
+    n = rt_pool_range_chunks(100, -1, -3, 1, bounds);
+    ASSERT_EQ(bounds[0], 100);
+    for (size_t i = 1; i < n; i++) {
+        ASSERT_EQ((100 - bounds[i]) % 3, 0);
+        ASSERT_LT(bounds[i], bounds[i - 1]);
+    }
+    ASSERT_LE(bounds[n], -1);
+    ASSERT_GT(bounds[n], -4);
+    
+    /* Every argument is run once, and a failure is reported */
+    for (size_t i = 0; i < 8; i++) {
+        rt_int_init(&values[i]);
+        rt_int_set_si(&values[i], 1000 + (int64_t)i);
+    }
+    ASSERT_EQ(rt_pool_run(pool_square_task, values, sizeof(rt_int), 8), RT_OK);
+    for (size_t i = 0; i < 8; i++) {
+        ASSERT_EQ(rt_int_cmp_si(&values[i], (1000 + (int64_t)i) * (1000 + (int64_t)i)), 0);
+        rt_int_clear(&values[i]);
+    }
+    RT_CLEAR_ERROR();
+    ASSERT_EQ(rt_pool_run(pool_failing_task, values, sizeof(rt_int), 3), RT_ERROR_INVALID);
+    ASSERT_EQ(rt_error_last()->code, RT_ERROR_INVALID);
+    RT_CLEAR_ERROR();
+    
+    rt_pool_shutdown();
+    rt_pool_set_threads(RT_POOL_DEFAULT_THREADS);
+}
+
 /* ==================== Extended String Tests ==================== */
 
 TEST(string_substring) {
@@ -260,6 +663,34 @@ TEST(string_find) {
     rt_str_clear(&not_found);
 }
 
+TEST(string_find_long) {
+    /* Matches past the vector blocks, near both ends and across block edges */
+    rt_str unit = rt_str_from_cstr("abcabcabd");
+    rt_str s = rt_str_repeat(unit, 50);
+    rt_str pattern = rt_str_from_cstr("abd");
+    ASSERT_EQ(rt_str_find(s, pattern, 0), 6);
+    ASSERT_EQ(rt_str_find(s, pattern, 7), 15);
+    ASSERT_EQ(rt_str_rfind(s, pattern), 447);
+    ASSERT_EQ(rt_str_find_cstr(s, "dab", 400), 404);
+    ASSERT_EQ(rt_str_find_cstr(s, "abe", 0), (size_t)-1);
+    rt_str_clear(&pattern);
+    
+    /* Patterns above RT_STR_TWOWAY_THRESHOLD, including a periodic one */
+    pattern = rt_str_repeat(unit, 5);
+    ASSERT_EQ(rt_str_find(s, pattern, 1), 9);
+    ASSERT_EQ(rt_str_rfind(s, pattern), 405);
+    rt_str_clear(&pattern);
+    rt_str_clear(&unit);
+    unit = rt_str_from_cstr("abcabcabdX");
+    pattern = rt_str_repeat(unit, 4);
+    ASSERT_EQ(rt_str_find(s, pattern, 0), (size_t)-1);
+    ASSERT_EQ(rt_str_rfind(s, pattern), (size_t)-1);
+    
+    rt_str_clear(&s);
+    rt_str_clear(&pattern);
+    rt_str_clear(&unit);
+}
+
 TEST(string_contains_starts_ends) {
     rt_str s = rt_str_from_cstr("Hello, World!");
     rt_str prefix = rt_str_from_cstr("Hello");
@@ -346,6 +777,153 @@ TEST(string_trim) {
     rt_str_clear(&s);
 }
 
+TEST(string_inplace_long) {
+    /* Longer than a vector block, with a tail, so every kernel path runs */
+    rt_str s = rt_str_from_cstr(" \t Mixed Case Text, More Mixed Case Text And Tail zZ@[` \n\r ");
+    rt_str lower = rt_str_from_cstr(" \t mixed case text, MORE mixed case text and tail Zz@[` \n\r ");
+    ASSERT_EQ(rt_str_compare_ignore_case(s, lower), 0);
+    lower.data[lower.len - 6] = 'y';
+    ASSERT(rt_str_compare_ignore_case(s, lower) < 0);
+    rt_str_clear(&lower);
+    
+    rt_str t = rt_str_substring(s, 0, 0);
+    ASSERT_EQ(rt_str_to_upper_inplace(&t), RT_OK);
+    ASSERT(strcmp(t.data, " \t MIXED CASE TEXT, MORE MIXED CASE TEXT AND TAIL ZZ@[` \n\r ") == 0);
+    rt_str_to_lower_inplace(&t);
+    ASSERT(strcmp(t.data, " \t mixed case text, more mixed case text and tail zz@[` \n\r ") == 0);
+    
+    ASSERT_EQ(rt_str_trim_inplace(&t), RT_OK);
+    ASSERT(strcmp(t.data, "mixed case text, more mixed case text and tail zz@[`") == 0);
+    ASSERT_EQ(rt_str_remove_whitespace_inplace(&t), RT_OK);
+    ASSERT(strcmp(t.data, "mixedcasetext,moremixedcasetextandtailzz@[`") == 0);
+    ASSERT_EQ(t.len, strlen(t.data));
+    rt_str_clear(&t);
+    
+    /* All whitespace trims to empty from either side */
+    rt_str blank = rt_str_from_cstr(" \t\n\v\f\r                                      ");
+    rt_str r = rt_str_rtrim(blank);
+    ASSERT_EQ(r.len, 0);
+    rt_str_clear(&r);
+    r = rt_str_trim(blank);
+    ASSERT_EQ(r.len, 0);
+    rt_str_clear(&r);
+    rt_str_trim_inplace(&blank);
+    ASSERT_EQ(blank.len, 0);
+    rt_str_clear(&blank);
+    
+    rt_str_clear(&s);
+}
+
+TEST(string_builder) {
+    rt_strbuf b = rt_str_null();
+    ASSERT_EQ(rt_strbuf_reserve(&b, 3), RT_OK);
+    ASSERT(b.cap >= 4);
+    ASSERT_EQ(rt_strbuf_append_bytes(&b, "n=", 2), RT_OK);
+    ASSERT_EQ(rt_strbuf_append_si(&b, INT64_MIN), RT_OK);
+    ASSERT(strcmp(b.data, "n=-9223372036854775808") == 0);
+    
+    rt_int x;
+    rt_int_init(&x);
+    rt_int_from_dec(&x, "-123456789012345678901234567890");
+    rt_strbuf_append_bytes(&b, ",", 1);
+    ASSERT_EQ(rt_strbuf_append_int(&b, &x), RT_OK);
+    ASSERT(strcmp(b.data, "n=-9223372036854775808,-123456789012345678901234567890") == 0);
+    ASSERT_EQ(b.len, strlen(b.data));
+    rt_int_clear(&x);
+    
+    /* Appending a string to itself reads the bytes before they move */
+    size_t len = b.len;
+    for (int i = 0; i < 6; i++) {
+        ASSERT_EQ(rt_strbuf_append(&b, b), RT_OK);
+    }
+    ASSERT_EQ(b.len, len << 6);
+    ASSERT(memcmp(b.data + b.len - len, "n=-9223372036854775808,", 23) == 0);
+    ASSERT_EQ(b.data[b.len], '\0');
+    
+    /* Appending its own tail */
+    rt_strbuf_append_bytes(&b, b.data + b.len - 3, 3);
+    ASSERT(memcmp(b.data + b.len - 6, "890890", 6) == 0);
+    
+    ASSERT_EQ(rt_strbuf_reserve(&b, SIZE_MAX), RT_ERROR_OVERFLOW);
+    rt_str_clear(&b);
+}
+
+TEST(string_views) {
+    rt_str s = rt_str_from_cstr("  alpha beta gamma  ");
+    
+    /* Slices share the parent's bytes and outlive it */
+    rt_str word = rt_str_substring(s, 8, 4);
+    rt_str trimmed = rt_str_trim(s);
+    ASSERT(word.data == s.data + 8);
+    ASSERT(trimmed.data == s.data + 2);
+    ASSERT_EQ(word.cap, 0);
+    rt_str_clear(&s);
+    ASSERT_EQ(word.len, 4);
+    ASSERT(memcmp(word.data, "beta", 4) == 0);
+    /* An unterminated slice is copied to give a C string */
+    ASSERT(!rt_str_is_writable(&word));
+    ASSERT(strcmp(rt_str_cstr(&word), "beta") == 0);
+    ASSERT(rt_str_is_writable(&word));
+    
+    /* Writing to a shared string copies it first */
+    rt_str copy = rt_str_share(trimmed);
+    ASSERT(copy.data == trimmed.data);
+    ASSERT_EQ(rt_str_to_upper_inplace(&copy), RT_OK);
+    ASSERT(copy.data != trimmed.data);
+    ASSERT(strcmp(copy.data, "ALPHA BETA GAMMA") == 0);
+    ASSERT(memcmp(trimmed.data, "alpha beta gamma", 16) == 0);
+    ASSERT_EQ(rt_strbuf_append(&trimmed, trimmed), RT_OK);
+    ASSERT(strcmp(trimmed.data, "alpha beta gammaalpha beta gamma") == 0);
+    rt_str_clear(&copy);
+    rt_str_clear(&trimmed);
+    
+    /* Parsing a slice stops at its end, not the parent's */
+    rt_str digits = rt_str_from_cstr("12345");
+    rt_str head = rt_str_slice_to(digits, 3);
+    int64_t v = 0;
+    ASSERT_EQ(rt_str_to_si(head, &v), RT_OK);
+    ASSERT_EQ(v, 123);
+    rt_str_trim_inplace(&head);
+    ASSERT_EQ(head.len, 3);
+    rt_str_clear(&head);
+    rt_str_clear(&digits);
+    rt_str_clear(&word);
+}
+
+TEST(string_intern) {
+    static const char lit[] = "interned";
+    rt_str a = rt_str_intern_static(lit, 8);
+    ASSERT(rt_str_is_interned(&a));
+    ASSERT(a.data == lit);
+    
+    rt_str dyn = rt_str_from_cstr("intern");
+    rt_str_append_cstr(&dyn, "ed");
+    rt_str b = rt_str_intern(dyn);
+    ASSERT(b.data == a.data);
+    ASSERT(rt_str_equals(a, b));
+    
+    rt_str prefix = rt_str_slice_to(dyn, 6);
+    rt_str c = rt_str_intern(prefix);
+    rt_str_clear(&prefix);
+    ASSERT(c.data != a.data);
+    ASSERT(!rt_str_equals(a, c));
+    ASSERT(strcmp(c.data, "intern") == 0);
+    
+    /* Enough entries to grow the table */
+    for (int i = 0; i < 500; i++) {
+        rt_str n = rt_str_from_si(i);
+        rt_str x = rt_str_intern(n);
+        ASSERT(x.data == rt_str_intern(n).data);
+        rt_str_clear(&n);
+    }
+    ASSERT(rt_str_intern(dyn).data == a.data);
+    
+    /* Clearing an interned string leaves the table intact */
+    rt_str_clear(&b);
+    ASSERT(strcmp(a.data, "interned") == 0);
+    rt_str_clear(&dyn);
+}
+
 TEST(string_repeat) {
     rt_str s = rt_str_from_cstr("ab");
     
@@ -399,6 +977,80 @@ TEST(string_to_int) {
     rt_int_clear(&result);
 }
 
+TEST(string_from_int) {
+    rt_int x;
+    rt_int_init(&x);
+    
+    rt_str s = rt_str_from_int(&x);
+    ASSERT_EQ(s.len, 1);
+    ASSERT_EQ(strcmp(s.data, "0"), 0);
+    rt_str_clear(&s);
+    
+    /* Longer than any fixed-size buffer */
+    rt_math_factorial(&x, 1000);
+    rt_int_mul_si(&x, &x, -1);
+    s = rt_str_from_int(&x);
+    ASSERT_EQ(s.len, 2569);
+    ASSERT_EQ(strncmp(s.data, "-402387260077", 13), 0);
+    ASSERT_EQ(s.data[s.len], '\0');
+    rt_str_clear(&s);
+    
+    rt_int_clear(&x);
+}
+
+TEST(int_to_buffer) {
+    rt_int x;
+    rt_int_init(&x);
+    rt_int_from_dec(&x, "-1000000000000000000000");
+    
+    char buf[64];
+    ASSERT_GE(sizeof(buf), rt_int_to_buffer_size(&x));
+    ASSERT_EQ(rt_int_to_buffer(buf, sizeof(buf), &x), 23);
+    ASSERT_EQ(strcmp(buf, "-1000000000000000000000"), 0);
+    
+    /* Exact fit (length + terminator) succeeds, one byte less fails */
+    rt_int_set_si(&x, 999);
+    ASSERT_EQ(rt_int_to_buffer(buf, 4, &x), 3);
+    ASSERT_EQ(strcmp(buf, "999"), 0);
+    ASSERT_EQ(rt_int_to_buffer(buf, 3, &x), 0);
+    
+    rt_int_clear(&x);
+}
+
+TEST(number_formatting) {
+    char buf[32];
+    char* end = buf + sizeof(buf) - 1;
+    *end = '\0';
+    
+    ASSERT_EQ(strcmp(rt_fmt_u64(end, 0), "0"), 0);
+    ASSERT_EQ(strcmp(rt_fmt_u64(end, 7), "7"), 0);
+    ASSERT_EQ(strcmp(rt_fmt_u64(end, 10), "10"), 0);
+    ASSERT_EQ(strcmp(rt_fmt_u64(end, 909), "909"), 0);
+    ASSERT_EQ(strcmp(rt_fmt_u64(end, UINT64_MAX), "18446744073709551615"), 0);
+    ASSERT_EQ(strcmp(rt_fmt_si(end, -1), "-1"), 0);
+    ASSERT_EQ(strcmp(rt_fmt_si(end, INT64_MIN), "-9223372036854775808"), 0);
+    
+    /* Zero-padded to the width, odd and even */
+    rt_fmt_digits(buf, 42, 5);
+    ASSERT_EQ(strncmp(buf, "00042", 5), 0);
+    rt_fmt_digits(buf, 1234567, 6);
+    ASSERT_EQ(strncmp(buf, "234567", 6), 0);
+    
+    rt_str s = rt_str_from_si(-1002003004);
+    ASSERT_EQ(strcmp(s.data, "-1002003004"), 0);
+    rt_str_clear(&s);
+    
+    /* Chunks of zeros inside a BigInt keep their padding */
+    rt_int x;
+    rt_int_init(&x);
+    const char* dec = "-1000000000000000000000000000000000000000000000000000000000700000000000000000001";
+    rt_int_from_dec(&x, dec);
+    s = rt_str_from_int(&x);
+    ASSERT_EQ(strcmp(s.data, dec), 0);
+    rt_str_clear(&s);
+    rt_int_clear(&x);
+}
+
 TEST(string_is_integer) {
     rt_str valid1 = rt_str_from_cstr("123");
     rt_str valid2 = rt_str_from_cstr("-456");
@@ -446,6 +1098,85 @@ TEST(string_join) {
 
 /* ==================== Main ==================== */
 
+#ifdef HAVE_PTHREADS
+#define THREADS_N 4
+
+typedef struct {
+    int id;
+    rt_str shared;
+    int ok;
+} thread_arg;
+
+static void* thread_worker(void* p) {
+    thread_arg* arg = (thread_arg*)p;
+    arg->ok = 0;
+    
+    /* Each thread sees only the errors it raised itself */
+    rt_error_code_t code = arg->id % 2 ? RT_ERROR_DIVZERO : RT_ERROR_INVALID;
+    RT_SET_ERROR(code, NULL);
+    
+    for (int round = 0; round < 200; round++) {
+        /* BigInt arithmetic through the per-thread pool */
+        rt_int f;
+        rt_int_init(&f);
+        if (rt_math_factorial(&f, 60 + arg->id) != RT_OK) return NULL;
+        rt_str digits = rt_str_from_int(&f);
+        rt_int_clear(&f);
+        
+        /* Parallel reference counting on one shared block */
+        rt_str mine = rt_str_share(arg->shared);
+        rt_str view = rt_str_substring(mine, arg->id, 8);
+        rt_str_append_cstr(&mine, "!");
+        int same = mine.data != arg->shared.data && view.len == 8 &&
+                   memcmp(view.data, arg->shared.data + arg->id, 8) == 0;
+        rt_str_clear(&view);
+        rt_str_clear(&mine);
+        
+        rt_str name = rt_str_from_si(round);
+        rt_str a = rt_str_intern(name);
+        rt_str b = rt_str_intern(name);
+        rt_str_clear(&name);
+        
+        if (!same || digits.len < 82 || a.data != b.data) {
+            rt_str_clear(&digits);
+            return NULL;
+        }
+        rt_str_clear(&digits);
+    }
+    
+    if (rt_last_error.code != code || rt_error_last()->code != code) return NULL;
+    rt_error_clear();
+    rt_mem_trim();
+    arg->ok = 1;
+    return NULL;
+}
+
+TEST(runtime_threads) {
+    rt_str shared = rt_str_from_cstr("shared between every worker thread");
+    pthread_t threads[THREADS_N];
+    thread_arg args[THREADS_N];
+    
+    RT_CLEAR_ERROR();
+    for (int i = 0; i < THREADS_N; i++) {
+        args[i].id = i;
+        args[i].shared = shared;
+        ASSERT_EQ(pthread_create(&threads[i], NULL, thread_worker, &args[i]), 0);
+    }
+    for (int i = 0; i < THREADS_N; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    for (int i = 0; i < THREADS_N; i++) {
+        ASSERT(args[i].ok);
+    }
+    
+    /* Worker errors never reached this thread, and the block is ours again */
+    ASSERT(!RT_HAS_ERROR());
+    ASSERT(rt_str_is_writable(&shared));
+    ASSERT(strcmp(shared.data, "shared between every worker thread") == 0);
+    rt_str_clear(&shared);
+}
+#endif
+
 int main(void) {
     printf("========================================\n");
     printf("PCC Extended Runtime Unit Tests\n");
@@ -456,30 +1187,53 @@ int main(void) {
     RUN_TEST(math_min_max_si);
     RUN_TEST(math_pow_si);
     RUN_TEST(math_sqrt_si);
+    RUN_TEST(math_powmod_si);
     RUN_TEST(math_gcd_si);
     RUN_TEST(math_lcm_si);
     RUN_TEST(math_is_prime_si);
     RUN_TEST(math_next_prime_si);
+    RUN_TEST(math_floordiv_mod_si);
     
     printf("\nBigInt Math Tests:\n");
     RUN_TEST(math_abs_bigint);
     RUN_TEST(math_min_max_bigint);
     RUN_TEST(math_factorial);
     RUN_TEST(math_binomial);
+    RUN_TEST(math_prod_range);
+    RUN_TEST(math_sqrt_bigint);
+    RUN_TEST(math_powmod);
+    RUN_TEST(int_native_promotion);
+    RUN_TEST(int_mod_pow2_and_words);
+    RUN_TEST(int_inline_fast_paths);
+    RUN_TEST(pool_tasks_and_parallel_mul);
+    RUN_TEST(pool_range_chunks_and_run);
     
     printf("\nExtended String Tests:\n");
     RUN_TEST(string_substring);
     RUN_TEST(string_find);
+    RUN_TEST(string_find_long);
     RUN_TEST(string_contains_starts_ends);
     RUN_TEST(string_compare);
     RUN_TEST(string_case_conversion);
     RUN_TEST(string_trim);
+    RUN_TEST(string_inplace_long);
+    RUN_TEST(string_builder);
+    RUN_TEST(string_views);
+    RUN_TEST(string_intern);
     RUN_TEST(string_repeat);
     RUN_TEST(string_replace);
     RUN_TEST(string_to_int);
+    RUN_TEST(string_from_int);
+    RUN_TEST(int_to_buffer);
+    RUN_TEST(number_formatting);
     RUN_TEST(string_is_integer);
     RUN_TEST(string_join);
     
+#ifdef HAVE_PTHREADS
+    printf("\nThreading Tests:\n");
+    RUN_TEST(runtime_threads);
+#endif
+    
     printf("\n========================================\n");
     printf("Test Summary:\n");
     printf("  Total:  %d\n", tests_run);
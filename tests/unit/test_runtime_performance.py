@@ -11,8 +11,12 @@ Measures:
 - CPU utilization percentage
 - Statistical analysis across multiple iterations
 
+Native runtime micro-benchmarks (bench_runtime.c) time the BigInt, math
+and string routines in process and are compared against a stored baseline.
+
 Usage:
     python test_runtime_performance.py
+    python test_runtime_performance.py --native [--quick] [--baseline FILE] [--save-baseline FILE]
     python -m pytest test_runtime_performance.py -v
 """
 
@@ -28,6 +32,8 @@ from dataclasses import dataclass, field
 from typing import List, Dict, Tuple, Optional
 from concurrent.futures import ThreadPoolExecutor
 import json
+import argparse
+import shutil
 
 # Add parent directory to path
 sys.path.insert(0, str(Path(__file__).parent.parent.parent))
@@ -53,7 +59,7 @@ class RuntimeMetrics:
 class BenchmarkResult:
     """Aggregated benchmark results across multiple iterations."""
     test_name: str
-    execution_type: str  # "python" or "compiled"
+    execution_type: str  # "python", "compiled" or "native"
     iterations: int
     
     # Time metrics (ms)
@@ -77,9 +83,14 @@ class BenchmarkResult:
     # Raw data for detailed analysis
     raw_metrics: List[RuntimeMetrics] = field(default_factory=list)
     
+    # Per-call metrics of native micro-benchmarks, which time many calls per iteration
+    ops_per_iteration: int = 1
+    ns_per_op: Optional[float] = None
+    cycles_per_op: Optional[float] = None
+    
     def to_dict(self) -> Dict:
         """Convert to dictionary for JSON serialization."""
-        return {
+        data = {
             "test_name": self.test_name,
             "execution_type": self.execution_type,
             "iterations": self.iterations,
@@ -100,6 +111,36 @@ class BenchmarkResult:
             },
             "cpu_percent": self.cpu_percent_mean,
         }
+        if self.ns_per_op is not None:
+            data["ops_per_iteration"] = self.ops_per_iteration
+            data["ns_per_op"] = self.ns_per_op
+            data["cycles_per_op"] = self.cycles_per_op
+        return data
+    
+    @classmethod
+    def from_dict(cls, data: Dict) -> "BenchmarkResult":
+        """Create from a to_dict() dictionary; metrics it lacks are zero."""
+        times = data.get("execution_time_ms", {})
+        cpu = data.get("cpu_time_ms", {})
+        memory = data.get("memory_mb", {})
+        return cls(
+            test_name=data["test_name"],
+            execution_type=data.get("execution_type", "compiled"),
+            iterations=data.get("iterations", 0),
+            exec_time_mean=times.get("mean", 0.0),
+            exec_time_median=times.get("median", 0.0),
+            exec_time_min=times.get("min", 0.0),
+            exec_time_max=times.get("max", 0.0),
+            exec_time_std=times.get("std", 0.0),
+            user_time_mean=cpu.get("user", 0.0),
+            system_time_mean=cpu.get("system", 0.0),
+            peak_memory_mean=memory.get("peak_mean", 0.0),
+            peak_memory_max=memory.get("peak_max", 0.0),
+            cpu_percent_mean=data.get("cpu_percent", 0.0),
+            ops_per_iteration=data.get("ops_per_iteration", 1),
+            ns_per_op=data.get("ns_per_op"),
+            cycles_per_op=data.get("cycles_per_op"),
+        )
 
 
 class PerformanceMonitor:
@@ -540,6 +581,95 @@ class ReportGenerator:
         
         with open(output_path, 'w') as f:
             json.dump(data, f, indent=2)
+    
+    @staticmethod
+    def load_json_results(path: Path) -> Dict[Tuple[str, str], BenchmarkResult]:
+        """Load the results of a JSON report, by test name and execution type.
+        
+        Reads both the native benchmark report, with one result per entry,
+        and generate_json_report() output, with a python and a compiled
+        result per entry.
+        """
+        with open(path) as f:
+            data = json.load(f)
+        
+        results = {}
+        for entry in data.get("benchmarks", []):
+            if "execution_time_ms" in entry:
+                parts = [entry]
+            else:
+                parts = [entry[kind] for kind in ("python", "compiled") if kind in entry]
+            for part in parts:
+                result = BenchmarkResult.from_dict(part)
+                results[(result.test_name, result.execution_type)] = result
+        return results
+    
+    @staticmethod
+    def compare_with_baseline(
+        current: Dict[Tuple[str, str], BenchmarkResult],
+        baseline: Dict[Tuple[str, str], BenchmarkResult],
+        tolerance: float = 0.25
+    ) -> List[str]:
+        """Compare results with a baseline and describe each regression.
+        
+        A result regresses when its time per call (or, without one, its
+        median time) is more than `tolerance` above the baseline's. Results
+        missing from either side are not compared.
+        """
+        regressions = []
+        for key, result in sorted(current.items()):
+            base = baseline.get(key)
+            if base is None:
+                continue
+            if result.ns_per_op is not None and base.ns_per_op is not None:
+                now, before, unit = result.ns_per_op, base.ns_per_op, "ns/op"
+            else:
+                now, before, unit = result.exec_time_median, base.exec_time_median, "ms"
+            if before > 0 and now > before * (1 + tolerance):
+                regressions.append(
+                    f"{key[0]} ({key[1]}): {now:.1f} {unit} vs baseline {before:.1f} {unit} "
+                    f"({(now / before - 1) * 100:+.0f}%)"
+                )
+        return regressions
+
+
+class NativeBenchmarkRunner:
+    """Build and run the native runtime micro-benchmarks (bench_runtime.c)."""
+    
+    SOURCE = Path(__file__).parent / "bench_runtime.c"
+    RUNTIME_DIR = Path(__file__).parent.parent.parent / "runtime"
+    
+    def __init__(self, build_dir: Path, compiler: str = "gcc"):
+        self.build_dir = Path(build_dir)
+        self.compiler = compiler
+        self.executable = self.build_dir / ("bench_runtime.exe" if os.name == "nt" else "bench_runtime")
+    
+    def build(self) -> Path:
+        """Compile the benchmarks with the runtime sources."""
+        self.build_dir.mkdir(parents=True, exist_ok=True)
+        cmd = [
+            self.compiler, "-O2", "-std=c11", f"-I{self.RUNTIME_DIR}",
+            str(self.SOURCE), *sorted(str(p) for p in self.RUNTIME_DIR.glob("rt_*.c")),
+            "-o", str(self.executable), "-pthread", "-lm",
+        ]
+        result = subprocess.run(cmd, capture_output=True, text=True)
+        if result.returncode != 0:
+            raise RuntimeError(f"Building bench_runtime failed:\n{result.stderr}")
+        return self.executable
+    
+    def run(self, *args: str, timeout: Optional[float] = None) -> Dict[Tuple[str, str], BenchmarkResult]:
+        """Run the benchmarks with command-line arguments and load the report."""
+        if not self.executable.exists():
+            self.build()
+        report = self.build_dir / "bench_runtime.json"
+        result = subprocess.run(
+            [str(self.executable), *args, "--json", str(report)],
+            capture_output=True, text=True, timeout=timeout
+        )
+        if result.returncode != 0:
+            raise RuntimeError(f"bench_runtime failed:\n{result.stderr}")
+        self.output = result.stdout
+        return ReportGenerator.load_json_results(report)
 
 
 # =============================================================================
@@ -663,6 +793,77 @@ class TestRuntimePerformance:
         assert compiled_result.iterations == 5
 
 
+class TestNativeRuntimeBenchmarks:
+    """Native runtime micro-benchmarks and their baseline comparison."""
+    
+    @staticmethod
+    def _native_result(name: str, ns_per_op: float) -> BenchmarkResult:
+        return BenchmarkResult(
+            test_name=name, execution_type="native", iterations=3,
+            exec_time_mean=1.0, exec_time_median=1.0, exec_time_min=1.0,
+            exec_time_max=1.0, exec_time_std=0.0, user_time_mean=0.0,
+            system_time_mean=0.0, peak_memory_mean=0.0, peak_memory_max=0.0,
+            cpu_percent_mean=0.0, ops_per_iteration=1000, ns_per_op=ns_per_op
+        )
+    
+    def test_compare_with_baseline(self, tmp_path):
+        """Test that only slowdowns beyond the tolerance are regressions."""
+        names = ["int_add/digits=19", "int_mul/digits=19", "str_find/chars=16"]
+        path = tmp_path / "baseline.json"
+        path.write_text(json.dumps({"benchmarks": [self._native_result(n, 10.0).to_dict() for n in names]}))
+        baseline = ReportGenerator.load_json_results(path)
+        assert baseline[("int_add/digits=19", "native")].ns_per_op == 10.0
+        
+        current = {
+            ("int_add/digits=19", "native"): self._native_result("int_add/digits=19", 12.0),
+            ("int_mul/digits=19", "native"): self._native_result("int_mul/digits=19", 20.0),
+            ("math_pow/digits=19", "native"): self._native_result("math_pow/digits=19", 99.0),
+        }
+        regressions = ReportGenerator.compare_with_baseline(current, baseline, tolerance=0.25)
+        assert len(regressions) == 1
+        assert regressions[0].startswith("int_mul/digits=19 (native): 20.0 ns/op")
+    
+    def test_load_comparison_report(self, tmp_path):
+        """Test that python and compiled results of a comparison report load too."""
+        python_result = BenchmarkResult.from_dict({"test_name": "loop", "execution_type": "python",
+                                                   "execution_time_ms": {"median": 80.0}})
+        compiled_result = BenchmarkResult.from_dict({"test_name": "loop", "execution_type": "compiled",
+                                                     "execution_time_ms": {"mean": 4.0, "median": 4.0}})
+        python_result.exec_time_mean = 80.0
+        path = tmp_path / "report.json"
+        ReportGenerator.generate_json_report([(python_result, compiled_result)], path)
+        
+        results = ReportGenerator.load_json_results(path)
+        assert set(results) == {("loop", "python"), ("loop", "compiled")}
+        assert "ns_per_op" not in results[("loop", "compiled")].to_dict()
+        slower = {("loop", "compiled"): BenchmarkResult.from_dict(
+            {"test_name": "loop", "execution_type": "compiled", "execution_time_ms": {"median": 6.0}})}
+        assert len(ReportGenerator.compare_with_baseline(slower, results)) == 1
+    
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    def test_native_quick_suite(self, tmp_path):
+        """Run the quick native suite; compare with PCC_BENCH_BASELINE when it is set."""
+        runner = NativeBenchmarkRunner(tmp_path)
+        results = runner.run("--quick")
+        
+        operations = {name.split("/")[0] for name, _ in results}
+        assert operations == {
+            "int_add", "int_mul", "int_divmod", "int_from_dec", "int_fprint",
+            "math_pow", "math_factorial", "math_sqrt",
+            "str_find", "str_replace", "str_concat", "str_join",
+        }
+        for result in results.values():
+            assert result.execution_type == "native"
+            assert result.iterations == 3
+            assert result.ns_per_op > 0
+        
+        baseline = os.environ.get("PCC_BENCH_BASELINE")
+        if baseline:
+            regressions = ReportGenerator.compare_with_baseline(
+                results, ReportGenerator.load_json_results(Path(baseline)))
+            assert not regressions, "\n".join(regressions)
+
+
 # =============================================================================
 # MAIN EXECUTION
 # =============================================================================
@@ -722,7 +923,56 @@ def run_full_benchmark_suite():
     print("=" * 70 + "\n")
 
 
+def run_native_benchmark_suite(
+    quick: bool = False,
+    baseline: Optional[Path] = None,
+    save_baseline: Optional[Path] = None,
+    tolerance: float = 0.25
+) -> int:
+    """Run the native runtime micro-benchmarks; returns 1 on regressions."""
+    print("\n" + "=" * 70)
+    print("  PCC NATIVE RUNTIME MICRO-BENCHMARKS")
+    print("=" * 70 + "\n")
+    
+    build_dir = Path(tempfile.mkdtemp(prefix="pcc_bench_native_"))
+    try:
+        runner = NativeBenchmarkRunner(build_dir)
+        results = runner.run(*(["--quick"] if quick else []))
+        print(runner.output)
+        if save_baseline:
+            shutil.copyfile(build_dir / "bench_runtime.json", save_baseline)
+            print(f"  Baseline saved to: {save_baseline.absolute()}")
+    finally:
+        shutil.rmtree(build_dir, ignore_errors=True)
+    
+    if baseline:
+        regressions = ReportGenerator.compare_with_baseline(
+            results, ReportGenerator.load_json_results(baseline), tolerance)
+        if regressions:
+            print(f"\n  {len(regressions)} regression(s) against {baseline}:")
+            for regression in regressions:
+                print(f"    {regression}")
+            return 1
+        print(f"\n  No regressions against {baseline} (tolerance {tolerance:.0%})")
+    return 0
+
+
 if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="PCC runtime performance benchmarks")
+    parser.add_argument("--native", action="store_true",
+                        help="run the native runtime micro-benchmarks instead")
+    parser.add_argument("--quick", action="store_true",
+                        help="native: sizes up to 10^4 digits and short repetitions")
+    parser.add_argument("--baseline", type=Path,
+                        help="native: JSON report to compare with; regressions fail the run")
+    parser.add_argument("--save-baseline", type=Path,
+                        help="native: save this run's JSON report to this file")
+    parser.add_argument("--tolerance", type=float, default=0.25,
+                        help="native: allowed slowdown against the baseline (default 0.25)")
+    args = parser.parse_args()
+    
+    if args.native:
+        sys.exit(run_native_benchmark_suite(args.quick, args.baseline, args.save_baseline, args.tolerance))
     run_full_benchmark_suite()
     print("\n  Running pytest...")
     pytest.main([__file__, "-v", "-s"])
@@ -0,0 +1,56 @@
+"""
+Unit tests for the build cache.
+
+This module tests BuildCache and content_hash from pcc.utils.cache.
+"""
+
+import pytest
+from pcc.utils.cache import BuildCache, compiler_fingerprint, content_hash, default_cache_dir
+
+
+class TestContentHash:
+    """Tests for content_hash()."""
+
+    def test_parts_are_delimited(self):
+        """Test that moving bytes between parts changes the hash."""
+        assert content_hash("ab", "c") != content_hash("a", "bc")
+        assert content_hash("ab", "c") == content_hash(b"ab", b"c")
+
+    def test_fingerprint_is_stable(self):
+        """Test that the compiler fingerprint is a hex digest computed once."""
+        assert len(compiler_fingerprint()) == 64
+        assert compiler_fingerprint() == compiler_fingerprint()
+
+
+class TestBuildCache:
+    """Tests for BuildCache."""
+
+    def test_text_round_trip(self, tmp_path):
+        """Test that text is stored under its kind and key."""
+        cache = BuildCache(tmp_path)
+        key = content_hash("print(1)")
+        assert cache.read_text("c", key, ".c") is None
+        path = cache.write_text("c", key, ".c", "int main(void) { return 0; }")
+        assert path == tmp_path / "c" / key[:2] / f"{key}.c"
+        assert cache.read_text("c", key, ".c") == "int main(void) { return 0; }"
+
+    def test_put_file_replaces_entry(self, tmp_path):
+        """Test that storing a file again replaces the entry and leaves no temporaries."""
+        cache = BuildCache(tmp_path / "cache")
+        src = tmp_path / "prog"
+        src.write_bytes(b"one")
+        cache.put_file("exe", "ab" * 32, "", src)
+        src.write_bytes(b"two")
+        entry = cache.put_file("exe", "ab" * 32, "", src)
+        assert entry.read_bytes() == b"two"
+        assert [p.name for p in entry.parent.iterdir()] == [entry.name]
+
+    def test_cache_dir_override(self, tmp_path, monkeypatch):
+        """Test that PCC_CACHE_DIR selects the default directory."""
+        monkeypatch.setenv("PCC_CACHE_DIR", str(tmp_path))
+        assert default_cache_dir() == tmp_path
+        assert BuildCache().root == tmp_path
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
@@ -0,0 +1,33 @@
+"""
+Unit tests for toolchain detection.
+
+This module tests ToolchainDetector from pcc.utils.toolchain.
+"""
+
+import shutil
+
+import pytest
+from pcc.utils.toolchain import OPT_MODES, Toolchain, ToolchainDetector
+
+
+class TestSupportedOptModes:
+    """Tests for ToolchainDetector.supported_opt_modes()."""
+
+    def test_missing_toolchain_supports_nothing(self):
+        """Test that a toolchain that is not installed reports no modes."""
+        detector = ToolchainDetector()
+        for toolchain in Toolchain:
+            if not detector.is_available(toolchain):
+                assert detector.supported_opt_modes(toolchain) == frozenset()
+
+    @pytest.mark.skipif(shutil.which("gcc") is None, reason="gcc not available")
+    def test_gcc_is_probed(self):
+        """Test that GCC reports a subset of the modes, the same one each time."""
+        detector = ToolchainDetector()
+        modes = detector.supported_opt_modes(Toolchain.GCC)
+        assert modes <= set(OPT_MODES)
+        assert detector.supported_opt_modes(Toolchain.GCC) == modes
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])